@@ -0,0 +1,80 @@
+#include "FuzzTarget.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces global allocation functions to track live and peak heap usage.
+// Every block is prefixed with its size, kept at max alignment.
+namespace
+{
+constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+std::atomic<size_t> g_liveBytes{ 0 };
+std::atomic<size_t> g_peakBytes{ 0 };
+
+void* Allocate(size_t size)
+{
+	void* block = std::malloc(size + HEADER_SIZE);
+	if (!block)
+	{
+		throw std::bad_alloc();
+	}
+	*static_cast<size_t*>(block) = size;
+	const size_t live = g_liveBytes.fetch_add(size) + size;
+	size_t peak = g_peakBytes.load();
+	while (live > peak && !g_peakBytes.compare_exchange_weak(peak, live))
+	{
+	}
+	return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void Deallocate(void* ptr)
+{
+	if (ptr)
+	{
+		void* block = static_cast<char*>(ptr) - HEADER_SIZE;
+		g_liveBytes.fetch_sub(*static_cast<size_t*>(block));
+		std::free(block);
+	}
+}
+}
+
+void ResetPeakAllocation()
+{
+	g_peakBytes = g_liveBytes.load();
+}
+
+size_t GetPeakAllocation()
+{
+	return g_peakBytes.load();
+}
+
+void* operator new(size_t size)
+{
+	return Allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+	return Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	Deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	Deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	Deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	Deallocate(ptr);
+}
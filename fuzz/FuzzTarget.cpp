@@ -0,0 +1,544 @@
+#include "FuzzTarget.h"
+#include "../src/Parser.h"
+#include "../src/Batch.h"
+#include "../src/LoopOptimizer.h"
+#include "../src/OnStackReplacement.h"
+#include "../src/Peephole.h"
+#include "../src/RangeAnalysis.h"
+#include "../src/Reassociation.h"
+#include "../src/Streaming.h"
+#include "../src/Tiering.h"
+#include "../src/VirtualMachine.h"
+#include "../src/CompileTime.h"
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace
+{
+using Scope = std::map<std::string, double>;
+// Variables of a run, empty when the engine threw
+using Outcome = std::optional<Scope>;
+
+// Records fed to the streaming and batch readers
+constexpr size_t MAX_RECORDS = 8;
+constexpr size_t MAX_INPUTS = 3;
+// Output records have to fit the buffer of RecordWriter
+constexpr size_t MAX_OUTPUTS = 64;
+// Longest to_chars output of a double
+constexpr size_t MAX_FIELD = 32;
+
+void RunFrontendAndEngines(const std::string& text)
+{
+	try
+	{
+		Lexer lexer(text);
+		while (lexer.Advance().type != TokenType::EndOfFile)
+		{
+		}
+	}
+	catch (const std::exception&)
+	{
+		return;
+	}
+
+	try
+	{
+		Parser parser(std::make_unique<Lexer>(text));
+		auto program = parser.ParseAsProgram();
+		Reassociation().Run(*program);
+		LoopOptimizer().Run(*program);
+		RangeAnalysis().Run(*program);
+		ExpressionCalculator calculator;
+		calculator.Calculate(*program);
+	}
+	catch (const std::exception&)
+	{
+	}
+
+	try
+	{
+		lsbasi::compile(text).Evaluate();
+	}
+	catch (const std::exception&)
+	{
+	}
+}
+
+// Parsed and optimized as main does without --fast-math
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto program = parser.ParseAsProgram();
+	LoopOptimizer().Run(*program);
+	RangeAnalysis().Run(*program);
+	return program;
+}
+
+std::string Format(double value)
+{
+	char text[MAX_FIELD];
+	return std::string(text, std::to_chars(text, text + MAX_FIELD, value).ptr);
+}
+
+// Values have to be the same bits, NaN ones included
+bool IsSame(double expected, double actual)
+{
+	return std::memcmp(&expected, &actual, sizeof(double)) == 0;
+}
+
+// Why 'actual' differs from the run of the tree walker, empty if it does not
+std::string Compare(const std::string& engine, const Outcome& expected, const Outcome& actual)
+{
+	if (expected.has_value() != actual.has_value())
+	{
+		return engine + (actual ? " ran a program the tree walker fails" : " fails a program the tree walker runs");
+	}
+	if (!expected)
+	{
+		return {};
+	}
+	for (const auto& [name, value] : *expected)
+	{
+		auto other = actual->find(name);
+		if (other == actual->end())
+		{
+			return engine + " does not assign " + name;
+		}
+		if (!IsSame(value, other->second))
+		{
+			return engine + " gives " + name + " = " + Format(other->second) + " instead of " + Format(value);
+		}
+	}
+	if (actual->size() != expected->size())
+	{
+		return engine + " assigns variables the tree walker does not";
+	}
+	return {};
+}
+
+template <typename Run>
+Outcome Try(Run run)
+{
+	try
+	{
+		return run();
+	}
+	catch (const std::exception&)
+	{
+		return std::nullopt;
+	}
+}
+
+Outcome RunTreeWalker(const ProgramNode& program, const RandomStream& random, const Scope& inputs = {})
+{
+	return Try([&] {
+		ExpressionCalculator calculator;
+		for (const auto& [name, value] : inputs)
+		{
+			calculator.SetVariable(name, value);
+		}
+		calculator.SetRandomStream(random);
+		calculator.Calculate(program);
+		return calculator.GetScope();
+	});
+}
+
+// Fields of the text records, shortest round-trip spelling of their values
+struct Records
+{
+	std::vector<std::string> inputs;
+	std::vector<std::vector<double>> values;
+	std::vector<std::vector<std::string>> fields;
+	// Appended to the records: no reader may accept it
+	std::string malformed;
+};
+
+// Records drawn from the seed, with the first declared variables as inputs:
+// BatchEvaluator reads no others from the file
+Records GenerateRecords(const ProgramNode& program, uint64_t seed)
+{
+	std::mt19937_64 random(seed);
+	auto below = [&random](size_t bound) {
+		return std::uniform_int_distribution<size_t>(0, bound - 1)(random);
+	};
+	const double SPECIAL[] = { 0.0, -0.0, 0.5, -1e-300, 1e300, 4503599627370497.0 };
+
+	Records records;
+	for (const auto& declaration : program.GetBlock().GetDeclarations())
+	{
+		for (const auto& var : declaration->GetVariables())
+		{
+			if (records.inputs.size() < MAX_INPUTS)
+			{
+				records.inputs.push_back(var->GetName());
+			}
+		}
+	}
+	const size_t count = 1 + below(MAX_RECORDS);
+	for (size_t record = 0; record < count; ++record)
+	{
+		std::vector<double> values;
+		std::vector<std::string> fields;
+		for (size_t i = 0; i < records.inputs.size(); ++i)
+		{
+			const size_t kind = below(4);
+			const double value = kind == 0 ? SPECIAL[below(std::size(SPECIAL))]
+				: kind == 1 ? static_cast<double>(below(2001)) - 1000
+				: std::ldexp(static_cast<double>(below(1 << 20)), static_cast<int>(below(40)) - 30);
+			values.push_back(value);
+			fields.push_back(Format(value));
+		}
+		records.values.push_back(std::move(values));
+		records.fields.push_back(std::move(fields));
+	}
+	if (!records.inputs.empty() && below(4) == 0)
+	{
+		records.malformed = below(2) ? "x1" : std::string(records.inputs.size() + 1, ',');
+	}
+	return records;
+}
+
+std::vector<std::string> Split(const std::string& text, char delimiter)
+{
+	std::vector<std::string> parts;
+	std::istringstream in(text);
+	std::string part;
+	while (std::getline(in, part, delimiter))
+	{
+		parts.push_back(part);
+	}
+	return parts;
+}
+
+// Why the fields of an output line differ from the run of the tree walker,
+// empty if they do not. Unassigned outputs are NaN, or empty when 'empty'
+std::string CompareFields(const std::string& engine, const std::vector<std::string>& outputs,
+	const Scope& expected, const std::string& line, bool empty)
+{
+	std::vector<std::string> fields = Split(line, ',');
+	// getline drops a last empty field
+	fields.resize(std::max(fields.size(), outputs.size()));
+	if (fields.size() != outputs.size())
+	{
+		return engine + " writes " + std::to_string(fields.size()) + " fields";
+	}
+	for (size_t i = 0; i < outputs.size(); ++i)
+	{
+		auto value = expected.find(outputs[i]);
+		if (value == expected.end())
+		{
+			if (empty ? !fields[i].empty() : fields[i] != "nan")
+			{
+				return engine + " writes '" + fields[i] + "' for the unassigned " + outputs[i];
+			}
+			continue;
+		}
+		double actual = 0;
+		const char* end = fields[i].data() + fields[i].size();
+		if (std::from_chars(fields[i].data(), end, actual).ptr != end || !IsSame(value->second, actual))
+		{
+			return engine + " writes " + outputs[i] + " = '" + fields[i] + "' instead of " + Format(value->second);
+		}
+	}
+	return {};
+}
+
+std::string ReadAll(std::FILE* file)
+{
+	std::string text;
+	std::rewind(file);
+	char buffer[4096];
+	for (size_t count; (count = std::fread(buffer, 1, sizeof(buffer), file)) != 0;)
+	{
+		text.append(buffer, count);
+	}
+	return text;
+}
+
+// Feeds the records to StreamingEvaluator as text and compares its output
+// lines with the tree walker
+std::string CompareStreaming(const ProgramNode& program, const Records& records,
+	const std::vector<std::string>& outputs, const std::vector<Scope>& expected)
+{
+	std::string text;
+	for (const auto& fields : records.fields)
+	{
+		// Blanks around fields are skipped
+		text += " " + boost::algorithm::join(fields, " , ") + "\n";
+	}
+	text += records.malformed.empty() ? "" : records.malformed + "\n";
+
+	std::unique_ptr<std::FILE, int (*)(std::FILE*)> out(std::tmpfile(), std::fclose);
+	if (!out)
+	{
+		return {};
+	}
+	try
+	{
+		StreamingEvaluator evaluator(program, records.inputs, outputs, StreamingEvaluator::Options());
+		RecordWriter writer(out.get());
+		const size_t consumed = evaluator.Consume(text.data(), text.size(), writer);
+		writer.Flush();
+		if (!records.malformed.empty())
+		{
+			return "streaming accepts the record '" + records.malformed + "'";
+		}
+		if (consumed != text.size())
+		{
+			return "streaming leaves " + std::to_string(text.size() - consumed) + " bytes of complete records";
+		}
+	}
+	catch (const std::invalid_argument& ex)
+	{
+		return records.malformed.empty() ? std::string("streaming rejects valid records: ") + ex.what() : std::string();
+	}
+	catch (const std::exception& ex)
+	{
+		return std::string("streaming fails: ") + ex.what();
+	}
+
+	const std::vector<std::string> lines = Split(ReadAll(out.get()), '\n');
+	if (lines.size() != expected.size())
+	{
+		return "streaming writes " + std::to_string(lines.size()) + " records of " + std::to_string(expected.size());
+	}
+	for (size_t i = 0; i < lines.size(); ++i)
+	{
+		const std::string reason = CompareFields("streaming", outputs, expected[i], lines[i], false);
+		if (!reason.empty())
+		{
+			return reason + " in record " + std::to_string(i + 1);
+		}
+	}
+	return {};
+}
+
+// Writes the records as a CSV file, quoting some fields and ending some lines
+// with CRLF, runs BatchEvaluator on it and compares its rows with the tree walker
+std::string CompareBatch(const ProgramNode& program, const Records& records,
+	const std::vector<std::string>& outputs, const std::vector<Scope>& expected, uint64_t seed)
+{
+	std::mt19937_64 random(seed);
+	std::string text = boost::algorithm::join(records.inputs, ",") + "\n";
+	for (size_t record = 0; record < records.fields.size(); ++record)
+	{
+		for (size_t i = 0; i < records.fields[record].size(); ++i)
+		{
+			text += i ? "," : "";
+			text += random() % 4 ? records.fields[record][i] : "\"" + records.fields[record][i] + "\"";
+		}
+		// The last line may end without a newline
+		text += random() % 4 == 0 ? "\r\n" : record + 1 < records.fields.size() || random() % 2 ? "\n" : "";
+	}
+	if (!records.malformed.empty())
+	{
+		text += (text.back() == '\n' ? "" : "\n") + records.malformed + "\n";
+	}
+
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "lsbasi-fuzz-records.csv";
+	std::ofstream(path, std::ios::binary) << text;
+	std::unique_ptr<std::FILE, int (*)(std::FILE*)> out(std::tmpfile(), std::fclose);
+	if (!out)
+	{
+		return {};
+	}
+	try
+	{
+		BatchEvaluator::Options options;
+		options.threads = 2;
+		BatchEvaluator(program, options).Run(path.string(), outputs, out.get());
+		if (!records.malformed.empty())
+		{
+			return "batch accepts the row '" + records.malformed + "'";
+		}
+	}
+	catch (const std::invalid_argument& ex)
+	{
+		return records.malformed.empty() ? std::string("batch rejects valid rows: ") + ex.what() : std::string();
+	}
+	catch (const std::exception& ex)
+	{
+		return std::string("batch fails: ") + ex.what();
+	}
+
+	std::vector<std::string> lines = Split(ReadAll(out.get()), '\n');
+	if (lines.size() != expected.size() + 1)
+	{
+		return "batch writes " + std::to_string(lines.size()) + " lines for " + std::to_string(expected.size()) + " rows";
+	}
+	for (size_t i = 0; i < expected.size(); ++i)
+	{
+		const std::string reason = CompareFields("batch", outputs, expected[i], lines[i + 1], true);
+		if (!reason.empty())
+		{
+			return reason + " in row " + std::to_string(i + 1);
+		}
+	}
+	return {};
+}
+
+// Runs an accepted program in the bytecode, OSR and tiered engines and its
+// records through the streaming and batch readers, and returns why any of
+// them differs from the tree walker, empty if none does
+std::string CompareEngines(const std::string& text)
+{
+	std::unique_ptr<ProgramNode> program;
+	try
+	{
+		program = Parse(text);
+	}
+	catch (const std::exception&)
+	{
+		return {};
+	}
+	const Outcome expected = RunTreeWalker(*program, RandomStream(0, 0));
+
+	std::string reason = Compare("OSR", expected, Try([&] {
+		auto tree = Parse(text);
+		OsrCalculator calculator(1);
+		calculator.Calculate(*tree);
+		return calculator.GetScope();
+	}));
+	if (!reason.empty())
+	{
+		return reason;
+	}
+
+	// Promoted after its first run, which the tree walker does
+	TieredExecutor::Thresholds thresholds;
+	thresholds.runs = 1;
+	TieredExecutor executor(thresholds);
+	const size_t tiered = executor.Load(Parse(text));
+	reason = Compare("tiering", expected, Try([&] { return executor.Run(tiered); }));
+	if (!reason.empty() || !expected)
+	{
+		return reason;
+	}
+	executor.Wait();
+	if (executor.GetTier(tiered) == TieredExecutor::Bytecode)
+	{
+		// Run n draws stream n
+		reason = Compare("tiered bytecode", RunTreeWalker(*program, RandomStream(0, 1)),
+			Try([&] { return executor.Run(tiered); }));
+		if (!reason.empty())
+		{
+			return reason;
+		}
+	}
+
+	BytecodeProgram code;
+	try
+	{
+		code = BytecodeCompiler().Compile(*program);
+	}
+	catch (const std::exception&)
+	{
+		// DECIMAL or BIGINT variables, the bytecode engines take none
+		return {};
+	}
+	PeepholeOptimizer().Optimize(code);
+	code.Assemble();
+	reason = Compare("bytecode", expected, Try([&] {
+		VirtualMachine machine(code);
+		machine.Run();
+		return machine.GetScope();
+	}));
+	if (!reason.empty())
+	{
+		return reason;
+	}
+
+	std::vector<std::string> variables;
+	for (const std::string& name : code.variables)
+	{
+		if (!name.empty() && variables.size() < MAX_OUTPUTS)
+		{
+			variables.push_back(name);
+		}
+	}
+	const uint64_t seed = std::hash<std::string>()(text);
+	const Records records = GenerateRecords(*program, seed);
+	if (records.inputs.empty() || variables.empty())
+	{
+		// Text records need a field, and no outputs are all for BatchEvaluator
+		return {};
+	}
+	std::vector<Scope> rows;
+	for (size_t record = 0; record < records.values.size(); ++record)
+	{
+		Scope inputs;
+		for (size_t i = 0; i < records.inputs.size(); ++i)
+		{
+			inputs[records.inputs[i]] = records.values[record][i];
+		}
+		// Record n draws stream n, rows of a record with a failing run are not compared
+		const Outcome row = RunTreeWalker(*program, RandomStream(0, record), inputs);
+		if (!row)
+		{
+			return {};
+		}
+		rows.push_back(*row);
+	}
+	reason = CompareStreaming(*program, records, variables, rows);
+	return reason.empty() ? CompareBatch(*program, records, variables, rows, seed) : reason;
+}
+}
+
+FuzzVerdict RunFuzzInput(const std::string& input, const FuzzLimits& limits)
+{
+	FuzzVerdict verdict;
+	ResetPeakAllocation();
+	const size_t live = GetPeakAllocation();
+
+	const auto start = std::chrono::steady_clock::now();
+	RunFrontendAndEngines(input);
+	const std::string difference = CompareEngines(input);
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+
+	verdict.milliseconds = std::chrono::duration<double, std::milli>(elapsed).count();
+	verdict.peakAllocatedBytes = GetPeakAllocation() - live;
+
+	const double bytes = static_cast<double>(std::max<size_t>(input.size(), 1));
+	if (!difference.empty())
+	{
+		verdict.divergent = true;
+		verdict.reason = difference;
+	}
+	else if (verdict.milliseconds >= limits.minReportedMilliseconds
+		&& verdict.milliseconds * 1e6 / bytes > limits.maxNanosecondsPerByte)
+	{
+		verdict.pathological = true;
+		verdict.reason = "time per input byte exceeds the limit";
+	}
+	else if (verdict.peakAllocatedBytes >= limits.minReportedAllocatedBytes
+		&& static_cast<double>(verdict.peakAllocatedBytes) / bytes > limits.maxAllocatedBytesPerByte)
+	{
+		verdict.pathological = true;
+		verdict.reason = "memory per input byte exceeds the limit";
+	}
+	return verdict;
+}
+
+// libFuzzer entry point: a pathological or divergent input is reported as a
+// crash, so the engine saves it and can shrink it with -minimize_crash=1
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+	const std::string input(reinterpret_cast<const char*>(data), size);
+	const FuzzVerdict verdict = RunFuzzInput(input);
+	if (verdict.pathological || verdict.divergent)
+	{
+		std::fprintf(stderr, "%s: %zu bytes, %.1f ms, %zu bytes allocated\n",
+			verdict.reason.c_str(), size, verdict.milliseconds, verdict.peakAllocatedBytes);
+		std::abort();
+	}
+	return 0;
+}
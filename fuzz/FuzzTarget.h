@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+// Inputs are flagged when both the absolute cost is noticeable and the cost
+// per input byte is above the limit, so small inputs with fixed overhead pass
+struct FuzzLimits
+{
+	double maxNanosecondsPerByte = 20000;
+	double minReportedMilliseconds = 20;
+	double maxAllocatedBytesPerByte = 4096;
+	size_t minReportedAllocatedBytes = 16 << 20;
+};
+
+struct FuzzVerdict
+{
+	double milliseconds = 0;
+	size_t peakAllocatedBytes = 0;
+	bool pathological = false;
+	// An engine or record reader disagrees with the tree walker
+	bool divergent = false;
+	std::string reason;
+};
+
+// Runs the input through Lexer, Parser, ExpressionCalculator and the
+// compile-time engine evaluated at runtime. Accepted programs also run in the
+// bytecode, OSR and tiered engines, and records generated for them through
+// the streaming and CSV batch readers, which all have to give the results of
+// the tree walker
+FuzzVerdict RunFuzzInput(const std::string& input, const FuzzLimits& limits = {});
+
+// Allocation accounting provided by AllocationCounter.cpp
+void ResetPeakAllocation();
+size_t GetPeakAllocation();
@@ -0,0 +1,411 @@
+#include "FuzzTarget.h"
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <vector>
+#ifdef __unix__
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+// Driver for builds without libFuzzer.
+//
+// Usage:
+//  lsbasi_fuzz <file|dir>...    replays inputs, fails if any is pathological
+//      or makes the engines disagree
+//  lsbasi_fuzz --runs=N [--seed=S] [--corpus=dir] [--regressions=dir]
+//      generates and mutates programs, minimizes pathological and divergent
+//      ones and stores them into the regression directory
+namespace fs = std::filesystem;
+
+namespace
+{
+const char* const FRAGMENTS[] = {
+	"PROGRAM", "VAR", "BEGIN", "END", "DIV", "FOR", "TO", "DOWNTO", "DO", "RANDOM", "INTEGER", "REAL", "DECIMAL", "DECIMAL(18, 6)", "BIGINT", ";", ":", ":=",
+	",", ".", "(", ")", "+", "-", "*", "/", "{", "}", " ", "\n", "a", "b", "x1", "0", "42", "3.14"
+};
+
+#ifdef __unix__
+// Stack overflows from deep recursion kill the process, so the input
+// under test is written out from the signal handler before dying
+std::string g_crashPath;
+const std::string* g_currentInput = nullptr;
+
+void OnCrash(int signal)
+{
+	const char message[] = "crash while running input, saved to ";
+	(void)!write(STDERR_FILENO, message, sizeof(message) - 1);
+	(void)!write(STDERR_FILENO, g_crashPath.c_str(), g_crashPath.size());
+	(void)!write(STDERR_FILENO, "\n", 1);
+	if (g_currentInput)
+	{
+		const int fd = open(g_crashPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd >= 0)
+		{
+			(void)!write(fd, g_currentInput->data(), g_currentInput->size());
+			close(fd);
+		}
+	}
+	std::signal(signal, SIG_DFL);
+	std::raise(signal);
+}
+
+void InstallCrashHandler(const fs::path& regressions)
+{
+	fs::create_directories(regressions);
+	g_crashPath = (regressions / "crash.pas").string();
+
+	static std::vector<char> alternateStack(1 << 16);
+	stack_t stack = {};
+	stack.ss_sp = alternateStack.data();
+	stack.ss_size = alternateStack.size();
+	sigaltstack(&stack, nullptr);
+
+	struct sigaction action = {};
+	action.sa_handler = OnCrash;
+	action.sa_flags = SA_ONSTACK;
+	sigaction(SIGSEGV, &action, nullptr);
+	sigaction(SIGBUS, &action, nullptr);
+}
+
+void SetCurrentInput(const std::string* input)
+{
+	g_currentInput = input;
+}
+#else
+void InstallCrashHandler(const fs::path&)
+{
+}
+
+void SetCurrentInput(const std::string*)
+{
+}
+#endif
+
+std::string ReadFile(const fs::path& path)
+{
+	std::ifstream input(path, std::ios::binary);
+	std::ostringstream text;
+	text << input.rdbuf();
+	return text.str();
+}
+
+class ProgramGenerator
+{
+public:
+	explicit ProgramGenerator(std::mt19937_64& random)
+		: m_random(random)
+	{
+	}
+
+	std::string Generate()
+	{
+		// Programs of very different sizes, so that cost growth becomes visible
+		m_scale = size_t(1) << Below(12);
+		m_varCount = 1 + Below(8 * m_scale);
+
+		std::string text = "PROGRAM p;\nVAR\n";
+		const char* const TYPES[] = { " : INTEGER;\n", " : REAL;\n", " : DECIMAL(18, 6);\n", " : BIGINT;\n" };
+		for (size_t i = 0; i < m_varCount; ++i)
+		{
+			text += "   v" + std::to_string(i) + TYPES[Below(4)];
+		}
+		// Variables are assigned before use, otherwise most runs stop early
+		text += "BEGIN\n";
+		for (size_t i = 0; i < m_varCount; ++i)
+		{
+			text += "v" + std::to_string(i) + " := " + std::to_string(i) + ";\n";
+		}
+		text += GenerateCompound(0);
+		return text + "\nEND.\n";
+	}
+
+private:
+	std::string GenerateCompound(size_t depth)
+	{
+		std::string text = "BEGIN\n";
+		const size_t count = 1 + Below(depth == 0 ? 16 * m_scale : 4);
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (i != 0)
+			{
+				text += ";\n";
+			}
+			if (depth < 4 && Below(6) == 0)
+			{
+				text += GenerateCompound(depth + 1);
+			}
+			else if (depth < 4 && Below(6) == 0)
+			{
+				// Short loops, so that OSR replaces them without the runs growing
+				text += "FOR " + Variable() + " := " + std::to_string(Below(5)) + (Below(2) ? " TO " : " DOWNTO ")
+					+ std::to_string(Below(5)) + " DO " + (Below(2) ? GenerateCompound(depth + 1)
+					: Variable() + " := " + GenerateExpression(0));
+			}
+			else
+			{
+				text += Variable() + " := " + GenerateExpression(0);
+			}
+		}
+		return text + "\nEND";
+	}
+
+	std::string GenerateExpression(size_t depth)
+	{
+		switch (depth > 6 ? Below(3) : Below(8))
+		{
+		case 0:
+			return std::to_string(Below(1000));
+		case 1:
+			return std::to_string(Below(100)) + "." + std::to_string(Below(100));
+		case 2:
+			return Variable();
+		case 3:
+			return "(" + GenerateExpression(depth + 1) + ")";
+		case 4:
+			return (Below(2) ? "-" : "+") + GenerateExpression(depth + 1);
+		case 5:
+			return Below(2) ? "RANDOM" : "RANDOMNORMAL";
+		default:
+		{
+			const char* const OPERATORS[] = { " + ", " - ", " * ", " / ", " DIV " };
+			return GenerateExpression(depth + 1) + OPERATORS[Below(5)] + GenerateExpression(depth + 1);
+		}
+		}
+	}
+
+	std::string Variable()
+	{
+		return "v" + std::to_string(Below(m_varCount));
+	}
+
+	size_t Below(size_t bound)
+	{
+		return std::uniform_int_distribution<size_t>(0, bound - 1)(m_random);
+	}
+
+	std::mt19937_64& m_random;
+	size_t m_scale = 1;
+	size_t m_varCount = 1;
+};
+
+std::string Mutate(std::string input, std::mt19937_64& random)
+{
+	const size_t MAX_INPUT_SIZE = 1 << 20;
+	auto below = [&random](size_t bound) {
+		return std::uniform_int_distribution<size_t>(0, bound - 1)(random);
+	};
+
+	const size_t mutations = 1 + below(4);
+	for (size_t i = 0; i < mutations; ++i)
+	{
+		const size_t pos = below(input.size() + 1);
+		switch (below(4))
+		{
+		case 0:
+			if (pos < input.size())
+			{
+				input[pos] = static_cast<char>(below(128));
+			}
+			break;
+		case 1:
+			input.erase(pos, below(16));
+			break;
+		case 2:
+			input.insert(pos, FRAGMENTS[below(std::size(FRAGMENTS))]);
+			break;
+		default:
+		{
+			// Repeating a piece many times exposes superlinear behavior
+			const size_t length = std::min<size_t>(1 + below(32), input.size() - std::min(pos, input.size()));
+			const std::string piece = input.substr(pos, length);
+			const size_t repeats = size_t(1) << below(14);
+			std::string repeated;
+			for (size_t r = 0; r < repeats && repeated.size() + input.size() < MAX_INPUT_SIZE; ++r)
+			{
+				repeated += piece;
+			}
+			input.insert(pos, repeated);
+			break;
+		}
+		}
+	}
+	return input;
+}
+
+bool IsFinding(const FuzzVerdict& verdict)
+{
+	return verdict.pathological || verdict.divergent;
+}
+
+// Removes chunks of decreasing size while the input stays pathological, or
+// divergent when it is
+std::string Minimize(std::string input, bool divergent, const FuzzLimits& limits)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+	auto running = [&deadline] {
+		return std::chrono::steady_clock::now() < deadline;
+	};
+
+	for (size_t chunk = input.size() / 2; chunk > 0 && running(); chunk /= 2)
+	{
+		for (size_t pos = 0; pos + chunk <= input.size() && running();)
+		{
+			std::string candidate = input.substr(0, pos) + input.substr(pos + chunk);
+			const FuzzVerdict verdict = RunFuzzInput(candidate, limits);
+			if (divergent ? verdict.divergent : verdict.pathological)
+			{
+				input = std::move(candidate);
+			}
+			else
+			{
+				pos += chunk;
+			}
+		}
+	}
+	return input;
+}
+
+int Replay(const std::vector<fs::path>& paths, const FuzzLimits& limits)
+{
+	size_t count = 0;
+	size_t failures = 0;
+	auto replay = [&](const fs::path& path) {
+		const FuzzVerdict verdict = RunFuzzInput(ReadFile(path), limits);
+		++count;
+		if (IsFinding(verdict))
+		{
+			++failures;
+			std::cout << path.string() << ": " << verdict.reason << " ("
+				<< verdict.milliseconds << " ms, " << verdict.peakAllocatedBytes << " bytes)" << std::endl;
+		}
+	};
+
+	for (const auto& path : paths)
+	{
+		if (fs::is_directory(path))
+		{
+			for (const auto& entry : fs::recursive_directory_iterator(path))
+			{
+				if (entry.is_regular_file())
+				{
+					replay(entry.path());
+				}
+			}
+		}
+		else
+		{
+			replay(path);
+		}
+	}
+	std::cout << count << " inputs, " << failures << " pathological or divergent" << std::endl;
+	return failures == 0 ? 0 : 1;
+}
+
+int Fuzz(size_t runs, uint64_t seed, const fs::path& corpus, const fs::path& regressions, const FuzzLimits& limits)
+{
+	std::mt19937_64 random(seed);
+	ProgramGenerator generator(random);
+	InstallCrashHandler(regressions);
+
+	std::vector<std::string> seeds;
+	if (fs::is_directory(corpus))
+	{
+		for (const auto& entry : fs::directory_iterator(corpus))
+		{
+			seeds.push_back(ReadFile(entry.path()));
+		}
+	}
+
+	size_t found = 0;
+	for (size_t run = 0; run < runs; ++run)
+	{
+		std::string input = (seeds.empty() || random() % 2) ? generator.Generate() : seeds[random() % seeds.size()];
+		if (random() % 4 != 0)
+		{
+			input = Mutate(std::move(input), random);
+		}
+
+		SetCurrentInput(&input);
+		const FuzzVerdict verdict = RunFuzzInput(input, limits);
+		SetCurrentInput(nullptr);
+		if (!IsFinding(verdict))
+		{
+			continue;
+		}
+
+		const std::string minimized = Minimize(input, verdict.divergent, limits);
+		std::ostringstream name;
+		name << (verdict.divergent ? "divergent-" : "slow-") << std::hex << std::hash<std::string>()(minimized) << ".pas";
+		fs::create_directories(regressions);
+		std::ofstream(regressions / name.str(), std::ios::binary) << minimized;
+		std::cout << "run " << run << ": " << verdict.reason << ", " << input.size() << " -> "
+			<< minimized.size() << " bytes, saved " << (regressions / name.str()).string() << std::endl;
+		++found;
+	}
+	std::cout << runs << " runs, " << found << " pathological or divergent inputs" << std::endl;
+	return 0;
+}
+}
+
+int main(int argc, char* argv[])
+{
+	FuzzLimits limits;
+	size_t runs = 0;
+	uint64_t seed = std::random_device()();
+	fs::path corpus = "fuzz/corpus";
+	fs::path regressions = "fuzz/regressions";
+	std::vector<fs::path> inputs;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		auto option = [&arg](const char* name) -> std::optional<std::string> {
+			const std::string prefix = std::string(name) + "=";
+			if (arg.rfind(prefix, 0) == 0)
+			{
+				return arg.substr(prefix.size());
+			}
+			return std::nullopt;
+		};
+
+		if (auto value = option("--runs"))
+		{
+			runs = std::stoul(*value);
+		}
+		else if (auto value = option("--seed"))
+		{
+			seed = std::stoull(*value);
+		}
+		else if (auto value = option("--corpus"))
+		{
+			corpus = *value;
+		}
+		else if (auto value = option("--regressions"))
+		{
+			regressions = *value;
+		}
+		else if (auto value = option("--max-ns-per-byte"))
+		{
+			limits.maxNanosecondsPerByte = std::stod(*value);
+		}
+		else
+		{
+			inputs.emplace_back(arg);
+		}
+	}
+
+	if (runs != 0)
+	{
+		std::cout << "seed " << seed << std::endl;
+		return Fuzz(runs, seed, corpus, regressions, limits);
+	}
+	return Replay(inputs, limits);
+}
@@ -0,0 +1,4005 @@
+PROGRAM LongChain;
+BEGIN
+   a := 1;
+   b := a + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+      + a - 2 * a DIV 3 + 1 + a - 2 * a DIV 3 + 1
+     
+END.
@@ -0,0 +1,6003 @@
+PROGRAM ManyVariables;
+BEGIN
+   v0 := 0;
+   v1 := 1;
+   v2 := 2;
+   v3 := 3;
+   v4 := 4;
+   v5 := 5;
+   v6 := 6;
+   v7 := 7;
+   v8 := 8;
+   v9 := 9;
+   v10 := 0;
+   v11 := 1;
+   v12 := 2;
+   v13 := 3;
+   v14 := 4;
+   v15 := 5;
+   v16 := 6;
+   v17 := 7;
+   v18 := 8;
+   v19 := 9;
+   v20 := 0;
+   v21 := 1;
+   v22 := 2;
+   v23 := 3;
+   v24 := 4;
+   v25 := 5;
+   v26 := 6;
+   v27 := 7;
+   v28 := 8;
+   v29 := 9;
+   v30 := 0;
+   v31 := 1;
+   v32 := 2;
+   v33 := 3;
+   v34 := 4;
+   v35 := 5;
+   v36 := 6;
+   v37 := 7;
+   v38 := 8;
+   v39 := 9;
+   v40 := 0;
+   v41 := 1;
+   v42 := 2;
+   v43 := 3;
+   v44 := 4;
+   v45 := 5;
+   v46 := 6;
+   v47 := 7;
+   v48 := 8;
+   v49 := 9;
+   v50 := 0;
+   v51 := 1;
+   v52 := 2;
+   v53 := 3;
+   v54 := 4;
+   v55 := 5;
+   v56 := 6;
+   v57 := 7;
+   v58 := 8;
+   v59 := 9;
+   v60 := 0;
+   v61 := 1;
+   v62 := 2;
+   v63 := 3;
+   v64 := 4;
+   v65 := 5;
+   v66 := 6;
+   v67 := 7;
+   v68 := 8;
+   v69 := 9;
+   v70 := 0;
+   v71 := 1;
+   v72 := 2;
+   v73 := 3;
+   v74 := 4;
+   v75 := 5;
+   v76 := 6;
+   v77 := 7;
+   v78 := 8;
+   v79 := 9;
+   v80 := 0;
+   v81 := 1;
+   v82 := 2;
+   v83 := 3;
+   v84 := 4;
+   v85 := 5;
+   v86 := 6;
+   v87 := 7;
+   v88 := 8;
+   v89 := 9;
+   v90 := 0;
+   v91 := 1;
+   v92 := 2;
+   v93 := 3;
+   v94 := 4;
+   v95 := 5;
+   v96 := 6;
+   v97 := 7;
+   v98 := 8;
+   v99 := 9;
+   v100 := 0;
+   v101 := 1;
+   v102 := 2;
+   v103 := 3;
+   v104 := 4;
+   v105 := 5;
+   v106 := 6;
+   v107 := 7;
+   v108 := 8;
+   v109 := 9;
+   v110 := 0;
+   v111 := 1;
+   v112 := 2;
+   v113 := 3;
+   v114 := 4;
+   v115 := 5;
+   v116 := 6;
+   v117 := 7;
+   v118 := 8;
+   v119 := 9;
+   v120 := 0;
+   v121 := 1;
+   v122 := 2;
+   v123 := 3;
+   v124 := 4;
+   v125 := 5;
+   v126 := 6;
+   v127 := 7;
+   v128 := 8;
+   v129 := 9;
+   v130 := 0;
+   v131 := 1;
+   v132 := 2;
+   v133 := 3;
+   v134 := 4;
+   v135 := 5;
+   v136 := 6;
+   v137 := 7;
+   v138 := 8;
+   v139 := 9;
+   v140 := 0;
+   v141 := 1;
+   v142 := 2;
+   v143 := 3;
+   v144 := 4;
+   v145 := 5;
+   v146 := 6;
+   v147 := 7;
+   v148 := 8;
+   v149 := 9;
+   v150 := 0;
+   v151 := 1;
+   v152 := 2;
+   v153 := 3;
+   v154 := 4;
+   v155 := 5;
+   v156 := 6;
+   v157 := 7;
+   v158 := 8;
+   v159 := 9;
+   v160 := 0;
+   v161 := 1;
+   v162 := 2;
+   v163 := 3;
+   v164 := 4;
+   v165 := 5;
+   v166 := 6;
+   v167 := 7;
+   v168 := 8;
+   v169 := 9;
+   v170 := 0;
+   v171 := 1;
+   v172 := 2;
+   v173 := 3;
+   v174 := 4;
+   v175 := 5;
+   v176 := 6;
+   v177 := 7;
+   v178 := 8;
+   v179 := 9;
+   v180 := 0;
+   v181 := 1;
+   v182 := 2;
+   v183 := 3;
+   v184 := 4;
+   v185 := 5;
+   v186 := 6;
+   v187 := 7;
+   v188 := 8;
+   v189 := 9;
+   v190 := 0;
+   v191 := 1;
+   v192 := 2;
+   v193 := 3;
+   v194 := 4;
+   v195 := 5;
+   v196 := 6;
+   v197 := 7;
+   v198 := 8;
+   v199 := 9;
+   v200 := 0;
+   v201 := 1;
+   v202 := 2;
+   v203 := 3;
+   v204 := 4;
+   v205 := 5;
+   v206 := 6;
+   v207 := 7;
+   v208 := 8;
+   v209 := 9;
+   v210 := 0;
+   v211 := 1;
+   v212 := 2;
+   v213 := 3;
+   v214 := 4;
+   v215 := 5;
+   v216 := 6;
+   v217 := 7;
+   v218 := 8;
+   v219 := 9;
+   v220 := 0;
+   v221 := 1;
+   v222 := 2;
+   v223 := 3;
+   v224 := 4;
+   v225 := 5;
+   v226 := 6;
+   v227 := 7;
+   v228 := 8;
+   v229 := 9;
+   v230 := 0;
+   v231 := 1;
+   v232 := 2;
+   v233 := 3;
+   v234 := 4;
+   v235 := 5;
+   v236 := 6;
+   v237 := 7;
+   v238 := 8;
+   v239 := 9;
+   v240 := 0;
+   v241 := 1;
+   v242 := 2;
+   v243 := 3;
+   v244 := 4;
+   v245 := 5;
+   v246 := 6;
+   v247 := 7;
+   v248 := 8;
+   v249 := 9;
+   v250 := 0;
+   v251 := 1;
+   v252 := 2;
+   v253 := 3;
+   v254 := 4;
+   v255 := 5;
+   v256 := 6;
+   v257 := 7;
+   v258 := 8;
+   v259 := 9;
+   v260 := 0;
+   v261 := 1;
+   v262 := 2;
+   v263 := 3;
+   v264 := 4;
+   v265 := 5;
+   v266 := 6;
+   v267 := 7;
+   v268 := 8;
+   v269 := 9;
+   v270 := 0;
+   v271 := 1;
+   v272 := 2;
+   v273 := 3;
+   v274 := 4;
+   v275 := 5;
+   v276 := 6;
+   v277 := 7;
+   v278 := 8;
+   v279 := 9;
+   v280 := 0;
+   v281 := 1;
+   v282 := 2;
+   v283 := 3;
+   v284 := 4;
+   v285 := 5;
+   v286 := 6;
+   v287 := 7;
+   v288 := 8;
+   v289 := 9;
+   v290 := 0;
+   v291 := 1;
+   v292 := 2;
+   v293 := 3;
+   v294 := 4;
+   v295 := 5;
+   v296 := 6;
+   v297 := 7;
+   v298 := 8;
+   v299 := 9;
+   v300 := 0;
+   v301 := 1;
+   v302 := 2;
+   v303 := 3;
+   v304 := 4;
+   v305 := 5;
+   v306 := 6;
+   v307 := 7;
+   v308 := 8;
+   v309 := 9;
+   v310 := 0;
+   v311 := 1;
+   v312 := 2;
+   v313 := 3;
+   v314 := 4;
+   v315 := 5;
+   v316 := 6;
+   v317 := 7;
+   v318 := 8;
+   v319 := 9;
+   v320 := 0;
+   v321 := 1;
+   v322 := 2;
+   v323 := 3;
+   v324 := 4;
+   v325 := 5;
+   v326 := 6;
+   v327 := 7;
+   v328 := 8;
+   v329 := 9;
+   v330 := 0;
+   v331 := 1;
+   v332 := 2;
+   v333 := 3;
+   v334 := 4;
+   v335 := 5;
+   v336 := 6;
+   v337 := 7;
+   v338 := 8;
+   v339 := 9;
+   v340 := 0;
+   v341 := 1;
+   v342 := 2;
+   v343 := 3;
+   v344 := 4;
+   v345 := 5;
+   v346 := 6;
+   v347 := 7;
+   v348 := 8;
+   v349 := 9;
+   v350 := 0;
+   v351 := 1;
+   v352 := 2;
+   v353 := 3;
+   v354 := 4;
+   v355 := 5;
+   v356 := 6;
+   v357 := 7;
+   v358 := 8;
+   v359 := 9;
+   v360 := 0;
+   v361 := 1;
+   v362 := 2;
+   v363 := 3;
+   v364 := 4;
+   v365 := 5;
+   v366 := 6;
+   v367 := 7;
+   v368 := 8;
+   v369 := 9;
+   v370 := 0;
+   v371 := 1;
+   v372 := 2;
+   v373 := 3;
+   v374 := 4;
+   v375 := 5;
+   v376 := 6;
+   v377 := 7;
+   v378 := 8;
+   v379 := 9;
+   v380 := 0;
+   v381 := 1;
+   v382 := 2;
+   v383 := 3;
+   v384 := 4;
+   v385 := 5;
+   v386 := 6;
+   v387 := 7;
+   v388 := 8;
+   v389 := 9;
+   v390 := 0;
+   v391 := 1;
+   v392 := 2;
+   v393 := 3;
+   v394 := 4;
+   v395 := 5;
+   v396 := 6;
+   v397 := 7;
+   v398 := 8;
+   v399 := 9;
+   v400 := 0;
+   v401 := 1;
+   v402 := 2;
+   v403 := 3;
+   v404 := 4;
+   v405 := 5;
+   v406 := 6;
+   v407 := 7;
+   v408 := 8;
+   v409 := 9;
+   v410 := 0;
+   v411 := 1;
+   v412 := 2;
+   v413 := 3;
+   v414 := 4;
+   v415 := 5;
+   v416 := 6;
+   v417 := 7;
+   v418 := 8;
+   v419 := 9;
+   v420 := 0;
+   v421 := 1;
+   v422 := 2;
+   v423 := 3;
+   v424 := 4;
+   v425 := 5;
+   v426 := 6;
+   v427 := 7;
+   v428 := 8;
+   v429 := 9;
+   v430 := 0;
+   v431 := 1;
+   v432 := 2;
+   v433 := 3;
+   v434 := 4;
+   v435 := 5;
+   v436 := 6;
+   v437 := 7;
+   v438 := 8;
+   v439 := 9;
+   v440 := 0;
+   v441 := 1;
+   v442 := 2;
+   v443 := 3;
+   v444 := 4;
+   v445 := 5;
+   v446 := 6;
+   v447 := 7;
+   v448 := 8;
+   v449 := 9;
+   v450 := 0;
+   v451 := 1;
+   v452 := 2;
+   v453 := 3;
+   v454 := 4;
+   v455 := 5;
+   v456 := 6;
+   v457 := 7;
+   v458 := 8;
+   v459 := 9;
+   v460 := 0;
+   v461 := 1;
+   v462 := 2;
+   v463 := 3;
+   v464 := 4;
+   v465 := 5;
+   v466 := 6;
+   v467 := 7;
+   v468 := 8;
+   v469 := 9;
+   v470 := 0;
+   v471 := 1;
+   v472 := 2;
+   v473 := 3;
+   v474 := 4;
+   v475 := 5;
+   v476 := 6;
+   v477 := 7;
+   v478 := 8;
+   v479 := 9;
+   v480 := 0;
+   v481 := 1;
+   v482 := 2;
+   v483 := 3;
+   v484 := 4;
+   v485 := 5;
+   v486 := 6;
+   v487 := 7;
+   v488 := 8;
+   v489 := 9;
+   v490 := 0;
+   v491 := 1;
+   v492 := 2;
+   v493 := 3;
+   v494 := 4;
+   v495 := 5;
+   v496 := 6;
+   v497 := 7;
+   v498 := 8;
+   v499 := 9;
+   v500 := 0;
+   v501 := 1;
+   v502 := 2;
+   v503 := 3;
+   v504 := 4;
+   v505 := 5;
+   v506 := 6;
+   v507 := 7;
+   v508 := 8;
+   v509 := 9;
+   v510 := 0;
+   v511 := 1;
+   v512 := 2;
+   v513 := 3;
+   v514 := 4;
+   v515 := 5;
+   v516 := 6;
+   v517 := 7;
+   v518 := 8;
+   v519 := 9;
+   v520 := 0;
+   v521 := 1;
+   v522 := 2;
+   v523 := 3;
+   v524 := 4;
+   v525 := 5;
+   v526 := 6;
+   v527 := 7;
+   v528 := 8;
+   v529 := 9;
+   v530 := 0;
+   v531 := 1;
+   v532 := 2;
+   v533 := 3;
+   v534 := 4;
+   v535 := 5;
+   v536 := 6;
+   v537 := 7;
+   v538 := 8;
+   v539 := 9;
+   v540 := 0;
+   v541 := 1;
+   v542 := 2;
+   v543 := 3;
+   v544 := 4;
+   v545 := 5;
+   v546 := 6;
+   v547 := 7;
+   v548 := 8;
+   v549 := 9;
+   v550 := 0;
+   v551 := 1;
+   v552 := 2;
+   v553 := 3;
+   v554 := 4;
+   v555 := 5;
+   v556 := 6;
+   v557 := 7;
+   v558 := 8;
+   v559 := 9;
+   v560 := 0;
+   v561 := 1;
+   v562 := 2;
+   v563 := 3;
+   v564 := 4;
+   v565 := 5;
+   v566 := 6;
+   v567 := 7;
+   v568 := 8;
+   v569 := 9;
+   v570 := 0;
+   v571 := 1;
+   v572 := 2;
+   v573 := 3;
+   v574 := 4;
+   v575 := 5;
+   v576 := 6;
+   v577 := 7;
+   v578 := 8;
+   v579 := 9;
+   v580 := 0;
+   v581 := 1;
+   v582 := 2;
+   v583 := 3;
+   v584 := 4;
+   v585 := 5;
+   v586 := 6;
+   v587 := 7;
+   v588 := 8;
+   v589 := 9;
+   v590 := 0;
+   v591 := 1;
+   v592 := 2;
+   v593 := 3;
+   v594 := 4;
+   v595 := 5;
+   v596 := 6;
+   v597 := 7;
+   v598 := 8;
+   v599 := 9;
+   v600 := 0;
+   v601 := 1;
+   v602 := 2;
+   v603 := 3;
+   v604 := 4;
+   v605 := 5;
+   v606 := 6;
+   v607 := 7;
+   v608 := 8;
+   v609 := 9;
+   v610 := 0;
+   v611 := 1;
+   v612 := 2;
+   v613 := 3;
+   v614 := 4;
+   v615 := 5;
+   v616 := 6;
+   v617 := 7;
+   v618 := 8;
+   v619 := 9;
+   v620 := 0;
+   v621 := 1;
+   v622 := 2;
+   v623 := 3;
+   v624 := 4;
+   v625 := 5;
+   v626 := 6;
+   v627 := 7;
+   v628 := 8;
+   v629 := 9;
+   v630 := 0;
+   v631 := 1;
+   v632 := 2;
+   v633 := 3;
+   v634 := 4;
+   v635 := 5;
+   v636 := 6;
+   v637 := 7;
+   v638 := 8;
+   v639 := 9;
+   v640 := 0;
+   v641 := 1;
+   v642 := 2;
+   v643 := 3;
+   v644 := 4;
+   v645 := 5;
+   v646 := 6;
+   v647 := 7;
+   v648 := 8;
+   v649 := 9;
+   v650 := 0;
+   v651 := 1;
+   v652 := 2;
+   v653 := 3;
+   v654 := 4;
+   v655 := 5;
+   v656 := 6;
+   v657 := 7;
+   v658 := 8;
+   v659 := 9;
+   v660 := 0;
+   v661 := 1;
+   v662 := 2;
+   v663 := 3;
+   v664 := 4;
+   v665 := 5;
+   v666 := 6;
+   v667 := 7;
+   v668 := 8;
+   v669 := 9;
+   v670 := 0;
+   v671 := 1;
+   v672 := 2;
+   v673 := 3;
+   v674 := 4;
+   v675 := 5;
+   v676 := 6;
+   v677 := 7;
+   v678 := 8;
+   v679 := 9;
+   v680 := 0;
+   v681 := 1;
+   v682 := 2;
+   v683 := 3;
+   v684 := 4;
+   v685 := 5;
+   v686 := 6;
+   v687 := 7;
+   v688 := 8;
+   v689 := 9;
+   v690 := 0;
+   v691 := 1;
+   v692 := 2;
+   v693 := 3;
+   v694 := 4;
+   v695 := 5;
+   v696 := 6;
+   v697 := 7;
+   v698 := 8;
+   v699 := 9;
+   v700 := 0;
+   v701 := 1;
+   v702 := 2;
+   v703 := 3;
+   v704 := 4;
+   v705 := 5;
+   v706 := 6;
+   v707 := 7;
+   v708 := 8;
+   v709 := 9;
+   v710 := 0;
+   v711 := 1;
+   v712 := 2;
+   v713 := 3;
+   v714 := 4;
+   v715 := 5;
+   v716 := 6;
+   v717 := 7;
+   v718 := 8;
+   v719 := 9;
+   v720 := 0;
+   v721 := 1;
+   v722 := 2;
+   v723 := 3;
+   v724 := 4;
+   v725 := 5;
+   v726 := 6;
+   v727 := 7;
+   v728 := 8;
+   v729 := 9;
+   v730 := 0;
+   v731 := 1;
+   v732 := 2;
+   v733 := 3;
+   v734 := 4;
+   v735 := 5;
+   v736 := 6;
+   v737 := 7;
+   v738 := 8;
+   v739 := 9;
+   v740 := 0;
+   v741 := 1;
+   v742 := 2;
+   v743 := 3;
+   v744 := 4;
+   v745 := 5;
+   v746 := 6;
+   v747 := 7;
+   v748 := 8;
+   v749 := 9;
+   v750 := 0;
+   v751 := 1;
+   v752 := 2;
+   v753 := 3;
+   v754 := 4;
+   v755 := 5;
+   v756 := 6;
+   v757 := 7;
+   v758 := 8;
+   v759 := 9;
+   v760 := 0;
+   v761 := 1;
+   v762 := 2;
+   v763 := 3;
+   v764 := 4;
+   v765 := 5;
+   v766 := 6;
+   v767 := 7;
+   v768 := 8;
+   v769 := 9;
+   v770 := 0;
+   v771 := 1;
+   v772 := 2;
+   v773 := 3;
+   v774 := 4;
+   v775 := 5;
+   v776 := 6;
+   v777 := 7;
+   v778 := 8;
+   v779 := 9;
+   v780 := 0;
+   v781 := 1;
+   v782 := 2;
+   v783 := 3;
+   v784 := 4;
+   v785 := 5;
+   v786 := 6;
+   v787 := 7;
+   v788 := 8;
+   v789 := 9;
+   v790 := 0;
+   v791 := 1;
+   v792 := 2;
+   v793 := 3;
+   v794 := 4;
+   v795 := 5;
+   v796 := 6;
+   v797 := 7;
+   v798 := 8;
+   v799 := 9;
+   v800 := 0;
+   v801 := 1;
+   v802 := 2;
+   v803 := 3;
+   v804 := 4;
+   v805 := 5;
+   v806 := 6;
+   v807 := 7;
+   v808 := 8;
+   v809 := 9;
+   v810 := 0;
+   v811 := 1;
+   v812 := 2;
+   v813 := 3;
+   v814 := 4;
+   v815 := 5;
+   v816 := 6;
+   v817 := 7;
+   v818 := 8;
+   v819 := 9;
+   v820 := 0;
+   v821 := 1;
+   v822 := 2;
+   v823 := 3;
+   v824 := 4;
+   v825 := 5;
+   v826 := 6;
+   v827 := 7;
+   v828 := 8;
+   v829 := 9;
+   v830 := 0;
+   v831 := 1;
+   v832 := 2;
+   v833 := 3;
+   v834 := 4;
+   v835 := 5;
+   v836 := 6;
+   v837 := 7;
+   v838 := 8;
+   v839 := 9;
+   v840 := 0;
+   v841 := 1;
+   v842 := 2;
+   v843 := 3;
+   v844 := 4;
+   v845 := 5;
+   v846 := 6;
+   v847 := 7;
+   v848 := 8;
+   v849 := 9;
+   v850 := 0;
+   v851 := 1;
+   v852 := 2;
+   v853 := 3;
+   v854 := 4;
+   v855 := 5;
+   v856 := 6;
+   v857 := 7;
+   v858 := 8;
+   v859 := 9;
+   v860 := 0;
+   v861 := 1;
+   v862 := 2;
+   v863 := 3;
+   v864 := 4;
+   v865 := 5;
+   v866 := 6;
+   v867 := 7;
+   v868 := 8;
+   v869 := 9;
+   v870 := 0;
+   v871 := 1;
+   v872 := 2;
+   v873 := 3;
+   v874 := 4;
+   v875 := 5;
+   v876 := 6;
+   v877 := 7;
+   v878 := 8;
+   v879 := 9;
+   v880 := 0;
+   v881 := 1;
+   v882 := 2;
+   v883 := 3;
+   v884 := 4;
+   v885 := 5;
+   v886 := 6;
+   v887 := 7;
+   v888 := 8;
+   v889 := 9;
+   v890 := 0;
+   v891 := 1;
+   v892 := 2;
+   v893 := 3;
+   v894 := 4;
+   v895 := 5;
+   v896 := 6;
+   v897 := 7;
+   v898 := 8;
+   v899 := 9;
+   v900 := 0;
+   v901 := 1;
+   v902 := 2;
+   v903 := 3;
+   v904 := 4;
+   v905 := 5;
+   v906 := 6;
+   v907 := 7;
+   v908 := 8;
+   v909 := 9;
+   v910 := 0;
+   v911 := 1;
+   v912 := 2;
+   v913 := 3;
+   v914 := 4;
+   v915 := 5;
+   v916 := 6;
+   v917 := 7;
+   v918 := 8;
+   v919 := 9;
+   v920 := 0;
+   v921 := 1;
+   v922 := 2;
+   v923 := 3;
+   v924 := 4;
+   v925 := 5;
+   v926 := 6;
+   v927 := 7;
+   v928 := 8;
+   v929 := 9;
+   v930 := 0;
+   v931 := 1;
+   v932 := 2;
+   v933 := 3;
+   v934 := 4;
+   v935 := 5;
+   v936 := 6;
+   v937 := 7;
+   v938 := 8;
+   v939 := 9;
+   v940 := 0;
+   v941 := 1;
+   v942 := 2;
+   v943 := 3;
+   v944 := 4;
+   v945 := 5;
+   v946 := 6;
+   v947 := 7;
+   v948 := 8;
+   v949 := 9;
+   v950 := 0;
+   v951 := 1;
+   v952 := 2;
+   v953 := 3;
+   v954 := 4;
+   v955 := 5;
+   v956 := 6;
+   v957 := 7;
+   v958 := 8;
+   v959 := 9;
+   v960 := 0;
+   v961 := 1;
+   v962 := 2;
+   v963 := 3;
+   v964 := 4;
+   v965 := 5;
+   v966 := 6;
+   v967 := 7;
+   v968 := 8;
+   v969 := 9;
+   v970 := 0;
+   v971 := 1;
+   v972 := 2;
+   v973 := 3;
+   v974 := 4;
+   v975 := 5;
+   v976 := 6;
+   v977 := 7;
+   v978 := 8;
+   v979 := 9;
+   v980 := 0;
+   v981 := 1;
+   v982 := 2;
+   v983 := 3;
+   v984 := 4;
+   v985 := 5;
+   v986 := 6;
+   v987 := 7;
+   v988 := 8;
+   v989 := 9;
+   v990 := 0;
+   v991 := 1;
+   v992 := 2;
+   v993 := 3;
+   v994 := 4;
+   v995 := 5;
+   v996 := 6;
+   v997 := 7;
+   v998 := 8;
+   v999 := 9;
+   v1000 := 0;
+   v1001 := 1;
+   v1002 := 2;
+   v1003 := 3;
+   v1004 := 4;
+   v1005 := 5;
+   v1006 := 6;
+   v1007 := 7;
+   v1008 := 8;
+   v1009 := 9;
+   v1010 := 0;
+   v1011 := 1;
+   v1012 := 2;
+   v1013 := 3;
+   v1014 := 4;
+   v1015 := 5;
+   v1016 := 6;
+   v1017 := 7;
+   v1018 := 8;
+   v1019 := 9;
+   v1020 := 0;
+   v1021 := 1;
+   v1022 := 2;
+   v1023 := 3;
+   v1024 := 4;
+   v1025 := 5;
+   v1026 := 6;
+   v1027 := 7;
+   v1028 := 8;
+   v1029 := 9;
+   v1030 := 0;
+   v1031 := 1;
+   v1032 := 2;
+   v1033 := 3;
+   v1034 := 4;
+   v1035 := 5;
+   v1036 := 6;
+   v1037 := 7;
+   v1038 := 8;
+   v1039 := 9;
+   v1040 := 0;
+   v1041 := 1;
+   v1042 := 2;
+   v1043 := 3;
+   v1044 := 4;
+   v1045 := 5;
+   v1046 := 6;
+   v1047 := 7;
+   v1048 := 8;
+   v1049 := 9;
+   v1050 := 0;
+   v1051 := 1;
+   v1052 := 2;
+   v1053 := 3;
+   v1054 := 4;
+   v1055 := 5;
+   v1056 := 6;
+   v1057 := 7;
+   v1058 := 8;
+   v1059 := 9;
+   v1060 := 0;
+   v1061 := 1;
+   v1062 := 2;
+   v1063 := 3;
+   v1064 := 4;
+   v1065 := 5;
+   v1066 := 6;
+   v1067 := 7;
+   v1068 := 8;
+   v1069 := 9;
+   v1070 := 0;
+   v1071 := 1;
+   v1072 := 2;
+   v1073 := 3;
+   v1074 := 4;
+   v1075 := 5;
+   v1076 := 6;
+   v1077 := 7;
+   v1078 := 8;
+   v1079 := 9;
+   v1080 := 0;
+   v1081 := 1;
+   v1082 := 2;
+   v1083 := 3;
+   v1084 := 4;
+   v1085 := 5;
+   v1086 := 6;
+   v1087 := 7;
+   v1088 := 8;
+   v1089 := 9;
+   v1090 := 0;
+   v1091 := 1;
+   v1092 := 2;
+   v1093 := 3;
+   v1094 := 4;
+   v1095 := 5;
+   v1096 := 6;
+   v1097 := 7;
+   v1098 := 8;
+   v1099 := 9;
+   v1100 := 0;
+   v1101 := 1;
+   v1102 := 2;
+   v1103 := 3;
+   v1104 := 4;
+   v1105 := 5;
+   v1106 := 6;
+   v1107 := 7;
+   v1108 := 8;
+   v1109 := 9;
+   v1110 := 0;
+   v1111 := 1;
+   v1112 := 2;
+   v1113 := 3;
+   v1114 := 4;
+   v1115 := 5;
+   v1116 := 6;
+   v1117 := 7;
+   v1118 := 8;
+   v1119 := 9;
+   v1120 := 0;
+   v1121 := 1;
+   v1122 := 2;
+   v1123 := 3;
+   v1124 := 4;
+   v1125 := 5;
+   v1126 := 6;
+   v1127 := 7;
+   v1128 := 8;
+   v1129 := 9;
+   v1130 := 0;
+   v1131 := 1;
+   v1132 := 2;
+   v1133 := 3;
+   v1134 := 4;
+   v1135 := 5;
+   v1136 := 6;
+   v1137 := 7;
+   v1138 := 8;
+   v1139 := 9;
+   v1140 := 0;
+   v1141 := 1;
+   v1142 := 2;
+   v1143 := 3;
+   v1144 := 4;
+   v1145 := 5;
+   v1146 := 6;
+   v1147 := 7;
+   v1148 := 8;
+   v1149 := 9;
+   v1150 := 0;
+   v1151 := 1;
+   v1152 := 2;
+   v1153 := 3;
+   v1154 := 4;
+   v1155 := 5;
+   v1156 := 6;
+   v1157 := 7;
+   v1158 := 8;
+   v1159 := 9;
+   v1160 := 0;
+   v1161 := 1;
+   v1162 := 2;
+   v1163 := 3;
+   v1164 := 4;
+   v1165 := 5;
+   v1166 := 6;
+   v1167 := 7;
+   v1168 := 8;
+   v1169 := 9;
+   v1170 := 0;
+   v1171 := 1;
+   v1172 := 2;
+   v1173 := 3;
+   v1174 := 4;
+   v1175 := 5;
+   v1176 := 6;
+   v1177 := 7;
+   v1178 := 8;
+   v1179 := 9;
+   v1180 := 0;
+   v1181 := 1;
+   v1182 := 2;
+   v1183 := 3;
+   v1184 := 4;
+   v1185 := 5;
+   v1186 := 6;
+   v1187 := 7;
+   v1188 := 8;
+   v1189 := 9;
+   v1190 := 0;
+   v1191 := 1;
+   v1192 := 2;
+   v1193 := 3;
+   v1194 := 4;
+   v1195 := 5;
+   v1196 := 6;
+   v1197 := 7;
+   v1198 := 8;
+   v1199 := 9;
+   v1200 := 0;
+   v1201 := 1;
+   v1202 := 2;
+   v1203 := 3;
+   v1204 := 4;
+   v1205 := 5;
+   v1206 := 6;
+   v1207 := 7;
+   v1208 := 8;
+   v1209 := 9;
+   v1210 := 0;
+   v1211 := 1;
+   v1212 := 2;
+   v1213 := 3;
+   v1214 := 4;
+   v1215 := 5;
+   v1216 := 6;
+   v1217 := 7;
+   v1218 := 8;
+   v1219 := 9;
+   v1220 := 0;
+   v1221 := 1;
+   v1222 := 2;
+   v1223 := 3;
+   v1224 := 4;
+   v1225 := 5;
+   v1226 := 6;
+   v1227 := 7;
+   v1228 := 8;
+   v1229 := 9;
+   v1230 := 0;
+   v1231 := 1;
+   v1232 := 2;
+   v1233 := 3;
+   v1234 := 4;
+   v1235 := 5;
+   v1236 := 6;
+   v1237 := 7;
+   v1238 := 8;
+   v1239 := 9;
+   v1240 := 0;
+   v1241 := 1;
+   v1242 := 2;
+   v1243 := 3;
+   v1244 := 4;
+   v1245 := 5;
+   v1246 := 6;
+   v1247 := 7;
+   v1248 := 8;
+   v1249 := 9;
+   v1250 := 0;
+   v1251 := 1;
+   v1252 := 2;
+   v1253 := 3;
+   v1254 := 4;
+   v1255 := 5;
+   v1256 := 6;
+   v1257 := 7;
+   v1258 := 8;
+   v1259 := 9;
+   v1260 := 0;
+   v1261 := 1;
+   v1262 := 2;
+   v1263 := 3;
+   v1264 := 4;
+   v1265 := 5;
+   v1266 := 6;
+   v1267 := 7;
+   v1268 := 8;
+   v1269 := 9;
+   v1270 := 0;
+   v1271 := 1;
+   v1272 := 2;
+   v1273 := 3;
+   v1274 := 4;
+   v1275 := 5;
+   v1276 := 6;
+   v1277 := 7;
+   v1278 := 8;
+   v1279 := 9;
+   v1280 := 0;
+   v1281 := 1;
+   v1282 := 2;
+   v1283 := 3;
+   v1284 := 4;
+   v1285 := 5;
+   v1286 := 6;
+   v1287 := 7;
+   v1288 := 8;
+   v1289 := 9;
+   v1290 := 0;
+   v1291 := 1;
+   v1292 := 2;
+   v1293 := 3;
+   v1294 := 4;
+   v1295 := 5;
+   v1296 := 6;
+   v1297 := 7;
+   v1298 := 8;
+   v1299 := 9;
+   v1300 := 0;
+   v1301 := 1;
+   v1302 := 2;
+   v1303 := 3;
+   v1304 := 4;
+   v1305 := 5;
+   v1306 := 6;
+   v1307 := 7;
+   v1308 := 8;
+   v1309 := 9;
+   v1310 := 0;
+   v1311 := 1;
+   v1312 := 2;
+   v1313 := 3;
+   v1314 := 4;
+   v1315 := 5;
+   v1316 := 6;
+   v1317 := 7;
+   v1318 := 8;
+   v1319 := 9;
+   v1320 := 0;
+   v1321 := 1;
+   v1322 := 2;
+   v1323 := 3;
+   v1324 := 4;
+   v1325 := 5;
+   v1326 := 6;
+   v1327 := 7;
+   v1328 := 8;
+   v1329 := 9;
+   v1330 := 0;
+   v1331 := 1;
+   v1332 := 2;
+   v1333 := 3;
+   v1334 := 4;
+   v1335 := 5;
+   v1336 := 6;
+   v1337 := 7;
+   v1338 := 8;
+   v1339 := 9;
+   v1340 := 0;
+   v1341 := 1;
+   v1342 := 2;
+   v1343 := 3;
+   v1344 := 4;
+   v1345 := 5;
+   v1346 := 6;
+   v1347 := 7;
+   v1348 := 8;
+   v1349 := 9;
+   v1350 := 0;
+   v1351 := 1;
+   v1352 := 2;
+   v1353 := 3;
+   v1354 := 4;
+   v1355 := 5;
+   v1356 := 6;
+   v1357 := 7;
+   v1358 := 8;
+   v1359 := 9;
+   v1360 := 0;
+   v1361 := 1;
+   v1362 := 2;
+   v1363 := 3;
+   v1364 := 4;
+   v1365 := 5;
+   v1366 := 6;
+   v1367 := 7;
+   v1368 := 8;
+   v1369 := 9;
+   v1370 := 0;
+   v1371 := 1;
+   v1372 := 2;
+   v1373 := 3;
+   v1374 := 4;
+   v1375 := 5;
+   v1376 := 6;
+   v1377 := 7;
+   v1378 := 8;
+   v1379 := 9;
+   v1380 := 0;
+   v1381 := 1;
+   v1382 := 2;
+   v1383 := 3;
+   v1384 := 4;
+   v1385 := 5;
+   v1386 := 6;
+   v1387 := 7;
+   v1388 := 8;
+   v1389 := 9;
+   v1390 := 0;
+   v1391 := 1;
+   v1392 := 2;
+   v1393 := 3;
+   v1394 := 4;
+   v1395 := 5;
+   v1396 := 6;
+   v1397 := 7;
+   v1398 := 8;
+   v1399 := 9;
+   v1400 := 0;
+   v1401 := 1;
+   v1402 := 2;
+   v1403 := 3;
+   v1404 := 4;
+   v1405 := 5;
+   v1406 := 6;
+   v1407 := 7;
+   v1408 := 8;
+   v1409 := 9;
+   v1410 := 0;
+   v1411 := 1;
+   v1412 := 2;
+   v1413 := 3;
+   v1414 := 4;
+   v1415 := 5;
+   v1416 := 6;
+   v1417 := 7;
+   v1418 := 8;
+   v1419 := 9;
+   v1420 := 0;
+   v1421 := 1;
+   v1422 := 2;
+   v1423 := 3;
+   v1424 := 4;
+   v1425 := 5;
+   v1426 := 6;
+   v1427 := 7;
+   v1428 := 8;
+   v1429 := 9;
+   v1430 := 0;
+   v1431 := 1;
+   v1432 := 2;
+   v1433 := 3;
+   v1434 := 4;
+   v1435 := 5;
+   v1436 := 6;
+   v1437 := 7;
+   v1438 := 8;
+   v1439 := 9;
+   v1440 := 0;
+   v1441 := 1;
+   v1442 := 2;
+   v1443 := 3;
+   v1444 := 4;
+   v1445 := 5;
+   v1446 := 6;
+   v1447 := 7;
+   v1448 := 8;
+   v1449 := 9;
+   v1450 := 0;
+   v1451 := 1;
+   v1452 := 2;
+   v1453 := 3;
+   v1454 := 4;
+   v1455 := 5;
+   v1456 := 6;
+   v1457 := 7;
+   v1458 := 8;
+   v1459 := 9;
+   v1460 := 0;
+   v1461 := 1;
+   v1462 := 2;
+   v1463 := 3;
+   v1464 := 4;
+   v1465 := 5;
+   v1466 := 6;
+   v1467 := 7;
+   v1468 := 8;
+   v1469 := 9;
+   v1470 := 0;
+   v1471 := 1;
+   v1472 := 2;
+   v1473 := 3;
+   v1474 := 4;
+   v1475 := 5;
+   v1476 := 6;
+   v1477 := 7;
+   v1478 := 8;
+   v1479 := 9;
+   v1480 := 0;
+   v1481 := 1;
+   v1482 := 2;
+   v1483 := 3;
+   v1484 := 4;
+   v1485 := 5;
+   v1486 := 6;
+   v1487 := 7;
+   v1488 := 8;
+   v1489 := 9;
+   v1490 := 0;
+   v1491 := 1;
+   v1492 := 2;
+   v1493 := 3;
+   v1494 := 4;
+   v1495 := 5;
+   v1496 := 6;
+   v1497 := 7;
+   v1498 := 8;
+   v1499 := 9;
+   v1500 := 0;
+   v1501 := 1;
+   v1502 := 2;
+   v1503 := 3;
+   v1504 := 4;
+   v1505 := 5;
+   v1506 := 6;
+   v1507 := 7;
+   v1508 := 8;
+   v1509 := 9;
+   v1510 := 0;
+   v1511 := 1;
+   v1512 := 2;
+   v1513 := 3;
+   v1514 := 4;
+   v1515 := 5;
+   v1516 := 6;
+   v1517 := 7;
+   v1518 := 8;
+   v1519 := 9;
+   v1520 := 0;
+   v1521 := 1;
+   v1522 := 2;
+   v1523 := 3;
+   v1524 := 4;
+   v1525 := 5;
+   v1526 := 6;
+   v1527 := 7;
+   v1528 := 8;
+   v1529 := 9;
+   v1530 := 0;
+   v1531 := 1;
+   v1532 := 2;
+   v1533 := 3;
+   v1534 := 4;
+   v1535 := 5;
+   v1536 := 6;
+   v1537 := 7;
+   v1538 := 8;
+   v1539 := 9;
+   v1540 := 0;
+   v1541 := 1;
+   v1542 := 2;
+   v1543 := 3;
+   v1544 := 4;
+   v1545 := 5;
+   v1546 := 6;
+   v1547 := 7;
+   v1548 := 8;
+   v1549 := 9;
+   v1550 := 0;
+   v1551 := 1;
+   v1552 := 2;
+   v1553 := 3;
+   v1554 := 4;
+   v1555 := 5;
+   v1556 := 6;
+   v1557 := 7;
+   v1558 := 8;
+   v1559 := 9;
+   v1560 := 0;
+   v1561 := 1;
+   v1562 := 2;
+   v1563 := 3;
+   v1564 := 4;
+   v1565 := 5;
+   v1566 := 6;
+   v1567 := 7;
+   v1568 := 8;
+   v1569 := 9;
+   v1570 := 0;
+   v1571 := 1;
+   v1572 := 2;
+   v1573 := 3;
+   v1574 := 4;
+   v1575 := 5;
+   v1576 := 6;
+   v1577 := 7;
+   v1578 := 8;
+   v1579 := 9;
+   v1580 := 0;
+   v1581 := 1;
+   v1582 := 2;
+   v1583 := 3;
+   v1584 := 4;
+   v1585 := 5;
+   v1586 := 6;
+   v1587 := 7;
+   v1588 := 8;
+   v1589 := 9;
+   v1590 := 0;
+   v1591 := 1;
+   v1592 := 2;
+   v1593 := 3;
+   v1594 := 4;
+   v1595 := 5;
+   v1596 := 6;
+   v1597 := 7;
+   v1598 := 8;
+   v1599 := 9;
+   v1600 := 0;
+   v1601 := 1;
+   v1602 := 2;
+   v1603 := 3;
+   v1604 := 4;
+   v1605 := 5;
+   v1606 := 6;
+   v1607 := 7;
+   v1608 := 8;
+   v1609 := 9;
+   v1610 := 0;
+   v1611 := 1;
+   v1612 := 2;
+   v1613 := 3;
+   v1614 := 4;
+   v1615 := 5;
+   v1616 := 6;
+   v1617 := 7;
+   v1618 := 8;
+   v1619 := 9;
+   v1620 := 0;
+   v1621 := 1;
+   v1622 := 2;
+   v1623 := 3;
+   v1624 := 4;
+   v1625 := 5;
+   v1626 := 6;
+   v1627 := 7;
+   v1628 := 8;
+   v1629 := 9;
+   v1630 := 0;
+   v1631 := 1;
+   v1632 := 2;
+   v1633 := 3;
+   v1634 := 4;
+   v1635 := 5;
+   v1636 := 6;
+   v1637 := 7;
+   v1638 := 8;
+   v1639 := 9;
+   v1640 := 0;
+   v1641 := 1;
+   v1642 := 2;
+   v1643 := 3;
+   v1644 := 4;
+   v1645 := 5;
+   v1646 := 6;
+   v1647 := 7;
+   v1648 := 8;
+   v1649 := 9;
+   v1650 := 0;
+   v1651 := 1;
+   v1652 := 2;
+   v1653 := 3;
+   v1654 := 4;
+   v1655 := 5;
+   v1656 := 6;
+   v1657 := 7;
+   v1658 := 8;
+   v1659 := 9;
+   v1660 := 0;
+   v1661 := 1;
+   v1662 := 2;
+   v1663 := 3;
+   v1664 := 4;
+   v1665 := 5;
+   v1666 := 6;
+   v1667 := 7;
+   v1668 := 8;
+   v1669 := 9;
+   v1670 := 0;
+   v1671 := 1;
+   v1672 := 2;
+   v1673 := 3;
+   v1674 := 4;
+   v1675 := 5;
+   v1676 := 6;
+   v1677 := 7;
+   v1678 := 8;
+   v1679 := 9;
+   v1680 := 0;
+   v1681 := 1;
+   v1682 := 2;
+   v1683 := 3;
+   v1684 := 4;
+   v1685 := 5;
+   v1686 := 6;
+   v1687 := 7;
+   v1688 := 8;
+   v1689 := 9;
+   v1690 := 0;
+   v1691 := 1;
+   v1692 := 2;
+   v1693 := 3;
+   v1694 := 4;
+   v1695 := 5;
+   v1696 := 6;
+   v1697 := 7;
+   v1698 := 8;
+   v1699 := 9;
+   v1700 := 0;
+   v1701 := 1;
+   v1702 := 2;
+   v1703 := 3;
+   v1704 := 4;
+   v1705 := 5;
+   v1706 := 6;
+   v1707 := 7;
+   v1708 := 8;
+   v1709 := 9;
+   v1710 := 0;
+   v1711 := 1;
+   v1712 := 2;
+   v1713 := 3;
+   v1714 := 4;
+   v1715 := 5;
+   v1716 := 6;
+   v1717 := 7;
+   v1718 := 8;
+   v1719 := 9;
+   v1720 := 0;
+   v1721 := 1;
+   v1722 := 2;
+   v1723 := 3;
+   v1724 := 4;
+   v1725 := 5;
+   v1726 := 6;
+   v1727 := 7;
+   v1728 := 8;
+   v1729 := 9;
+   v1730 := 0;
+   v1731 := 1;
+   v1732 := 2;
+   v1733 := 3;
+   v1734 := 4;
+   v1735 := 5;
+   v1736 := 6;
+   v1737 := 7;
+   v1738 := 8;
+   v1739 := 9;
+   v1740 := 0;
+   v1741 := 1;
+   v1742 := 2;
+   v1743 := 3;
+   v1744 := 4;
+   v1745 := 5;
+   v1746 := 6;
+   v1747 := 7;
+   v1748 := 8;
+   v1749 := 9;
+   v1750 := 0;
+   v1751 := 1;
+   v1752 := 2;
+   v1753 := 3;
+   v1754 := 4;
+   v1755 := 5;
+   v1756 := 6;
+   v1757 := 7;
+   v1758 := 8;
+   v1759 := 9;
+   v1760 := 0;
+   v1761 := 1;
+   v1762 := 2;
+   v1763 := 3;
+   v1764 := 4;
+   v1765 := 5;
+   v1766 := 6;
+   v1767 := 7;
+   v1768 := 8;
+   v1769 := 9;
+   v1770 := 0;
+   v1771 := 1;
+   v1772 := 2;
+   v1773 := 3;
+   v1774 := 4;
+   v1775 := 5;
+   v1776 := 6;
+   v1777 := 7;
+   v1778 := 8;
+   v1779 := 9;
+   v1780 := 0;
+   v1781 := 1;
+   v1782 := 2;
+   v1783 := 3;
+   v1784 := 4;
+   v1785 := 5;
+   v1786 := 6;
+   v1787 := 7;
+   v1788 := 8;
+   v1789 := 9;
+   v1790 := 0;
+   v1791 := 1;
+   v1792 := 2;
+   v1793 := 3;
+   v1794 := 4;
+   v1795 := 5;
+   v1796 := 6;
+   v1797 := 7;
+   v1798 := 8;
+   v1799 := 9;
+   v1800 := 0;
+   v1801 := 1;
+   v1802 := 2;
+   v1803 := 3;
+   v1804 := 4;
+   v1805 := 5;
+   v1806 := 6;
+   v1807 := 7;
+   v1808 := 8;
+   v1809 := 9;
+   v1810 := 0;
+   v1811 := 1;
+   v1812 := 2;
+   v1813 := 3;
+   v1814 := 4;
+   v1815 := 5;
+   v1816 := 6;
+   v1817 := 7;
+   v1818 := 8;
+   v1819 := 9;
+   v1820 := 0;
+   v1821 := 1;
+   v1822 := 2;
+   v1823 := 3;
+   v1824 := 4;
+   v1825 := 5;
+   v1826 := 6;
+   v1827 := 7;
+   v1828 := 8;
+   v1829 := 9;
+   v1830 := 0;
+   v1831 := 1;
+   v1832 := 2;
+   v1833 := 3;
+   v1834 := 4;
+   v1835 := 5;
+   v1836 := 6;
+   v1837 := 7;
+   v1838 := 8;
+   v1839 := 9;
+   v1840 := 0;
+   v1841 := 1;
+   v1842 := 2;
+   v1843 := 3;
+   v1844 := 4;
+   v1845 := 5;
+   v1846 := 6;
+   v1847 := 7;
+   v1848 := 8;
+   v1849 := 9;
+   v1850 := 0;
+   v1851 := 1;
+   v1852 := 2;
+   v1853 := 3;
+   v1854 := 4;
+   v1855 := 5;
+   v1856 := 6;
+   v1857 := 7;
+   v1858 := 8;
+   v1859 := 9;
+   v1860 := 0;
+   v1861 := 1;
+   v1862 := 2;
+   v1863 := 3;
+   v1864 := 4;
+   v1865 := 5;
+   v1866 := 6;
+   v1867 := 7;
+   v1868 := 8;
+   v1869 := 9;
+   v1870 := 0;
+   v1871 := 1;
+   v1872 := 2;
+   v1873 := 3;
+   v1874 := 4;
+   v1875 := 5;
+   v1876 := 6;
+   v1877 := 7;
+   v1878 := 8;
+   v1879 := 9;
+   v1880 := 0;
+   v1881 := 1;
+   v1882 := 2;
+   v1883 := 3;
+   v1884 := 4;
+   v1885 := 5;
+   v1886 := 6;
+   v1887 := 7;
+   v1888 := 8;
+   v1889 := 9;
+   v1890 := 0;
+   v1891 := 1;
+   v1892 := 2;
+   v1893 := 3;
+   v1894 := 4;
+   v1895 := 5;
+   v1896 := 6;
+   v1897 := 7;
+   v1898 := 8;
+   v1899 := 9;
+   v1900 := 0;
+   v1901 := 1;
+   v1902 := 2;
+   v1903 := 3;
+   v1904 := 4;
+   v1905 := 5;
+   v1906 := 6;
+   v1907 := 7;
+   v1908 := 8;
+   v1909 := 9;
+   v1910 := 0;
+   v1911 := 1;
+   v1912 := 2;
+   v1913 := 3;
+   v1914 := 4;
+   v1915 := 5;
+   v1916 := 6;
+   v1917 := 7;
+   v1918 := 8;
+   v1919 := 9;
+   v1920 := 0;
+   v1921 := 1;
+   v1922 := 2;
+   v1923 := 3;
+   v1924 := 4;
+   v1925 := 5;
+   v1926 := 6;
+   v1927 := 7;
+   v1928 := 8;
+   v1929 := 9;
+   v1930 := 0;
+   v1931 := 1;
+   v1932 := 2;
+   v1933 := 3;
+   v1934 := 4;
+   v1935 := 5;
+   v1936 := 6;
+   v1937 := 7;
+   v1938 := 8;
+   v1939 := 9;
+   v1940 := 0;
+   v1941 := 1;
+   v1942 := 2;
+   v1943 := 3;
+   v1944 := 4;
+   v1945 := 5;
+   v1946 := 6;
+   v1947 := 7;
+   v1948 := 8;
+   v1949 := 9;
+   v1950 := 0;
+   v1951 := 1;
+   v1952 := 2;
+   v1953 := 3;
+   v1954 := 4;
+   v1955 := 5;
+   v1956 := 6;
+   v1957 := 7;
+   v1958 := 8;
+   v1959 := 9;
+   v1960 := 0;
+   v1961 := 1;
+   v1962 := 2;
+   v1963 := 3;
+   v1964 := 4;
+   v1965 := 5;
+   v1966 := 6;
+   v1967 := 7;
+   v1968 := 8;
+   v1969 := 9;
+   v1970 := 0;
+   v1971 := 1;
+   v1972 := 2;
+   v1973 := 3;
+   v1974 := 4;
+   v1975 := 5;
+   v1976 := 6;
+   v1977 := 7;
+   v1978 := 8;
+   v1979 := 9;
+   v1980 := 0;
+   v1981 := 1;
+   v1982 := 2;
+   v1983 := 3;
+   v1984 := 4;
+   v1985 := 5;
+   v1986 := 6;
+   v1987 := 7;
+   v1988 := 8;
+   v1989 := 9;
+   v1990 := 0;
+   v1991 := 1;
+   v1992 := 2;
+   v1993 := 3;
+   v1994 := 4;
+   v1995 := 5;
+   v1996 := 6;
+   v1997 := 7;
+   v1998 := 8;
+   v1999 := 9;
+   v2000 := 0;
+   v2001 := 1;
+   v2002 := 2;
+   v2003 := 3;
+   v2004 := 4;
+   v2005 := 5;
+   v2006 := 6;
+   v2007 := 7;
+   v2008 := 8;
+   v2009 := 9;
+   v2010 := 0;
+   v2011 := 1;
+   v2012 := 2;
+   v2013 := 3;
+   v2014 := 4;
+   v2015 := 5;
+   v2016 := 6;
+   v2017 := 7;
+   v2018 := 8;
+   v2019 := 9;
+   v2020 := 0;
+   v2021 := 1;
+   v2022 := 2;
+   v2023 := 3;
+   v2024 := 4;
+   v2025 := 5;
+   v2026 := 6;
+   v2027 := 7;
+   v2028 := 8;
+   v2029 := 9;
+   v2030 := 0;
+   v2031 := 1;
+   v2032 := 2;
+   v2033 := 3;
+   v2034 := 4;
+   v2035 := 5;
+   v2036 := 6;
+   v2037 := 7;
+   v2038 := 8;
+   v2039 := 9;
+   v2040 := 0;
+   v2041 := 1;
+   v2042 := 2;
+   v2043 := 3;
+   v2044 := 4;
+   v2045 := 5;
+   v2046 := 6;
+   v2047 := 7;
+   v2048 := 8;
+   v2049 := 9;
+   v2050 := 0;
+   v2051 := 1;
+   v2052 := 2;
+   v2053 := 3;
+   v2054 := 4;
+   v2055 := 5;
+   v2056 := 6;
+   v2057 := 7;
+   v2058 := 8;
+   v2059 := 9;
+   v2060 := 0;
+   v2061 := 1;
+   v2062 := 2;
+   v2063 := 3;
+   v2064 := 4;
+   v2065 := 5;
+   v2066 := 6;
+   v2067 := 7;
+   v2068 := 8;
+   v2069 := 9;
+   v2070 := 0;
+   v2071 := 1;
+   v2072 := 2;
+   v2073 := 3;
+   v2074 := 4;
+   v2075 := 5;
+   v2076 := 6;
+   v2077 := 7;
+   v2078 := 8;
+   v2079 := 9;
+   v2080 := 0;
+   v2081 := 1;
+   v2082 := 2;
+   v2083 := 3;
+   v2084 := 4;
+   v2085 := 5;
+   v2086 := 6;
+   v2087 := 7;
+   v2088 := 8;
+   v2089 := 9;
+   v2090 := 0;
+   v2091 := 1;
+   v2092 := 2;
+   v2093 := 3;
+   v2094 := 4;
+   v2095 := 5;
+   v2096 := 6;
+   v2097 := 7;
+   v2098 := 8;
+   v2099 := 9;
+   v2100 := 0;
+   v2101 := 1;
+   v2102 := 2;
+   v2103 := 3;
+   v2104 := 4;
+   v2105 := 5;
+   v2106 := 6;
+   v2107 := 7;
+   v2108 := 8;
+   v2109 := 9;
+   v2110 := 0;
+   v2111 := 1;
+   v2112 := 2;
+   v2113 := 3;
+   v2114 := 4;
+   v2115 := 5;
+   v2116 := 6;
+   v2117 := 7;
+   v2118 := 8;
+   v2119 := 9;
+   v2120 := 0;
+   v2121 := 1;
+   v2122 := 2;
+   v2123 := 3;
+   v2124 := 4;
+   v2125 := 5;
+   v2126 := 6;
+   v2127 := 7;
+   v2128 := 8;
+   v2129 := 9;
+   v2130 := 0;
+   v2131 := 1;
+   v2132 := 2;
+   v2133 := 3;
+   v2134 := 4;
+   v2135 := 5;
+   v2136 := 6;
+   v2137 := 7;
+   v2138 := 8;
+   v2139 := 9;
+   v2140 := 0;
+   v2141 := 1;
+   v2142 := 2;
+   v2143 := 3;
+   v2144 := 4;
+   v2145 := 5;
+   v2146 := 6;
+   v2147 := 7;
+   v2148 := 8;
+   v2149 := 9;
+   v2150 := 0;
+   v2151 := 1;
+   v2152 := 2;
+   v2153 := 3;
+   v2154 := 4;
+   v2155 := 5;
+   v2156 := 6;
+   v2157 := 7;
+   v2158 := 8;
+   v2159 := 9;
+   v2160 := 0;
+   v2161 := 1;
+   v2162 := 2;
+   v2163 := 3;
+   v2164 := 4;
+   v2165 := 5;
+   v2166 := 6;
+   v2167 := 7;
+   v2168 := 8;
+   v2169 := 9;
+   v2170 := 0;
+   v2171 := 1;
+   v2172 := 2;
+   v2173 := 3;
+   v2174 := 4;
+   v2175 := 5;
+   v2176 := 6;
+   v2177 := 7;
+   v2178 := 8;
+   v2179 := 9;
+   v2180 := 0;
+   v2181 := 1;
+   v2182 := 2;
+   v2183 := 3;
+   v2184 := 4;
+   v2185 := 5;
+   v2186 := 6;
+   v2187 := 7;
+   v2188 := 8;
+   v2189 := 9;
+   v2190 := 0;
+   v2191 := 1;
+   v2192 := 2;
+   v2193 := 3;
+   v2194 := 4;
+   v2195 := 5;
+   v2196 := 6;
+   v2197 := 7;
+   v2198 := 8;
+   v2199 := 9;
+   v2200 := 0;
+   v2201 := 1;
+   v2202 := 2;
+   v2203 := 3;
+   v2204 := 4;
+   v2205 := 5;
+   v2206 := 6;
+   v2207 := 7;
+   v2208 := 8;
+   v2209 := 9;
+   v2210 := 0;
+   v2211 := 1;
+   v2212 := 2;
+   v2213 := 3;
+   v2214 := 4;
+   v2215 := 5;
+   v2216 := 6;
+   v2217 := 7;
+   v2218 := 8;
+   v2219 := 9;
+   v2220 := 0;
+   v2221 := 1;
+   v2222 := 2;
+   v2223 := 3;
+   v2224 := 4;
+   v2225 := 5;
+   v2226 := 6;
+   v2227 := 7;
+   v2228 := 8;
+   v2229 := 9;
+   v2230 := 0;
+   v2231 := 1;
+   v2232 := 2;
+   v2233 := 3;
+   v2234 := 4;
+   v2235 := 5;
+   v2236 := 6;
+   v2237 := 7;
+   v2238 := 8;
+   v2239 := 9;
+   v2240 := 0;
+   v2241 := 1;
+   v2242 := 2;
+   v2243 := 3;
+   v2244 := 4;
+   v2245 := 5;
+   v2246 := 6;
+   v2247 := 7;
+   v2248 := 8;
+   v2249 := 9;
+   v2250 := 0;
+   v2251 := 1;
+   v2252 := 2;
+   v2253 := 3;
+   v2254 := 4;
+   v2255 := 5;
+   v2256 := 6;
+   v2257 := 7;
+   v2258 := 8;
+   v2259 := 9;
+   v2260 := 0;
+   v2261 := 1;
+   v2262 := 2;
+   v2263 := 3;
+   v2264 := 4;
+   v2265 := 5;
+   v2266 := 6;
+   v2267 := 7;
+   v2268 := 8;
+   v2269 := 9;
+   v2270 := 0;
+   v2271 := 1;
+   v2272 := 2;
+   v2273 := 3;
+   v2274 := 4;
+   v2275 := 5;
+   v2276 := 6;
+   v2277 := 7;
+   v2278 := 8;
+   v2279 := 9;
+   v2280 := 0;
+   v2281 := 1;
+   v2282 := 2;
+   v2283 := 3;
+   v2284 := 4;
+   v2285 := 5;
+   v2286 := 6;
+   v2287 := 7;
+   v2288 := 8;
+   v2289 := 9;
+   v2290 := 0;
+   v2291 := 1;
+   v2292 := 2;
+   v2293 := 3;
+   v2294 := 4;
+   v2295 := 5;
+   v2296 := 6;
+   v2297 := 7;
+   v2298 := 8;
+   v2299 := 9;
+   v2300 := 0;
+   v2301 := 1;
+   v2302 := 2;
+   v2303 := 3;
+   v2304 := 4;
+   v2305 := 5;
+   v2306 := 6;
+   v2307 := 7;
+   v2308 := 8;
+   v2309 := 9;
+   v2310 := 0;
+   v2311 := 1;
+   v2312 := 2;
+   v2313 := 3;
+   v2314 := 4;
+   v2315 := 5;
+   v2316 := 6;
+   v2317 := 7;
+   v2318 := 8;
+   v2319 := 9;
+   v2320 := 0;
+   v2321 := 1;
+   v2322 := 2;
+   v2323 := 3;
+   v2324 := 4;
+   v2325 := 5;
+   v2326 := 6;
+   v2327 := 7;
+   v2328 := 8;
+   v2329 := 9;
+   v2330 := 0;
+   v2331 := 1;
+   v2332 := 2;
+   v2333 := 3;
+   v2334 := 4;
+   v2335 := 5;
+   v2336 := 6;
+   v2337 := 7;
+   v2338 := 8;
+   v2339 := 9;
+   v2340 := 0;
+   v2341 := 1;
+   v2342 := 2;
+   v2343 := 3;
+   v2344 := 4;
+   v2345 := 5;
+   v2346 := 6;
+   v2347 := 7;
+   v2348 := 8;
+   v2349 := 9;
+   v2350 := 0;
+   v2351 := 1;
+   v2352 := 2;
+   v2353 := 3;
+   v2354 := 4;
+   v2355 := 5;
+   v2356 := 6;
+   v2357 := 7;
+   v2358 := 8;
+   v2359 := 9;
+   v2360 := 0;
+   v2361 := 1;
+   v2362 := 2;
+   v2363 := 3;
+   v2364 := 4;
+   v2365 := 5;
+   v2366 := 6;
+   v2367 := 7;
+   v2368 := 8;
+   v2369 := 9;
+   v2370 := 0;
+   v2371 := 1;
+   v2372 := 2;
+   v2373 := 3;
+   v2374 := 4;
+   v2375 := 5;
+   v2376 := 6;
+   v2377 := 7;
+   v2378 := 8;
+   v2379 := 9;
+   v2380 := 0;
+   v2381 := 1;
+   v2382 := 2;
+   v2383 := 3;
+   v2384 := 4;
+   v2385 := 5;
+   v2386 := 6;
+   v2387 := 7;
+   v2388 := 8;
+   v2389 := 9;
+   v2390 := 0;
+   v2391 := 1;
+   v2392 := 2;
+   v2393 := 3;
+   v2394 := 4;
+   v2395 := 5;
+   v2396 := 6;
+   v2397 := 7;
+   v2398 := 8;
+   v2399 := 9;
+   v2400 := 0;
+   v2401 := 1;
+   v2402 := 2;
+   v2403 := 3;
+   v2404 := 4;
+   v2405 := 5;
+   v2406 := 6;
+   v2407 := 7;
+   v2408 := 8;
+   v2409 := 9;
+   v2410 := 0;
+   v2411 := 1;
+   v2412 := 2;
+   v2413 := 3;
+   v2414 := 4;
+   v2415 := 5;
+   v2416 := 6;
+   v2417 := 7;
+   v2418 := 8;
+   v2419 := 9;
+   v2420 := 0;
+   v2421 := 1;
+   v2422 := 2;
+   v2423 := 3;
+   v2424 := 4;
+   v2425 := 5;
+   v2426 := 6;
+   v2427 := 7;
+   v2428 := 8;
+   v2429 := 9;
+   v2430 := 0;
+   v2431 := 1;
+   v2432 := 2;
+   v2433 := 3;
+   v2434 := 4;
+   v2435 := 5;
+   v2436 := 6;
+   v2437 := 7;
+   v2438 := 8;
+   v2439 := 9;
+   v2440 := 0;
+   v2441 := 1;
+   v2442 := 2;
+   v2443 := 3;
+   v2444 := 4;
+   v2445 := 5;
+   v2446 := 6;
+   v2447 := 7;
+   v2448 := 8;
+   v2449 := 9;
+   v2450 := 0;
+   v2451 := 1;
+   v2452 := 2;
+   v2453 := 3;
+   v2454 := 4;
+   v2455 := 5;
+   v2456 := 6;
+   v2457 := 7;
+   v2458 := 8;
+   v2459 := 9;
+   v2460 := 0;
+   v2461 := 1;
+   v2462 := 2;
+   v2463 := 3;
+   v2464 := 4;
+   v2465 := 5;
+   v2466 := 6;
+   v2467 := 7;
+   v2468 := 8;
+   v2469 := 9;
+   v2470 := 0;
+   v2471 := 1;
+   v2472 := 2;
+   v2473 := 3;
+   v2474 := 4;
+   v2475 := 5;
+   v2476 := 6;
+   v2477 := 7;
+   v2478 := 8;
+   v2479 := 9;
+   v2480 := 0;
+   v2481 := 1;
+   v2482 := 2;
+   v2483 := 3;
+   v2484 := 4;
+   v2485 := 5;
+   v2486 := 6;
+   v2487 := 7;
+   v2488 := 8;
+   v2489 := 9;
+   v2490 := 0;
+   v2491 := 1;
+   v2492 := 2;
+   v2493 := 3;
+   v2494 := 4;
+   v2495 := 5;
+   v2496 := 6;
+   v2497 := 7;
+   v2498 := 8;
+   v2499 := 9;
+   v2500 := 0;
+   v2501 := 1;
+   v2502 := 2;
+   v2503 := 3;
+   v2504 := 4;
+   v2505 := 5;
+   v2506 := 6;
+   v2507 := 7;
+   v2508 := 8;
+   v2509 := 9;
+   v2510 := 0;
+   v2511 := 1;
+   v2512 := 2;
+   v2513 := 3;
+   v2514 := 4;
+   v2515 := 5;
+   v2516 := 6;
+   v2517 := 7;
+   v2518 := 8;
+   v2519 := 9;
+   v2520 := 0;
+   v2521 := 1;
+   v2522 := 2;
+   v2523 := 3;
+   v2524 := 4;
+   v2525 := 5;
+   v2526 := 6;
+   v2527 := 7;
+   v2528 := 8;
+   v2529 := 9;
+   v2530 := 0;
+   v2531 := 1;
+   v2532 := 2;
+   v2533 := 3;
+   v2534 := 4;
+   v2535 := 5;
+   v2536 := 6;
+   v2537 := 7;
+   v2538 := 8;
+   v2539 := 9;
+   v2540 := 0;
+   v2541 := 1;
+   v2542 := 2;
+   v2543 := 3;
+   v2544 := 4;
+   v2545 := 5;
+   v2546 := 6;
+   v2547 := 7;
+   v2548 := 8;
+   v2549 := 9;
+   v2550 := 0;
+   v2551 := 1;
+   v2552 := 2;
+   v2553 := 3;
+   v2554 := 4;
+   v2555 := 5;
+   v2556 := 6;
+   v2557 := 7;
+   v2558 := 8;
+   v2559 := 9;
+   v2560 := 0;
+   v2561 := 1;
+   v2562 := 2;
+   v2563 := 3;
+   v2564 := 4;
+   v2565 := 5;
+   v2566 := 6;
+   v2567 := 7;
+   v2568 := 8;
+   v2569 := 9;
+   v2570 := 0;
+   v2571 := 1;
+   v2572 := 2;
+   v2573 := 3;
+   v2574 := 4;
+   v2575 := 5;
+   v2576 := 6;
+   v2577 := 7;
+   v2578 := 8;
+   v2579 := 9;
+   v2580 := 0;
+   v2581 := 1;
+   v2582 := 2;
+   v2583 := 3;
+   v2584 := 4;
+   v2585 := 5;
+   v2586 := 6;
+   v2587 := 7;
+   v2588 := 8;
+   v2589 := 9;
+   v2590 := 0;
+   v2591 := 1;
+   v2592 := 2;
+   v2593 := 3;
+   v2594 := 4;
+   v2595 := 5;
+   v2596 := 6;
+   v2597 := 7;
+   v2598 := 8;
+   v2599 := 9;
+   v2600 := 0;
+   v2601 := 1;
+   v2602 := 2;
+   v2603 := 3;
+   v2604 := 4;
+   v2605 := 5;
+   v2606 := 6;
+   v2607 := 7;
+   v2608 := 8;
+   v2609 := 9;
+   v2610 := 0;
+   v2611 := 1;
+   v2612 := 2;
+   v2613 := 3;
+   v2614 := 4;
+   v2615 := 5;
+   v2616 := 6;
+   v2617 := 7;
+   v2618 := 8;
+   v2619 := 9;
+   v2620 := 0;
+   v2621 := 1;
+   v2622 := 2;
+   v2623 := 3;
+   v2624 := 4;
+   v2625 := 5;
+   v2626 := 6;
+   v2627 := 7;
+   v2628 := 8;
+   v2629 := 9;
+   v2630 := 0;
+   v2631 := 1;
+   v2632 := 2;
+   v2633 := 3;
+   v2634 := 4;
+   v2635 := 5;
+   v2636 := 6;
+   v2637 := 7;
+   v2638 := 8;
+   v2639 := 9;
+   v2640 := 0;
+   v2641 := 1;
+   v2642 := 2;
+   v2643 := 3;
+   v2644 := 4;
+   v2645 := 5;
+   v2646 := 6;
+   v2647 := 7;
+   v2648 := 8;
+   v2649 := 9;
+   v2650 := 0;
+   v2651 := 1;
+   v2652 := 2;
+   v2653 := 3;
+   v2654 := 4;
+   v2655 := 5;
+   v2656 := 6;
+   v2657 := 7;
+   v2658 := 8;
+   v2659 := 9;
+   v2660 := 0;
+   v2661 := 1;
+   v2662 := 2;
+   v2663 := 3;
+   v2664 := 4;
+   v2665 := 5;
+   v2666 := 6;
+   v2667 := 7;
+   v2668 := 8;
+   v2669 := 9;
+   v2670 := 0;
+   v2671 := 1;
+   v2672 := 2;
+   v2673 := 3;
+   v2674 := 4;
+   v2675 := 5;
+   v2676 := 6;
+   v2677 := 7;
+   v2678 := 8;
+   v2679 := 9;
+   v2680 := 0;
+   v2681 := 1;
+   v2682 := 2;
+   v2683 := 3;
+   v2684 := 4;
+   v2685 := 5;
+   v2686 := 6;
+   v2687 := 7;
+   v2688 := 8;
+   v2689 := 9;
+   v2690 := 0;
+   v2691 := 1;
+   v2692 := 2;
+   v2693 := 3;
+   v2694 := 4;
+   v2695 := 5;
+   v2696 := 6;
+   v2697 := 7;
+   v2698 := 8;
+   v2699 := 9;
+   v2700 := 0;
+   v2701 := 1;
+   v2702 := 2;
+   v2703 := 3;
+   v2704 := 4;
+   v2705 := 5;
+   v2706 := 6;
+   v2707 := 7;
+   v2708 := 8;
+   v2709 := 9;
+   v2710 := 0;
+   v2711 := 1;
+   v2712 := 2;
+   v2713 := 3;
+   v2714 := 4;
+   v2715 := 5;
+   v2716 := 6;
+   v2717 := 7;
+   v2718 := 8;
+   v2719 := 9;
+   v2720 := 0;
+   v2721 := 1;
+   v2722 := 2;
+   v2723 := 3;
+   v2724 := 4;
+   v2725 := 5;
+   v2726 := 6;
+   v2727 := 7;
+   v2728 := 8;
+   v2729 := 9;
+   v2730 := 0;
+   v2731 := 1;
+   v2732 := 2;
+   v2733 := 3;
+   v2734 := 4;
+   v2735 := 5;
+   v2736 := 6;
+   v2737 := 7;
+   v2738 := 8;
+   v2739 := 9;
+   v2740 := 0;
+   v2741 := 1;
+   v2742 := 2;
+   v2743 := 3;
+   v2744 := 4;
+   v2745 := 5;
+   v2746 := 6;
+   v2747 := 7;
+   v2748 := 8;
+   v2749 := 9;
+   v2750 := 0;
+   v2751 := 1;
+   v2752 := 2;
+   v2753 := 3;
+   v2754 := 4;
+   v2755 := 5;
+   v2756 := 6;
+   v2757 := 7;
+   v2758 := 8;
+   v2759 := 9;
+   v2760 := 0;
+   v2761 := 1;
+   v2762 := 2;
+   v2763 := 3;
+   v2764 := 4;
+   v2765 := 5;
+   v2766 := 6;
+   v2767 := 7;
+   v2768 := 8;
+   v2769 := 9;
+   v2770 := 0;
+   v2771 := 1;
+   v2772 := 2;
+   v2773 := 3;
+   v2774 := 4;
+   v2775 := 5;
+   v2776 := 6;
+   v2777 := 7;
+   v2778 := 8;
+   v2779 := 9;
+   v2780 := 0;
+   v2781 := 1;
+   v2782 := 2;
+   v2783 := 3;
+   v2784 := 4;
+   v2785 := 5;
+   v2786 := 6;
+   v2787 := 7;
+   v2788 := 8;
+   v2789 := 9;
+   v2790 := 0;
+   v2791 := 1;
+   v2792 := 2;
+   v2793 := 3;
+   v2794 := 4;
+   v2795 := 5;
+   v2796 := 6;
+   v2797 := 7;
+   v2798 := 8;
+   v2799 := 9;
+   v2800 := 0;
+   v2801 := 1;
+   v2802 := 2;
+   v2803 := 3;
+   v2804 := 4;
+   v2805 := 5;
+   v2806 := 6;
+   v2807 := 7;
+   v2808 := 8;
+   v2809 := 9;
+   v2810 := 0;
+   v2811 := 1;
+   v2812 := 2;
+   v2813 := 3;
+   v2814 := 4;
+   v2815 := 5;
+   v2816 := 6;
+   v2817 := 7;
+   v2818 := 8;
+   v2819 := 9;
+   v2820 := 0;
+   v2821 := 1;
+   v2822 := 2;
+   v2823 := 3;
+   v2824 := 4;
+   v2825 := 5;
+   v2826 := 6;
+   v2827 := 7;
+   v2828 := 8;
+   v2829 := 9;
+   v2830 := 0;
+   v2831 := 1;
+   v2832 := 2;
+   v2833 := 3;
+   v2834 := 4;
+   v2835 := 5;
+   v2836 := 6;
+   v2837 := 7;
+   v2838 := 8;
+   v2839 := 9;
+   v2840 := 0;
+   v2841 := 1;
+   v2842 := 2;
+   v2843 := 3;
+   v2844 := 4;
+   v2845 := 5;
+   v2846 := 6;
+   v2847 := 7;
+   v2848 := 8;
+   v2849 := 9;
+   v2850 := 0;
+   v2851 := 1;
+   v2852 := 2;
+   v2853 := 3;
+   v2854 := 4;
+   v2855 := 5;
+   v2856 := 6;
+   v2857 := 7;
+   v2858 := 8;
+   v2859 := 9;
+   v2860 := 0;
+   v2861 := 1;
+   v2862 := 2;
+   v2863 := 3;
+   v2864 := 4;
+   v2865 := 5;
+   v2866 := 6;
+   v2867 := 7;
+   v2868 := 8;
+   v2869 := 9;
+   v2870 := 0;
+   v2871 := 1;
+   v2872 := 2;
+   v2873 := 3;
+   v2874 := 4;
+   v2875 := 5;
+   v2876 := 6;
+   v2877 := 7;
+   v2878 := 8;
+   v2879 := 9;
+   v2880 := 0;
+   v2881 := 1;
+   v2882 := 2;
+   v2883 := 3;
+   v2884 := 4;
+   v2885 := 5;
+   v2886 := 6;
+   v2887 := 7;
+   v2888 := 8;
+   v2889 := 9;
+   v2890 := 0;
+   v2891 := 1;
+   v2892 := 2;
+   v2893 := 3;
+   v2894 := 4;
+   v2895 := 5;
+   v2896 := 6;
+   v2897 := 7;
+   v2898 := 8;
+   v2899 := 9;
+   v2900 := 0;
+   v2901 := 1;
+   v2902 := 2;
+   v2903 := 3;
+   v2904 := 4;
+   v2905 := 5;
+   v2906 := 6;
+   v2907 := 7;
+   v2908 := 8;
+   v2909 := 9;
+   v2910 := 0;
+   v2911 := 1;
+   v2912 := 2;
+   v2913 := 3;
+   v2914 := 4;
+   v2915 := 5;
+   v2916 := 6;
+   v2917 := 7;
+   v2918 := 8;
+   v2919 := 9;
+   v2920 := 0;
+   v2921 := 1;
+   v2922 := 2;
+   v2923 := 3;
+   v2924 := 4;
+   v2925 := 5;
+   v2926 := 6;
+   v2927 := 7;
+   v2928 := 8;
+   v2929 := 9;
+   v2930 := 0;
+   v2931 := 1;
+   v2932 := 2;
+   v2933 := 3;
+   v2934 := 4;
+   v2935 := 5;
+   v2936 := 6;
+   v2937 := 7;
+   v2938 := 8;
+   v2939 := 9;
+   v2940 := 0;
+   v2941 := 1;
+   v2942 := 2;
+   v2943 := 3;
+   v2944 := 4;
+   v2945 := 5;
+   v2946 := 6;
+   v2947 := 7;
+   v2948 := 8;
+   v2949 := 9;
+   v2950 := 0;
+   v2951 := 1;
+   v2952 := 2;
+   v2953 := 3;
+   v2954 := 4;
+   v2955 := 5;
+   v2956 := 6;
+   v2957 := 7;
+   v2958 := 8;
+   v2959 := 9;
+   v2960 := 0;
+   v2961 := 1;
+   v2962 := 2;
+   v2963 := 3;
+   v2964 := 4;
+   v2965 := 5;
+   v2966 := 6;
+   v2967 := 7;
+   v2968 := 8;
+   v2969 := 9;
+   v2970 := 0;
+   v2971 := 1;
+   v2972 := 2;
+   v2973 := 3;
+   v2974 := 4;
+   v2975 := 5;
+   v2976 := 6;
+   v2977 := 7;
+   v2978 := 8;
+   v2979 := 9;
+   v2980 := 0;
+   v2981 := 1;
+   v2982 := 2;
+   v2983 := 3;
+   v2984 := 4;
+   v2985 := 5;
+   v2986 := 6;
+   v2987 := 7;
+   v2988 := 8;
+   v2989 := 9;
+   v2990 := 0;
+   v2991 := 1;
+   v2992 := 2;
+   v2993 := 3;
+   v2994 := 4;
+   v2995 := 5;
+   v2996 := 6;
+   v2997 := 7;
+   v2998 := 8;
+   v2999 := 9;
+   v3000 := 0;
+   v3001 := 1;
+   v3002 := 2;
+   v3003 := 3;
+   v3004 := 4;
+   v3005 := 5;
+   v3006 := 6;
+   v3007 := 7;
+   v3008 := 8;
+   v3009 := 9;
+   v3010 := 0;
+   v3011 := 1;
+   v3012 := 2;
+   v3013 := 3;
+   v3014 := 4;
+   v3015 := 5;
+   v3016 := 6;
+   v3017 := 7;
+   v3018 := 8;
+   v3019 := 9;
+   v3020 := 0;
+   v3021 := 1;
+   v3022 := 2;
+   v3023 := 3;
+   v3024 := 4;
+   v3025 := 5;
+   v3026 := 6;
+   v3027 := 7;
+   v3028 := 8;
+   v3029 := 9;
+   v3030 := 0;
+   v3031 := 1;
+   v3032 := 2;
+   v3033 := 3;
+   v3034 := 4;
+   v3035 := 5;
+   v3036 := 6;
+   v3037 := 7;
+   v3038 := 8;
+   v3039 := 9;
+   v3040 := 0;
+   v3041 := 1;
+   v3042 := 2;
+   v3043 := 3;
+   v3044 := 4;
+   v3045 := 5;
+   v3046 := 6;
+   v3047 := 7;
+   v3048 := 8;
+   v3049 := 9;
+   v3050 := 0;
+   v3051 := 1;
+   v3052 := 2;
+   v3053 := 3;
+   v3054 := 4;
+   v3055 := 5;
+   v3056 := 6;
+   v3057 := 7;
+   v3058 := 8;
+   v3059 := 9;
+   v3060 := 0;
+   v3061 := 1;
+   v3062 := 2;
+   v3063 := 3;
+   v3064 := 4;
+   v3065 := 5;
+   v3066 := 6;
+   v3067 := 7;
+   v3068 := 8;
+   v3069 := 9;
+   v3070 := 0;
+   v3071 := 1;
+   v3072 := 2;
+   v3073 := 3;
+   v3074 := 4;
+   v3075 := 5;
+   v3076 := 6;
+   v3077 := 7;
+   v3078 := 8;
+   v3079 := 9;
+   v3080 := 0;
+   v3081 := 1;
+   v3082 := 2;
+   v3083 := 3;
+   v3084 := 4;
+   v3085 := 5;
+   v3086 := 6;
+   v3087 := 7;
+   v3088 := 8;
+   v3089 := 9;
+   v3090 := 0;
+   v3091 := 1;
+   v3092 := 2;
+   v3093 := 3;
+   v3094 := 4;
+   v3095 := 5;
+   v3096 := 6;
+   v3097 := 7;
+   v3098 := 8;
+   v3099 := 9;
+   v3100 := 0;
+   v3101 := 1;
+   v3102 := 2;
+   v3103 := 3;
+   v3104 := 4;
+   v3105 := 5;
+   v3106 := 6;
+   v3107 := 7;
+   v3108 := 8;
+   v3109 := 9;
+   v3110 := 0;
+   v3111 := 1;
+   v3112 := 2;
+   v3113 := 3;
+   v3114 := 4;
+   v3115 := 5;
+   v3116 := 6;
+   v3117 := 7;
+   v3118 := 8;
+   v3119 := 9;
+   v3120 := 0;
+   v3121 := 1;
+   v3122 := 2;
+   v3123 := 3;
+   v3124 := 4;
+   v3125 := 5;
+   v3126 := 6;
+   v3127 := 7;
+   v3128 := 8;
+   v3129 := 9;
+   v3130 := 0;
+   v3131 := 1;
+   v3132 := 2;
+   v3133 := 3;
+   v3134 := 4;
+   v3135 := 5;
+   v3136 := 6;
+   v3137 := 7;
+   v3138 := 8;
+   v3139 := 9;
+   v3140 := 0;
+   v3141 := 1;
+   v3142 := 2;
+   v3143 := 3;
+   v3144 := 4;
+   v3145 := 5;
+   v3146 := 6;
+   v3147 := 7;
+   v3148 := 8;
+   v3149 := 9;
+   v3150 := 0;
+   v3151 := 1;
+   v3152 := 2;
+   v3153 := 3;
+   v3154 := 4;
+   v3155 := 5;
+   v3156 := 6;
+   v3157 := 7;
+   v3158 := 8;
+   v3159 := 9;
+   v3160 := 0;
+   v3161 := 1;
+   v3162 := 2;
+   v3163 := 3;
+   v3164 := 4;
+   v3165 := 5;
+   v3166 := 6;
+   v3167 := 7;
+   v3168 := 8;
+   v3169 := 9;
+   v3170 := 0;
+   v3171 := 1;
+   v3172 := 2;
+   v3173 := 3;
+   v3174 := 4;
+   v3175 := 5;
+   v3176 := 6;
+   v3177 := 7;
+   v3178 := 8;
+   v3179 := 9;
+   v3180 := 0;
+   v3181 := 1;
+   v3182 := 2;
+   v3183 := 3;
+   v3184 := 4;
+   v3185 := 5;
+   v3186 := 6;
+   v3187 := 7;
+   v3188 := 8;
+   v3189 := 9;
+   v3190 := 0;
+   v3191 := 1;
+   v3192 := 2;
+   v3193 := 3;
+   v3194 := 4;
+   v3195 := 5;
+   v3196 := 6;
+   v3197 := 7;
+   v3198 := 8;
+   v3199 := 9;
+   v3200 := 0;
+   v3201 := 1;
+   v3202 := 2;
+   v3203 := 3;
+   v3204 := 4;
+   v3205 := 5;
+   v3206 := 6;
+   v3207 := 7;
+   v3208 := 8;
+   v3209 := 9;
+   v3210 := 0;
+   v3211 := 1;
+   v3212 := 2;
+   v3213 := 3;
+   v3214 := 4;
+   v3215 := 5;
+   v3216 := 6;
+   v3217 := 7;
+   v3218 := 8;
+   v3219 := 9;
+   v3220 := 0;
+   v3221 := 1;
+   v3222 := 2;
+   v3223 := 3;
+   v3224 := 4;
+   v3225 := 5;
+   v3226 := 6;
+   v3227 := 7;
+   v3228 := 8;
+   v3229 := 9;
+   v3230 := 0;
+   v3231 := 1;
+   v3232 := 2;
+   v3233 := 3;
+   v3234 := 4;
+   v3235 := 5;
+   v3236 := 6;
+   v3237 := 7;
+   v3238 := 8;
+   v3239 := 9;
+   v3240 := 0;
+   v3241 := 1;
+   v3242 := 2;
+   v3243 := 3;
+   v3244 := 4;
+   v3245 := 5;
+   v3246 := 6;
+   v3247 := 7;
+   v3248 := 8;
+   v3249 := 9;
+   v3250 := 0;
+   v3251 := 1;
+   v3252 := 2;
+   v3253 := 3;
+   v3254 := 4;
+   v3255 := 5;
+   v3256 := 6;
+   v3257 := 7;
+   v3258 := 8;
+   v3259 := 9;
+   v3260 := 0;
+   v3261 := 1;
+   v3262 := 2;
+   v3263 := 3;
+   v3264 := 4;
+   v3265 := 5;
+   v3266 := 6;
+   v3267 := 7;
+   v3268 := 8;
+   v3269 := 9;
+   v3270 := 0;
+   v3271 := 1;
+   v3272 := 2;
+   v3273 := 3;
+   v3274 := 4;
+   v3275 := 5;
+   v3276 := 6;
+   v3277 := 7;
+   v3278 := 8;
+   v3279 := 9;
+   v3280 := 0;
+   v3281 := 1;
+   v3282 := 2;
+   v3283 := 3;
+   v3284 := 4;
+   v3285 := 5;
+   v3286 := 6;
+   v3287 := 7;
+   v3288 := 8;
+   v3289 := 9;
+   v3290 := 0;
+   v3291 := 1;
+   v3292 := 2;
+   v3293 := 3;
+   v3294 := 4;
+   v3295 := 5;
+   v3296 := 6;
+   v3297 := 7;
+   v3298 := 8;
+   v3299 := 9;
+   v3300 := 0;
+   v3301 := 1;
+   v3302 := 2;
+   v3303 := 3;
+   v3304 := 4;
+   v3305 := 5;
+   v3306 := 6;
+   v3307 := 7;
+   v3308 := 8;
+   v3309 := 9;
+   v3310 := 0;
+   v3311 := 1;
+   v3312 := 2;
+   v3313 := 3;
+   v3314 := 4;
+   v3315 := 5;
+   v3316 := 6;
+   v3317 := 7;
+   v3318 := 8;
+   v3319 := 9;
+   v3320 := 0;
+   v3321 := 1;
+   v3322 := 2;
+   v3323 := 3;
+   v3324 := 4;
+   v3325 := 5;
+   v3326 := 6;
+   v3327 := 7;
+   v3328 := 8;
+   v3329 := 9;
+   v3330 := 0;
+   v3331 := 1;
+   v3332 := 2;
+   v3333 := 3;
+   v3334 := 4;
+   v3335 := 5;
+   v3336 := 6;
+   v3337 := 7;
+   v3338 := 8;
+   v3339 := 9;
+   v3340 := 0;
+   v3341 := 1;
+   v3342 := 2;
+   v3343 := 3;
+   v3344 := 4;
+   v3345 := 5;
+   v3346 := 6;
+   v3347 := 7;
+   v3348 := 8;
+   v3349 := 9;
+   v3350 := 0;
+   v3351 := 1;
+   v3352 := 2;
+   v3353 := 3;
+   v3354 := 4;
+   v3355 := 5;
+   v3356 := 6;
+   v3357 := 7;
+   v3358 := 8;
+   v3359 := 9;
+   v3360 := 0;
+   v3361 := 1;
+   v3362 := 2;
+   v3363 := 3;
+   v3364 := 4;
+   v3365 := 5;
+   v3366 := 6;
+   v3367 := 7;
+   v3368 := 8;
+   v3369 := 9;
+   v3370 := 0;
+   v3371 := 1;
+   v3372 := 2;
+   v3373 := 3;
+   v3374 := 4;
+   v3375 := 5;
+   v3376 := 6;
+   v3377 := 7;
+   v3378 := 8;
+   v3379 := 9;
+   v3380 := 0;
+   v3381 := 1;
+   v3382 := 2;
+   v3383 := 3;
+   v3384 := 4;
+   v3385 := 5;
+   v3386 := 6;
+   v3387 := 7;
+   v3388 := 8;
+   v3389 := 9;
+   v3390 := 0;
+   v3391 := 1;
+   v3392 := 2;
+   v3393 := 3;
+   v3394 := 4;
+   v3395 := 5;
+   v3396 := 6;
+   v3397 := 7;
+   v3398 := 8;
+   v3399 := 9;
+   v3400 := 0;
+   v3401 := 1;
+   v3402 := 2;
+   v3403 := 3;
+   v3404 := 4;
+   v3405 := 5;
+   v3406 := 6;
+   v3407 := 7;
+   v3408 := 8;
+   v3409 := 9;
+   v3410 := 0;
+   v3411 := 1;
+   v3412 := 2;
+   v3413 := 3;
+   v3414 := 4;
+   v3415 := 5;
+   v3416 := 6;
+   v3417 := 7;
+   v3418 := 8;
+   v3419 := 9;
+   v3420 := 0;
+   v3421 := 1;
+   v3422 := 2;
+   v3423 := 3;
+   v3424 := 4;
+   v3425 := 5;
+   v3426 := 6;
+   v3427 := 7;
+   v3428 := 8;
+   v3429 := 9;
+   v3430 := 0;
+   v3431 := 1;
+   v3432 := 2;
+   v3433 := 3;
+   v3434 := 4;
+   v3435 := 5;
+   v3436 := 6;
+   v3437 := 7;
+   v3438 := 8;
+   v3439 := 9;
+   v3440 := 0;
+   v3441 := 1;
+   v3442 := 2;
+   v3443 := 3;
+   v3444 := 4;
+   v3445 := 5;
+   v3446 := 6;
+   v3447 := 7;
+   v3448 := 8;
+   v3449 := 9;
+   v3450 := 0;
+   v3451 := 1;
+   v3452 := 2;
+   v3453 := 3;
+   v3454 := 4;
+   v3455 := 5;
+   v3456 := 6;
+   v3457 := 7;
+   v3458 := 8;
+   v3459 := 9;
+   v3460 := 0;
+   v3461 := 1;
+   v3462 := 2;
+   v3463 := 3;
+   v3464 := 4;
+   v3465 := 5;
+   v3466 := 6;
+   v3467 := 7;
+   v3468 := 8;
+   v3469 := 9;
+   v3470 := 0;
+   v3471 := 1;
+   v3472 := 2;
+   v3473 := 3;
+   v3474 := 4;
+   v3475 := 5;
+   v3476 := 6;
+   v3477 := 7;
+   v3478 := 8;
+   v3479 := 9;
+   v3480 := 0;
+   v3481 := 1;
+   v3482 := 2;
+   v3483 := 3;
+   v3484 := 4;
+   v3485 := 5;
+   v3486 := 6;
+   v3487 := 7;
+   v3488 := 8;
+   v3489 := 9;
+   v3490 := 0;
+   v3491 := 1;
+   v3492 := 2;
+   v3493 := 3;
+   v3494 := 4;
+   v3495 := 5;
+   v3496 := 6;
+   v3497 := 7;
+   v3498 := 8;
+   v3499 := 9;
+   v3500 := 0;
+   v3501 := 1;
+   v3502 := 2;
+   v3503 := 3;
+   v3504 := 4;
+   v3505 := 5;
+   v3506 := 6;
+   v3507 := 7;
+   v3508 := 8;
+   v3509 := 9;
+   v3510 := 0;
+   v3511 := 1;
+   v3512 := 2;
+   v3513 := 3;
+   v3514 := 4;
+   v3515 := 5;
+   v3516 := 6;
+   v3517 := 7;
+   v3518 := 8;
+   v3519 := 9;
+   v3520 := 0;
+   v3521 := 1;
+   v3522 := 2;
+   v3523 := 3;
+   v3524 := 4;
+   v3525 := 5;
+   v3526 := 6;
+   v3527 := 7;
+   v3528 := 8;
+   v3529 := 9;
+   v3530 := 0;
+   v3531 := 1;
+   v3532 := 2;
+   v3533 := 3;
+   v3534 := 4;
+   v3535 := 5;
+   v3536 := 6;
+   v3537 := 7;
+   v3538 := 8;
+   v3539 := 9;
+   v3540 := 0;
+   v3541 := 1;
+   v3542 := 2;
+   v3543 := 3;
+   v3544 := 4;
+   v3545 := 5;
+   v3546 := 6;
+   v3547 := 7;
+   v3548 := 8;
+   v3549 := 9;
+   v3550 := 0;
+   v3551 := 1;
+   v3552 := 2;
+   v3553 := 3;
+   v3554 := 4;
+   v3555 := 5;
+   v3556 := 6;
+   v3557 := 7;
+   v3558 := 8;
+   v3559 := 9;
+   v3560 := 0;
+   v3561 := 1;
+   v3562 := 2;
+   v3563 := 3;
+   v3564 := 4;
+   v3565 := 5;
+   v3566 := 6;
+   v3567 := 7;
+   v3568 := 8;
+   v3569 := 9;
+   v3570 := 0;
+   v3571 := 1;
+   v3572 := 2;
+   v3573 := 3;
+   v3574 := 4;
+   v3575 := 5;
+   v3576 := 6;
+   v3577 := 7;
+   v3578 := 8;
+   v3579 := 9;
+   v3580 := 0;
+   v3581 := 1;
+   v3582 := 2;
+   v3583 := 3;
+   v3584 := 4;
+   v3585 := 5;
+   v3586 := 6;
+   v3587 := 7;
+   v3588 := 8;
+   v3589 := 9;
+   v3590 := 0;
+   v3591 := 1;
+   v3592 := 2;
+   v3593 := 3;
+   v3594 := 4;
+   v3595 := 5;
+   v3596 := 6;
+   v3597 := 7;
+   v3598 := 8;
+   v3599 := 9;
+   v3600 := 0;
+   v3601 := 1;
+   v3602 := 2;
+   v3603 := 3;
+   v3604 := 4;
+   v3605 := 5;
+   v3606 := 6;
+   v3607 := 7;
+   v3608 := 8;
+   v3609 := 9;
+   v3610 := 0;
+   v3611 := 1;
+   v3612 := 2;
+   v3613 := 3;
+   v3614 := 4;
+   v3615 := 5;
+   v3616 := 6;
+   v3617 := 7;
+   v3618 := 8;
+   v3619 := 9;
+   v3620 := 0;
+   v3621 := 1;
+   v3622 := 2;
+   v3623 := 3;
+   v3624 := 4;
+   v3625 := 5;
+   v3626 := 6;
+   v3627 := 7;
+   v3628 := 8;
+   v3629 := 9;
+   v3630 := 0;
+   v3631 := 1;
+   v3632 := 2;
+   v3633 := 3;
+   v3634 := 4;
+   v3635 := 5;
+   v3636 := 6;
+   v3637 := 7;
+   v3638 := 8;
+   v3639 := 9;
+   v3640 := 0;
+   v3641 := 1;
+   v3642 := 2;
+   v3643 := 3;
+   v3644 := 4;
+   v3645 := 5;
+   v3646 := 6;
+   v3647 := 7;
+   v3648 := 8;
+   v3649 := 9;
+   v3650 := 0;
+   v3651 := 1;
+   v3652 := 2;
+   v3653 := 3;
+   v3654 := 4;
+   v3655 := 5;
+   v3656 := 6;
+   v3657 := 7;
+   v3658 := 8;
+   v3659 := 9;
+   v3660 := 0;
+   v3661 := 1;
+   v3662 := 2;
+   v3663 := 3;
+   v3664 := 4;
+   v3665 := 5;
+   v3666 := 6;
+   v3667 := 7;
+   v3668 := 8;
+   v3669 := 9;
+   v3670 := 0;
+   v3671 := 1;
+   v3672 := 2;
+   v3673 := 3;
+   v3674 := 4;
+   v3675 := 5;
+   v3676 := 6;
+   v3677 := 7;
+   v3678 := 8;
+   v3679 := 9;
+   v3680 := 0;
+   v3681 := 1;
+   v3682 := 2;
+   v3683 := 3;
+   v3684 := 4;
+   v3685 := 5;
+   v3686 := 6;
+   v3687 := 7;
+   v3688 := 8;
+   v3689 := 9;
+   v3690 := 0;
+   v3691 := 1;
+   v3692 := 2;
+   v3693 := 3;
+   v3694 := 4;
+   v3695 := 5;
+   v3696 := 6;
+   v3697 := 7;
+   v3698 := 8;
+   v3699 := 9;
+   v3700 := 0;
+   v3701 := 1;
+   v3702 := 2;
+   v3703 := 3;
+   v3704 := 4;
+   v3705 := 5;
+   v3706 := 6;
+   v3707 := 7;
+   v3708 := 8;
+   v3709 := 9;
+   v3710 := 0;
+   v3711 := 1;
+   v3712 := 2;
+   v3713 := 3;
+   v3714 := 4;
+   v3715 := 5;
+   v3716 := 6;
+   v3717 := 7;
+   v3718 := 8;
+   v3719 := 9;
+   v3720 := 0;
+   v3721 := 1;
+   v3722 := 2;
+   v3723 := 3;
+   v3724 := 4;
+   v3725 := 5;
+   v3726 := 6;
+   v3727 := 7;
+   v3728 := 8;
+   v3729 := 9;
+   v3730 := 0;
+   v3731 := 1;
+   v3732 := 2;
+   v3733 := 3;
+   v3734 := 4;
+   v3735 := 5;
+   v3736 := 6;
+   v3737 := 7;
+   v3738 := 8;
+   v3739 := 9;
+   v3740 := 0;
+   v3741 := 1;
+   v3742 := 2;
+   v3743 := 3;
+   v3744 := 4;
+   v3745 := 5;
+   v3746 := 6;
+   v3747 := 7;
+   v3748 := 8;
+   v3749 := 9;
+   v3750 := 0;
+   v3751 := 1;
+   v3752 := 2;
+   v3753 := 3;
+   v3754 := 4;
+   v3755 := 5;
+   v3756 := 6;
+   v3757 := 7;
+   v3758 := 8;
+   v3759 := 9;
+   v3760 := 0;
+   v3761 := 1;
+   v3762 := 2;
+   v3763 := 3;
+   v3764 := 4;
+   v3765 := 5;
+   v3766 := 6;
+   v3767 := 7;
+   v3768 := 8;
+   v3769 := 9;
+   v3770 := 0;
+   v3771 := 1;
+   v3772 := 2;
+   v3773 := 3;
+   v3774 := 4;
+   v3775 := 5;
+   v3776 := 6;
+   v3777 := 7;
+   v3778 := 8;
+   v3779 := 9;
+   v3780 := 0;
+   v3781 := 1;
+   v3782 := 2;
+   v3783 := 3;
+   v3784 := 4;
+   v3785 := 5;
+   v3786 := 6;
+   v3787 := 7;
+   v3788 := 8;
+   v3789 := 9;
+   v3790 := 0;
+   v3791 := 1;
+   v3792 := 2;
+   v3793 := 3;
+   v3794 := 4;
+   v3795 := 5;
+   v3796 := 6;
+   v3797 := 7;
+   v3798 := 8;
+   v3799 := 9;
+   v3800 := 0;
+   v3801 := 1;
+   v3802 := 2;
+   v3803 := 3;
+   v3804 := 4;
+   v3805 := 5;
+   v3806 := 6;
+   v3807 := 7;
+   v3808 := 8;
+   v3809 := 9;
+   v3810 := 0;
+   v3811 := 1;
+   v3812 := 2;
+   v3813 := 3;
+   v3814 := 4;
+   v3815 := 5;
+   v3816 := 6;
+   v3817 := 7;
+   v3818 := 8;
+   v3819 := 9;
+   v3820 := 0;
+   v3821 := 1;
+   v3822 := 2;
+   v3823 := 3;
+   v3824 := 4;
+   v3825 := 5;
+   v3826 := 6;
+   v3827 := 7;
+   v3828 := 8;
+   v3829 := 9;
+   v3830 := 0;
+   v3831 := 1;
+   v3832 := 2;
+   v3833 := 3;
+   v3834 := 4;
+   v3835 := 5;
+   v3836 := 6;
+   v3837 := 7;
+   v3838 := 8;
+   v3839 := 9;
+   v3840 := 0;
+   v3841 := 1;
+   v3842 := 2;
+   v3843 := 3;
+   v3844 := 4;
+   v3845 := 5;
+   v3846 := 6;
+   v3847 := 7;
+   v3848 := 8;
+   v3849 := 9;
+   v3850 := 0;
+   v3851 := 1;
+   v3852 := 2;
+   v3853 := 3;
+   v3854 := 4;
+   v3855 := 5;
+   v3856 := 6;
+   v3857 := 7;
+   v3858 := 8;
+   v3859 := 9;
+   v3860 := 0;
+   v3861 := 1;
+   v3862 := 2;
+   v3863 := 3;
+   v3864 := 4;
+   v3865 := 5;
+   v3866 := 6;
+   v3867 := 7;
+   v3868 := 8;
+   v3869 := 9;
+   v3870 := 0;
+   v3871 := 1;
+   v3872 := 2;
+   v3873 := 3;
+   v3874 := 4;
+   v3875 := 5;
+   v3876 := 6;
+   v3877 := 7;
+   v3878 := 8;
+   v3879 := 9;
+   v3880 := 0;
+   v3881 := 1;
+   v3882 := 2;
+   v3883 := 3;
+   v3884 := 4;
+   v3885 := 5;
+   v3886 := 6;
+   v3887 := 7;
+   v3888 := 8;
+   v3889 := 9;
+   v3890 := 0;
+   v3891 := 1;
+   v3892 := 2;
+   v3893 := 3;
+   v3894 := 4;
+   v3895 := 5;
+   v3896 := 6;
+   v3897 := 7;
+   v3898 := 8;
+   v3899 := 9;
+   v3900 := 0;
+   v3901 := 1;
+   v3902 := 2;
+   v3903 := 3;
+   v3904 := 4;
+   v3905 := 5;
+   v3906 := 6;
+   v3907 := 7;
+   v3908 := 8;
+   v3909 := 9;
+   v3910 := 0;
+   v3911 := 1;
+   v3912 := 2;
+   v3913 := 3;
+   v3914 := 4;
+   v3915 := 5;
+   v3916 := 6;
+   v3917 := 7;
+   v3918 := 8;
+   v3919 := 9;
+   v3920 := 0;
+   v3921 := 1;
+   v3922 := 2;
+   v3923 := 3;
+   v3924 := 4;
+   v3925 := 5;
+   v3926 := 6;
+   v3927 := 7;
+   v3928 := 8;
+   v3929 := 9;
+   v3930 := 0;
+   v3931 := 1;
+   v3932 := 2;
+   v3933 := 3;
+   v3934 := 4;
+   v3935 := 5;
+   v3936 := 6;
+   v3937 := 7;
+   v3938 := 8;
+   v3939 := 9;
+   v3940 := 0;
+   v3941 := 1;
+   v3942 := 2;
+   v3943 := 3;
+   v3944 := 4;
+   v3945 := 5;
+   v3946 := 6;
+   v3947 := 7;
+   v3948 := 8;
+   v3949 := 9;
+   v3950 := 0;
+   v3951 := 1;
+   v3952 := 2;
+   v3953 := 3;
+   v3954 := 4;
+   v3955 := 5;
+   v3956 := 6;
+   v3957 := 7;
+   v3958 := 8;
+   v3959 := 9;
+   v3960 := 0;
+   v3961 := 1;
+   v3962 := 2;
+   v3963 := 3;
+   v3964 := 4;
+   v3965 := 5;
+   v3966 := 6;
+   v3967 := 7;
+   v3968 := 8;
+   v3969 := 9;
+   v3970 := 0;
+   v3971 := 1;
+   v3972 := 2;
+   v3973 := 3;
+   v3974 := 4;
+   v3975 := 5;
+   v3976 := 6;
+   v3977 := 7;
+   v3978 := 8;
+   v3979 := 9;
+   v3980 := 0;
+   v3981 := 1;
+   v3982 := 2;
+   v3983 := 3;
+   v3984 := 4;
+   v3985 := 5;
+   v3986 := 6;
+   v3987 := 7;
+   v3988 := 8;
+   v3989 := 9;
+   v3990 := 0;
+   v3991 := 1;
+   v3992 := 2;
+   v3993 := 3;
+   v3994 := 4;
+   v3995 := 5;
+   v3996 := 6;
+   v3997 := 7;
+   v3998 := 8;
+   v3999 := 9;
+   v4000 := 0;
+   v4001 := 1;
+   v4002 := 2;
+   v4003 := 3;
+   v4004 := 4;
+   v4005 := 5;
+   v4006 := 6;
+   v4007 := 7;
+   v4008 := 8;
+   v4009 := 9;
+   v4010 := 0;
+   v4011 := 1;
+   v4012 := 2;
+   v4013 := 3;
+   v4014 := 4;
+   v4015 := 5;
+   v4016 := 6;
+   v4017 := 7;
+   v4018 := 8;
+   v4019 := 9;
+   v4020 := 0;
+   v4021 := 1;
+   v4022 := 2;
+   v4023 := 3;
+   v4024 := 4;
+   v4025 := 5;
+   v4026 := 6;
+   v4027 := 7;
+   v4028 := 8;
+   v4029 := 9;
+   v4030 := 0;
+   v4031 := 1;
+   v4032 := 2;
+   v4033 := 3;
+   v4034 := 4;
+   v4035 := 5;
+   v4036 := 6;
+   v4037 := 7;
+   v4038 := 8;
+   v4039 := 9;
+   v4040 := 0;
+   v4041 := 1;
+   v4042 := 2;
+   v4043 := 3;
+   v4044 := 4;
+   v4045 := 5;
+   v4046 := 6;
+   v4047 := 7;
+   v4048 := 8;
+   v4049 := 9;
+   v4050 := 0;
+   v4051 := 1;
+   v4052 := 2;
+   v4053 := 3;
+   v4054 := 4;
+   v4055 := 5;
+   v4056 := 6;
+   v4057 := 7;
+   v4058 := 8;
+   v4059 := 9;
+   v4060 := 0;
+   v4061 := 1;
+   v4062 := 2;
+   v4063 := 3;
+   v4064 := 4;
+   v4065 := 5;
+   v4066 := 6;
+   v4067 := 7;
+   v4068 := 8;
+   v4069 := 9;
+   v4070 := 0;
+   v4071 := 1;
+   v4072 := 2;
+   v4073 := 3;
+   v4074 := 4;
+   v4075 := 5;
+   v4076 := 6;
+   v4077 := 7;
+   v4078 := 8;
+   v4079 := 9;
+   v4080 := 0;
+   v4081 := 1;
+   v4082 := 2;
+   v4083 := 3;
+   v4084 := 4;
+   v4085 := 5;
+   v4086 := 6;
+   v4087 := 7;
+   v4088 := 8;
+   v4089 := 9;
+   v4090 := 0;
+   v4091 := 1;
+   v4092 := 2;
+   v4093 := 3;
+   v4094 := 4;
+   v4095 := 5;
+   v4096 := 6;
+   v4097 := 7;
+   v4098 := 8;
+   v4099 := 9;
+   v4100 := 0;
+   v4101 := 1;
+   v4102 := 2;
+   v4103 := 3;
+   v4104 := 4;
+   v4105 := 5;
+   v4106 := 6;
+   v4107 := 7;
+   v4108 := 8;
+   v4109 := 9;
+   v4110 := 0;
+   v4111 := 1;
+   v4112 := 2;
+   v4113 := 3;
+   v4114 := 4;
+   v4115 := 5;
+   v4116 := 6;
+   v4117 := 7;
+   v4118 := 8;
+   v4119 := 9;
+   v4120 := 0;
+   v4121 := 1;
+   v4122 := 2;
+   v4123 := 3;
+   v4124 := 4;
+   v4125 := 5;
+   v4126 := 6;
+   v4127 := 7;
+   v4128 := 8;
+   v4129 := 9;
+   v4130 := 0;
+   v4131 := 1;
+   v4132 := 2;
+   v4133 := 3;
+   v4134 := 4;
+   v4135 := 5;
+   v4136 := 6;
+   v4137 := 7;
+   v4138 := 8;
+   v4139 := 9;
+   v4140 := 0;
+   v4141 := 1;
+   v4142 := 2;
+   v4143 := 3;
+   v4144 := 4;
+   v4145 := 5;
+   v4146 := 6;
+   v4147 := 7;
+   v4148 := 8;
+   v4149 := 9;
+   v4150 := 0;
+   v4151 := 1;
+   v4152 := 2;
+   v4153 := 3;
+   v4154 := 4;
+   v4155 := 5;
+   v4156 := 6;
+   v4157 := 7;
+   v4158 := 8;
+   v4159 := 9;
+   v4160 := 0;
+   v4161 := 1;
+   v4162 := 2;
+   v4163 := 3;
+   v4164 := 4;
+   v4165 := 5;
+   v4166 := 6;
+   v4167 := 7;
+   v4168 := 8;
+   v4169 := 9;
+   v4170 := 0;
+   v4171 := 1;
+   v4172 := 2;
+   v4173 := 3;
+   v4174 := 4;
+   v4175 := 5;
+   v4176 := 6;
+   v4177 := 7;
+   v4178 := 8;
+   v4179 := 9;
+   v4180 := 0;
+   v4181 := 1;
+   v4182 := 2;
+   v4183 := 3;
+   v4184 := 4;
+   v4185 := 5;
+   v4186 := 6;
+   v4187 := 7;
+   v4188 := 8;
+   v4189 := 9;
+   v4190 := 0;
+   v4191 := 1;
+   v4192 := 2;
+   v4193 := 3;
+   v4194 := 4;
+   v4195 := 5;
+   v4196 := 6;
+   v4197 := 7;
+   v4198 := 8;
+   v4199 := 9;
+   v4200 := 0;
+   v4201 := 1;
+   v4202 := 2;
+   v4203 := 3;
+   v4204 := 4;
+   v4205 := 5;
+   v4206 := 6;
+   v4207 := 7;
+   v4208 := 8;
+   v4209 := 9;
+   v4210 := 0;
+   v4211 := 1;
+   v4212 := 2;
+   v4213 := 3;
+   v4214 := 4;
+   v4215 := 5;
+   v4216 := 6;
+   v4217 := 7;
+   v4218 := 8;
+   v4219 := 9;
+   v4220 := 0;
+   v4221 := 1;
+   v4222 := 2;
+   v4223 := 3;
+   v4224 := 4;
+   v4225 := 5;
+   v4226 := 6;
+   v4227 := 7;
+   v4228 := 8;
+   v4229 := 9;
+   v4230 := 0;
+   v4231 := 1;
+   v4232 := 2;
+   v4233 := 3;
+   v4234 := 4;
+   v4235 := 5;
+   v4236 := 6;
+   v4237 := 7;
+   v4238 := 8;
+   v4239 := 9;
+   v4240 := 0;
+   v4241 := 1;
+   v4242 := 2;
+   v4243 := 3;
+   v4244 := 4;
+   v4245 := 5;
+   v4246 := 6;
+   v4247 := 7;
+   v4248 := 8;
+   v4249 := 9;
+   v4250 := 0;
+   v4251 := 1;
+   v4252 := 2;
+   v4253 := 3;
+   v4254 := 4;
+   v4255 := 5;
+   v4256 := 6;
+   v4257 := 7;
+   v4258 := 8;
+   v4259 := 9;
+   v4260 := 0;
+   v4261 := 1;
+   v4262 := 2;
+   v4263 := 3;
+   v4264 := 4;
+   v4265 := 5;
+   v4266 := 6;
+   v4267 := 7;
+   v4268 := 8;
+   v4269 := 9;
+   v4270 := 0;
+   v4271 := 1;
+   v4272 := 2;
+   v4273 := 3;
+   v4274 := 4;
+   v4275 := 5;
+   v4276 := 6;
+   v4277 := 7;
+   v4278 := 8;
+   v4279 := 9;
+   v4280 := 0;
+   v4281 := 1;
+   v4282 := 2;
+   v4283 := 3;
+   v4284 := 4;
+   v4285 := 5;
+   v4286 := 6;
+   v4287 := 7;
+   v4288 := 8;
+   v4289 := 9;
+   v4290 := 0;
+   v4291 := 1;
+   v4292 := 2;
+   v4293 := 3;
+   v4294 := 4;
+   v4295 := 5;
+   v4296 := 6;
+   v4297 := 7;
+   v4298 := 8;
+   v4299 := 9;
+   v4300 := 0;
+   v4301 := 1;
+   v4302 := 2;
+   v4303 := 3;
+   v4304 := 4;
+   v4305 := 5;
+   v4306 := 6;
+   v4307 := 7;
+   v4308 := 8;
+   v4309 := 9;
+   v4310 := 0;
+   v4311 := 1;
+   v4312 := 2;
+   v4313 := 3;
+   v4314 := 4;
+   v4315 := 5;
+   v4316 := 6;
+   v4317 := 7;
+   v4318 := 8;
+   v4319 := 9;
+   v4320 := 0;
+   v4321 := 1;
+   v4322 := 2;
+   v4323 := 3;
+   v4324 := 4;
+   v4325 := 5;
+   v4326 := 6;
+   v4327 := 7;
+   v4328 := 8;
+   v4329 := 9;
+   v4330 := 0;
+   v4331 := 1;
+   v4332 := 2;
+   v4333 := 3;
+   v4334 := 4;
+   v4335 := 5;
+   v4336 := 6;
+   v4337 := 7;
+   v4338 := 8;
+   v4339 := 9;
+   v4340 := 0;
+   v4341 := 1;
+   v4342 := 2;
+   v4343 := 3;
+   v4344 := 4;
+   v4345 := 5;
+   v4346 := 6;
+   v4347 := 7;
+   v4348 := 8;
+   v4349 := 9;
+   v4350 := 0;
+   v4351 := 1;
+   v4352 := 2;
+   v4353 := 3;
+   v4354 := 4;
+   v4355 := 5;
+   v4356 := 6;
+   v4357 := 7;
+   v4358 := 8;
+   v4359 := 9;
+   v4360 := 0;
+   v4361 := 1;
+   v4362 := 2;
+   v4363 := 3;
+   v4364 := 4;
+   v4365 := 5;
+   v4366 := 6;
+   v4367 := 7;
+   v4368 := 8;
+   v4369 := 9;
+   v4370 := 0;
+   v4371 := 1;
+   v4372 := 2;
+   v4373 := 3;
+   v4374 := 4;
+   v4375 := 5;
+   v4376 := 6;
+   v4377 := 7;
+   v4378 := 8;
+   v4379 := 9;
+   v4380 := 0;
+   v4381 := 1;
+   v4382 := 2;
+   v4383 := 3;
+   v4384 := 4;
+   v4385 := 5;
+   v4386 := 6;
+   v4387 := 7;
+   v4388 := 8;
+   v4389 := 9;
+   v4390 := 0;
+   v4391 := 1;
+   v4392 := 2;
+   v4393 := 3;
+   v4394 := 4;
+   v4395 := 5;
+   v4396 := 6;
+   v4397 := 7;
+   v4398 := 8;
+   v4399 := 9;
+   v4400 := 0;
+   v4401 := 1;
+   v4402 := 2;
+   v4403 := 3;
+   v4404 := 4;
+   v4405 := 5;
+   v4406 := 6;
+   v4407 := 7;
+   v4408 := 8;
+   v4409 := 9;
+   v4410 := 0;
+   v4411 := 1;
+   v4412 := 2;
+   v4413 := 3;
+   v4414 := 4;
+   v4415 := 5;
+   v4416 := 6;
+   v4417 := 7;
+   v4418 := 8;
+   v4419 := 9;
+   v4420 := 0;
+   v4421 := 1;
+   v4422 := 2;
+   v4423 := 3;
+   v4424 := 4;
+   v4425 := 5;
+   v4426 := 6;
+   v4427 := 7;
+   v4428 := 8;
+   v4429 := 9;
+   v4430 := 0;
+   v4431 := 1;
+   v4432 := 2;
+   v4433 := 3;
+   v4434 := 4;
+   v4435 := 5;
+   v4436 := 6;
+   v4437 := 7;
+   v4438 := 8;
+   v4439 := 9;
+   v4440 := 0;
+   v4441 := 1;
+   v4442 := 2;
+   v4443 := 3;
+   v4444 := 4;
+   v4445 := 5;
+   v4446 := 6;
+   v4447 := 7;
+   v4448 := 8;
+   v4449 := 9;
+   v4450 := 0;
+   v4451 := 1;
+   v4452 := 2;
+   v4453 := 3;
+   v4454 := 4;
+   v4455 := 5;
+   v4456 := 6;
+   v4457 := 7;
+   v4458 := 8;
+   v4459 := 9;
+   v4460 := 0;
+   v4461 := 1;
+   v4462 := 2;
+   v4463 := 3;
+   v4464 := 4;
+   v4465 := 5;
+   v4466 := 6;
+   v4467 := 7;
+   v4468 := 8;
+   v4469 := 9;
+   v4470 := 0;
+   v4471 := 1;
+   v4472 := 2;
+   v4473 := 3;
+   v4474 := 4;
+   v4475 := 5;
+   v4476 := 6;
+   v4477 := 7;
+   v4478 := 8;
+   v4479 := 9;
+   v4480 := 0;
+   v4481 := 1;
+   v4482 := 2;
+   v4483 := 3;
+   v4484 := 4;
+   v4485 := 5;
+   v4486 := 6;
+   v4487 := 7;
+   v4488 := 8;
+   v4489 := 9;
+   v4490 := 0;
+   v4491 := 1;
+   v4492 := 2;
+   v4493 := 3;
+   v4494 := 4;
+   v4495 := 5;
+   v4496 := 6;
+   v4497 := 7;
+   v4498 := 8;
+   v4499 := 9;
+   v4500 := 0;
+   v4501 := 1;
+   v4502 := 2;
+   v4503 := 3;
+   v4504 := 4;
+   v4505 := 5;
+   v4506 := 6;
+   v4507 := 7;
+   v4508 := 8;
+   v4509 := 9;
+   v4510 := 0;
+   v4511 := 1;
+   v4512 := 2;
+   v4513 := 3;
+   v4514 := 4;
+   v4515 := 5;
+   v4516 := 6;
+   v4517 := 7;
+   v4518 := 8;
+   v4519 := 9;
+   v4520 := 0;
+   v4521 := 1;
+   v4522 := 2;
+   v4523 := 3;
+   v4524 := 4;
+   v4525 := 5;
+   v4526 := 6;
+   v4527 := 7;
+   v4528 := 8;
+   v4529 := 9;
+   v4530 := 0;
+   v4531 := 1;
+   v4532 := 2;
+   v4533 := 3;
+   v4534 := 4;
+   v4535 := 5;
+   v4536 := 6;
+   v4537 := 7;
+   v4538 := 8;
+   v4539 := 9;
+   v4540 := 0;
+   v4541 := 1;
+   v4542 := 2;
+   v4543 := 3;
+   v4544 := 4;
+   v4545 := 5;
+   v4546 := 6;
+   v4547 := 7;
+   v4548 := 8;
+   v4549 := 9;
+   v4550 := 0;
+   v4551 := 1;
+   v4552 := 2;
+   v4553 := 3;
+   v4554 := 4;
+   v4555 := 5;
+   v4556 := 6;
+   v4557 := 7;
+   v4558 := 8;
+   v4559 := 9;
+   v4560 := 0;
+   v4561 := 1;
+   v4562 := 2;
+   v4563 := 3;
+   v4564 := 4;
+   v4565 := 5;
+   v4566 := 6;
+   v4567 := 7;
+   v4568 := 8;
+   v4569 := 9;
+   v4570 := 0;
+   v4571 := 1;
+   v4572 := 2;
+   v4573 := 3;
+   v4574 := 4;
+   v4575 := 5;
+   v4576 := 6;
+   v4577 := 7;
+   v4578 := 8;
+   v4579 := 9;
+   v4580 := 0;
+   v4581 := 1;
+   v4582 := 2;
+   v4583 := 3;
+   v4584 := 4;
+   v4585 := 5;
+   v4586 := 6;
+   v4587 := 7;
+   v4588 := 8;
+   v4589 := 9;
+   v4590 := 0;
+   v4591 := 1;
+   v4592 := 2;
+   v4593 := 3;
+   v4594 := 4;
+   v4595 := 5;
+   v4596 := 6;
+   v4597 := 7;
+   v4598 := 8;
+   v4599 := 9;
+   v4600 := 0;
+   v4601 := 1;
+   v4602 := 2;
+   v4603 := 3;
+   v4604 := 4;
+   v4605 := 5;
+   v4606 := 6;
+   v4607 := 7;
+   v4608 := 8;
+   v4609 := 9;
+   v4610 := 0;
+   v4611 := 1;
+   v4612 := 2;
+   v4613 := 3;
+   v4614 := 4;
+   v4615 := 5;
+   v4616 := 6;
+   v4617 := 7;
+   v4618 := 8;
+   v4619 := 9;
+   v4620 := 0;
+   v4621 := 1;
+   v4622 := 2;
+   v4623 := 3;
+   v4624 := 4;
+   v4625 := 5;
+   v4626 := 6;
+   v4627 := 7;
+   v4628 := 8;
+   v4629 := 9;
+   v4630 := 0;
+   v4631 := 1;
+   v4632 := 2;
+   v4633 := 3;
+   v4634 := 4;
+   v4635 := 5;
+   v4636 := 6;
+   v4637 := 7;
+   v4638 := 8;
+   v4639 := 9;
+   v4640 := 0;
+   v4641 := 1;
+   v4642 := 2;
+   v4643 := 3;
+   v4644 := 4;
+   v4645 := 5;
+   v4646 := 6;
+   v4647 := 7;
+   v4648 := 8;
+   v4649 := 9;
+   v4650 := 0;
+   v4651 := 1;
+   v4652 := 2;
+   v4653 := 3;
+   v4654 := 4;
+   v4655 := 5;
+   v4656 := 6;
+   v4657 := 7;
+   v4658 := 8;
+   v4659 := 9;
+   v4660 := 0;
+   v4661 := 1;
+   v4662 := 2;
+   v4663 := 3;
+   v4664 := 4;
+   v4665 := 5;
+   v4666 := 6;
+   v4667 := 7;
+   v4668 := 8;
+   v4669 := 9;
+   v4670 := 0;
+   v4671 := 1;
+   v4672 := 2;
+   v4673 := 3;
+   v4674 := 4;
+   v4675 := 5;
+   v4676 := 6;
+   v4677 := 7;
+   v4678 := 8;
+   v4679 := 9;
+   v4680 := 0;
+   v4681 := 1;
+   v4682 := 2;
+   v4683 := 3;
+   v4684 := 4;
+   v4685 := 5;
+   v4686 := 6;
+   v4687 := 7;
+   v4688 := 8;
+   v4689 := 9;
+   v4690 := 0;
+   v4691 := 1;
+   v4692 := 2;
+   v4693 := 3;
+   v4694 := 4;
+   v4695 := 5;
+   v4696 := 6;
+   v4697 := 7;
+   v4698 := 8;
+   v4699 := 9;
+   v4700 := 0;
+   v4701 := 1;
+   v4702 := 2;
+   v4703 := 3;
+   v4704 := 4;
+   v4705 := 5;
+   v4706 := 6;
+   v4707 := 7;
+   v4708 := 8;
+   v4709 := 9;
+   v4710 := 0;
+   v4711 := 1;
+   v4712 := 2;
+   v4713 := 3;
+   v4714 := 4;
+   v4715 := 5;
+   v4716 := 6;
+   v4717 := 7;
+   v4718 := 8;
+   v4719 := 9;
+   v4720 := 0;
+   v4721 := 1;
+   v4722 := 2;
+   v4723 := 3;
+   v4724 := 4;
+   v4725 := 5;
+   v4726 := 6;
+   v4727 := 7;
+   v4728 := 8;
+   v4729 := 9;
+   v4730 := 0;
+   v4731 := 1;
+   v4732 := 2;
+   v4733 := 3;
+   v4734 := 4;
+   v4735 := 5;
+   v4736 := 6;
+   v4737 := 7;
+   v4738 := 8;
+   v4739 := 9;
+   v4740 := 0;
+   v4741 := 1;
+   v4742 := 2;
+   v4743 := 3;
+   v4744 := 4;
+   v4745 := 5;
+   v4746 := 6;
+   v4747 := 7;
+   v4748 := 8;
+   v4749 := 9;
+   v4750 := 0;
+   v4751 := 1;
+   v4752 := 2;
+   v4753 := 3;
+   v4754 := 4;
+   v4755 := 5;
+   v4756 := 6;
+   v4757 := 7;
+   v4758 := 8;
+   v4759 := 9;
+   v4760 := 0;
+   v4761 := 1;
+   v4762 := 2;
+   v4763 := 3;
+   v4764 := 4;
+   v4765 := 5;
+   v4766 := 6;
+   v4767 := 7;
+   v4768 := 8;
+   v4769 := 9;
+   v4770 := 0;
+   v4771 := 1;
+   v4772 := 2;
+   v4773 := 3;
+   v4774 := 4;
+   v4775 := 5;
+   v4776 := 6;
+   v4777 := 7;
+   v4778 := 8;
+   v4779 := 9;
+   v4780 := 0;
+   v4781 := 1;
+   v4782 := 2;
+   v4783 := 3;
+   v4784 := 4;
+   v4785 := 5;
+   v4786 := 6;
+   v4787 := 7;
+   v4788 := 8;
+   v4789 := 9;
+   v4790 := 0;
+   v4791 := 1;
+   v4792 := 2;
+   v4793 := 3;
+   v4794 := 4;
+   v4795 := 5;
+   v4796 := 6;
+   v4797 := 7;
+   v4798 := 8;
+   v4799 := 9;
+   v4800 := 0;
+   v4801 := 1;
+   v4802 := 2;
+   v4803 := 3;
+   v4804 := 4;
+   v4805 := 5;
+   v4806 := 6;
+   v4807 := 7;
+   v4808 := 8;
+   v4809 := 9;
+   v4810 := 0;
+   v4811 := 1;
+   v4812 := 2;
+   v4813 := 3;
+   v4814 := 4;
+   v4815 := 5;
+   v4816 := 6;
+   v4817 := 7;
+   v4818 := 8;
+   v4819 := 9;
+   v4820 := 0;
+   v4821 := 1;
+   v4822 := 2;
+   v4823 := 3;
+   v4824 := 4;
+   v4825 := 5;
+   v4826 := 6;
+   v4827 := 7;
+   v4828 := 8;
+   v4829 := 9;
+   v4830 := 0;
+   v4831 := 1;
+   v4832 := 2;
+   v4833 := 3;
+   v4834 := 4;
+   v4835 := 5;
+   v4836 := 6;
+   v4837 := 7;
+   v4838 := 8;
+   v4839 := 9;
+   v4840 := 0;
+   v4841 := 1;
+   v4842 := 2;
+   v4843 := 3;
+   v4844 := 4;
+   v4845 := 5;
+   v4846 := 6;
+   v4847 := 7;
+   v4848 := 8;
+   v4849 := 9;
+   v4850 := 0;
+   v4851 := 1;
+   v4852 := 2;
+   v4853 := 3;
+   v4854 := 4;
+   v4855 := 5;
+   v4856 := 6;
+   v4857 := 7;
+   v4858 := 8;
+   v4859 := 9;
+   v4860 := 0;
+   v4861 := 1;
+   v4862 := 2;
+   v4863 := 3;
+   v4864 := 4;
+   v4865 := 5;
+   v4866 := 6;
+   v4867 := 7;
+   v4868 := 8;
+   v4869 := 9;
+   v4870 := 0;
+   v4871 := 1;
+   v4872 := 2;
+   v4873 := 3;
+   v4874 := 4;
+   v4875 := 5;
+   v4876 := 6;
+   v4877 := 7;
+   v4878 := 8;
+   v4879 := 9;
+   v4880 := 0;
+   v4881 := 1;
+   v4882 := 2;
+   v4883 := 3;
+   v4884 := 4;
+   v4885 := 5;
+   v4886 := 6;
+   v4887 := 7;
+   v4888 := 8;
+   v4889 := 9;
+   v4890 := 0;
+   v4891 := 1;
+   v4892 := 2;
+   v4893 := 3;
+   v4894 := 4;
+   v4895 := 5;
+   v4896 := 6;
+   v4897 := 7;
+   v4898 := 8;
+   v4899 := 9;
+   v4900 := 0;
+   v4901 := 1;
+   v4902 := 2;
+   v4903 := 3;
+   v4904 := 4;
+   v4905 := 5;
+   v4906 := 6;
+   v4907 := 7;
+   v4908 := 8;
+   v4909 := 9;
+   v4910 := 0;
+   v4911 := 1;
+   v4912 := 2;
+   v4913 := 3;
+   v4914 := 4;
+   v4915 := 5;
+   v4916 := 6;
+   v4917 := 7;
+   v4918 := 8;
+   v4919 := 9;
+   v4920 := 0;
+   v4921 := 1;
+   v4922 := 2;
+   v4923 := 3;
+   v4924 := 4;
+   v4925 := 5;
+   v4926 := 6;
+   v4927 := 7;
+   v4928 := 8;
+   v4929 := 9;
+   v4930 := 0;
+   v4931 := 1;
+   v4932 := 2;
+   v4933 := 3;
+   v4934 := 4;
+   v4935 := 5;
+   v4936 := 6;
+   v4937 := 7;
+   v4938 := 8;
+   v4939 := 9;
+   v4940 := 0;
+   v4941 := 1;
+   v4942 := 2;
+   v4943 := 3;
+   v4944 := 4;
+   v4945 := 5;
+   v4946 := 6;
+   v4947 := 7;
+   v4948 := 8;
+   v4949 := 9;
+   v4950 := 0;
+   v4951 := 1;
+   v4952 := 2;
+   v4953 := 3;
+   v4954 := 4;
+   v4955 := 5;
+   v4956 := 6;
+   v4957 := 7;
+   v4958 := 8;
+   v4959 := 9;
+   v4960 := 0;
+   v4961 := 1;
+   v4962 := 2;
+   v4963 := 3;
+   v4964 := 4;
+   v4965 := 5;
+   v4966 := 6;
+   v4967 := 7;
+   v4968 := 8;
+   v4969 := 9;
+   v4970 := 0;
+   v4971 := 1;
+   v4972 := 2;
+   v4973 := 3;
+   v4974 := 4;
+   v4975 := 5;
+   v4976 := 6;
+   v4977 := 7;
+   v4978 := 8;
+   v4979 := 9;
+   v4980 := 0;
+   v4981 := 1;
+   v4982 := 2;
+   v4983 := 3;
+   v4984 := 4;
+   v4985 := 5;
+   v4986 := 6;
+   v4987 := 7;
+   v4988 := 8;
+   v4989 := 9;
+   v4990 := 0;
+   v4991 := 1;
+   v4992 := 2;
+   v4993 := 3;
+   v4994 := 4;
+   v4995 := 5;
+   v4996 := 6;
+   v4997 := 7;
+   v4998 := 8;
+   v4999 := 9;
+   v5000 := 0;
+   v5001 := 1;
+   v5002 := 2;
+   v5003 := 3;
+   v5004 := 4;
+   v5005 := 5;
+   v5006 := 6;
+   v5007 := 7;
+   v5008 := 8;
+   v5009 := 9;
+   v5010 := 0;
+   v5011 := 1;
+   v5012 := 2;
+   v5013 := 3;
+   v5014 := 4;
+   v5015 := 5;
+   v5016 := 6;
+   v5017 := 7;
+   v5018 := 8;
+   v5019 := 9;
+   v5020 := 0;
+   v5021 := 1;
+   v5022 := 2;
+   v5023 := 3;
+   v5024 := 4;
+   v5025 := 5;
+   v5026 := 6;
+   v5027 := 7;
+   v5028 := 8;
+   v5029 := 9;
+   v5030 := 0;
+   v5031 := 1;
+   v5032 := 2;
+   v5033 := 3;
+   v5034 := 4;
+   v5035 := 5;
+   v5036 := 6;
+   v5037 := 7;
+   v5038 := 8;
+   v5039 := 9;
+   v5040 := 0;
+   v5041 := 1;
+   v5042 := 2;
+   v5043 := 3;
+   v5044 := 4;
+   v5045 := 5;
+   v5046 := 6;
+   v5047 := 7;
+   v5048 := 8;
+   v5049 := 9;
+   v5050 := 0;
+   v5051 := 1;
+   v5052 := 2;
+   v5053 := 3;
+   v5054 := 4;
+   v5055 := 5;
+   v5056 := 6;
+   v5057 := 7;
+   v5058 := 8;
+   v5059 := 9;
+   v5060 := 0;
+   v5061 := 1;
+   v5062 := 2;
+   v5063 := 3;
+   v5064 := 4;
+   v5065 := 5;
+   v5066 := 6;
+   v5067 := 7;
+   v5068 := 8;
+   v5069 := 9;
+   v5070 := 0;
+   v5071 := 1;
+   v5072 := 2;
+   v5073 := 3;
+   v5074 := 4;
+   v5075 := 5;
+   v5076 := 6;
+   v5077 := 7;
+   v5078 := 8;
+   v5079 := 9;
+   v5080 := 0;
+   v5081 := 1;
+   v5082 := 2;
+   v5083 := 3;
+   v5084 := 4;
+   v5085 := 5;
+   v5086 := 6;
+   v5087 := 7;
+   v5088 := 8;
+   v5089 := 9;
+   v5090 := 0;
+   v5091 := 1;
+   v5092 := 2;
+   v5093 := 3;
+   v5094 := 4;
+   v5095 := 5;
+   v5096 := 6;
+   v5097 := 7;
+   v5098 := 8;
+   v5099 := 9;
+   v5100 := 0;
+   v5101 := 1;
+   v5102 := 2;
+   v5103 := 3;
+   v5104 := 4;
+   v5105 := 5;
+   v5106 := 6;
+   v5107 := 7;
+   v5108 := 8;
+   v5109 := 9;
+   v5110 := 0;
+   v5111 := 1;
+   v5112 := 2;
+   v5113 := 3;
+   v5114 := 4;
+   v5115 := 5;
+   v5116 := 6;
+   v5117 := 7;
+   v5118 := 8;
+   v5119 := 9;
+   v5120 := 0;
+   v5121 := 1;
+   v5122 := 2;
+   v5123 := 3;
+   v5124 := 4;
+   v5125 := 5;
+   v5126 := 6;
+   v5127 := 7;
+   v5128 := 8;
+   v5129 := 9;
+   v5130 := 0;
+   v5131 := 1;
+   v5132 := 2;
+   v5133 := 3;
+   v5134 := 4;
+   v5135 := 5;
+   v5136 := 6;
+   v5137 := 7;
+   v5138 := 8;
+   v5139 := 9;
+   v5140 := 0;
+   v5141 := 1;
+   v5142 := 2;
+   v5143 := 3;
+   v5144 := 4;
+   v5145 := 5;
+   v5146 := 6;
+   v5147 := 7;
+   v5148 := 8;
+   v5149 := 9;
+   v5150 := 0;
+   v5151 := 1;
+   v5152 := 2;
+   v5153 := 3;
+   v5154 := 4;
+   v5155 := 5;
+   v5156 := 6;
+   v5157 := 7;
+   v5158 := 8;
+   v5159 := 9;
+   v5160 := 0;
+   v5161 := 1;
+   v5162 := 2;
+   v5163 := 3;
+   v5164 := 4;
+   v5165 := 5;
+   v5166 := 6;
+   v5167 := 7;
+   v5168 := 8;
+   v5169 := 9;
+   v5170 := 0;
+   v5171 := 1;
+   v5172 := 2;
+   v5173 := 3;
+   v5174 := 4;
+   v5175 := 5;
+   v5176 := 6;
+   v5177 := 7;
+   v5178 := 8;
+   v5179 := 9;
+   v5180 := 0;
+   v5181 := 1;
+   v5182 := 2;
+   v5183 := 3;
+   v5184 := 4;
+   v5185 := 5;
+   v5186 := 6;
+   v5187 := 7;
+   v5188 := 8;
+   v5189 := 9;
+   v5190 := 0;
+   v5191 := 1;
+   v5192 := 2;
+   v5193 := 3;
+   v5194 := 4;
+   v5195 := 5;
+   v5196 := 6;
+   v5197 := 7;
+   v5198 := 8;
+   v5199 := 9;
+   v5200 := 0;
+   v5201 := 1;
+   v5202 := 2;
+   v5203 := 3;
+   v5204 := 4;
+   v5205 := 5;
+   v5206 := 6;
+   v5207 := 7;
+   v5208 := 8;
+   v5209 := 9;
+   v5210 := 0;
+   v5211 := 1;
+   v5212 := 2;
+   v5213 := 3;
+   v5214 := 4;
+   v5215 := 5;
+   v5216 := 6;
+   v5217 := 7;
+   v5218 := 8;
+   v5219 := 9;
+   v5220 := 0;
+   v5221 := 1;
+   v5222 := 2;
+   v5223 := 3;
+   v5224 := 4;
+   v5225 := 5;
+   v5226 := 6;
+   v5227 := 7;
+   v5228 := 8;
+   v5229 := 9;
+   v5230 := 0;
+   v5231 := 1;
+   v5232 := 2;
+   v5233 := 3;
+   v5234 := 4;
+   v5235 := 5;
+   v5236 := 6;
+   v5237 := 7;
+   v5238 := 8;
+   v5239 := 9;
+   v5240 := 0;
+   v5241 := 1;
+   v5242 := 2;
+   v5243 := 3;
+   v5244 := 4;
+   v5245 := 5;
+   v5246 := 6;
+   v5247 := 7;
+   v5248 := 8;
+   v5249 := 9;
+   v5250 := 0;
+   v5251 := 1;
+   v5252 := 2;
+   v5253 := 3;
+   v5254 := 4;
+   v5255 := 5;
+   v5256 := 6;
+   v5257 := 7;
+   v5258 := 8;
+   v5259 := 9;
+   v5260 := 0;
+   v5261 := 1;
+   v5262 := 2;
+   v5263 := 3;
+   v5264 := 4;
+   v5265 := 5;
+   v5266 := 6;
+   v5267 := 7;
+   v5268 := 8;
+   v5269 := 9;
+   v5270 := 0;
+   v5271 := 1;
+   v5272 := 2;
+   v5273 := 3;
+   v5274 := 4;
+   v5275 := 5;
+   v5276 := 6;
+   v5277 := 7;
+   v5278 := 8;
+   v5279 := 9;
+   v5280 := 0;
+   v5281 := 1;
+   v5282 := 2;
+   v5283 := 3;
+   v5284 := 4;
+   v5285 := 5;
+   v5286 := 6;
+   v5287 := 7;
+   v5288 := 8;
+   v5289 := 9;
+   v5290 := 0;
+   v5291 := 1;
+   v5292 := 2;
+   v5293 := 3;
+   v5294 := 4;
+   v5295 := 5;
+   v5296 := 6;
+   v5297 := 7;
+   v5298 := 8;
+   v5299 := 9;
+   v5300 := 0;
+   v5301 := 1;
+   v5302 := 2;
+   v5303 := 3;
+   v5304 := 4;
+   v5305 := 5;
+   v5306 := 6;
+   v5307 := 7;
+   v5308 := 8;
+   v5309 := 9;
+   v5310 := 0;
+   v5311 := 1;
+   v5312 := 2;
+   v5313 := 3;
+   v5314 := 4;
+   v5315 := 5;
+   v5316 := 6;
+   v5317 := 7;
+   v5318 := 8;
+   v5319 := 9;
+   v5320 := 0;
+   v5321 := 1;
+   v5322 := 2;
+   v5323 := 3;
+   v5324 := 4;
+   v5325 := 5;
+   v5326 := 6;
+   v5327 := 7;
+   v5328 := 8;
+   v5329 := 9;
+   v5330 := 0;
+   v5331 := 1;
+   v5332 := 2;
+   v5333 := 3;
+   v5334 := 4;
+   v5335 := 5;
+   v5336 := 6;
+   v5337 := 7;
+   v5338 := 8;
+   v5339 := 9;
+   v5340 := 0;
+   v5341 := 1;
+   v5342 := 2;
+   v5343 := 3;
+   v5344 := 4;
+   v5345 := 5;
+   v5346 := 6;
+   v5347 := 7;
+   v5348 := 8;
+   v5349 := 9;
+   v5350 := 0;
+   v5351 := 1;
+   v5352 := 2;
+   v5353 := 3;
+   v5354 := 4;
+   v5355 := 5;
+   v5356 := 6;
+   v5357 := 7;
+   v5358 := 8;
+   v5359 := 9;
+   v5360 := 0;
+   v5361 := 1;
+   v5362 := 2;
+   v5363 := 3;
+   v5364 := 4;
+   v5365 := 5;
+   v5366 := 6;
+   v5367 := 7;
+   v5368 := 8;
+   v5369 := 9;
+   v5370 := 0;
+   v5371 := 1;
+   v5372 := 2;
+   v5373 := 3;
+   v5374 := 4;
+   v5375 := 5;
+   v5376 := 6;
+   v5377 := 7;
+   v5378 := 8;
+   v5379 := 9;
+   v5380 := 0;
+   v5381 := 1;
+   v5382 := 2;
+   v5383 := 3;
+   v5384 := 4;
+   v5385 := 5;
+   v5386 := 6;
+   v5387 := 7;
+   v5388 := 8;
+   v5389 := 9;
+   v5390 := 0;
+   v5391 := 1;
+   v5392 := 2;
+   v5393 := 3;
+   v5394 := 4;
+   v5395 := 5;
+   v5396 := 6;
+   v5397 := 7;
+   v5398 := 8;
+   v5399 := 9;
+   v5400 := 0;
+   v5401 := 1;
+   v5402 := 2;
+   v5403 := 3;
+   v5404 := 4;
+   v5405 := 5;
+   v5406 := 6;
+   v5407 := 7;
+   v5408 := 8;
+   v5409 := 9;
+   v5410 := 0;
+   v5411 := 1;
+   v5412 := 2;
+   v5413 := 3;
+   v5414 := 4;
+   v5415 := 5;
+   v5416 := 6;
+   v5417 := 7;
+   v5418 := 8;
+   v5419 := 9;
+   v5420 := 0;
+   v5421 := 1;
+   v5422 := 2;
+   v5423 := 3;
+   v5424 := 4;
+   v5425 := 5;
+   v5426 := 6;
+   v5427 := 7;
+   v5428 := 8;
+   v5429 := 9;
+   v5430 := 0;
+   v5431 := 1;
+   v5432 := 2;
+   v5433 := 3;
+   v5434 := 4;
+   v5435 := 5;
+   v5436 := 6;
+   v5437 := 7;
+   v5438 := 8;
+   v5439 := 9;
+   v5440 := 0;
+   v5441 := 1;
+   v5442 := 2;
+   v5443 := 3;
+   v5444 := 4;
+   v5445 := 5;
+   v5446 := 6;
+   v5447 := 7;
+   v5448 := 8;
+   v5449 := 9;
+   v5450 := 0;
+   v5451 := 1;
+   v5452 := 2;
+   v5453 := 3;
+   v5454 := 4;
+   v5455 := 5;
+   v5456 := 6;
+   v5457 := 7;
+   v5458 := 8;
+   v5459 := 9;
+   v5460 := 0;
+   v5461 := 1;
+   v5462 := 2;
+   v5463 := 3;
+   v5464 := 4;
+   v5465 := 5;
+   v5466 := 6;
+   v5467 := 7;
+   v5468 := 8;
+   v5469 := 9;
+   v5470 := 0;
+   v5471 := 1;
+   v5472 := 2;
+   v5473 := 3;
+   v5474 := 4;
+   v5475 := 5;
+   v5476 := 6;
+   v5477 := 7;
+   v5478 := 8;
+   v5479 := 9;
+   v5480 := 0;
+   v5481 := 1;
+   v5482 := 2;
+   v5483 := 3;
+   v5484 := 4;
+   v5485 := 5;
+   v5486 := 6;
+   v5487 := 7;
+   v5488 := 8;
+   v5489 := 9;
+   v5490 := 0;
+   v5491 := 1;
+   v5492 := 2;
+   v5493 := 3;
+   v5494 := 4;
+   v5495 := 5;
+   v5496 := 6;
+   v5497 := 7;
+   v5498 := 8;
+   v5499 := 9;
+   v5500 := 0;
+   v5501 := 1;
+   v5502 := 2;
+   v5503 := 3;
+   v5504 := 4;
+   v5505 := 5;
+   v5506 := 6;
+   v5507 := 7;
+   v5508 := 8;
+   v5509 := 9;
+   v5510 := 0;
+   v5511 := 1;
+   v5512 := 2;
+   v5513 := 3;
+   v5514 := 4;
+   v5515 := 5;
+   v5516 := 6;
+   v5517 := 7;
+   v5518 := 8;
+   v5519 := 9;
+   v5520 := 0;
+   v5521 := 1;
+   v5522 := 2;
+   v5523 := 3;
+   v5524 := 4;
+   v5525 := 5;
+   v5526 := 6;
+   v5527 := 7;
+   v5528 := 8;
+   v5529 := 9;
+   v5530 := 0;
+   v5531 := 1;
+   v5532 := 2;
+   v5533 := 3;
+   v5534 := 4;
+   v5535 := 5;
+   v5536 := 6;
+   v5537 := 7;
+   v5538 := 8;
+   v5539 := 9;
+   v5540 := 0;
+   v5541 := 1;
+   v5542 := 2;
+   v5543 := 3;
+   v5544 := 4;
+   v5545 := 5;
+   v5546 := 6;
+   v5547 := 7;
+   v5548 := 8;
+   v5549 := 9;
+   v5550 := 0;
+   v5551 := 1;
+   v5552 := 2;
+   v5553 := 3;
+   v5554 := 4;
+   v5555 := 5;
+   v5556 := 6;
+   v5557 := 7;
+   v5558 := 8;
+   v5559 := 9;
+   v5560 := 0;
+   v5561 := 1;
+   v5562 := 2;
+   v5563 := 3;
+   v5564 := 4;
+   v5565 := 5;
+   v5566 := 6;
+   v5567 := 7;
+   v5568 := 8;
+   v5569 := 9;
+   v5570 := 0;
+   v5571 := 1;
+   v5572 := 2;
+   v5573 := 3;
+   v5574 := 4;
+   v5575 := 5;
+   v5576 := 6;
+   v5577 := 7;
+   v5578 := 8;
+   v5579 := 9;
+   v5580 := 0;
+   v5581 := 1;
+   v5582 := 2;
+   v5583 := 3;
+   v5584 := 4;
+   v5585 := 5;
+   v5586 := 6;
+   v5587 := 7;
+   v5588 := 8;
+   v5589 := 9;
+   v5590 := 0;
+   v5591 := 1;
+   v5592 := 2;
+   v5593 := 3;
+   v5594 := 4;
+   v5595 := 5;
+   v5596 := 6;
+   v5597 := 7;
+   v5598 := 8;
+   v5599 := 9;
+   v5600 := 0;
+   v5601 := 1;
+   v5602 := 2;
+   v5603 := 3;
+   v5604 := 4;
+   v5605 := 5;
+   v5606 := 6;
+   v5607 := 7;
+   v5608 := 8;
+   v5609 := 9;
+   v5610 := 0;
+   v5611 := 1;
+   v5612 := 2;
+   v5613 := 3;
+   v5614 := 4;
+   v5615 := 5;
+   v5616 := 6;
+   v5617 := 7;
+   v5618 := 8;
+   v5619 := 9;
+   v5620 := 0;
+   v5621 := 1;
+   v5622 := 2;
+   v5623 := 3;
+   v5624 := 4;
+   v5625 := 5;
+   v5626 := 6;
+   v5627 := 7;
+   v5628 := 8;
+   v5629 := 9;
+   v5630 := 0;
+   v5631 := 1;
+   v5632 := 2;
+   v5633 := 3;
+   v5634 := 4;
+   v5635 := 5;
+   v5636 := 6;
+   v5637 := 7;
+   v5638 := 8;
+   v5639 := 9;
+   v5640 := 0;
+   v5641 := 1;
+   v5642 := 2;
+   v5643 := 3;
+   v5644 := 4;
+   v5645 := 5;
+   v5646 := 6;
+   v5647 := 7;
+   v5648 := 8;
+   v5649 := 9;
+   v5650 := 0;
+   v5651 := 1;
+   v5652 := 2;
+   v5653 := 3;
+   v5654 := 4;
+   v5655 := 5;
+   v5656 := 6;
+   v5657 := 7;
+   v5658 := 8;
+   v5659 := 9;
+   v5660 := 0;
+   v5661 := 1;
+   v5662 := 2;
+   v5663 := 3;
+   v5664 := 4;
+   v5665 := 5;
+   v5666 := 6;
+   v5667 := 7;
+   v5668 := 8;
+   v5669 := 9;
+   v5670 := 0;
+   v5671 := 1;
+   v5672 := 2;
+   v5673 := 3;
+   v5674 := 4;
+   v5675 := 5;
+   v5676 := 6;
+   v5677 := 7;
+   v5678 := 8;
+   v5679 := 9;
+   v5680 := 0;
+   v5681 := 1;
+   v5682 := 2;
+   v5683 := 3;
+   v5684 := 4;
+   v5685 := 5;
+   v5686 := 6;
+   v5687 := 7;
+   v5688 := 8;
+   v5689 := 9;
+   v5690 := 0;
+   v5691 := 1;
+   v5692 := 2;
+   v5693 := 3;
+   v5694 := 4;
+   v5695 := 5;
+   v5696 := 6;
+   v5697 := 7;
+   v5698 := 8;
+   v5699 := 9;
+   v5700 := 0;
+   v5701 := 1;
+   v5702 := 2;
+   v5703 := 3;
+   v5704 := 4;
+   v5705 := 5;
+   v5706 := 6;
+   v5707 := 7;
+   v5708 := 8;
+   v5709 := 9;
+   v5710 := 0;
+   v5711 := 1;
+   v5712 := 2;
+   v5713 := 3;
+   v5714 := 4;
+   v5715 := 5;
+   v5716 := 6;
+   v5717 := 7;
+   v5718 := 8;
+   v5719 := 9;
+   v5720 := 0;
+   v5721 := 1;
+   v5722 := 2;
+   v5723 := 3;
+   v5724 := 4;
+   v5725 := 5;
+   v5726 := 6;
+   v5727 := 7;
+   v5728 := 8;
+   v5729 := 9;
+   v5730 := 0;
+   v5731 := 1;
+   v5732 := 2;
+   v5733 := 3;
+   v5734 := 4;
+   v5735 := 5;
+   v5736 := 6;
+   v5737 := 7;
+   v5738 := 8;
+   v5739 := 9;
+   v5740 := 0;
+   v5741 := 1;
+   v5742 := 2;
+   v5743 := 3;
+   v5744 := 4;
+   v5745 := 5;
+   v5746 := 6;
+   v5747 := 7;
+   v5748 := 8;
+   v5749 := 9;
+   v5750 := 0;
+   v5751 := 1;
+   v5752 := 2;
+   v5753 := 3;
+   v5754 := 4;
+   v5755 := 5;
+   v5756 := 6;
+   v5757 := 7;
+   v5758 := 8;
+   v5759 := 9;
+   v5760 := 0;
+   v5761 := 1;
+   v5762 := 2;
+   v5763 := 3;
+   v5764 := 4;
+   v5765 := 5;
+   v5766 := 6;
+   v5767 := 7;
+   v5768 := 8;
+   v5769 := 9;
+   v5770 := 0;
+   v5771 := 1;
+   v5772 := 2;
+   v5773 := 3;
+   v5774 := 4;
+   v5775 := 5;
+   v5776 := 6;
+   v5777 := 7;
+   v5778 := 8;
+   v5779 := 9;
+   v5780 := 0;
+   v5781 := 1;
+   v5782 := 2;
+   v5783 := 3;
+   v5784 := 4;
+   v5785 := 5;
+   v5786 := 6;
+   v5787 := 7;
+   v5788 := 8;
+   v5789 := 9;
+   v5790 := 0;
+   v5791 := 1;
+   v5792 := 2;
+   v5793 := 3;
+   v5794 := 4;
+   v5795 := 5;
+   v5796 := 6;
+   v5797 := 7;
+   v5798 := 8;
+   v5799 := 9;
+   v5800 := 0;
+   v5801 := 1;
+   v5802 := 2;
+   v5803 := 3;
+   v5804 := 4;
+   v5805 := 5;
+   v5806 := 6;
+   v5807 := 7;
+   v5808 := 8;
+   v5809 := 9;
+   v5810 := 0;
+   v5811 := 1;
+   v5812 := 2;
+   v5813 := 3;
+   v5814 := 4;
+   v5815 := 5;
+   v5816 := 6;
+   v5817 := 7;
+   v5818 := 8;
+   v5819 := 9;
+   v5820 := 0;
+   v5821 := 1;
+   v5822 := 2;
+   v5823 := 3;
+   v5824 := 4;
+   v5825 := 5;
+   v5826 := 6;
+   v5827 := 7;
+   v5828 := 8;
+   v5829 := 9;
+   v5830 := 0;
+   v5831 := 1;
+   v5832 := 2;
+   v5833 := 3;
+   v5834 := 4;
+   v5835 := 5;
+   v5836 := 6;
+   v5837 := 7;
+   v5838 := 8;
+   v5839 := 9;
+   v5840 := 0;
+   v5841 := 1;
+   v5842 := 2;
+   v5843 := 3;
+   v5844 := 4;
+   v5845 := 5;
+   v5846 := 6;
+   v5847 := 7;
+   v5848 := 8;
+   v5849 := 9;
+   v5850 := 0;
+   v5851 := 1;
+   v5852 := 2;
+   v5853 := 3;
+   v5854 := 4;
+   v5855 := 5;
+   v5856 := 6;
+   v5857 := 7;
+   v5858 := 8;
+   v5859 := 9;
+   v5860 := 0;
+   v5861 := 1;
+   v5862 := 2;
+   v5863 := 3;
+   v5864 := 4;
+   v5865 := 5;
+   v5866 := 6;
+   v5867 := 7;
+   v5868 := 8;
+   v5869 := 9;
+   v5870 := 0;
+   v5871 := 1;
+   v5872 := 2;
+   v5873 := 3;
+   v5874 := 4;
+   v5875 := 5;
+   v5876 := 6;
+   v5877 := 7;
+   v5878 := 8;
+   v5879 := 9;
+   v5880 := 0;
+   v5881 := 1;
+   v5882 := 2;
+   v5883 := 3;
+   v5884 := 4;
+   v5885 := 5;
+   v5886 := 6;
+   v5887 := 7;
+   v5888 := 8;
+   v5889 := 9;
+   v5890 := 0;
+   v5891 := 1;
+   v5892 := 2;
+   v5893 := 3;
+   v5894 := 4;
+   v5895 := 5;
+   v5896 := 6;
+   v5897 := 7;
+   v5898 := 8;
+   v5899 := 9;
+   v5900 := 0;
+   v5901 := 1;
+   v5902 := 2;
+   v5903 := 3;
+   v5904 := 4;
+   v5905 := 5;
+   v5906 := 6;
+   v5907 := 7;
+   v5908 := 8;
+   v5909 := 9;
+   v5910 := 0;
+   v5911 := 1;
+   v5912 := 2;
+   v5913 := 3;
+   v5914 := 4;
+   v5915 := 5;
+   v5916 := 6;
+   v5917 := 7;
+   v5918 := 8;
+   v5919 := 9;
+   v5920 := 0;
+   v5921 := 1;
+   v5922 := 2;
+   v5923 := 3;
+   v5924 := 4;
+   v5925 := 5;
+   v5926 := 6;
+   v5927 := 7;
+   v5928 := 8;
+   v5929 := 9;
+   v5930 := 0;
+   v5931 := 1;
+   v5932 := 2;
+   v5933 := 3;
+   v5934 := 4;
+   v5935 := 5;
+   v5936 := 6;
+   v5937 := 7;
+   v5938 := 8;
+   v5939 := 9;
+   v5940 := 0;
+   v5941 := 1;
+   v5942 := 2;
+   v5943 := 3;
+   v5944 := 4;
+   v5945 := 5;
+   v5946 := 6;
+   v5947 := 7;
+   v5948 := 8;
+   v5949 := 9;
+   v5950 := 0;
+   v5951 := 1;
+   v5952 := 2;
+   v5953 := 3;
+   v5954 := 4;
+   v5955 := 5;
+   v5956 := 6;
+   v5957 := 7;
+   v5958 := 8;
+   v5959 := 9;
+   v5960 := 0;
+   v5961 := 1;
+   v5962 := 2;
+   v5963 := 3;
+   v5964 := 4;
+   v5965 := 5;
+   v5966 := 6;
+   v5967 := 7;
+   v5968 := 8;
+   v5969 := 9;
+   v5970 := 0;
+   v5971 := 1;
+   v5972 := 2;
+   v5973 := 3;
+   v5974 := 4;
+   v5975 := 5;
+   v5976 := 6;
+   v5977 := 7;
+   v5978 := 8;
+   v5979 := 9;
+   v5980 := 0;
+   v5981 := 1;
+   v5982 := 2;
+   v5983 := 3;
+   v5984 := 4;
+   v5985 := 5;
+   v5986 := 6;
+   v5987 := 7;
+   v5988 := 8;
+   v5989 := 9;
+   v5990 := 0;
+   v5991 := 1;
+   v5992 := 2;
+   v5993 := 3;
+   v5994 := 4;
+   v5995 := 5;
+   v5996 := 6;
+   v5997 := 7;
+   v5998 := 8;
+   v5999 := 9
+END.
@@ -1,20 +1,35 @@
 #pragma once
 #include <map>
+#include <cmath>
+#include <cfenv>
+#include <sstream>
+#include <array>
 #include <vector>
 #include <memory>
+#include <optional>
+#include <unordered_map>
 #include <string>
 #include <stdexcept>
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
+#include <boost/container/small_vector.hpp>
+#include "SymbolTable.h"
+#include "Decimal.h"
+#include "BigInt.h"
+#include "Random.h"
 
 // Forward declarations
 class BinOpNode;
 class LeafNumNode;
 class UnOpNode;
 class LeafVarNode;
+class LeafInvariantNode;
+class InductionNode;
+class RandomNode;
 class LeafNopNode;
 class AssignNode;
 class CompoundNode;
+class ForNode;
 class ProgramNode;
 class BlockNode;
 class VarDeclNode;
@@ -30,11 +45,15 @@ public:
 	virtual void Visit(const LeafNumNode& num) = 0;
 	virtual void Visit(const UnOpNode& unop) = 0;
 	virtual void Visit(const LeafVarNode& var) = 0;
+	virtual void Visit(const LeafInvariantNode& invariant) = 0;
+	virtual void Visit(const InductionNode& induction) = 0;
+	virtual void Visit(const RandomNode& random) = 0;
 
 	// Statements
 	virtual void Visit(const LeafNopNode& nop) = 0;
 	virtual void Visit(const AssignNode& assign) = 0;
 	virtual void Visit(const CompoundNode& compound) = 0;
+	virtual void Visit(const ForNode& loop) = 0;
 	virtual void Visit(const TypeNode& type) = 0; // ?
 	virtual void Visit(const VarDeclNode& vardecl) = 0;
 	virtual void Visit(const BlockNode& block) = 0;
@@ -52,6 +71,12 @@ public:
 	using Ptr = std::unique_ptr<ASTNode>;
 	virtual ~ASTNode() = default;
 	virtual void Accept(IASTNodeVisitor& visitor)const = 0;
+
+	// Cheaper than dynamic_cast on the paths walking operator chains
+	virtual const BinOpNode* AsBinOp()const
+	{
+		return nullptr;
+	}
 };
 
 class BinOpNode : public ASTNode
@@ -73,6 +98,16 @@ public:
 	{
 	}
 
+	~BinOpNode() override
+	{
+		// Left operands of a chain are freed in a loop, not recursively
+		while (m_left && m_left->AsBinOp())
+		{
+			ASTNode::Ptr next = std::move(static_cast<BinOpNode&>(*m_left).m_left);
+			m_left = std::move(next);
+		}
+	}
+
 	Operator GetOperator()const
 	{
 		return m_op;
@@ -88,15 +123,143 @@ public:
 		return *m_right;
 	}
 
+	// Both return the replaced operand
+	ASTNode::Ptr ReplaceLeft(ASTNode::Ptr&& left)
+	{
+		std::swap(m_left, left);
+		return std::move(left);
+	}
+
+	ASTNode::Ptr ReplaceRight(ASTNode::Ptr&& right)
+	{
+		std::swap(m_right, right);
+		return std::move(right);
+	}
+
+	// Facts proven by RangeAnalysis about the values this node sees at run time,
+	// engines skip the checks they make redundant
+	enum Proof : uint8_t
+	{
+		NoOverflow = 1, // operands and result fit into 63 bits
+		NonZeroDivisor = 2
+	};
+
+	void SetProofs(uint8_t proofs)
+	{
+		m_proofs = proofs;
+	}
+
+	bool IsProven(Proof proof)const
+	{
+		return (m_proofs & proof) != 0;
+	}
+
+	// DIV by the constant 2^shift, set by LoopOptimizer; 0 for other nodes
+	void SetShift(uint8_t shift)
+	{
+		m_shift = shift;
+	}
+
+	uint8_t GetShift()const
+	{
+		return m_shift;
+	}
+
 	void Accept(IASTNodeVisitor& visitor)const override
 	{
 		visitor.Visit(*this);
 	}
 
+	const BinOpNode* AsBinOp()const override
+	{
+		return this;
+	}
+
 private:
 	ASTNode::Ptr m_left;
 	ASTNode::Ptr m_right;
 	Operator m_op;
+	uint8_t m_proofs = 0;
+	uint8_t m_shift = 0;
+};
+
+// A chain like a + b + ... + z nests to the left as deep as it is long, and
+// the parser only limits the nesting of parentheses and unary operators.
+// Visitors evaluate their operators with Walk: 'leaf' gets the left operand,
+// then 'apply' the operator. Short chains recurse like any other expression,
+// past RECURSION_LIMIT nested operators the left operands of a chain are
+// collected and applied from the innermost out without recursion
+class ChainWalker
+{
+public:
+	static constexpr size_t RECURSION_LIMIT = 64;
+
+	template <typename Leaf, typename Apply>
+	void Walk(const BinOpNode& root, Leaf&& leaf, Apply&& apply)
+	{
+		if (m_depth < RECURSION_LIMIT)
+		{
+			Nesting nesting(m_depth);
+			leaf(root.GetLeft());
+			apply(root);
+			return;
+		}
+		WalkIteratively(root, leaf, apply);
+	}
+
+private:
+	template <typename Leaf, typename Apply>
+	void WalkIteratively(const BinOpNode& root, Leaf& leaf, Apply& apply)
+	{
+		const size_t base = m_stack.size();
+		try
+		{
+			const BinOpNode* binop = &root;
+			for (;;)
+			{
+				m_stack.push_back(binop);
+				const BinOpNode* left = binop->GetLeft().AsBinOp();
+				if (!left)
+				{
+					break;
+				}
+				binop = left;
+			}
+			leaf(binop->GetLeft());
+			while (m_stack.size() > base)
+			{
+				binop = m_stack.back();
+				m_stack.pop_back();
+				apply(*binop);
+			}
+		}
+		catch (...)
+		{
+			m_stack.resize(base);
+			throw;
+		}
+	}
+
+	class Nesting
+	{
+	public:
+		explicit Nesting(size_t& depth)
+			: m_depth(depth)
+		{
+			++m_depth;
+		}
+
+		~Nesting()
+		{
+			--m_depth;
+		}
+
+	private:
+		size_t& m_depth;
+	};
+
+	size_t m_depth = 0;
+	std::vector<const BinOpNode*> m_stack;
 };
 
 class UnOpNode : public ASTNode
@@ -119,6 +282,12 @@ public:
 		return *m_expression;
 	}
 
+	ASTNode::Ptr ReplaceExpression(ASTNode::Ptr&& expression)
+	{
+		std::swap(m_expression, expression);
+		return std::move(expression);
+	}
+
 	Operator GetOperator()const
 	{
 		return m_op;
@@ -137,15 +306,35 @@ private:
 class LeafNumNode : public ASTNode
 {
 public:
-	explicit LeafNumNode(int value, bool integral = true)
-		: m_value(value)
-		, m_integral(integral)
+	explicit LeafNumNode(double value, bool integral = true)
+		: m_value(integral ? std::round(value) : value)
 	{
 	}
 
+	// Node of a constant whose exact value for DECIMAL arithmetic is 'exact',
+	// empty when the constant does not fit into a Decimal. Only constants the
+	// double does not give back exactly, like 1.10, keep it in the node
+	static std::unique_ptr<LeafNumNode> Create(double value, const std::optional<Decimal>& exact);
+
 	double GetValue()const
 	{
-		return m_integral ? std::round(m_value) : m_value;
+		return m_value;
+	}
+
+	// The shortest decimal of the double, unless the constant was written otherwise
+	virtual Decimal GetDecimal()const
+	{
+		if (!(std::abs(m_value) < 1e18))
+		{
+			throw std::overflow_error("number constant does not fit into DECIMAL");
+		}
+		return Decimal::FromDouble(m_value);
+	}
+
+	// Exact value of an integer constant its double rounds, null for others
+	virtual const BigInt* GetExactInteger()const
+	{
+		return nullptr;
 	}
 
 	void Accept(IASTNodeVisitor& visitor)const override
@@ -155,57 +344,98 @@ public:
 
 private:
 	double m_value;
-	bool m_integral;
 };
 
-class LeafVarNode : public ASTNode
+// Constant with digits its double does not give back, see LeafNumNode::Create
+class LeafExactNumNode final : public LeafNumNode
 {
 public:
-	explicit LeafVarNode(const std::string& name)
-		: m_name(name)
+	LeafExactNumNode(double value, const std::optional<Decimal>& exact)
+		: LeafNumNode(value, false)
 	{
+		if (exact)
+		{
+			m_units = exact->GetUnits();
+			m_scale = static_cast<uint8_t>(exact->GetScale());
+		}
 	}
 
-	const std::string& GetName()const
+	Decimal GetDecimal()const override
 	{
-		return m_name;
+		if (m_scale == NOT_EXACT)
+		{
+			throw std::overflow_error("number constant does not fit into DECIMAL");
+		}
+		return Decimal::FromUnits(m_units, m_scale);
 	}
 
-	void Accept(IASTNodeVisitor& visitor)const override
+private:
+	static constexpr uint8_t NOT_EXACT = 0xFF;
+
+	int64_t m_units = 0;
+	uint8_t m_scale = NOT_EXACT;
+};
+
+// Integer constant beyond 2^53, for BIGINT arithmetic and DECIMAL (up to 18
+// digits) it keeps the value the double rounds
+class LeafBigNumNode final : public LeafNumNode
+{
+public:
+	LeafBigNumNode(double value, BigInt exact)
+		: LeafNumNode(value)
+		, m_exact(std::move(exact))
 	{
-		visitor.Visit(*this);
+	}
+
+	Decimal GetDecimal()const override
+	{
+		constexpr int64_t LIMIT = 1000000000000000000;
+		int64_t units = 0;
+		if (!m_exact.TryGetInt64(units) || units <= -LIMIT || units >= LIMIT)
+		{
+			throw std::overflow_error("number constant does not fit into DECIMAL");
+		}
+		return Decimal::FromUnits(units, 0);
+	}
+
+	const BigInt* GetExactInteger()const override
+	{
+		return &m_exact;
 	}
 
 private:
-	std::string m_name;
+	BigInt m_exact;
 };
 
-class LeafNopNode : public ASTNode
+inline std::unique_ptr<LeafNumNode> LeafNumNode::Create(double value, const std::optional<Decimal>& exact)
 {
-public:
-	void Accept(IASTNodeVisitor& visitor)const override
+	if (exact && std::abs(value) < 1e18)
 	{
-		visitor.Visit(*this);
+		const Decimal shortest = Decimal::FromDouble(value);
+		if (shortest.GetUnits() == exact->GetUnits() && shortest.GetScale() == exact->GetScale())
+		{
+			return std::make_unique<LeafNumNode>(value, false);
+		}
 	}
-};
+	return std::make_unique<LeafExactNumNode>(value, exact);
+}
 
-class AssignNode : public ASTNode
+class LeafVarNode : public ASTNode
 {
 public:
-	explicit AssignNode(const std::string& left, ASTNode::Ptr&& right)
-		: m_left(left)
-		, m_right(std::move(right))
+	explicit LeafVarNode(const std::string& name)
+		: m_name(SymbolTable::Intern(name))
 	{
 	}
 
-	const std::string& GetLeft()const
+	const std::string& GetName()const
 	{
-		return m_left;
+		return SymbolTable::GetName(m_name);
 	}
 
-	const ASTNode& GetRight()const
+	SymbolTable::Id GetNameId()const
 	{
-		return *m_right;
+		return m_name;
 	}
 
 	void Accept(IASTNodeVisitor& visitor)const override
@@ -214,30 +444,28 @@ public:
 	}
 
 private:
-	std::string m_left;
-	ASTNode::Ptr m_right;
+	SymbolTable::Id m_name;
 };
 
-class CompoundNode : public ASTNode
+// Next draw of the RandomStream of the engine, RANDOM or RANDOMNORMAL. Every
+// evaluation takes a new draw, so the node is never invariant or constant
+class RandomNode : public ASTNode
 {
 public:
-	void AddChild(ASTNode::Ptr&& child)
+	enum Distribution
 	{
-		m_children.push_back(std::move(child));
-	}
+		Uniform,
+		Normal
+	};
 
-	const ASTNode& GetChild(size_t index)const
+	explicit RandomNode(Distribution distribution)
+		: m_distribution(distribution)
 	{
-		if (index >= m_children.size())
-		{
-			throw std::out_of_range("index must be less than children count");
-		}
-		return *m_children[index];
 	}
 
-	size_t GetCount()const
+	Distribution GetDistribution()const
 	{
-		return m_children.size();
+		return m_distribution;
 	}
 
 	void Accept(IASTNodeVisitor& visitor)const override
@@ -246,217 +474,635 @@ public:
 	}
 
 private:
-	std::vector<ASTNode::Ptr> m_children;
+	Distribution m_distribution;
 };
 
-class TypeNode : public ASTNode
+// Value of a loop-invariant expression, computed once by the enclosing
+// ForNode before its first iteration, see LoopOptimizer
+class LeafInvariantNode : public ASTNode
 {
 public:
-	enum Type
+	LeafInvariantNode(uint32_t slot, const ASTNode& expression)
+		: m_slot(slot)
+		, m_expression(expression)
 	{
-		Integer,
-		Real
-	};
+	}
 
-	TypeNode(Type type)
-		: m_type(type)
+	uint32_t GetSlot()const
 	{
+		return m_slot;
 	}
 
-	Type GetType()const
+	// Owned by the loop
+	const ASTNode& GetExpression()const
 	{
-		return m_type;
+		return m_expression;
 	}
 
-	void Accept(IASTNodeVisitor& visitor) const override
+	void Accept(IASTNodeVisitor& visitor)const override
 	{
 		visitor.Visit(*this);
 	}
 
 private:
-	Type m_type;
+	uint32_t m_slot;
+	const ASTNode& m_expression;
 };
 
-class VarDeclNode : public ASTNode
+// Product of the loop variable and an invariant stride, kept up to date by
+// the enclosing ForNode with an addition per iteration. The product itself
+// is evaluated when the additions can't be exact, see ExpressionCalculator
+class InductionNode : public ASTNode
 {
 public:
-	VarDeclNode(std::vector<std::unique_ptr<LeafVarNode>>&& vars, std::unique_ptr<TypeNode>&& type)
-		: m_vars(std::move(vars))
-		, m_type(std::move(type))
+	InductionNode(uint32_t slot, ASTNode::Ptr&& product)
+		: m_slot(slot)
+		, m_product(std::move(product))
 	{
 	}
 
-	const std::vector<std::unique_ptr<LeafVarNode>> &GetVariables()const
+	uint32_t GetSlot()const
 	{
-		return m_vars;
+		return m_slot;
 	}
 
-	const TypeNode& GetTypeNode()const
+	const ASTNode& GetProduct()const
 	{
-		return *m_type;
+		return *m_product;
 	}
 
-	void Accept(IASTNodeVisitor& visitor) const override
+	void Accept(IASTNodeVisitor& visitor)const override
 	{
 		visitor.Visit(*this);
 	}
 
 private:
-	std::vector<std::unique_ptr<LeafVarNode>> m_vars;
-	std::unique_ptr<TypeNode> m_type;
+	uint32_t m_slot;
+	ASTNode::Ptr m_product;
 };
 
-class BlockNode : public ASTNode
+class LeafNopNode : public ASTNode
 {
 public:
-	BlockNode(
-		std::vector<std::unique_ptr<VarDeclNode>>&& declarations,
-		std::unique_ptr<CompoundNode>&& compound)
-		: m_declarations(std::move(declarations))
-		, m_compound(std::move(compound))
+	void Accept(IASTNodeVisitor& visitor)const override
 	{
+		visitor.Visit(*this);
 	}
+};
 
-	const std::vector<std::unique_ptr<VarDeclNode>> &GetDeclarations()const
+class AssignNode : public ASTNode
+{
+public:
+	explicit AssignNode(const std::string& left, ASTNode::Ptr&& right)
+		: m_left(SymbolTable::Intern(left))
+		, m_right(std::move(right))
 	{
-		return m_declarations;
 	}
 
-	const CompoundNode& GetCompound()const
+	AssignNode(SymbolTable::Id left, ASTNode::Ptr&& right)
+		: m_left(left)
+		, m_right(std::move(right))
 	{
-		return *m_compound;
 	}
 
-	void Accept(IASTNodeVisitor& visitor) const override
+	const std::string& GetLeft()const
 	{
-		visitor.Visit(*this);
+		return SymbolTable::GetName(m_left);
 	}
 
-private:
-	std::vector<std::unique_ptr<VarDeclNode>> m_declarations;
-	std::unique_ptr<CompoundNode> m_compound;
-};
-
-class ProgramNode : public ASTNode
-{
-public:
-	ProgramNode(const std::string& name, std::unique_ptr<BlockNode>&& block)
-		: m_name(name)
-		, m_block(std::move(block))
+	SymbolTable::Id GetLeftId()const
 	{
+		return m_left;
 	}
 
-	std::string GetName()const
+	const ASTNode& GetRight()const
 	{
-		return m_name;
+		return *m_right;
 	}
 
-	const BlockNode& GetBlock()const
+	ASTNode::Ptr ReplaceRight(ASTNode::Ptr&& right)
 	{
-		return *m_block;
+		std::swap(m_right, right);
+		return std::move(right);
 	}
 
-	void Accept(IASTNodeVisitor& visitor) const override
+	void Accept(IASTNodeVisitor& visitor)const override
 	{
 		visitor.Visit(*this);
 	}
 
 private:
-	std::string m_name;
-	std::unique_ptr<BlockNode> m_block;
+	SymbolTable::Id m_left;
+	ASTNode::Ptr m_right;
 };
 
-////////////////////////////////////////////////////////
-//                                                    //
-//                    Visitors                        //
-//                                                    //
-////////////////////////////////////////////////////////
-class ExpressionCalculator : public IASTNodeVisitor
+class CompoundNode : public ASTNode
 {
 public:
-	double Calculate(const ASTNode& node)
-	{
-		node.Accept(*this);
-		return m_acc;
-	}
+	// Most blocks hold a single statement, keep it without extra allocation
+	using Children = boost::container::small_vector<ASTNode::Ptr, 1>;
 
-	void Visit(const LeafNumNode& num) override
+	void AddChild(ASTNode::Ptr&& child)
 	{
-		m_acc = num.GetValue();
+		m_children.push_back(std::move(child));
 	}
 
-	void Visit(const BinOpNode& binop) override
+	ASTNode::Ptr ReplaceChild(size_t index, ASTNode::Ptr&& child)
 	{
-		switch (binop.GetOperator())
+		if (index >= m_children.size())
 		{
-		case BinOpNode::Plus:
-			m_acc = Calculate(binop.GetLeft()) + Calculate(binop.GetRight());
-			break;
-		case BinOpNode::Minus:
-			m_acc = Calculate(binop.GetLeft()) - Calculate(binop.GetRight());
-			break;
-		case BinOpNode::Mul:
-			m_acc = Calculate(binop.GetLeft()) * Calculate(binop.GetRight());
-			break;
-		case BinOpNode::IntegerDiv:
-			m_acc = std::round(Calculate(binop.GetLeft()) / Calculate(binop.GetRight()));
-			break;
-		case BinOpNode::FloatDiv:
-			m_acc = Calculate(binop.GetLeft()) / Calculate(binop.GetRight());
-			break;
-		default:
-			throw std::logic_error("undefined operator");
+			throw std::out_of_range("index must be less than children count");
 		}
+		std::swap(m_children[index], child);
+		return std::move(child);
 	}
 
-	void Visit(const UnOpNode& unop) override
+	const ASTNode& GetChild(size_t index)const
 	{
-		switch (unop.GetOperator())
+		if (index >= m_children.size())
 		{
-		case UnOpNode::Plus:
-			m_acc = +Calculate(unop.GetExpression());
-			break;
-		case UnOpNode::Minus:
-			m_acc = -Calculate(unop.GetExpression());
-			break;
-		default:
-			throw std::logic_error("undefined unary operator");
+			throw std::out_of_range("index must be less than children count");
 		}
+		return *m_children[index];
 	}
 
-	void Visit(const LeafNopNode& nop) override
+	size_t GetCount()const
 	{
-		(void)nop;
+		return m_children.size();
 	}
 
-	void Visit(const LeafVarNode& var) override
+	const Children& GetChildren()const
 	{
-		const std::string varname = boost::algorithm::to_lower_copy(var.GetName());
-		auto it = std::find_if(m_scope.begin(), m_scope.end(), [&varname](const auto& pair) {
-			return varname == boost::algorithm::to_lower_copy(pair.first);
-		});
+		return m_children;
+	}
 
-		if (it == m_scope.end())
-		{
-			throw std::runtime_error("variable is not defined");
+	// Coverage counter of the child 'i' is at GetCoverageSlot() + i
+	void SetCoverageSlot(uint32_t slot)
+	{
+		m_coverageSlot = slot;
+	}
+
+	uint32_t GetCoverageSlot()const
+	{
+		return m_coverageSlot;
+	}
+
+	void Accept(IASTNodeVisitor& visitor)const override
+	{
+		visitor.Visit(*this);
+	}
+
+private:
+	Children m_children;
+	uint32_t m_coverageSlot = 0;
+};
+
+// FOR variable := start TO|DOWNTO end DO body
+// Bounds are evaluated once, the variable takes every value from start to
+// end by a step of 1 and keeps the last one; the body does not run when
+// end is behind start
+class ForNode : public ASTNode
+{
+public:
+	enum Direction
+	{
+		To,
+		DownTo
+	};
+
+	struct Invariant
+	{
+		uint32_t slot;
+		ASTNode::Ptr expression;
+	};
+
+	struct Induction
+	{
+		uint32_t slot;
+		const ASTNode* stride; // owned by the InductionNode
+	};
+
+	ForNode(SymbolTable::Id variable, ASTNode::Ptr&& start, ASTNode::Ptr&& end, Direction direction, ASTNode::Ptr&& body)
+		: m_variable(variable)
+		, m_start(std::move(start))
+		, m_end(std::move(end))
+		, m_body(std::move(body))
+		, m_direction(direction)
+	{
+	}
+
+	const std::string& GetVariable()const
+	{
+		return SymbolTable::GetName(m_variable);
+	}
+
+	SymbolTable::Id GetVariableId()const
+	{
+		return m_variable;
+	}
+
+	const ASTNode& GetStart()const
+	{
+		return *m_start;
+	}
+
+	const ASTNode& GetEnd()const
+	{
+		return *m_end;
+	}
+
+	Direction GetDirection()const
+	{
+		return m_direction;
+	}
+
+	const ASTNode& GetBody()const
+	{
+		return *m_body;
+	}
+
+	ASTNode::Ptr ReplaceStart(ASTNode::Ptr&& start)
+	{
+		std::swap(m_start, start);
+		return std::move(start);
+	}
+
+	ASTNode::Ptr ReplaceEnd(ASTNode::Ptr&& end)
+	{
+		std::swap(m_end, end);
+		return std::move(end);
+	}
+
+	// Computed before the first iteration, in the order added
+	void AddInvariant(uint32_t slot, ASTNode::Ptr&& expression)
+	{
+		m_invariants.push_back({ slot, std::move(expression) });
+	}
+
+	const std::vector<Invariant>& GetInvariants()const
+	{
+		return m_invariants;
+	}
+
+	void AddInduction(uint32_t slot, const ASTNode& stride)
+	{
+		m_inductions.push_back({ slot, &stride });
+	}
+
+	const std::vector<Induction>& GetInductions()const
+	{
+		return m_inductions;
+	}
+
+	// Coverage counter of a body that is not a compound, see StatementCoverage
+	static constexpr uint32_t NO_COVERAGE_SLOT = UINT32_MAX;
+
+	void SetCoverageSlot(uint32_t slot)
+	{
+		m_coverageSlot = slot;
+	}
+
+	uint32_t GetCoverageSlot()const
+	{
+		return m_coverageSlot;
+	}
+
+	void Accept(IASTNodeVisitor& visitor)const override
+	{
+		visitor.Visit(*this);
+	}
+
+private:
+	SymbolTable::Id m_variable;
+	ASTNode::Ptr m_start;
+	ASTNode::Ptr m_end;
+	ASTNode::Ptr m_body;
+	Direction m_direction;
+	uint32_t m_coverageSlot = NO_COVERAGE_SLOT;
+	std::vector<Invariant> m_invariants;
+	std::vector<Induction> m_inductions;
+};
+
+class TypeNode : public ASTNode
+{
+public:
+	enum Type
+	{
+		Integer,
+		Real,
+		Decimal,
+		BigInt
+	};
+
+	TypeNode(Type type)
+		: m_type(type)
+	{
+	}
+
+	// DECIMAL(precision, scale)
+	TypeNode(Type type, uint8_t precision, uint8_t scale)
+		: m_type(type)
+		, m_precision(precision)
+		, m_scale(scale)
+	{
+	}
+
+	Type GetType()const
+	{
+		return m_type;
+	}
+
+	uint8_t GetPrecision()const
+	{
+		return m_precision;
+	}
+
+	uint8_t GetScale()const
+	{
+		return m_scale;
+	}
+
+	void Accept(IASTNodeVisitor& visitor) const override
+	{
+		visitor.Visit(*this);
+	}
+
+private:
+	Type m_type;
+	uint8_t m_precision = 0;
+	uint8_t m_scale = 0;
+};
+
+class VarDeclNode : public ASTNode
+{
+public:
+	VarDeclNode(std::vector<std::unique_ptr<LeafVarNode>>&& vars, std::unique_ptr<TypeNode>&& type)
+		: m_vars(std::move(vars))
+		, m_type(std::move(type))
+	{
+	}
+
+	const std::vector<std::unique_ptr<LeafVarNode>> &GetVariables()const
+	{
+		return m_vars;
+	}
+
+	const TypeNode& GetTypeNode()const
+	{
+		return *m_type;
+	}
+
+	void Accept(IASTNodeVisitor& visitor) const override
+	{
+		visitor.Visit(*this);
+	}
+
+private:
+	std::vector<std::unique_ptr<LeafVarNode>> m_vars;
+	std::unique_ptr<TypeNode> m_type;
+};
+
+class BlockNode : public ASTNode
+{
+public:
+	BlockNode(
+		std::vector<std::unique_ptr<VarDeclNode>>&& declarations,
+		std::unique_ptr<CompoundNode>&& compound)
+		: m_declarations(std::move(declarations))
+		, m_compound(std::move(compound))
+	{
+	}
+
+	const std::vector<std::unique_ptr<VarDeclNode>> &GetDeclarations()const
+	{
+		return m_declarations;
+	}
+
+	const CompoundNode& GetCompound()const
+	{
+		return *m_compound;
+	}
+
+	void Accept(IASTNodeVisitor& visitor) const override
+	{
+		visitor.Visit(*this);
+	}
+
+private:
+	std::vector<std::unique_ptr<VarDeclNode>> m_declarations;
+	std::unique_ptr<CompoundNode> m_compound;
+};
+
+class ProgramNode : public ASTNode
+{
+public:
+	ProgramNode(const std::string& name, std::unique_ptr<BlockNode>&& block)
+		: m_name(name)
+		, m_block(std::move(block))
+	{
+	}
+
+	std::string GetName()const
+	{
+		return m_name;
+	}
+
+	const BlockNode& GetBlock()const
+	{
+		return *m_block;
+	}
+
+	void Accept(IASTNodeVisitor& visitor) const override
+	{
+		visitor.Visit(*this);
+	}
+
+private:
+	std::string m_name;
+	std::unique_ptr<BlockNode> m_block;
+};
+
+////////////////////////////////////////////////////////
+//                                                    //
+//                    Visitors                        //
+//                                                    //
+////////////////////////////////////////////////////////
+class ExpressionCalculator : public IASTNodeVisitor
+{
+public:
+	// IEEE exceptions reported by the floating-point checks
+	static constexpr int FLOATING_POINT_ERRORS = FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW;
+
+	double Calculate(const ASTNode& node)
+	{
+		node.Accept(*this);
+		return m_acc;
+	}
+
+	// REAL arithmetic of the double engine, rounded like every other engine
+	static double Apply(BinOpNode::Operator op, double left, double right)
+	{
+		switch (op)
+		{
+		case BinOpNode::Plus:
+			return left + right;
+		case BinOpNode::Minus:
+			return left - right;
+		case BinOpNode::Mul:
+			return left * right;
+		case BinOpNode::IntegerDiv:
+			return std::round(left / right);
+		case BinOpNode::FloatDiv:
+			return left / right;
+		default:
+			throw std::logic_error("undefined operator");
 		}
-		m_acc = it->second;
+	}
+
+	void Visit(const LeafNumNode& num) override
+	{
+		m_acc = num.GetValue();
+	}
+
+	void Visit(const BinOpNode& binop) override
+	{
+		// Left operand first, RANDOM draws come in the order of the other engines
+		m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+			[this](const BinOpNode& node) {
+				const double left = m_acc;
+				if (node.GetShift())
+				{
+					// Multiplying by 2^-shift rounds exactly like dividing by 2^shift
+					m_acc = std::round(left * RECIPROCALS_OF_TWO[node.GetShift()]);
+					return;
+				}
+				const double right = Calculate(node.GetRight());
+				m_acc = Apply(node.GetOperator(), left, right);
+			});
+	}
+
+	void Visit(const UnOpNode& unop) override
+	{
+		switch (unop.GetOperator())
+		{
+		case UnOpNode::Plus:
+			m_acc = +Calculate(unop.GetExpression());
+			break;
+		case UnOpNode::Minus:
+			m_acc = -Calculate(unop.GetExpression());
+			break;
+		default:
+			throw std::logic_error("undefined unary operator");
+		}
+	}
+
+	void Visit(const LeafNopNode& nop) override
+	{
+		(void)nop;
+	}
+
+	void Visit(const LeafVarNode& var) override
+	{
+		auto it = m_index.find(SymbolTable::GetFoldedId(var.GetNameId()));
+		if (it == m_index.end())
+		{
+			throw std::runtime_error("variable is not defined");
+		}
+		m_acc = it->second->second;
+	}
+
+	void Visit(const LeafInvariantNode& invariant) override
+	{
+		m_acc = m_invariants[invariant.GetSlot()];
+	}
+
+	void Visit(const InductionNode& induction) override
+	{
+		// Sums reach zero as +0, the product may be -0
+		const InductionState& state = m_inductions[induction.GetSlot()];
+		m_acc = state.exact && state.value != 0 ? state.value : Calculate(induction.GetProduct());
+	}
+
+	void Visit(const RandomNode& random) override
+	{
+		m_acc = random.GetDistribution() == RandomNode::Normal ? m_random.Normal() : m_random.Uniform();
 	}
 
 	void Visit(const AssignNode& assign) override
 	{
-		const std::string varname = boost::algorithm::to_lower_copy(assign.GetLeft());
-		auto it = std::find_if(m_scope.begin(), m_scope.end(), [&varname](const auto& pair) {
-			return varname == boost::algorithm::to_lower_copy(pair.first);
-		});
+		const SymbolTable::Id varname = SymbolTable::GetFoldedId(assign.GetLeftId());
+		auto decimal = m_decimals.empty() ? m_decimals.end() : m_decimals.find(varname);
+		auto bigint = m_bigints.empty() ? m_bigints.end() : m_bigints.find(varname);
+		const double value = decimal != m_decimals.end() ? AssignDecimal(decimal->second, assign.GetRight())
+			: bigint != m_bigints.end() ? AssignBigInt(bigint->second, assign.GetRight())
+			: m_floatingPointChecks ? CalculateChecked(assign.GetRight(), "assignment to ", assign.GetLeft())
+			: Calculate(assign.GetRight());
+		FindOrAdd(varname, assign.GetLeft()) = value;
+	}
+
+	void Visit(const ForNode& loop) override
+	{
+		const double start = m_floatingPointChecks ? CalculateChecked(loop.GetStart(), "FOR bounds of ", loop.GetVariable())
+			: Calculate(loop.GetStart());
+		const double end = m_floatingPointChecks ? CalculateChecked(loop.GetEnd(), "FOR bounds of ", loop.GetVariable())
+			: Calculate(loop.GetEnd());
+		const double step = loop.GetDirection() == ForNode::To ? 1 : -1;
+		if (!((end - start) * step >= 0))
+		{
+			return;
+		}
+		if (!(std::abs(start) <= EXACT_LIMIT && std::abs(end) <= EXACT_LIMIT))
+		{
+			throw std::runtime_error("FOR bounds are out of range");
+		}
 
-		if (it == m_scope.end())
+		// Expressions hoisted from the body are checked here, statements read their values
+		for (const auto& invariant : loop.GetInvariants())
 		{
-			m_scope.emplace(assign.GetLeft(), Calculate(assign.GetRight()));
+			At(m_invariants, invariant.slot) = m_floatingPointChecks
+				? CalculateChecked(*invariant.expression, "invariant of FOR ", loop.GetVariable())
+				: Calculate(*invariant.expression);
 		}
-		else
+		for (const auto& induction : loop.GetInductions())
 		{
-			it->second = Calculate(assign.GetRight());
+			const double stride = m_floatingPointChecks
+				? CalculateChecked(*induction.stride, "invariant of FOR ", loop.GetVariable())
+				: Calculate(*induction.stride);
+			InductionState& state = At(m_inductions, induction.slot);
+			state.value = start * stride;
+			state.step = step * stride;
+			// Sums of integers below 2^53 equal the products
+			state.exact = IsExactInteger(start) && IsExactInteger(stride) &&
+				std::abs(start * stride) <= EXACT_LIMIT && std::abs(end * stride) <= EXACT_LIMIT;
+		}
+
+		const SymbolTable::Id varname = SymbolTable::GetFoldedId(loop.GetVariableId());
+		const bool exact = m_decimals.count(varname) != 0 || m_bigints.count(varname) != 0;
+		double& counter = FindOrAdd(varname, loop.GetVariable());
+		const double count = std::floor((end - start) * step) + 1;
+		uint64_t* backEdges = m_backEdgeLimit ? &m_backEdges[&loop] : nullptr;
+		uint64_t* bodyCoverage = m_coverage && loop.GetCoverageSlot() != ForNode::NO_COVERAGE_SLOT
+			? &m_coverage[loop.GetCoverageSlot()]
+			: nullptr;
+		double value = start;
+		for (double i = 0; i < count; ++i, value += step, ++m_loopIterations)
+		{
+			counter = exact ? AssignCounter(varname, value) : value;
+			if (bodyCoverage)
+			{
+				++*bodyCoverage;
+			}
+			loop.GetBody().Accept(*this);
+			for (const auto& induction : loop.GetInductions())
+			{
+				InductionState& state = m_inductions[induction.slot];
+				state.value += state.step;
+			}
+			if (backEdges && ++*backEdges >= m_backEdgeLimit && i + 1 < count &&
+				ReplaceLoop(loop, value + step, count - i - 1))
+			{
+				return;
+			}
 		}
 	}
 
@@ -464,6 +1110,10 @@ public:
 	{
 		for (size_t i = 0; i < compound.GetCount(); ++i)
 		{
+			if (m_coverage)
+			{
+				++m_coverage[compound.GetCoverageSlot() + i];
+			}
 			compound.GetChild(i).Accept(*this);
 		}
 	}
@@ -475,7 +1125,18 @@ public:
 
 	void Visit(const VarDeclNode& vardecl) override
 	{
-		(void)vardecl;
+		const TypeNode& type = vardecl.GetTypeNode();
+		for (const auto& var : vardecl.GetVariables())
+		{
+			if (type.GetType() == TypeNode::Decimal)
+			{
+				m_decimals[SymbolTable::GetFoldedId(var->GetNameId())] = { type.GetPrecision(), type.GetScale(), std::nullopt };
+			}
+			else if (type.GetType() == TypeNode::BigInt)
+			{
+				m_bigints[SymbolTable::GetFoldedId(var->GetNameId())] = std::nullopt;
+			}
+		}
 	}
 
 	void Visit(const BlockNode& block) override
@@ -492,9 +1153,689 @@ public:
 		Visit(program.GetBlock());
 	}
 
+	// Counters indexed by statement slots, see StatementCoverage
+	void SetCoverageCounters(uint64_t* counters)
+	{
+		m_coverage = counters;
+	}
+
+	// Sets an INTEGER or REAL variable before the program runs, as an input
+	void SetVariable(const std::string& name, double value)
+	{
+		FindOrAdd(SymbolTable::InternFolded(name), name) = value;
+	}
+
+	// Assigned variables, DECIMAL and BIGINT ones as doubles
+	const std::map<std::string, double>& GetScope()const
+	{
+		return m_scope;
+	}
+
+	// FOR body iterations run so far
+	uint64_t GetLoopIterations()const
+	{
+		return m_loopIterations;
+	}
+
+	// Stream of RANDOM and RANDOMNORMAL, seed 0 and stream 0 by default
+	void SetRandomStream(const RandomStream& random)
+	{
+		m_random = random;
+	}
+
+	const RandomStream& GetRandomStream()const
+	{
+		return m_random;
+	}
+
+	// Division by zero, invalid operations and overflow of REAL arithmetic
+	// throw instead of producing infinities and NaN. The IEEE exception flags
+	// are tested after every statement, so the operations themselves are not
+	// checked; a statement raising a flag is evaluated again operation by
+	// operation to report which one did
+	void SetFloatingPointChecks(bool checks)
+	{
+		m_floatingPointChecks = checks;
+	}
+
 protected:
+	// Called on back-edges of a FOR loop once it has taken m_backEdgeLimit of
+	// them over all its runs. An override may run the remaining iterations,
+	// the next one with the loop variable set to 'next', and return true
+	virtual bool ReplaceLoop(const ForNode& loop, double next, double remaining)
+	{
+		(void)loop;
+		(void)next;
+		(void)remaining;
+		return false;
+	}
+
+	struct DecimalVariable
+	{
+		uint8_t precision = Decimal::MAX_PRECISION;
+		uint8_t scale = 0;
+		std::optional<Decimal> value;
+	};
+
+	// Evaluates expressions assigned to DECIMAL variables without binary
+	// rounding: constants keep their decimal digits, DECIMAL variables their
+	// exact values, other variables are converted with Decimal::FromDouble
+	class DecimalCalculator : public IASTNodeVisitor
+	{
+	public:
+		// Quotients keep at least 'scale' fraction digits, the scale of the target
+		DecimalCalculator(const ExpressionCalculator& scope, int scale)
+			: m_scope(scope)
+			, m_scale(scale)
+		{
+		}
+
+		Decimal Calculate(const ASTNode& node)
+		{
+			node.Accept(*this);
+			return m_acc;
+		}
+
+		void Visit(const LeafNumNode& num) override
+		{
+			m_acc = num.GetDecimal();
+		}
+
+		void Visit(const BinOpNode& binop) override
+		{
+			m_scope.m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+				[this](const BinOpNode& node) { Combine(node); });
+		}
+
+		void Visit(const UnOpNode& unop) override
+		{
+			switch (unop.GetOperator())
+			{
+			case UnOpNode::Plus:
+				m_acc = +Calculate(unop.GetExpression());
+				break;
+			case UnOpNode::Minus:
+				m_acc = -Calculate(unop.GetExpression());
+				break;
+			default:
+				throw std::logic_error("undefined unary operator");
+			}
+		}
+
+		void Visit(const LeafVarNode& var) override
+		{
+			const SymbolTable::Id varname = SymbolTable::GetFoldedId(var.GetNameId());
+			auto decimal = m_scope.m_decimals.find(varname);
+			if (decimal != m_scope.m_decimals.end() && decimal->second.value)
+			{
+				m_acc = *decimal->second.value;
+				return;
+			}
+			auto bigint = m_scope.m_bigints.find(varname);
+			int64_t integral = 0;
+			if (bigint != m_scope.m_bigints.end() && bigint->second)
+			{
+				if (!bigint->second->TryGetInt64(integral))
+				{
+					throw std::overflow_error("BIGINT value does not fit into DECIMAL");
+				}
+				m_acc = Decimal::FromUnits(integral, 0);
+				return;
+			}
+			auto it = m_scope.m_index.find(varname);
+			if (it == m_scope.m_index.end())
+			{
+				throw std::runtime_error("variable is not defined");
+			}
+			m_acc = Decimal::FromDouble(it->second->second);
+		}
+
+		void Visit(const LeafInvariantNode& invariant) override
+		{
+			m_acc = Calculate(invariant.GetExpression());
+		}
+
+		void Visit(const InductionNode& induction) override
+		{
+			m_acc = Calculate(induction.GetProduct());
+		}
+
+		void Visit(const RandomNode& random) override
+		{
+			(void)random;
+			throw std::runtime_error("RANDOM in DECIMAL expression");
+		}
+
+		void Visit(const LeafNopNode& nop) override
+		{
+			(void)nop;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const AssignNode& assign) override
+		{
+			(void)assign;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const CompoundNode& compound) override
+		{
+			(void)compound;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const ForNode& loop) override
+		{
+			(void)loop;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const TypeNode& type) override
+		{
+			(void)type;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const VarDeclNode& vardecl) override
+		{
+			(void)vardecl;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const BlockNode& block) override
+		{
+			(void)block;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const ProgramNode& program) override
+		{
+			(void)program;
+			throw std::logic_error("node is not an expression");
+		}
+
+	private:
+		// Applies the operator to m_acc, the value of the left operand
+		void Combine(const BinOpNode& binop)
+		{
+			const Decimal left = m_acc;
+			const Decimal right = Calculate(binop.GetRight());
+			switch (binop.GetOperator())
+			{
+			case BinOpNode::Plus:
+				m_acc = left + right;
+				break;
+			case BinOpNode::Minus:
+				m_acc = left - right;
+				break;
+			case BinOpNode::Mul:
+				m_acc = left * right;
+				break;
+			case BinOpNode::IntegerDiv:
+				m_acc = Divide(binop, left, right, 0);
+				break;
+			case BinOpNode::FloatDiv:
+				m_acc = Divide(binop, left, right, Decimal::GetDivisionScale(left, right, m_scale));
+				break;
+			default:
+				throw std::logic_error("undefined operator");
+			}
+		}
+
+		static Decimal Divide(const BinOpNode& binop, const Decimal& left, const Decimal& right, int scale)
+		{
+			return binop.IsProven(BinOpNode::NonZeroDivisor)
+				? Decimal::DivideUnchecked(left, right, scale)
+				: Decimal::Divide(left, right, scale);
+		}
+
+	private:
+		const ExpressionCalculator& m_scope;
+		int m_scale;
+		Decimal m_acc;
+	};
+
+	// Evaluates expressions assigned to BIGINT variables: values that fit into
+	// 63 bits take the inline fast path of BigInt, greater ones spill to the heap.
+	// Only integral operands are accepted, '/' is rejected.
+	class BigIntCalculator : public IASTNodeVisitor
+	{
+	public:
+		explicit BigIntCalculator(const ExpressionCalculator& scope)
+			: m_scope(scope)
+		{
+		}
+
+		BigInt Calculate(const ASTNode& node)
+		{
+			node.Accept(*this);
+			return std::move(m_acc);
+		}
+
+		void Visit(const LeafNumNode& num) override
+		{
+			const BigInt* exact = num.GetExactInteger();
+			m_acc = exact ? *exact : ToBigInt(num.GetDecimal());
+		}
+
+		void Visit(const BinOpNode& binop) override
+		{
+			m_scope.m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+				[this](const BinOpNode& node) { Combine(node); });
+		}
+
+		void Visit(const UnOpNode& unop) override
+		{
+			switch (unop.GetOperator())
+			{
+			case UnOpNode::Plus:
+				m_acc = Calculate(unop.GetExpression());
+				break;
+			case UnOpNode::Minus:
+				m_acc = -Calculate(unop.GetExpression());
+				break;
+			default:
+				throw std::logic_error("undefined unary operator");
+			}
+		}
+
+		void Visit(const LeafVarNode& var) override
+		{
+			const SymbolTable::Id varname = SymbolTable::GetFoldedId(var.GetNameId());
+			auto bigint = m_scope.m_bigints.find(varname);
+			if (bigint != m_scope.m_bigints.end() && bigint->second)
+			{
+				m_acc = *bigint->second;
+				return;
+			}
+			auto decimal = m_scope.m_decimals.find(varname);
+			if (decimal != m_scope.m_decimals.end() && decimal->second.value)
+			{
+				m_acc = ToBigInt(*decimal->second.value);
+				return;
+			}
+			auto it = m_scope.m_index.find(varname);
+			if (it == m_scope.m_index.end())
+			{
+				throw std::runtime_error("variable is not defined");
+			}
+			m_acc = BigInt::FromDouble(it->second->second);
+		}
+
+		void Visit(const LeafInvariantNode& invariant) override
+		{
+			m_acc = Calculate(invariant.GetExpression());
+		}
+
+		void Visit(const InductionNode& induction) override
+		{
+			m_acc = Calculate(induction.GetProduct());
+		}
+
+		void Visit(const RandomNode& random) override
+		{
+			(void)random;
+			throw std::runtime_error("RANDOM in BIGINT expression");
+		}
+
+		void Visit(const LeafNopNode& nop) override
+		{
+			(void)nop;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const AssignNode& assign) override
+		{
+			(void)assign;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const CompoundNode& compound) override
+		{
+			(void)compound;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const ForNode& loop) override
+		{
+			(void)loop;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const TypeNode& type) override
+		{
+			(void)type;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const VarDeclNode& vardecl) override
+		{
+			(void)vardecl;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const BlockNode& block) override
+		{
+			(void)block;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const ProgramNode& program) override
+		{
+			(void)program;
+			throw std::logic_error("node is not an expression");
+		}
+
+	private:
+		// Applies the operator to m_acc, the value of the left operand
+		void Combine(const BinOpNode& binop)
+		{
+			const BigInt left = std::move(m_acc);
+			const BigInt right = Calculate(binop.GetRight());
+			const bool inlined = binop.IsProven(BinOpNode::NoOverflow);
+			switch (binop.GetOperator())
+			{
+			case BinOpNode::Plus:
+				m_acc = inlined ? BigInt::AddUnchecked(left, right) : left + right;
+				break;
+			case BinOpNode::Minus:
+				m_acc = inlined ? BigInt::SubtractUnchecked(left, right) : left - right;
+				break;
+			case BinOpNode::Mul:
+				m_acc = inlined ? BigInt::MultiplyUnchecked(left, right) : left * right;
+				break;
+			case BinOpNode::IntegerDiv:
+				m_acc = binop.GetShift() ? BigInt::DivideRoundedByPowerOfTwo(left, binop.GetShift())
+					: binop.IsProven(BinOpNode::NonZeroDivisor) ? BigInt::DivideRoundedUnchecked(left, right)
+					: BigInt::DivideRounded(left, right);
+				break;
+			case BinOpNode::FloatDiv:
+				throw std::runtime_error("real division in BIGINT expression");
+			default:
+				throw std::logic_error("undefined operator");
+			}
+		}
+
+		static BigInt ToBigInt(const Decimal& value)
+		{
+			const Decimal integral = value.Rescale(0);
+			if (integral != value)
+			{
+				throw std::invalid_argument("value is not an integer");
+			}
+			return BigInt(integral.GetUnits());
+		}
+
+	private:
+		const ExpressionCalculator& m_scope;
+		BigInt m_acc;
+	};
+
+	// Evaluates an expression that raised a floating-point exception again,
+	// testing the flags after every operation, and throws for the first one
+	// raising any. Reads the variables like ExpressionCalculator, RANDOM
+	// draws from a copy of the stream set back to the start of the statement
+	class FloatingPointChecker : public IASTNodeVisitor
+	{
+	public:
+		FloatingPointChecker(const ExpressionCalculator& scope, const RandomStream& random, const std::string& context)
+			: m_scope(scope)
+			, m_random(random)
+			, m_context(context)
+		{
+		}
+
+		double Calculate(const ASTNode& node)
+		{
+			node.Accept(*this);
+			return m_acc;
+		}
+
+		void Visit(const LeafNumNode& num) override
+		{
+			m_acc = num.GetValue();
+		}
+
+		void Visit(const BinOpNode& binop) override
+		{
+			m_scope.m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+				[this](const BinOpNode& node) { Combine(node); });
+		}
+
+		void Visit(const UnOpNode& unop) override
+		{
+			const double value = Calculate(unop.GetExpression());
+			m_acc = unop.GetOperator() == UnOpNode::Minus ? -value : +value;
+		}
+
+		void Visit(const LeafVarNode& var) override
+		{
+			auto it = m_scope.m_index.find(SymbolTable::GetFoldedId(var.GetNameId()));
+			if (it == m_scope.m_index.end())
+			{
+				throw std::runtime_error("variable is not defined");
+			}
+			m_acc = it->second->second;
+		}
+
+		void Visit(const LeafInvariantNode& invariant) override
+		{
+			m_acc = Calculate(invariant.GetExpression());
+		}
+
+		void Visit(const InductionNode& induction) override
+		{
+			const InductionState& state = m_scope.m_inductions[induction.GetSlot()];
+			m_acc = state.exact && state.value != 0 ? state.value : Calculate(induction.GetProduct());
+		}
+
+		void Visit(const RandomNode& random) override
+		{
+			m_acc = random.GetDistribution() == RandomNode::Normal ? m_random.Normal() : m_random.Uniform();
+		}
+
+		void Visit(const LeafNopNode& nop) override
+		{
+			(void)nop;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const AssignNode& assign) override
+		{
+			(void)assign;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const CompoundNode& compound) override
+		{
+			(void)compound;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const ForNode& loop) override
+		{
+			(void)loop;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const TypeNode& type) override
+		{
+			(void)type;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const VarDeclNode& vardecl) override
+		{
+			(void)vardecl;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const BlockNode& block) override
+		{
+			(void)block;
+			throw std::logic_error("node is not an expression");
+		}
+
+		void Visit(const ProgramNode& program) override
+		{
+			(void)program;
+			throw std::logic_error("node is not an expression");
+		}
+
+	private:
+		// Applies the operator to m_acc, the value of the left operand
+		void Combine(const BinOpNode& binop)
+		{
+			const double left = m_acc;
+			if (binop.GetShift())
+			{
+				m_acc = std::round(left * RECIPROCALS_OF_TWO[binop.GetShift()]);
+				return;
+			}
+			const double right = Calculate(binop.GetRight());
+			std::feclearexcept(FLOATING_POINT_ERRORS);
+			m_acc = Apply(binop.GetOperator(), left, right);
+			const int raised = std::fetestexcept(FLOATING_POINT_ERRORS);
+			if (!raised)
+			{
+				return;
+			}
+			static const char* const OPERATORS[] = { "+", "-", "*", "DIV", "/" };
+			std::ostringstream message;
+			message << (raised & FE_DIVBYZERO ? "division by zero" : raised & FE_INVALID ? "invalid operation" : "overflow")
+				<< " in " << left << " " << OPERATORS[binop.GetOperator()] << " " << right << ", " << m_context;
+			if (raised & FE_OVERFLOW && !(raised & (FE_DIVBYZERO | FE_INVALID)))
+			{
+				throw std::overflow_error(message.str());
+			}
+			throw std::domain_error(message.str());
+		}
+
+		const ExpressionCalculator& m_scope;
+		RandomStream m_random;
+		const std::string& m_context;
+		double m_acc = 0;
+	};
+
+	// Calculate with the floating-point checks, 'context' and 'name' describe
+	// the statement in the error
+	double CalculateChecked(const ASTNode& expression, const char* context, const std::string& name)
+	{
+		// The flags are sticky and clearing them reloads the floating-point
+		// environment, so they are only cleared once raised: the statement is
+		// then evaluated again operation by operation to find the culprit
+		const uint64_t draws = m_random.GetPosition();
+		const double value = Calculate(expression);
+		if (!std::fetestexcept(FLOATING_POINT_ERRORS))
+		{
+			return value;
+		}
+		std::feclearexcept(FLOATING_POINT_ERRORS);
+		RandomStream random = m_random;
+		random.SetPosition(draws);
+		FloatingPointChecker(*this, random, context + name).Calculate(expression);
+		// Left raised by code before the statement
+		return value;
+	}
+
+	struct InductionState
+	{
+		double value = 0;
+		double step = 0;
+		bool exact = false;
+	};
+
+	// Integers doubles represent exactly
+	static constexpr double EXACT_LIMIT = 9007199254740992.0;
+	// 2^-shift for DIV by 2^shift
+	static constexpr std::array<double, 64> RECIPROCALS_OF_TWO = [] {
+		std::array<double, 64> reciprocals{};
+		double value = 1;
+		for (double& reciprocal : reciprocals)
+		{
+			reciprocal = value;
+			value /= 2;
+		}
+		return reciprocals;
+	}();
+
+	static bool IsExactInteger(double value)
+	{
+		return std::abs(value) <= EXACT_LIMIT && value == std::trunc(value);
+	}
+
+	template <typename T>
+	static T& At(std::vector<T>& slots, uint32_t slot)
+	{
+		if (slot >= slots.size())
+		{
+			slots.resize(slot + 1);
+		}
+		return slots[slot];
+	}
+
+	// Value of the variable in m_scope, added on first assignment
+	double& FindOrAdd(SymbolTable::Id varname, const std::string& name)
+	{
+		auto it = m_index.find(varname);
+		if (it == m_index.end())
+		{
+			it = m_index.emplace(varname, m_scope.emplace(name, 0.0).first).first;
+		}
+		return it->second->second;
+	}
+
+	// Stores the exact value of a DECIMAL or BIGINT loop variable, returns it as double
+	double AssignCounter(SymbolTable::Id varname, double value)
+	{
+		auto decimal = m_decimals.find(varname);
+		if (decimal != m_decimals.end())
+		{
+			const Decimal exact = Decimal::FromDouble(value).Rescale(decimal->second.scale);
+			exact.CheckPrecision(decimal->second.precision);
+			decimal->second.value = exact;
+			return exact.ToDouble();
+		}
+		auto& bigint = m_bigints.at(varname);
+		bigint = BigInt::FromDouble(value);
+		return bigint->ToDouble();
+	}
+
+	double AssignBigInt(std::optional<BigInt>& variable, const ASTNode& expression)
+	{
+		variable = BigIntCalculator(*this).Calculate(expression);
+		return variable->ToDouble();
+	}
+
+	// Rounds the value to the declared scale, keeps it exact and returns as double
+	double AssignDecimal(DecimalVariable& variable, const ASTNode& expression)
+	{
+		const Decimal value = DecimalCalculator(*this, variable.scale).Calculate(expression).Rescale(variable.scale);
+		value.CheckPrecision(variable.precision);
+		variable.value = value;
+		return value.ToDouble();
+	}
+
 	std::map<std::string, double> m_scope;
+	// Lookup into m_scope by folded name id, m_scope keeps names as first assigned
+	std::unordered_map<SymbolTable::Id, std::map<std::string, double>::iterator> m_index;
+	// Declared DECIMAL variables by folded name id, values are mirrored in m_scope
+	std::unordered_map<SymbolTable::Id, DecimalVariable> m_decimals;
+	// Declared BIGINT variables by folded name id, values are mirrored in m_scope as doubles
+	std::unordered_map<SymbolTable::Id, std::optional<BigInt>> m_bigints;
+	// Values of LeafInvariantNode and InductionNode by slot
+	std::vector<double> m_invariants;
+	std::vector<InductionState> m_inductions;
+	RandomStream m_random;
+	bool m_floatingPointChecks = false;
 	double m_acc = 0;
+	uint64_t* m_coverage = nullptr;
+	uint64_t m_loopIterations = 0;
+	// No back-edges are counted while it is 0
+	uint64_t m_backEdgeLimit = 0;
+	std::unordered_map<const ForNode*, uint64_t> m_backEdges;
+	// Shared with the nested calculators
+	mutable ChainWalker m_chain;
 };
 
 class ReversePolishNotationTranslator : public IASTNodeVisitor
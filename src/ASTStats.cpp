@@ -0,0 +1,167 @@
+#include "ASTStats.h"
+#include <iostream>
+#include <iomanip>
+
+namespace
+{
+template <typename T>
+size_t GetHeapBytes(const std::vector<T>& vector)
+{
+	return vector.capacity() * sizeof(T);
+}
+
+size_t GetHeapBytes(const CompoundNode::Children& children)
+{
+	return children.capacity() > children.static_capacity ? children.capacity() * sizeof(ASTNode::Ptr) : 0;
+}
+
+size_t GetHeapBytes(const std::string& str)
+{
+	return str.capacity() > std::string().capacity() ? str.capacity() + 1 : 0;
+}
+}
+
+void ASTStatsCollector::Collect(const ASTNode& node)
+{
+	node.Accept(*this);
+}
+
+void ASTStatsCollector::Print(std::ostream& out)const
+{
+	Entry total;
+	out << std::left << std::setw(16) << "node" << std::right
+		<< std::setw(10) << "count" << std::setw(12) << "bytes" << std::setw(12) << "bytes/node" << std::endl;
+	for (const auto& [type, entry] : m_entries)
+	{
+		out << std::left << std::setw(16) << type << std::right
+			<< std::setw(10) << entry.count << std::setw(12) << entry.bytes
+			<< std::setw(12) << std::fixed << std::setprecision(1) << double(entry.bytes) / entry.count << std::endl;
+		total.count += entry.count;
+		total.bytes += entry.bytes;
+	}
+	out << std::left << std::setw(16) << "total" << std::right
+		<< std::setw(10) << total.count << std::setw(12) << total.bytes << std::endl;
+	out << std::left << std::setw(16) << "symbols" << std::right
+		<< std::setw(10) << SymbolTable::GetCount() << std::setw(12) << SymbolTable::GetMemoryUsage() << std::endl;
+}
+
+void ASTStatsCollector::Visit(const BinOpNode& binop)
+{
+	m_chain.Walk(binop, [this](const ASTNode& left) { Collect(left); },
+		[this](const BinOpNode& node) {
+			Add("BinOpNode", sizeof(node));
+			Collect(node.GetRight());
+		});
+}
+
+void ASTStatsCollector::Visit(const LeafNumNode& num)
+{
+	if (dynamic_cast<const LeafExactNumNode*>(&num))
+	{
+		Add("LeafExactNumNode", sizeof(LeafExactNumNode));
+		return;
+	}
+	if (num.GetExactInteger())
+	{
+		Add("LeafBigNumNode", sizeof(LeafBigNumNode));
+		return;
+	}
+	Add("LeafNumNode", sizeof(num));
+}
+
+void ASTStatsCollector::Visit(const UnOpNode& unop)
+{
+	Add("UnOpNode", sizeof(unop));
+	Collect(unop.GetExpression());
+}
+
+void ASTStatsCollector::Visit(const LeafVarNode& var)
+{
+	Add("LeafVarNode", sizeof(var));
+}
+
+void ASTStatsCollector::Visit(const LeafInvariantNode& invariant)
+{
+	Add("LeafInvariantNode", sizeof(invariant));
+}
+
+void ASTStatsCollector::Visit(const InductionNode& induction)
+{
+	Add("InductionNode", sizeof(induction));
+	Collect(induction.GetProduct());
+}
+
+void ASTStatsCollector::Visit(const RandomNode& random)
+{
+	Add("RandomNode", sizeof(random));
+}
+
+void ASTStatsCollector::Visit(const LeafNopNode& nop)
+{
+	Add("LeafNopNode", sizeof(nop));
+}
+
+void ASTStatsCollector::Visit(const AssignNode& assign)
+{
+	Add("AssignNode", sizeof(assign));
+	Collect(assign.GetRight());
+}
+
+void ASTStatsCollector::Visit(const CompoundNode& compound)
+{
+	Add("CompoundNode", sizeof(compound) + GetHeapBytes(compound.GetChildren()));
+	for (const auto& child : compound.GetChildren())
+	{
+		Collect(*child);
+	}
+}
+
+void ASTStatsCollector::Visit(const ForNode& loop)
+{
+	Add("ForNode", sizeof(loop) + GetHeapBytes(loop.GetInvariants()) + GetHeapBytes(loop.GetInductions()));
+	Collect(loop.GetStart());
+	Collect(loop.GetEnd());
+	for (const auto& invariant : loop.GetInvariants())
+	{
+		Collect(*invariant.expression);
+	}
+	Collect(loop.GetBody());
+}
+
+void ASTStatsCollector::Visit(const TypeNode& type)
+{
+	Add("TypeNode", sizeof(type));
+}
+
+void ASTStatsCollector::Visit(const VarDeclNode& vardecl)
+{
+	Add("VarDeclNode", sizeof(vardecl) + GetHeapBytes(vardecl.GetVariables()));
+	for (const auto& var : vardecl.GetVariables())
+	{
+		Collect(*var);
+	}
+	Collect(vardecl.GetTypeNode());
+}
+
+void ASTStatsCollector::Visit(const BlockNode& block)
+{
+	Add("BlockNode", sizeof(block) + GetHeapBytes(block.GetDeclarations()));
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Collect(*declaration);
+	}
+	Collect(block.GetCompound());
+}
+
+void ASTStatsCollector::Visit(const ProgramNode& program)
+{
+	Add("ProgramNode", sizeof(program) + GetHeapBytes(program.GetName()));
+	Collect(program.GetBlock());
+}
+
+void ASTStatsCollector::Add(const char* type, size_t bytes)
+{
+	auto& entry = m_entries[type];
+	++entry.count;
+	entry.bytes += bytes;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "AST.h"
+#include <iosfwd>
+
+// Counts nodes of each type and the memory they own: the node object itself
+// plus heap buffers of child lists and strings. Interned names are shared
+// by all nodes and reported separately.
+class ASTStatsCollector : public IASTNodeVisitor
+{
+public:
+	struct Entry
+	{
+		size_t count = 0;
+		size_t bytes = 0;
+	};
+
+	void Collect(const ASTNode& node);
+	void Print(std::ostream& out)const;
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	void Add(const char* type, size_t bytes);
+
+private:
+	std::map<std::string, Entry> m_entries;
+	ChainWalker m_chain;
+};
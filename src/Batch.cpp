@@ -0,0 +1,315 @@
+#include "Batch.h"
+#include "Columnar.h"
+#include "Csv.h"
+#include "Peephole.h"
+#include "VirtualMachine.h"
+#include <chrono>
+#include <charconv>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+// Longest to_chars output of a double
+constexpr size_t MAX_FIELD = 32;
+}
+
+BatchEvaluator::BatchEvaluator(const ProgramNode& program, Options options)
+	: m_program(program)
+	, m_options(options)
+{
+	try
+	{
+		m_code = std::make_unique<BytecodeProgram>(BytecodeCompiler().Compile(program));
+	}
+	catch (const std::runtime_error& ex)
+	{
+		throw std::runtime_error(std::string("batch mode needs a program the bytecode can express: ") + ex.what());
+	}
+	PeepholeOptimizer(m_options.contract).Optimize(*m_code);
+	m_code->Assemble();
+	if (!m_code->GetFixedDraws(m_draws) || m_draws.size() > MAX_FIXED_DRAWS)
+	{
+		m_draws.clear();
+	}
+	for (const auto& declaration : program.GetBlock().GetDeclarations())
+	{
+		for (const auto& var : declaration->GetVariables())
+		{
+			m_declared.push_back(var->GetName());
+		}
+	}
+}
+
+void BatchEvaluator::Run(const std::string& path, std::vector<std::string> outputs, std::FILE* out)
+{
+	Run(path, outputs, out, nullptr);
+}
+
+void BatchEvaluator::Run(const std::string& path, std::vector<std::string> outputs, const std::string& columnarPath)
+{
+	Run(path, outputs, nullptr, &columnarPath);
+}
+
+void BatchEvaluator::Run(const std::string& path, std::vector<std::string>& outputs, std::FILE* out,
+	const std::string* columnarPath)
+{
+	// Columnar files are used as mapped, CSV ones are parsed into 'storage'
+	std::unique_ptr<ColumnarFile> columnar;
+	std::unique_ptr<CsvReader> csv;
+	std::vector<std::string> header;
+	if (ColumnarFile::IsColumnar(path))
+	{
+		columnar = std::make_unique<ColumnarFile>(path);
+		for (const ColumnarFile::Column& column : columnar->GetColumns())
+		{
+			header.push_back(column.name);
+		}
+	}
+	else
+	{
+		csv = std::make_unique<CsvReader>(path, m_options.delimiter);
+		header = csv->GetHeader();
+	}
+	std::vector<std::string> inputs;
+	const bool allOutputs = outputs.empty();
+	for (const std::string& name : m_declared)
+	{
+		const bool input = std::any_of(header.begin(), header.end(), [&](const std::string& column) {
+			return boost::algorithm::iequals(column, name);
+		});
+		if (input)
+		{
+			inputs.push_back(name);
+		}
+		else if (allOutputs)
+		{
+			outputs.push_back(name);
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::vector<double>> storage(inputs.size());
+	std::vector<const double*> columns;
+	uint64_t rows = 0;
+	if (columnar)
+	{
+		rows = columnar->GetRowCount();
+		for (size_t i = 0; i < inputs.size(); ++i)
+		{
+			columns.push_back(columnar->GetDoubles(inputs[i], storage[i]));
+		}
+		m_stats.bytes += columnar->GetSize();
+	}
+	else
+	{
+		storage = csv->Read(inputs, m_options.threads);
+		rows = csv->GetStats().rows;
+		for (const std::vector<double>& column : storage)
+		{
+			columns.push_back(column.data());
+		}
+		m_stats.bytes += csv->GetStats().bytes;
+	}
+	const auto read = std::chrono::steady_clock::now();
+	m_stats.readSeconds += std::chrono::duration<double>(read - start).count();
+	start = read;
+
+	std::vector<uint32_t> inputIndices;
+	for (const std::string& input : inputs)
+	{
+		inputIndices.push_back(m_code->FindVariable(input));
+	}
+	std::vector<uint32_t> outputIndices;
+	for (const std::string& output : outputs)
+	{
+		outputIndices.push_back(m_code->FindVariable(output));
+	}
+
+	unsigned threads = m_options.threads ? m_options.threads : std::max(1u, std::thread::hardware_concurrency());
+	threads = static_cast<unsigned>(std::min<uint64_t>(threads, std::max<uint64_t>(rows, 1)));
+	// CSV text of the rows of every thread, written in order once all are
+	// done, or the output columns, NaN where a row leaves the variable unassigned
+	std::vector<std::string> texts(columnarPath ? 0 : threads);
+	std::vector<std::vector<double>> outputColumns(columnarPath ? outputs.size() : 0, std::vector<double>(rows));
+	std::mutex mutex;
+	std::exception_ptr error;
+	auto work = [&](unsigned part) {
+		try
+		{
+			VirtualMachine machine(*m_code);
+			const uint64_t begin = rows * part / threads;
+			const uint64_t end = rows * (part + 1) / threads;
+			char field[MAX_FIELD];
+			std::vector<double> draws(m_draws.size() * DRAW_ROWS);
+			// First row of the chunk the flags are tested after
+			uint64_t chunk = begin;
+			for (uint64_t row = begin; row < end; ++row)
+			{
+				if (m_options.floatingPointChecks && row == chunk)
+				{
+					std::feclearexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+				}
+				machine.Reset();
+				for (size_t i = 0; i < inputIndices.size(); ++i)
+				{
+					if (inputIndices[i] != BytecodeProgram::NO_VARIABLE)
+					{
+						machine.SetVariable(inputIndices[i], columns[i][row]);
+					}
+				}
+				if (m_draws.empty())
+				{
+					machine.SetRandomStream(RandomStream(m_options.seed, row));
+				}
+				else
+				{
+					if ((row - begin) % DRAW_ROWS == 0)
+					{
+						DrawRows(row, static_cast<size_t>(std::min(DRAW_ROWS, end - row)), draws.data());
+					}
+					machine.SetDraws(&draws[(row - begin) % DRAW_ROWS], DRAW_ROWS);
+				}
+				try
+				{
+					machine.Run();
+				}
+				catch (const std::exception& ex)
+				{
+					throw std::runtime_error("row " + std::to_string(row + 1) + ": " + ex.what());
+				}
+				for (size_t i = 0; i < outputIndices.size(); ++i)
+				{
+					// Copied out of the optional, whose value GCC takes as maybe
+					// uninitialized in to_chars
+					const std::optional<double> value = outputIndices[i] != BytecodeProgram::NO_VARIABLE
+						? machine.GetVariable(outputIndices[i])
+						: std::nullopt;
+					const bool assigned = value.has_value();
+					const double number = value.value_or(std::nan(""));
+					if (columnarPath)
+					{
+						outputColumns[i][row] = number;
+						continue;
+					}
+					if (i)
+					{
+						texts[part] += m_options.delimiter;
+					}
+					if (assigned)
+					{
+						texts[part].append(field, std::to_chars(field, field + MAX_FIELD, number).ptr);
+					}
+				}
+				if (!columnarPath)
+				{
+					texts[part] += '\n';
+				}
+				if (m_options.floatingPointChecks && (row + 1 == end || row + 1 - chunk == CHUNK))
+				{
+					if (std::fetestexcept(ExpressionCalculator::FLOATING_POINT_ERRORS))
+					{
+						CheckRows(chunk, row + 1, inputs, columns);
+					}
+					chunk = row + 1;
+				}
+			}
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			error = error ? error : std::current_exception();
+		}
+	};
+	std::vector<std::thread> workers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		workers.emplace_back(work, i);
+	}
+	work(0);
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+
+	if (columnarPath)
+	{
+		std::vector<const double*> results;
+		for (const std::vector<double>& column : outputColumns)
+		{
+			results.push_back(column.data());
+		}
+		ColumnarFile::Write(*columnarPath, outputs, results, rows);
+	}
+	else
+	{
+		const std::string line = boost::algorithm::join(outputs, std::string(1, m_options.delimiter)) + "\n";
+		bool written = std::fwrite(line.data(), 1, line.size(), out) == line.size();
+		for (const std::string& text : texts)
+		{
+			written = written && std::fwrite(text.data(), 1, text.size(), out) == text.size();
+		}
+		if (!written || std::fflush(out) != 0)
+		{
+			throw std::runtime_error("can't write the output");
+		}
+	}
+
+	m_stats.rows += rows;
+	m_stats.threads = threads;
+	m_stats.evaluateSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void BatchEvaluator::DrawRows(uint64_t first, size_t count, double* draws)const
+{
+	for (size_t i = 0; i < m_draws.size(); ++i)
+	{
+		auto lanes = m_draws[i] == RandomNode::Normal ? RandomStream::NormalLanes : RandomStream::UniformLanes;
+		lanes(m_options.seed, first, i, draws + i * DRAW_ROWS, count);
+	}
+}
+
+void BatchEvaluator::CheckRows(uint64_t begin, uint64_t end, const std::vector<std::string>& inputs,
+	const std::vector<const double*>& columns)const
+{
+	for (uint64_t row = begin; row < end; ++row)
+	{
+		ExpressionCalculator calculator;
+		for (size_t i = 0; i < inputs.size(); ++i)
+		{
+			calculator.SetVariable(inputs[i], columns[i][row]);
+		}
+		calculator.SetRandomStream(RandomStream(m_options.seed, row));
+		calculator.SetFloatingPointChecks(true);
+		try
+		{
+			calculator.Calculate(m_program);
+		}
+		catch (const std::exception& ex)
+		{
+			throw std::runtime_error("row " + std::to_string(row + 1) + ": " + ex.what());
+		}
+	}
+}
+
+const BatchEvaluator::Stats& BatchEvaluator::GetStats()const
+{
+	return m_stats;
+}
+
+void BatchEvaluator::PrintStats(std::ostream& out)const
+{
+	out << "rows: " << m_stats.rows << " on " << m_stats.threads << " threads" << std::endl;
+	out << "read: " << m_stats.bytes << " bytes in " << m_stats.readSeconds << " s, "
+		<< (m_stats.readSeconds > 0 ? static_cast<double>(m_stats.bytes) / m_stats.readSeconds / 1e9 : 0) << " GB/s"
+		<< std::endl;
+	out << "evaluated: " << m_stats.evaluateSeconds << " s, "
+		<< (m_stats.evaluateSeconds > 0 ? static_cast<double>(m_stats.rows) / m_stats.evaluateSeconds : 0) << " rows/s"
+		<< std::endl;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "Bytecode.h"
+#include <cstdio>
+#include <iosfwd>
+
+// Evaluates a program once per row of a CSV or columnar file. The columns
+// named like variables the program declares are its inputs, read by
+// CsvReader or used as mapped from a ColumnarFile; the outputs are written
+// as CSV in row order, a variable a row leaves unassigned as an empty
+// field, or as a columnar file, where it is NaN. The program is compiled
+// to bytecode once, the rows are split across threads, each running its
+// VirtualMachine over consecutive rows. Row n draws RANDOM from stream n of
+// the seed; when every RANDOM is outside loops each row draws the same
+// positions, and those are generated for blocks of rows at once.
+class BatchEvaluator
+{
+public:
+	struct Options
+	{
+		char delimiter = ',';
+		// 0 for one per hardware thread
+		unsigned threads = 0;
+		uint64_t seed = 0;
+		// See ExpressionCalculator::SetFloatingPointChecks. Bytecode tests
+		// the flags once per chunk of rows, the rows of a chunk raising one
+		// are run again in the tree walker to report the row and the statement
+		bool floatingPointChecks = false;
+		// Fuses multiply-add in the bytecode, see PeepholeOptimizer
+		bool contract = false;
+	};
+
+	struct Stats
+	{
+		uint64_t rows = 0;
+		uint64_t bytes = 0;
+		unsigned threads = 0;
+		// Parsing CSV, or mapping a columnar file
+		double readSeconds = 0;
+		// Output formatting included
+		double evaluateSeconds = 0;
+	};
+
+	// The program has to be expressible in bytecode and, with the
+	// floating-point checks, outlive the evaluator
+	BatchEvaluator(const ProgramNode& program, Options options);
+
+	// With no outputs, the declared variables not read from the file
+	void Run(const std::string& path, std::vector<std::string> outputs, std::FILE* out);
+	void Run(const std::string& path, std::vector<std::string> outputs, const std::string& columnarPath);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+private:
+	// Rows between tests of the floating-point flags
+	static constexpr uint64_t CHUNK = 4096;
+	// Rows drawn at once, and draws per row at most to do so
+	static constexpr uint64_t DRAW_ROWS = 256;
+	static constexpr size_t MAX_FIXED_DRAWS = 64;
+
+	// Writes CSV to 'out' without a columnar path
+	void Run(const std::string& path, std::vector<std::string>& outputs, std::FILE* out, const std::string* columnarPath);
+	// Runs the rows in [begin, end) in the tree walker with the floating-point
+	// checks, throws for the first raising an exception in a statement
+	void CheckRows(uint64_t begin, uint64_t end, const std::vector<std::string>& inputs,
+		const std::vector<const double*>& columns)const;
+	// The fixed draws of 'count' rows from 'first' on, DRAW_ROWS apart
+	void DrawRows(uint64_t first, size_t count, double* draws)const;
+
+	const ProgramNode& m_program;
+	Options m_options;
+	std::unique_ptr<BytecodeProgram> m_code;
+	std::vector<std::string> m_declared;
+	// RandomNode::Distribution of each draw of a row, empty if not fixed
+	std::vector<uint32_t> m_draws;
+	Stats m_stats;
+};
@@ -0,0 +1,614 @@
+#include "BigInt.h"
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <cassert>
+#include <stdexcept>
+#include <algorithm>
+
+struct BigInt::Large
+{
+	bool negative = false;
+	Magnitude magnitude;
+};
+
+namespace
+{
+using Magnitude = std::vector<uint32_t>;
+
+// Inline values are within [-2^62, 2^62)
+const uint64_t SMALL_LIMIT = uint64_t(1) << 62;
+
+void Trim(Magnitude& value)
+{
+	while (!value.empty() && value.back() == 0)
+	{
+		value.pop_back();
+	}
+}
+
+Magnitude MakeMagnitude(uint64_t value)
+{
+	Magnitude result{ static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32) };
+	Trim(result);
+	return result;
+}
+
+int CompareMagnitudes(const Magnitude& left, const Magnitude& right)
+{
+	if (left.size() != right.size())
+	{
+		return left.size() < right.size() ? -1 : 1;
+	}
+	for (size_t i = left.size(); i-- > 0;)
+	{
+		if (left[i] != right[i])
+		{
+			return left[i] < right[i] ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+Magnitude AddMagnitudes(const Magnitude& left, const Magnitude& right)
+{
+	const Magnitude& longer = left.size() >= right.size() ? left : right;
+	const Magnitude& shorter = left.size() >= right.size() ? right : left;
+	Magnitude result(longer.size() + 1);
+	uint64_t carry = 0;
+	for (size_t i = 0; i < longer.size(); ++i)
+	{
+		carry += uint64_t(longer[i]) + (i < shorter.size() ? shorter[i] : 0);
+		result[i] = static_cast<uint32_t>(carry);
+		carry >>= 32;
+	}
+	result.back() = static_cast<uint32_t>(carry);
+	Trim(result);
+	return result;
+}
+
+// Requires left >= right
+Magnitude SubtractMagnitudes(const Magnitude& left, const Magnitude& right)
+{
+	Magnitude result(left.size());
+	int64_t borrow = 0;
+	for (size_t i = 0; i < left.size(); ++i)
+	{
+		int64_t difference = int64_t(left[i]) - (i < right.size() ? right[i] : 0) - borrow;
+		borrow = difference < 0 ? 1 : 0;
+		result[i] = static_cast<uint32_t>(difference + (borrow << 32));
+	}
+	assert(borrow == 0);
+	Trim(result);
+	return result;
+}
+
+// Adds 'value' shifted by 'shift' limbs, 'result' must have room for the sum
+void AddShifted(Magnitude& result, const Magnitude& value, size_t shift)
+{
+	uint64_t carry = 0;
+	for (size_t i = 0; i < value.size() || carry != 0; ++i)
+	{
+		assert(shift + i < result.size());
+		carry += uint64_t(result[shift + i]) + (i < value.size() ? value[i] : 0);
+		result[shift + i] = static_cast<uint32_t>(carry);
+		carry >>= 32;
+	}
+}
+
+Magnitude MultiplySchoolbook(const uint32_t* left, size_t leftSize, const uint32_t* right, size_t rightSize)
+{
+	Magnitude result(leftSize + rightSize);
+	for (size_t i = 0; i < leftSize; ++i)
+	{
+		uint64_t carry = 0;
+		for (size_t j = 0; j < rightSize; ++j)
+		{
+			carry += uint64_t(left[i]) * right[j] + result[i + j];
+			result[i + j] = static_cast<uint32_t>(carry);
+			carry >>= 32;
+		}
+		result[i + rightSize] = static_cast<uint32_t>(carry);
+	}
+	Trim(result);
+	return result;
+}
+
+Magnitude MakeMagnitude(const uint32_t* begin, size_t size)
+{
+	Magnitude result(begin, begin + size);
+	Trim(result);
+	return result;
+}
+
+// Karatsuba splits both operands at 'half' limbs:
+// (a1 B + a0)(b1 B + b0) = a1 b1 B^2 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B + a0 b0
+Magnitude MultiplyMagnitudes(const uint32_t* left, size_t leftSize, const uint32_t* right, size_t rightSize)
+{
+	const size_t shorter = std::min(leftSize, rightSize);
+	const size_t longer = std::max(leftSize, rightSize);
+	if (shorter < BigInt::KARATSUBA_THRESHOLD || shorter * 2 < longer)
+	{
+		return MultiplySchoolbook(left, leftSize, right, rightSize);
+	}
+
+	const size_t half = longer / 2;
+	const Magnitude left0 = MakeMagnitude(left, half);
+	const Magnitude left1 = MakeMagnitude(left + half, leftSize - half);
+	const Magnitude right0 = MakeMagnitude(right, half);
+	const Magnitude right1 = MakeMagnitude(right + half, rightSize - half);
+
+	const Magnitude low = MultiplyMagnitudes(left0.data(), left0.size(), right0.data(), right0.size());
+	const Magnitude high = MultiplyMagnitudes(left1.data(), left1.size(), right1.data(), right1.size());
+	const Magnitude leftSum = AddMagnitudes(left0, left1);
+	const Magnitude rightSum = AddMagnitudes(right0, right1);
+	const Magnitude middle = SubtractMagnitudes(
+		SubtractMagnitudes(MultiplyMagnitudes(leftSum.data(), leftSum.size(), rightSum.data(), rightSum.size()), low),
+		high);
+
+	Magnitude result(leftSize + rightSize);
+	AddShifted(result, low, 0);
+	AddShifted(result, middle, half);
+	AddShifted(result, high, 2 * half);
+	Trim(result);
+	return result;
+}
+
+uint32_t DivideBySmall(Magnitude& value, uint32_t divisor)
+{
+	uint64_t remainder = 0;
+	for (size_t i = value.size(); i-- > 0;)
+	{
+		const uint64_t current = (remainder << 32) | value[i];
+		value[i] = static_cast<uint32_t>(current / divisor);
+		remainder = current % divisor;
+	}
+	Trim(value);
+	return static_cast<uint32_t>(remainder);
+}
+
+void MultiplyAddSmall(Magnitude& value, uint32_t factor, uint32_t addend)
+{
+	uint64_t carry = addend;
+	for (auto& limb : value)
+	{
+		carry += uint64_t(limb) * factor;
+		limb = static_cast<uint32_t>(carry);
+		carry >>= 32;
+	}
+	if (carry != 0)
+	{
+		value.push_back(static_cast<uint32_t>(carry));
+	}
+}
+
+// Knuth's algorithm D with 32-bit limbs, 'divisor' must not be empty
+void DivideMagnitudes(const Magnitude& dividend, const Magnitude& divisor, Magnitude& quotient, Magnitude& remainder)
+{
+	if (CompareMagnitudes(dividend, divisor) < 0)
+	{
+		quotient.clear();
+		remainder = dividend;
+		return;
+	}
+	if (divisor.size() == 1)
+	{
+		quotient = dividend;
+		remainder = MakeMagnitude(DivideBySmall(quotient, divisor[0]));
+		return;
+	}
+
+	// Normalize so that the top limb of the divisor has its high bit set
+	int shift = 0;
+	while ((divisor.back() << shift & 0x80000000u) == 0)
+	{
+		++shift;
+	}
+	const size_t n = divisor.size();
+	const size_t m = dividend.size() - n;
+	Magnitude v(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		v[i] = static_cast<uint32_t>((uint64_t(divisor[i]) << shift) | (i > 0 ? (uint64_t(divisor[i - 1]) << shift) >> 32 : 0));
+	}
+	Magnitude u(dividend.size() + 1);
+	for (size_t i = 0; i < dividend.size(); ++i)
+	{
+		u[i] = static_cast<uint32_t>((uint64_t(dividend[i]) << shift) | (i > 0 ? (uint64_t(dividend[i - 1]) << shift) >> 32 : 0));
+	}
+	u[dividend.size()] = static_cast<uint32_t>((uint64_t(dividend.back()) << shift) >> 32);
+
+	const uint64_t BASE = uint64_t(1) << 32;
+	quotient.assign(m + 1, 0);
+	for (size_t j = m + 1; j-- > 0;)
+	{
+		// Estimate the quotient limb from the top two limbs, it is at most 2 too large
+		const uint64_t top = (uint64_t(u[j + n]) << 32) | u[j + n - 1];
+		uint64_t estimate = top / v[n - 1];
+		uint64_t rest = top % v[n - 1];
+		while (estimate >= BASE || estimate * v[n - 2] > ((rest << 32) | u[j + n - 2]))
+		{
+			--estimate;
+			rest += v[n - 1];
+			if (rest >= BASE)
+			{
+				break;
+			}
+		}
+
+		// Subtract estimate * v from the current window of u
+		int64_t borrow = 0;
+		int64_t difference = 0;
+		for (size_t i = 0; i < n; ++i)
+		{
+			const uint64_t product = estimate * v[i];
+			difference = int64_t(u[i + j]) - borrow - int64_t(product & 0xFFFFFFFFu);
+			u[i + j] = static_cast<uint32_t>(difference);
+			borrow = int64_t(product >> 32) - (difference >> 32);
+		}
+		difference = int64_t(u[j + n]) - borrow;
+		u[j + n] = static_cast<uint32_t>(difference);
+
+		quotient[j] = static_cast<uint32_t>(estimate);
+		if (difference < 0)
+		{
+			// Estimate was one too large, add v back
+			--quotient[j];
+			uint64_t carry = 0;
+			for (size_t i = 0; i < n; ++i)
+			{
+				carry += uint64_t(u[i + j]) + v[i];
+				u[i + j] = static_cast<uint32_t>(carry);
+				carry >>= 32;
+			}
+			u[j + n] = static_cast<uint32_t>(u[j + n] + carry);
+		}
+	}
+	Trim(quotient);
+
+	remainder.assign(n, 0);
+	for (size_t i = 0; i < n; ++i)
+	{
+		remainder[i] = static_cast<uint32_t>(((uint64_t(u[i + 1]) << 32) | u[i]) >> shift);
+	}
+	Trim(remainder);
+}
+}
+
+#if !defined(__GNUC__) && !defined(__clang__)
+bool BigInt::AddOverflow(int64_t left, int64_t right, int64_t& result)
+{
+	if ((right > 0 && left > std::numeric_limits<int64_t>::max() - right) ||
+		(right < 0 && left < std::numeric_limits<int64_t>::min() - right))
+	{
+		return true;
+	}
+	result = left + right;
+	return false;
+}
+
+bool BigInt::SubOverflow(int64_t left, int64_t right, int64_t& result)
+{
+	if ((right < 0 && left > std::numeric_limits<int64_t>::max() + right) ||
+		(right > 0 && left < std::numeric_limits<int64_t>::min() + right))
+	{
+		return true;
+	}
+	result = left - right;
+	return false;
+}
+
+bool BigInt::MulOverflow(int64_t left, int64_t right, int64_t& result)
+{
+	const int64_t max = std::numeric_limits<int64_t>::max();
+	const int64_t min = std::numeric_limits<int64_t>::min();
+	if (left > 0 ? (right > 0 ? left > max / right : right < min / left)
+		: (right > 0 ? left < min / right : left != 0 && right < max / left))
+	{
+		return true;
+	}
+	result = left * right;
+	return false;
+}
+#endif
+
+BigInt::BigInt(int64_t value)
+	: m_word(1)
+{
+	if (value >= -int64_t(SMALL_LIMIT) && value < int64_t(SMALL_LIMIT))
+	{
+		m_word = (static_cast<uint64_t>(value) << 1) | 1;
+		return;
+	}
+	const uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+	*this = Make(value < 0, MakeMagnitude(magnitude));
+}
+
+BigInt::BigInt(const BigInt& other)
+	: m_word(other.m_word)
+{
+	if (!other.IsSmall())
+	{
+		m_word = reinterpret_cast<uintptr_t>(new Large(*reinterpret_cast<const Large*>(other.m_word)));
+	}
+}
+
+BigInt::BigInt(BigInt&& other)noexcept
+	: m_word(other.m_word)
+{
+	other.m_word = 1;
+}
+
+BigInt& BigInt::operator=(const BigInt& other)
+{
+	if (this != &other)
+	{
+		*this = BigInt(other);
+	}
+	return *this;
+}
+
+BigInt& BigInt::operator=(BigInt&& other)noexcept
+{
+	std::swap(m_word, other.m_word);
+	return *this;
+}
+
+BigInt::~BigInt()
+{
+	if (!IsSmall())
+	{
+		delete reinterpret_cast<Large*>(m_word);
+	}
+}
+
+BigInt BigInt::Parse(std::string_view text)
+{
+	const bool negative = !text.empty() && text.front() == '-';
+	text.remove_prefix(negative ? 1 : 0);
+	if (text.empty())
+	{
+		throw std::invalid_argument("invalid integer constant");
+	}
+
+	Magnitude magnitude;
+	uint32_t chunk = 0;
+	uint32_t factor = 1;
+	for (char ch : text)
+	{
+		if (ch < '0' || ch > '9')
+		{
+			throw std::invalid_argument("invalid integer constant");
+		}
+		chunk = chunk * 10 + (ch - '0');
+		factor *= 10;
+		if (factor == 1000000000)
+		{
+			MultiplyAddSmall(magnitude, factor, chunk);
+			chunk = 0;
+			factor = 1;
+		}
+	}
+	MultiplyAddSmall(magnitude, factor, chunk);
+	return Make(negative, std::move(magnitude));
+}
+
+BigInt BigInt::FromDouble(double value)
+{
+	if (!std::isfinite(value) || std::trunc(value) != value)
+	{
+		throw std::invalid_argument("value is not an integer");
+	}
+	if (std::abs(value) < static_cast<double>(SMALL_LIMIT))
+	{
+		return BigInt(static_cast<int64_t>(value));
+	}
+
+	// value = mantissa * 2^exponent with a 53-bit integral mantissa
+	int exponent = 0;
+	const double fraction = std::frexp(std::abs(value), &exponent);
+	const uint64_t mantissa = static_cast<uint64_t>(std::ldexp(fraction, 53));
+	exponent -= 53;
+	assert(exponent > 0);
+
+	Magnitude magnitude(exponent / 32, 0);
+	const int bits = exponent % 32;
+	magnitude.push_back(static_cast<uint32_t>(mantissa << bits));
+	magnitude.push_back(static_cast<uint32_t>((mantissa << bits) >> 32));
+	magnitude.push_back(static_cast<uint32_t>(bits == 0 ? 0 : mantissa >> (64 - bits)));
+	return Make(value < 0, std::move(magnitude));
+}
+
+bool BigInt::IsNegative()const
+{
+	if (IsSmall())
+	{
+		return Word(*this) < 0;
+	}
+	return reinterpret_cast<const Large*>(m_word)->negative;
+}
+
+bool BigInt::TryGetInt64(int64_t& value)const
+{
+	if (IsSmall())
+	{
+		value = Word(*this) >> 1;
+		return true;
+	}
+	const Large& large = *reinterpret_cast<const Large*>(m_word);
+	if (large.magnitude.size() > 2)
+	{
+		return false;
+	}
+	const uint64_t magnitude = (uint64_t(large.magnitude[1]) << 32) | large.magnitude[0];
+	const uint64_t limit = uint64_t(std::numeric_limits<int64_t>::max()) + (large.negative ? 1 : 0);
+	if (magnitude > limit)
+	{
+		return false;
+	}
+	value = large.negative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+	return true;
+}
+
+double BigInt::ToDouble()const
+{
+	if (IsSmall())
+	{
+		return static_cast<double>(Word(*this) >> 1);
+	}
+	const Large& large = *reinterpret_cast<const Large*>(m_word);
+	double result = 0;
+	for (size_t i = large.magnitude.size(); i-- > 0;)
+	{
+		result = result * 4294967296.0 + large.magnitude[i];
+	}
+	return large.negative ? -result : result;
+}
+
+std::string BigInt::ToString()const
+{
+	if (IsSmall())
+	{
+		return std::to_string(Word(*this) >> 1);
+	}
+	const Large& large = *reinterpret_cast<const Large*>(m_word);
+	Magnitude magnitude = large.magnitude;
+	std::string digits;
+	while (!magnitude.empty())
+	{
+		uint32_t chunk = DivideBySmall(magnitude, 1000000000);
+		for (int i = 0; i < 9 && (chunk != 0 || !magnitude.empty()); ++i)
+		{
+			digits += static_cast<char>('0' + chunk % 10);
+			chunk /= 10;
+		}
+	}
+	if (large.negative)
+	{
+		digits += '-';
+	}
+	std::reverse(digits.begin(), digits.end());
+	return digits;
+}
+
+BigInt BigInt::DivideRounded(const BigInt& left, const BigInt& right)
+{
+	if (right.m_word == 1)
+	{
+		throw std::domain_error("division by zero");
+	}
+	return DivideRoundedUnchecked(left, right);
+}
+
+BigInt BigInt::DivideRoundedUnchecked(const BigInt& left, const BigInt& right)
+{
+	assert(right.m_word != 1);
+	if (left.IsSmall() && right.IsSmall())
+	{
+		const int64_t dividend = Word(left) >> 1;
+		const int64_t divisor = Word(right) >> 1;
+		int64_t quotient = dividend / divisor;
+		const int64_t remainder = dividend % divisor;
+		if (2 * std::abs(remainder) >= std::abs(divisor))
+		{
+			quotient += (dividend < 0) != (divisor < 0) ? -1 : 1;
+		}
+		return BigInt(quotient);
+	}
+
+	Magnitude dividend;
+	Magnitude divisor;
+	const bool negative = left.Split(dividend) != right.Split(divisor);
+	Magnitude quotient;
+	Magnitude remainder;
+	DivideMagnitudes(dividend, divisor, quotient, remainder);
+	if (CompareMagnitudes(AddMagnitudes(remainder, remainder), divisor) >= 0)
+	{
+		quotient = AddMagnitudes(quotient, MakeMagnitude(1));
+	}
+	return Make(negative, std::move(quotient));
+}
+
+BigInt BigInt::Add(const BigInt& left, const BigInt& right, bool subtract)
+{
+	Magnitude leftMagnitude;
+	Magnitude rightMagnitude;
+	const bool leftNegative = left.Split(leftMagnitude);
+	const bool rightNegative = right.Split(rightMagnitude) != subtract;
+	if (leftNegative == rightNegative)
+	{
+		return Make(leftNegative, AddMagnitudes(leftMagnitude, rightMagnitude));
+	}
+	if (CompareMagnitudes(leftMagnitude, rightMagnitude) >= 0)
+	{
+		return Make(leftNegative, SubtractMagnitudes(leftMagnitude, rightMagnitude));
+	}
+	return Make(rightNegative, SubtractMagnitudes(rightMagnitude, leftMagnitude));
+}
+
+BigInt BigInt::Multiply(const BigInt& left, const BigInt& right)
+{
+	Magnitude leftMagnitude;
+	Magnitude rightMagnitude;
+	const bool negative = left.Split(leftMagnitude) != right.Split(rightMagnitude);
+	return Make(negative, MultiplyMagnitudes(
+		leftMagnitude.data(), leftMagnitude.size(), rightMagnitude.data(), rightMagnitude.size()));
+}
+
+BigInt BigInt::Negate(const BigInt& value)
+{
+	Magnitude magnitude;
+	const bool negative = value.Split(magnitude);
+	return Make(!negative, std::move(magnitude));
+}
+
+int BigInt::Compare(const BigInt& left, const BigInt& right)
+{
+	if (left.IsSmall() && right.IsSmall())
+	{
+		return Word(left) < Word(right) ? -1 : Word(left) > Word(right) ? 1 : 0;
+	}
+	Magnitude leftMagnitude;
+	Magnitude rightMagnitude;
+	const bool leftNegative = left.Split(leftMagnitude);
+	const bool rightNegative = right.Split(rightMagnitude);
+	if (leftNegative != rightNegative)
+	{
+		return leftNegative ? -1 : 1;
+	}
+	const int result = CompareMagnitudes(leftMagnitude, rightMagnitude);
+	return leftNegative ? -result : result;
+}
+
+BigInt BigInt::Make(bool negative, Magnitude&& magnitude)
+{
+	Trim(magnitude);
+	negative = negative && !magnitude.empty();
+	if (magnitude.size() <= 2)
+	{
+		const uint64_t value = magnitude.empty() ? 0
+			: (uint64_t(magnitude.size() == 2 ? magnitude[1] : 0) << 32) | magnitude[0];
+		if (value < SMALL_LIMIT || (negative && value == SMALL_LIMIT))
+		{
+			const int64_t signedValue = negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+			return FromWord((static_cast<uint64_t>(signedValue) << 1) | 1);
+		}
+	}
+	BigInt result;
+	result.m_word = reinterpret_cast<uintptr_t>(new Large{ negative, std::move(magnitude) });
+	assert(!result.IsSmall());
+	return result;
+}
+
+bool BigInt::Split(Magnitude& magnitude)const
+{
+	if (IsSmall())
+	{
+		const int64_t value = Word(*this) >> 1;
+		magnitude = MakeMagnitude(value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value));
+		return value < 0;
+	}
+	const Large& large = *reinterpret_cast<const Large*>(m_word);
+	magnitude = large.magnitude;
+	return large.negative;
+}
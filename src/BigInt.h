@@ -0,0 +1,186 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+// Arbitrary-precision integer in a single 64-bit word. Values that fit into
+// 63 bits are stored inline as (value << 1) | 1, so arithmetic on them is a
+// couple of instructions with an overflow check; greater values spill into
+// a heap-allocated magnitude of 32-bit limbs, the word then holds a pointer
+// to it (aligned, so its low bit is 0). Results that fit into 63 bits again
+// are always stored inline.
+class BigInt
+{
+public:
+	// Operands with at least this many limbs are multiplied with Karatsuba
+	static constexpr size_t KARATSUBA_THRESHOLD = 32;
+
+	BigInt()
+		: m_word(1)
+	{
+	}
+
+	BigInt(int64_t value);
+	BigInt(const BigInt& other);
+	BigInt(BigInt&& other)noexcept;
+	BigInt& operator=(const BigInt& other);
+	BigInt& operator=(BigInt&& other)noexcept;
+	~BigInt();
+
+	// Optional '-' followed by decimal digits
+	static BigInt Parse(std::string_view text);
+	// The value must be integral
+	static BigInt FromDouble(double value);
+
+	bool IsSmall()const
+	{
+		return (m_word & 1) != 0;
+	}
+
+	bool IsNegative()const;
+	bool TryGetInt64(int64_t& value)const;
+	// Nearest double for values up to 2^53, approximate beyond
+	double ToDouble()const;
+	std::string ToString()const;
+
+	friend BigInt operator+(const BigInt& left, const BigInt& right)
+	{
+		int64_t sum;
+		if ((left.m_word & right.m_word & 1) && !AddOverflow(Word(left), Word(right) - 1, sum))
+		{
+			return FromWord(static_cast<uint64_t>(sum));
+		}
+		return Add(left, right, false);
+	}
+
+	friend BigInt operator-(const BigInt& left, const BigInt& right)
+	{
+		int64_t difference;
+		if ((left.m_word & right.m_word & 1) && !SubOverflow(Word(left), Word(right) - 1, difference))
+		{
+			return FromWord(static_cast<uint64_t>(difference));
+		}
+		return Add(left, right, true);
+	}
+
+	friend BigInt operator*(const BigInt& left, const BigInt& right)
+	{
+		int64_t product;
+		if ((left.m_word & right.m_word & 1) && !MulOverflow(Word(left) - 1, Word(right) >> 1, product))
+		{
+			return FromWord(static_cast<uint64_t>(product) | 1);
+		}
+		return Multiply(left, right);
+	}
+
+	BigInt operator-()const
+	{
+		int64_t negated;
+		if (IsSmall() && !SubOverflow(2, Word(*this), negated))
+		{
+			return FromWord(static_cast<uint64_t>(negated));
+		}
+		return Negate(*this);
+	}
+
+	// Operands and the result are known to fit into 63 bits, see RangeAnalysis
+	static BigInt AddUnchecked(const BigInt& left, const BigInt& right)
+	{
+		return FromWord(left.m_word + right.m_word - 1);
+	}
+
+	static BigInt SubtractUnchecked(const BigInt& left, const BigInt& right)
+	{
+		return FromWord(left.m_word - right.m_word + 1);
+	}
+
+	static BigInt MultiplyUnchecked(const BigInt& left, const BigInt& right)
+	{
+		return FromWord((left.m_word - 1) * static_cast<uint64_t>(Word(right) >> 1) | 1);
+	}
+
+	// Quotient rounded half away from zero, like DIV of ExpressionCalculator
+	static BigInt DivideRounded(const BigInt& left, const BigInt& right);
+	// Same for a divisor known to be non-zero
+	static BigInt DivideRoundedUnchecked(const BigInt& left, const BigInt& right);
+
+	// Same for the divisor 2^shift, 0 < shift < 63: inline values are shifted
+	static BigInt DivideRoundedByPowerOfTwo(const BigInt& left, unsigned shift)
+	{
+		if (left.IsSmall())
+		{
+			const int64_t value = Word(left) >> 1;
+			const int64_t half = int64_t(1) << (shift - 1);
+			const int64_t quotient = value < 0 ? -((half - value) >> shift) : (value + half) >> shift;
+			return FromWord(static_cast<uint64_t>(quotient) << 1 | 1);
+		}
+		return DivideRounded(left, BigInt(int64_t(1) << shift));
+	}
+
+	friend bool operator==(const BigInt& left, const BigInt& right)
+	{
+		return Compare(left, right) == 0;
+	}
+
+	friend bool operator!=(const BigInt& left, const BigInt& right)
+	{
+		return Compare(left, right) != 0;
+	}
+
+	friend bool operator<(const BigInt& left, const BigInt& right)
+	{
+		return Compare(left, right) < 0;
+	}
+
+private:
+	struct Large;
+	// Little-endian limbs without leading zeros
+	using Magnitude = std::vector<uint32_t>;
+
+	static BigInt FromWord(uint64_t word)
+	{
+		BigInt result;
+		result.m_word = word;
+		return result;
+	}
+
+	static int64_t Word(const BigInt& value)
+	{
+		return static_cast<int64_t>(value.m_word);
+	}
+
+	static bool AddOverflow(int64_t left, int64_t right, int64_t& result);
+	static bool SubOverflow(int64_t left, int64_t right, int64_t& result);
+	static bool MulOverflow(int64_t left, int64_t right, int64_t& result);
+
+	// Slow paths for operands or results that do not fit into 63 bits
+	static BigInt Add(const BigInt& left, const BigInt& right, bool subtract);
+	static BigInt Multiply(const BigInt& left, const BigInt& right);
+	static BigInt Negate(const BigInt& value);
+	static int Compare(const BigInt& left, const BigInt& right);
+
+	static BigInt Make(bool negative, Magnitude&& magnitude);
+	// Returns the sign, inline values are expanded into limbs
+	bool Split(Magnitude& magnitude)const;
+
+private:
+	uint64_t m_word;
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+inline bool BigInt::AddOverflow(int64_t left, int64_t right, int64_t& result)
+{
+	return __builtin_add_overflow(left, right, &result);
+}
+
+inline bool BigInt::SubOverflow(int64_t left, int64_t right, int64_t& result)
+{
+	return __builtin_sub_overflow(left, right, &result);
+}
+
+inline bool BigInt::MulOverflow(int64_t left, int64_t right, int64_t& result)
+{
+	return __builtin_mul_overflow(left, right, &result);
+}
+#endif
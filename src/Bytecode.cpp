@@ -0,0 +1,402 @@
+#include "Bytecode.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+namespace
+{
+const char* GetName(OpCode op)
+{
+	switch (op)
+	{
+	case OpCode::Label:
+		return "Label";
+	case OpCode::PushConst:
+		return "PushConst";
+	case OpCode::Load:
+		return "Load";
+	case OpCode::Store:
+		return "Store";
+	case OpCode::Tee:
+		return "Tee";
+	case OpCode::Pop:
+		return "Pop";
+	case OpCode::Dup:
+		return "Dup";
+	case OpCode::Add:
+		return "Add";
+	case OpCode::Sub:
+		return "Sub";
+	case OpCode::Mul:
+		return "Mul";
+	case OpCode::Div:
+		return "Div";
+	case OpCode::IntDiv:
+		return "IntDiv";
+	case OpCode::IntDivByPowerOfTwo:
+		return "IntDivByPowerOfTwo";
+	case OpCode::Neg:
+		return "Neg";
+	case OpCode::Pos:
+		return "Pos";
+	case OpCode::Random:
+		return "Random";
+	case OpCode::MulAdd:
+		return "MulAdd";
+	case OpCode::MulSub:
+		return "MulSub";
+	case OpCode::AddMul:
+		return "AddMul";
+	case OpCode::SubMul:
+		return "SubMul";
+	case OpCode::ForEnter:
+		return "ForEnter";
+	case OpCode::ForNext:
+		return "ForNext";
+	case OpCode::Count:
+		return "Count";
+	}
+	return "?";
+}
+}
+
+uint32_t BytecodeProgram::AddConstant(double value)
+{
+	constants.push_back(value);
+	return static_cast<uint32_t>(constants.size() - 1);
+}
+
+uint32_t BytecodeProgram::FindVariable(const std::string& name)const
+{
+	for (uint32_t i = 0; i < variables.size(); ++i)
+	{
+		if (!variables[i].empty() && boost::algorithm::iequals(variables[i], name))
+		{
+			return i;
+		}
+	}
+	return NO_VARIABLE;
+}
+
+void BytecodeProgram::Assemble()
+{
+	if (assembled)
+	{
+		return;
+	}
+	std::vector<uint32_t> labels;
+	std::vector<Instruction> assembledCode;
+	assembledCode.reserve(code.size());
+	for (const Instruction& instruction : code)
+	{
+		if (instruction.op == OpCode::Label)
+		{
+			if (instruction.operand >= labels.size())
+			{
+				labels.resize(instruction.operand + 1);
+			}
+			labels[instruction.operand] = static_cast<uint32_t>(assembledCode.size());
+			continue;
+		}
+		assembledCode.push_back(instruction);
+	}
+	for (Loop& loop : loops)
+	{
+		loop.body = labels.at(loop.body);
+		loop.exit = labels.at(loop.exit);
+	}
+	code = std::move(assembledCode);
+	assembled = true;
+}
+
+bool BytecodeProgram::GetFixedDraws(std::vector<uint32_t>& distributions)const
+{
+	distributions.clear();
+	// Code before it belongs to a loop
+	size_t loopEnd = 0;
+	for (size_t pc = 0; pc < code.size(); ++pc)
+	{
+		if (code[pc].op == OpCode::ForEnter)
+		{
+			loopEnd = std::max<size_t>(loopEnd, loops[code[pc].operand].exit);
+		}
+		else if (code[pc].op == OpCode::Random)
+		{
+			if (pc < loopEnd)
+			{
+				return false;
+			}
+			distributions.push_back(code[pc].operand);
+		}
+	}
+	return true;
+}
+
+void BytecodeProgram::Print(std::ostream& out)const
+{
+	auto variable = [this](uint32_t index) {
+		return variables[index].empty() ? "$" + std::to_string(index) : variables[index];
+	};
+	for (size_t i = 0; i < code.size(); ++i)
+	{
+		const Instruction& instruction = code[i];
+		out << std::setw(6) << i << "  " << std::left << std::setw(20) << GetName(instruction.op) << std::right;
+		switch (instruction.op)
+		{
+		case OpCode::PushConst:
+		case OpCode::IntDivByPowerOfTwo:
+			out << constants[instruction.operand];
+			break;
+		case OpCode::Load:
+		case OpCode::Store:
+		case OpCode::Tee:
+			out << variable(instruction.operand);
+			break;
+		case OpCode::Label:
+			out << "L" << instruction.operand;
+			break;
+		case OpCode::Random:
+			out << (instruction.operand == RandomNode::Normal ? "normal" : "uniform");
+			break;
+		case OpCode::ForEnter:
+			out << variable(loops[instruction.operand].variable) << ", exit "
+				<< (assembled ? "" : "L") << loops[instruction.operand].exit;
+			break;
+		case OpCode::ForNext:
+			out << variable(loops[instruction.operand].variable) << ", body "
+				<< (assembled ? "" : "L") << loops[instruction.operand].body;
+			break;
+		case OpCode::Count:
+			out << coverageBlocks[instruction.operand].size() << " statements";
+			break;
+		default:
+			break;
+		}
+		out << std::endl;
+	}
+}
+
+BytecodeProgram BytecodeCompiler::Compile(const ProgramNode& program)
+{
+	if (m_coverage)
+	{
+		StartCoverageBlock();
+	}
+	program.Accept(*this);
+	return std::move(m_program);
+}
+
+BytecodeProgram BytecodeCompiler::CompileLoop(const ForNode& loop)
+{
+	loop.Accept(*this);
+	return std::move(m_program);
+}
+
+void BytecodeCompiler::SetCoverage(bool coverage)
+{
+	m_coverage = coverage;
+}
+
+void BytecodeCompiler::Visit(const BinOpNode& binop)
+{
+	m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+		[this](const BinOpNode& node) {
+			if (node.GetShift())
+			{
+				Emit(OpCode::IntDivByPowerOfTwo, m_program.AddConstant(std::ldexp(1.0, -node.GetShift())));
+				return;
+			}
+			node.GetRight().Accept(*this);
+			switch (node.GetOperator())
+			{
+			case BinOpNode::Plus:
+				Emit(OpCode::Add);
+				break;
+			case BinOpNode::Minus:
+				Emit(OpCode::Sub);
+				break;
+			case BinOpNode::Mul:
+				Emit(OpCode::Mul);
+				break;
+			case BinOpNode::IntegerDiv:
+				Emit(OpCode::IntDiv);
+				break;
+			case BinOpNode::FloatDiv:
+				Emit(OpCode::Div);
+				break;
+			default:
+				throw std::logic_error("undefined operator");
+			}
+		});
+}
+
+void BytecodeCompiler::Visit(const LeafNumNode& num)
+{
+	Emit(OpCode::PushConst, m_program.AddConstant(num.GetValue()));
+}
+
+void BytecodeCompiler::Visit(const UnOpNode& unop)
+{
+	unop.GetExpression().Accept(*this);
+	switch (unop.GetOperator())
+	{
+	case UnOpNode::Plus:
+		Emit(OpCode::Pos);
+		break;
+	case UnOpNode::Minus:
+		Emit(OpCode::Neg);
+		break;
+	default:
+		throw std::logic_error("undefined unary operator");
+	}
+}
+
+void BytecodeCompiler::Visit(const LeafVarNode& var)
+{
+	Emit(OpCode::Load, GetVariable(var.GetName()));
+}
+
+void BytecodeCompiler::Visit(const LeafInvariantNode& invariant)
+{
+	Emit(OpCode::Load, GetInvariant(invariant.GetSlot()));
+}
+
+void BytecodeCompiler::Visit(const InductionNode& induction)
+{
+	induction.GetProduct().Accept(*this);
+}
+
+void BytecodeCompiler::Visit(const RandomNode& random)
+{
+	Emit(OpCode::Random, random.GetDistribution());
+}
+
+void BytecodeCompiler::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void BytecodeCompiler::Visit(const AssignNode& assign)
+{
+	assign.GetRight().Accept(*this);
+	Emit(OpCode::Tee, GetVariable(assign.GetLeft()));
+	Emit(OpCode::Pop);
+}
+
+void BytecodeCompiler::Visit(const CompoundNode& compound)
+{
+	if (m_coverageBlock != NO_COVERAGE_BLOCK)
+	{
+		std::vector<uint32_t>& block = m_program.coverageBlocks[m_coverageBlock];
+		for (size_t i = 0; i < compound.GetCount(); ++i)
+		{
+			block.push_back(compound.GetCoverageSlot() + static_cast<uint32_t>(i));
+		}
+	}
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void BytecodeCompiler::Visit(const ForNode& loop)
+{
+	BytecodeProgram::Loop compiled;
+	compiled.variable = GetVariable(loop.GetVariable());
+	compiled.step = loop.GetDirection() == ForNode::To ? 1 : -1;
+	compiled.body = NewLabel();
+	compiled.exit = NewLabel();
+	const uint32_t index = static_cast<uint32_t>(m_program.loops.size());
+	m_program.loops.push_back(compiled);
+
+	loop.GetStart().Accept(*this);
+	loop.GetEnd().Accept(*this);
+	Emit(OpCode::ForEnter, index);
+	for (const auto& invariant : loop.GetInvariants())
+	{
+		invariant.expression->Accept(*this);
+		Emit(OpCode::Store, GetInvariant(invariant.slot));
+	}
+	Emit(OpCode::Label, compiled.body);
+	const uint32_t enclosingBlock = m_coverageBlock;
+	if (m_coverage)
+	{
+		StartCoverageBlock();
+		if (loop.GetCoverageSlot() != ForNode::NO_COVERAGE_SLOT)
+		{
+			m_program.coverageBlocks[m_coverageBlock].push_back(loop.GetCoverageSlot());
+		}
+	}
+	loop.GetBody().Accept(*this);
+	m_coverageBlock = enclosingBlock;
+	Emit(OpCode::ForNext, index);
+	Emit(OpCode::Label, compiled.exit);
+}
+
+void BytecodeCompiler::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void BytecodeCompiler::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode::Type type = vardecl.GetTypeNode().GetType();
+	if (type == TypeNode::Decimal || type == TypeNode::BigInt)
+	{
+		throw std::runtime_error("bytecode supports INTEGER and REAL variables only");
+	}
+}
+
+void BytecodeCompiler::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	Visit(block.GetCompound());
+}
+
+void BytecodeCompiler::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+void BytecodeCompiler::Emit(OpCode op, uint32_t operand)
+{
+	m_program.code.push_back({ op, operand });
+}
+
+uint32_t BytecodeCompiler::GetVariable(const std::string& name)
+{
+	auto [it, inserted] = m_variables.emplace(boost::algorithm::to_lower_copy(name), 0);
+	if (inserted)
+	{
+		it->second = static_cast<uint32_t>(m_program.variables.size());
+		m_program.variables.push_back(name);
+	}
+	return it->second;
+}
+
+uint32_t BytecodeCompiler::GetInvariant(uint32_t slot)
+{
+	auto [it, inserted] = m_program.invariants.emplace(slot, 0);
+	if (inserted)
+	{
+		it->second = static_cast<uint32_t>(m_program.variables.size());
+		m_program.variables.emplace_back();
+	}
+	return it->second;
+}
+
+uint32_t BytecodeCompiler::NewLabel()
+{
+	return m_labels++;
+}
+
+void BytecodeCompiler::StartCoverageBlock()
+{
+	m_coverageBlock = static_cast<uint32_t>(m_program.coverageBlocks.size());
+	m_program.coverageBlocks.emplace_back();
+	Emit(OpCode::Count, m_coverageBlock);
+}
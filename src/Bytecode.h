@@ -0,0 +1,126 @@
+#pragma once
+#include "AST.h"
+#include <iosfwd>
+
+// Instructions of the stack machine, see VirtualMachine
+enum class OpCode : uint8_t
+{
+	Label, // jump target, removed by Assemble
+	PushConst, // constant
+	Load, // variable
+	Store, // variable, pops the value
+	Tee, // variable, keeps the value on the stack
+	Pop,
+	Dup,
+	Add,
+	Sub,
+	Mul,
+	Div,
+	IntDiv,
+	IntDivByPowerOfTwo, // constant holding 2^-k
+	Neg,
+	Pos,
+	Random, // RandomNode::Distribution
+	// Fused multiply-add, rounded once, see PeepholeOptimizer
+	MulAdd, // a * b + c, c on top of the stack
+	MulSub, // a * b - c
+	AddMul, // c + a * b, b on top of the stack
+	SubMul, // c - a * b
+	ForEnter, // loop, pops end and start
+	ForNext, // loop
+	Count, // coverage block, see BytecodeCompiler::SetCoverage
+};
+
+struct Instruction
+{
+	OpCode op;
+	uint32_t operand = 0;
+};
+
+// Compiled program: variables are numbered in the order they appear, hidden
+// ones (loop invariants) have empty names and are not reported
+struct BytecodeProgram
+{
+	struct Loop
+	{
+		uint32_t variable = 0;
+		double step = 1; // -1 for DOWNTO
+		// Labels until Assemble, instruction indices after it
+		uint32_t body = 0;
+		uint32_t exit = 0;
+	};
+
+	std::vector<Instruction> code;
+	std::vector<double> constants;
+	std::vector<std::string> variables;
+	// Hidden variables of LeafInvariantNode slots
+	std::unordered_map<uint32_t, uint32_t> invariants;
+	std::vector<Loop> loops;
+	// StatementCoverage slots of the statements each Count instruction runs
+	std::vector<std::vector<uint32_t>> coverageBlocks;
+	bool assembled = false;
+
+	static constexpr uint32_t NO_VARIABLE = UINT32_MAX;
+
+	uint32_t AddConstant(double value);
+	// Index of the variable, ignoring case, or NO_VARIABLE
+	uint32_t FindVariable(const std::string& name)const;
+	// Resolves labels of the loops into instruction indices and drops them
+	void Assemble();
+	// Distributions of the Random instructions of assembled code, in the order
+	// every run executes them; false when one is in a loop, whose bounds
+	// decide how often it runs
+	bool GetFixedDraws(std::vector<uint32_t>& distributions)const;
+	void Print(std::ostream& out)const;
+};
+
+// Naive lowering of a program, one instruction per node. Assignments are
+// expressions leaving their value, statements drop it. Only INTEGER and
+// REAL variables are supported; InductionNode products are computed as is.
+class BytecodeCompiler : public IASTNodeVisitor
+{
+public:
+	BytecodeProgram Compile(const ProgramNode& program);
+	// Just the loop, which is loops[0]; invariants of enclosing loops become
+	// hidden variables the caller has to set
+	BytecodeProgram CompileLoop(const ForNode& loop);
+	// Counts statements for StatementCoverage: the program and every loop
+	// body start with a Count of the statements run as often as it. The
+	// statements around the loop of CompileLoop are left to the caller
+	void SetCoverage(bool coverage);
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	void Emit(OpCode op, uint32_t operand = 0);
+	uint32_t GetVariable(const std::string& name);
+	uint32_t GetInvariant(uint32_t slot);
+	uint32_t NewLabel();
+	void StartCoverageBlock();
+
+private:
+	BytecodeProgram m_program;
+	// By lowercase name
+	std::unordered_map<std::string, uint32_t> m_variables;
+	uint32_t m_labels = 0;
+	ChainWalker m_chain;
+	static constexpr uint32_t NO_COVERAGE_BLOCK = UINT32_MAX;
+
+	bool m_coverage = false;
+	// Index in coverageBlocks of the statements being compiled
+	uint32_t m_coverageBlock = NO_COVERAGE_BLOCK;
+};
@@ -0,0 +1,298 @@
+#include "Columnar.h"
+#include "Csv.h"
+#include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+// Magic, version, rows, column count, reserved
+constexpr size_t FILE_HEADER_SIZE = 24;
+// Offset, type, name length
+constexpr size_t COLUMN_HEADER_SIZE = 16;
+// Longest to_chars output of a double or an int64
+constexpr size_t MAX_FIELD = 32;
+
+bool IsLittleEndian()
+{
+	const uint16_t one = 1;
+	unsigned char first;
+	std::memcpy(&first, &one, 1);
+	return first == 1;
+}
+
+template <typename T>
+T Read(const char* p)
+{
+	T value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+template <typename T>
+void Append(std::string& bytes, T value)
+{
+	bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+// Closes the file, written or not
+struct FileCloser
+{
+	void operator()(std::FILE* file)const
+	{
+		std::fclose(file);
+	}
+};
+using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+FilePtr OpenForWriting(const std::string& path)
+{
+	FilePtr file(std::fopen(path.c_str(), "wb"));
+	if (!file)
+	{
+		throw std::runtime_error("can't open file '" + path + "' for writing");
+	}
+	return file;
+}
+
+void WriteBytes(std::FILE* file, const void* data, size_t size, const std::string& path)
+{
+	if (size && std::fwrite(data, 1, size, file) != size)
+	{
+		throw std::runtime_error("can't write file '" + path + "'");
+	}
+}
+}
+
+ColumnarFile::ColumnarFile(const std::string& path)
+	: m_file(path)
+{
+	if (!IsLittleEndian())
+	{
+		throw std::runtime_error("columnar files need a little-endian host");
+	}
+	const char* const data = m_file.GetData();
+	const size_t size = m_file.GetSize();
+	auto invalid = [&](const std::string& reason) {
+		return std::runtime_error("'" + path + "' is not a columnar file: " + reason);
+	};
+	if (size < FILE_HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+	{
+		throw invalid("no header");
+	}
+	if (Read<uint32_t>(data + 4) != VERSION)
+	{
+		throw invalid("version " + std::to_string(Read<uint32_t>(data + 4)));
+	}
+	m_rows = Read<uint64_t>(data + 8);
+	const uint32_t count = Read<uint32_t>(data + 16);
+	if (m_rows > size / sizeof(double))
+	{
+		throw invalid("more rows than the file holds");
+	}
+
+	size_t position = FILE_HEADER_SIZE;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		if (size - position < COLUMN_HEADER_SIZE)
+		{
+			throw invalid("the column headers are cut");
+		}
+		const uint64_t offset = Read<uint64_t>(data + position);
+		const uint32_t type = Read<uint32_t>(data + position + 8);
+		const uint32_t length = Read<uint32_t>(data + position + 12);
+		position += COLUMN_HEADER_SIZE;
+		// With its padding, position stays within the file
+		const uint64_t padded = AlignUp(length, 8);
+		if (size - position < padded)
+		{
+			throw invalid("the column headers are cut");
+		}
+		std::string name(data + position, length);
+		position += static_cast<size_t>(padded);
+		if (type != Float64 && type != Int64)
+		{
+			throw invalid("column '" + name + "' has type " + std::to_string(type));
+		}
+		if (offset % ALIGNMENT != 0)
+		{
+			throw invalid("the data of column '" + name + "' is not aligned");
+		}
+		if (offset > size || (size - offset) / sizeof(double) < m_rows)
+		{
+			throw invalid("the data of column '" + name + "' is not in the file");
+		}
+		m_columns.push_back({ std::move(name), static_cast<Type>(type), data + offset });
+	}
+}
+
+bool ColumnarFile::IsColumnar(const std::string& path)
+{
+	FilePtr file(std::fopen(path.c_str(), "rb"));
+	char magic[sizeof(MAGIC)];
+	return file && std::fread(magic, 1, sizeof(magic), file.get()) == sizeof(magic)
+		&& std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+uint64_t ColumnarFile::GetRowCount()const
+{
+	return m_rows;
+}
+
+const std::vector<ColumnarFile::Column>& ColumnarFile::GetColumns()const
+{
+	return m_columns;
+}
+
+const double* ColumnarFile::GetDoubles(const std::string& name, std::vector<double>& storage)const
+{
+	auto column = std::find_if(m_columns.begin(), m_columns.end(), [&](const Column& candidate) {
+		return boost::algorithm::iequals(candidate.name, name);
+	});
+	if (column == m_columns.end())
+	{
+		throw std::invalid_argument("no column '" + name + "'");
+	}
+	if (column->type == Float64)
+	{
+		// Aligned by the format, the mapping starts at a page
+		return reinterpret_cast<const double*>(column->data);
+	}
+	storage.resize(m_rows);
+	for (uint64_t row = 0; row < m_rows; ++row)
+	{
+		storage[row] = static_cast<double>(Read<int64_t>(column->data + row * sizeof(int64_t)));
+	}
+	return storage.data();
+}
+
+size_t ColumnarFile::GetSize()const
+{
+	return m_file.GetSize();
+}
+
+void ColumnarFile::Write(const std::string& path, const std::vector<std::string>& names,
+	const std::vector<const double*>& columns, uint64_t rows)
+{
+	if (!IsLittleEndian())
+	{
+		throw std::runtime_error("columnar files need a little-endian host");
+	}
+	if (names.size() != columns.size())
+	{
+		throw std::logic_error("a name is needed for every column");
+	}
+	for (auto name = names.begin(); name != names.end(); ++name)
+	{
+		if (std::any_of(names.begin(), name, [&](const std::string& other) { return boost::algorithm::iequals(other, *name); }))
+		{
+			throw std::invalid_argument("duplicate column '" + *name + "'");
+		}
+	}
+
+	std::string header(MAGIC, sizeof(MAGIC));
+	Append(header, VERSION);
+	Append(header, rows);
+	Append(header, static_cast<uint32_t>(names.size()));
+	Append(header, uint32_t(0));
+	uint64_t headerSize = FILE_HEADER_SIZE;
+	for (const std::string& name : names)
+	{
+		headerSize += COLUMN_HEADER_SIZE + AlignUp(name.size(), 8);
+	}
+	const uint64_t columnSize = AlignUp(rows * sizeof(double), ALIGNMENT);
+	uint64_t offset = AlignUp(headerSize, ALIGNMENT);
+	for (const std::string& name : names)
+	{
+		Append(header, offset);
+		Append(header, static_cast<uint32_t>(Float64));
+		Append(header, static_cast<uint32_t>(name.size()));
+		header += name;
+		header.append(static_cast<size_t>(AlignUp(name.size(), 8) - name.size()), '\0');
+		offset += columnSize;
+	}
+	header.append(static_cast<size_t>(AlignUp(headerSize, ALIGNMENT) - headerSize), '\0');
+
+	FilePtr file = OpenForWriting(path);
+	WriteBytes(file.get(), header.data(), header.size(), path);
+	const char padding[ALIGNMENT] = {};
+	for (const double* column : columns)
+	{
+		WriteBytes(file.get(), column, static_cast<size_t>(rows * sizeof(double)), path);
+		WriteBytes(file.get(), padding, static_cast<size_t>(columnSize - rows * sizeof(double)), path);
+	}
+	if (std::fflush(file.get()) != 0)
+	{
+		throw std::runtime_error("can't write file '" + path + "'");
+	}
+}
+
+void ColumnarFile::FromCsv(const std::string& csvPath, const std::string& path, std::vector<std::string> columns,
+	char delimiter, unsigned threads)
+{
+	CsvReader reader(csvPath, delimiter);
+	if (columns.empty())
+	{
+		columns = reader.GetHeader();
+	}
+	const std::vector<std::vector<double>> values = reader.Read(columns, threads);
+	std::vector<const double*> data;
+	for (const std::vector<double>& column : values)
+	{
+		data.push_back(column.data());
+	}
+	Write(path, columns, data, reader.GetStats().rows);
+}
+
+void ColumnarFile::ToCsv(const std::string& csvPath, char delimiter)const
+{
+	FilePtr file = OpenForWriting(csvPath);
+	std::string text;
+	for (size_t i = 0; i < m_columns.size(); ++i)
+	{
+		text += i ? std::string(1, delimiter) + m_columns[i].name : m_columns[i].name;
+	}
+	text += '\n';
+	char field[MAX_FIELD];
+	for (uint64_t row = 0; row < m_rows; ++row)
+	{
+		for (size_t i = 0; i < m_columns.size(); ++i)
+		{
+			if (i)
+			{
+				text += delimiter;
+			}
+			const char* value = m_columns[i].data + row * sizeof(double);
+			if (m_columns[i].type == Int64)
+			{
+				text.append(field, std::to_chars(field, field + MAX_FIELD, Read<int64_t>(value)).ptr);
+			}
+			else if (!std::isnan(Read<double>(value)))
+			{
+				// NaN is written as an empty field, which CsvReader reads back as NaN
+				text.append(field, std::to_chars(field, field + MAX_FIELD, Read<double>(value)).ptr);
+			}
+		}
+		text += '\n';
+		if (text.size() >= 1 << 16)
+		{
+			WriteBytes(file.get(), text.data(), text.size(), csvPath);
+			text.clear();
+		}
+	}
+	WriteBytes(file.get(), text.data(), text.size(), csvPath);
+	if (std::fflush(file.get()) != 0)
+	{
+		throw std::runtime_error("can't write file '" + csvPath + "'");
+	}
+}
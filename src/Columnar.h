@@ -0,0 +1,59 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstdint>
+#include <vector>
+
+// Binary columnar tables of numbers, used in place from a mapped file with
+// no parsing. All values are little-endian, and all columns have the same
+// number of rows:
+//   "LSBC", uint32 version, uint64 rows, uint32 column count, uint32 0
+//   per column: uint64 offset of its data in the file, uint32 type,
+//               uint32 name length, the name, zeros to a multiple of 8
+//   the data of every column at its offset, which is a multiple of
+//   ALIGNMENT, rows values of its type
+// Float64 columns are read as they are mapped, Int64 ones are converted.
+class ColumnarFile
+{
+public:
+	enum Type : uint32_t
+	{
+		Float64,
+		Int64
+	};
+
+	struct Column
+	{
+		std::string name;
+		Type type;
+		const char* data;
+	};
+
+	static constexpr char MAGIC[4] = { 'L', 'S', 'B', 'C' };
+	static constexpr uint32_t VERSION = 1;
+	static constexpr uint64_t ALIGNMENT = 64;
+
+	explicit ColumnarFile(const std::string& path);
+
+	// Whether the file starts like a columnar one
+	static bool IsColumnar(const std::string& path);
+	uint64_t GetRowCount()const;
+	const std::vector<Column>& GetColumns()const;
+	// Values of the column by name, ignoring case: the mapped ones for
+	// Float64 columns, else converted into 'storage'
+	const double* GetDoubles(const std::string& name, std::vector<double>& storage)const;
+	size_t GetSize()const;
+
+	// Float64 columns of 'rows' values each
+	static void Write(const std::string& path, const std::vector<std::string>& names,
+		const std::vector<const double*>& columns, uint64_t rows);
+	// Converters, CSV fields as read and written by CsvReader and BatchEvaluator;
+	// with no columns, all of the CSV file, which then have to be numeric
+	static void FromCsv(const std::string& csvPath, const std::string& path, std::vector<std::string> columns = {},
+		char delimiter = ',', unsigned threads = 0);
+	void ToCsv(const std::string& csvPath, char delimiter = ',')const;
+
+private:
+	MappedFile m_file;
+	uint64_t m_rows = 0;
+	std::vector<Column> m_columns;
+};
@@ -0,0 +1,869 @@
+#pragma once
+#include "TokenType.h"
+#include "Decimal.h"
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+// Compile-time counterpart of Lexer, Parser and ExpressionCalculator.
+// Accepts the same grammar as Parser::ParseAsProgram, but keeps tokens, nodes
+// and variables in fixed-capacity arrays so that the whole pipeline can run
+// inside a constant expression:
+//
+//	constexpr auto program = lsbasi::compile("PROGRAM p; BEGIN a := 2 * 3 END.");
+//	static_assert(program.Evaluate().Get("a") == 6);
+//
+// Syntax errors, undefined variables and exceeded capacities are reported
+// by throwing, which fails the build when evaluated in a constant expression.
+namespace lsbasi
+{
+namespace detail
+{
+constexpr char ToLower(char ch)
+{
+	return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+constexpr bool IsDigit(char ch)
+{
+	return ch >= '0' && ch <= '9';
+}
+
+constexpr bool IsAlpha(char ch)
+{
+	return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+constexpr bool IsSpace(char ch)
+{
+	return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\v' || ch == '\f';
+}
+
+constexpr bool EqualsIgnoreCase(std::string_view left, std::string_view right)
+{
+	if (left.size() != right.size())
+	{
+		return false;
+	}
+	for (size_t i = 0; i < left.size(); ++i)
+	{
+		if (ToLower(left[i]) != ToLower(right[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Same as std::round (half away from zero), which is not constexpr
+constexpr double Round(double value)
+{
+	constexpr double exact = 4503599627370496.0; // 2^52, all greater doubles are integral
+	if (!(value > -exact && value < exact))
+	{
+		return value;
+	}
+	const double truncated = static_cast<double>(static_cast<int64_t>(value));
+	const double fraction = value - truncated;
+	if (fraction >= 0.5)
+	{
+		return truncated + 1;
+	}
+	if (fraction <= -0.5)
+	{
+		return truncated - 1;
+	}
+	return truncated;
+}
+
+constexpr double Pow10(int exponent)
+{
+	double result = 1;
+	for (int i = 0; i < exponent; ++i)
+	{
+		result *= 10;
+	}
+	return result;
+}
+}
+
+struct ConstexprToken
+{
+	TokenType type = TokenType::EndOfFile;
+	std::string_view value = {};
+};
+
+class ConstexprLexer
+{
+public:
+	constexpr explicit ConstexprLexer(std::string_view text)
+		: m_text(text)
+	{
+	}
+
+	constexpr ConstexprToken Advance()
+	{
+		while (m_pos < m_text.length())
+		{
+			const char ch = m_text[m_pos];
+			if (detail::IsSpace(ch))
+			{
+				++m_pos;
+				continue;
+			}
+			if (ch == '{')
+			{
+				SkipComment();
+				continue;
+			}
+			if (detail::IsDigit(ch))
+			{
+				return ReadAsNumberConstant();
+			}
+			if (detail::IsAlpha(ch) || ch == '_')
+			{
+				return ReadAsKeywordOrIdentifier();
+			}
+
+			++m_pos;
+			switch (ch)
+			{
+			case '+':
+				return { TokenType::Plus };
+			case '-':
+				return { TokenType::Minus };
+			case '*':
+				return { TokenType::Mul };
+			case '/':
+				return { TokenType::FloatDiv };
+			case '(':
+				return { TokenType::LeftParen };
+			case ')':
+				return { TokenType::RightParen };
+			case ';':
+				return { TokenType::Semicolon };
+			case '.':
+				return { TokenType::Dot };
+			case ',':
+				return { TokenType::Comma };
+			case ':':
+				if (m_pos < m_text.length() && m_text[m_pos] == '=')
+				{
+					++m_pos;
+					return { TokenType::Assign };
+				}
+				return { TokenType::Colon };
+			default:
+				throw std::invalid_argument("can't parse character");
+			}
+		}
+		return { TokenType::EndOfFile };
+	}
+
+private:
+	constexpr ConstexprToken ReadAsNumberConstant()
+	{
+		const size_t start = m_pos;
+		while (m_pos < m_text.length() && detail::IsDigit(m_text[m_pos]))
+		{
+			++m_pos;
+		}
+		if (m_pos < m_text.length() && m_text[m_pos] == '.')
+		{
+			++m_pos;
+			while (m_pos < m_text.length() && detail::IsDigit(m_text[m_pos]))
+			{
+				++m_pos;
+			}
+			return { TokenType::RealConstant, m_text.substr(start, m_pos - start) };
+		}
+		return { TokenType::IntegerConstant, m_text.substr(start, m_pos - start) };
+	}
+
+	constexpr ConstexprToken ReadAsKeywordOrIdentifier()
+	{
+		constexpr std::pair<std::string_view, TokenType> RESERVED_KEYWORDS[] = {
+			{ "begin", TokenType::Begin },
+			{ "end", TokenType::End },
+			{ "div", TokenType::IntegerDiv },
+			{ "program", TokenType::Program },
+			{ "var", TokenType::Var },
+			{ "integer", TokenType::Integer },
+			{ "real", TokenType::Real },
+			{ "decimal", TokenType::Decimal },
+			{ "bigint", TokenType::BigInt },
+			{ "for", TokenType::For },
+			{ "to", TokenType::To },
+			{ "downto", TokenType::DownTo },
+			{ "do", TokenType::Do },
+			{ "random", TokenType::Random },
+			{ "randomnormal", TokenType::RandomNormal }
+		};
+
+		const size_t start = m_pos;
+		while (m_pos < m_text.length() &&
+			(detail::IsAlpha(m_text[m_pos]) || detail::IsDigit(m_text[m_pos]) || m_text[m_pos] == '_'))
+		{
+			++m_pos;
+		}
+
+		const std::string_view chars = m_text.substr(start, m_pos - start);
+		for (const auto& [keyword, type] : RESERVED_KEYWORDS)
+		{
+			if (detail::EqualsIgnoreCase(chars, keyword))
+			{
+				return { type };
+			}
+		}
+		return { TokenType::Identifier, chars };
+	}
+
+	constexpr void SkipComment()
+	{
+		while (m_pos < m_text.length() && m_text[m_pos] != '}')
+		{
+			++m_pos;
+		}
+		if (m_pos < m_text.length())
+		{
+			++m_pos;
+		}
+	}
+
+private:
+	std::string_view m_text;
+	size_t m_pos = 0;
+};
+
+template <size_t MaxVars>
+class ConstexprScope
+{
+public:
+	constexpr void Set(size_t index, std::string_view name, double value)
+	{
+		m_names[index] = name;
+		m_values[index] = value;
+		m_defined[index] = true;
+		m_exact[index] = false;
+	}
+
+	// Value of a DECIMAL variable, also readable as double
+	constexpr void Set(size_t index, std::string_view name, const Decimal& value)
+	{
+		Set(index, name, value.ToDouble());
+		m_decimals[index] = value;
+		m_exact[index] = true;
+	}
+
+	constexpr bool IsDefined(size_t index)const
+	{
+		return m_defined[index];
+	}
+
+	constexpr double Get(size_t index)const
+	{
+		if (!m_defined[index])
+		{
+			throw std::runtime_error("variable is not defined");
+		}
+		return m_values[index];
+	}
+
+	constexpr double Get(std::string_view name)const
+	{
+		return Get(Find(name));
+	}
+
+	// Exact value of a DECIMAL variable, others are converted with Decimal::FromDouble
+	constexpr Decimal GetDecimal(size_t index)const
+	{
+		return m_exact[index] ? m_decimals[index] : Decimal::FromDouble(Get(index));
+	}
+
+	constexpr Decimal GetDecimal(std::string_view name)const
+	{
+		return GetDecimal(Find(name));
+	}
+
+private:
+	constexpr size_t Find(std::string_view name)const
+	{
+		for (size_t i = 0; i < MaxVars; ++i)
+		{
+			if (m_defined[i] && detail::EqualsIgnoreCase(m_names[i], name))
+			{
+				return i;
+			}
+		}
+		throw std::runtime_error("variable is not defined");
+	}
+
+private:
+	std::array<std::string_view, MaxVars> m_names{};
+	std::array<double, MaxVars> m_values{};
+	std::array<Decimal, MaxVars> m_decimals{};
+	std::array<bool, MaxVars> m_defined{};
+	std::array<bool, MaxVars> m_exact{};
+};
+
+// Flattened AST: nodes refer to each other by index into the node pool,
+// statements of a compound are chained through 'next'.
+template <size_t MaxNodes = 512, size_t MaxVars = 64>
+class ConstexprProgram
+{
+public:
+	enum class NodeKind
+	{
+		Num,
+		Var,
+		BinOp,
+		UnOp,
+		Nop,
+		Assign,
+		Compound,
+		For
+	};
+
+	struct Node
+	{
+		NodeKind kind = NodeKind::Nop;
+		TokenType op = TokenType::EndOfFile;
+		double value = 0;
+		Decimal decimal; // exact value of a number constant
+		bool exact = false;
+		size_t var = 0;
+		size_t left = npos;
+		size_t right = npos;
+		size_t next = npos;
+		size_t body = npos; // statement of a FOR
+	};
+
+	// Declared type of a variable, only DECIMAL ones are evaluated differently
+	struct VarType
+	{
+		bool decimal = false;
+		int precision = Decimal::MAX_PRECISION;
+		int scale = 0;
+	};
+
+	static constexpr size_t npos = std::numeric_limits<size_t>::max();
+	// Integers doubles represent exactly, FOR bounds must stay within
+	static constexpr double EXACT_LIMIT = 9007199254740992.0;
+
+	constexpr explicit ConstexprProgram(std::string_view text)
+		: m_lexer(text)
+		, m_currentToken(m_lexer.Advance())
+	{
+		ParseAsProgram();
+	}
+
+	constexpr std::string_view GetName()const
+	{
+		return m_name;
+	}
+
+	constexpr size_t GetNodeCount()const
+	{
+		return m_nodeCount;
+	}
+
+	constexpr ConstexprScope<MaxVars> Evaluate()const
+	{
+		ConstexprScope<MaxVars> scope;
+		Execute(m_root, scope);
+		return scope;
+	}
+
+private:
+	constexpr void ParseAsProgram()
+	{
+		EatAndAdvance(TokenType::Program);
+		m_name = m_currentToken.value;
+		EatAndAdvance(TokenType::Identifier);
+		EatAndAdvance(TokenType::Semicolon);
+		m_root = ParseAsBlock();
+		EatAndAdvance(TokenType::Dot);
+		EatAndAdvance(TokenType::EndOfFile);
+	}
+
+	// block:
+	//  declarations compound_statement
+	constexpr size_t ParseAsBlock()
+	{
+		ParseAsDeclarations();
+		return ParseAsCompound();
+	}
+
+	// declarations:
+	//  VAR (variables_declaration SEMICOLON)+ |
+	//  empty
+	constexpr void ParseAsDeclarations()
+	{
+		if (m_currentToken.type == TokenType::Var)
+		{
+			EatAndAdvance(TokenType::Var);
+			while (m_currentToken.type == TokenType::Identifier)
+			{
+				ParseAsVariablesDeclaration();
+				EatAndAdvance(TokenType::Semicolon);
+			}
+		}
+	}
+
+	// variables_declaration:
+	//  ID (COMMA ID)* COLON type_spec
+	constexpr void ParseAsVariablesDeclaration()
+	{
+		std::array<size_t, MaxVars> vars{};
+		size_t count = 0;
+		vars[count++] = ParseAsVariable();
+		while (m_currentToken.type == TokenType::Comma)
+		{
+			EatAndAdvance(TokenType::Comma);
+			vars[count++] = ParseAsVariable();
+		}
+		EatAndAdvance(TokenType::Colon);
+		const VarType type = ParseAsTypeNode();
+		for (size_t i = 0; i < count; ++i)
+		{
+			m_types[vars[i]] = type;
+		}
+	}
+
+	constexpr VarType ParseAsTypeNode()
+	{
+		if (m_currentToken.type == TokenType::Integer)
+		{
+			EatAndAdvance(TokenType::Integer);
+			return {};
+		}
+		else if (m_currentToken.type == TokenType::Real)
+		{
+			EatAndAdvance(TokenType::Real);
+			return {};
+		}
+		else if (m_currentToken.type == TokenType::Decimal)
+		{
+			return ParseAsDecimalType();
+		}
+		throw std::runtime_error("invalid variable type");
+	}
+
+	// decimal_type:
+	//  DECIMAL LPAREN INTEGER_CONST COMMA INTEGER_CONST RPAREN
+	constexpr VarType ParseAsDecimalType()
+	{
+		EatAndAdvance(TokenType::Decimal);
+		EatAndAdvance(TokenType::LeftParen);
+		const double precision = ParseInteger(m_currentToken.value);
+		EatAndAdvance(TokenType::IntegerConstant);
+		EatAndAdvance(TokenType::Comma);
+		const double scale = ParseInteger(m_currentToken.value);
+		EatAndAdvance(TokenType::IntegerConstant);
+		EatAndAdvance(TokenType::RightParen);
+		if (precision < 1 || precision > Decimal::MAX_PRECISION || scale > precision)
+		{
+			throw std::runtime_error("invalid DECIMAL precision or scale");
+		}
+		return { true, static_cast<int>(precision), static_cast<int>(scale) };
+	}
+
+	constexpr size_t ParseAsCompound()
+	{
+		EatAndAdvance(TokenType::Begin);
+		const size_t node = ParseAsStatementList();
+		EatAndAdvance(TokenType::End);
+		return node;
+	}
+
+	constexpr size_t ParseAsStatementList()
+	{
+		const size_t node = MakeNode(NodeKind::Compound);
+		size_t last = ParseAsStatement();
+		m_nodes[node].left = last;
+		while (m_currentToken.type == TokenType::Semicolon)
+		{
+			EatAndAdvance(TokenType::Semicolon);
+			const size_t statement = ParseAsStatement();
+			m_nodes[last].next = statement;
+			last = statement;
+		}
+		return node;
+	}
+
+	constexpr size_t ParseAsStatement()
+	{
+		if (m_currentToken.type == TokenType::Begin)
+		{
+			return ParseAsCompound();
+		}
+		else if (m_currentToken.type == TokenType::Identifier)
+		{
+			return ParseAsAssignment();
+		}
+		else if (m_currentToken.type == TokenType::For)
+		{
+			return ParseAsFor();
+		}
+		return MakeNode(NodeKind::Nop);
+	}
+
+	// for_statement:
+	//  FOR ID ASSIGN expr (TO | DOWNTO) expr DO statement
+	constexpr size_t ParseAsFor()
+	{
+		EatAndAdvance(TokenType::For);
+		const size_t var = ParseAsVariable();
+		EatAndAdvance(TokenType::Assign);
+		const size_t start = ParseAsExpr();
+		const TokenType direction = m_currentToken.type;
+		if (direction != TokenType::To && direction != TokenType::DownTo)
+		{
+			throw std::runtime_error("can't parse as To");
+		}
+		EatAndAdvance(direction);
+		const size_t end = ParseAsExpr();
+		EatAndAdvance(TokenType::Do);
+		const size_t body = ParseAsStatement();
+		const size_t node = MakeNode(NodeKind::For);
+		m_nodes[node].op = direction;
+		m_nodes[node].var = var;
+		m_nodes[node].left = start;
+		m_nodes[node].right = end;
+		m_nodes[node].body = body;
+		return node;
+	}
+
+	constexpr size_t ParseAsAssignment()
+	{
+		const size_t var = ParseAsVariable();
+		EatAndAdvance(TokenType::Assign);
+		const size_t expr = ParseAsExpr();
+		const size_t node = MakeNode(NodeKind::Assign);
+		m_nodes[node].var = var;
+		m_nodes[node].right = expr;
+		return node;
+	}
+
+	// Returns index of the variable in the scope, case-insensitive
+	constexpr size_t ParseAsVariable()
+	{
+		const std::string_view name = m_currentToken.value;
+		EatAndAdvance(TokenType::Identifier);
+		for (size_t i = 0; i < m_varCount; ++i)
+		{
+			if (detail::EqualsIgnoreCase(m_vars[i], name))
+			{
+				return i;
+			}
+		}
+		if (m_varCount == MaxVars)
+		{
+			throw std::length_error("too many variables for compile-time program");
+		}
+		m_vars[m_varCount] = name;
+		return m_varCount++;
+	}
+
+	constexpr size_t ParseAsFactor()
+	{
+		if (m_currentToken.type == TokenType::Minus || m_currentToken.type == TokenType::Plus)
+		{
+			const TokenType op = m_currentToken.type;
+			EatAndAdvance(op);
+			const size_t expr = ParseAsFactor();
+			const size_t node = MakeNode(NodeKind::UnOp);
+			m_nodes[node].op = op;
+			m_nodes[node].left = expr;
+			return node;
+		}
+		else if (m_currentToken.type == TokenType::IntegerConstant)
+		{
+			const double value = ParseInteger(m_currentToken.value);
+			const size_t node = MakeNode(NodeKind::Num);
+			m_nodes[node].value = value;
+			m_nodes[node].exact = Decimal::TryParse(m_currentToken.value, m_nodes[node].decimal);
+			EatAndAdvance(TokenType::IntegerConstant);
+			return node;
+		}
+		else if (m_currentToken.type == TokenType::RealConstant)
+		{
+			const double value = ParseReal(m_currentToken.value);
+			const size_t node = MakeNode(NodeKind::Num);
+			m_nodes[node].value = value;
+			m_nodes[node].exact = Decimal::TryParse(m_currentToken.value, m_nodes[node].decimal);
+			EatAndAdvance(TokenType::RealConstant);
+			return node;
+		}
+		else if (m_currentToken.type == TokenType::LeftParen)
+		{
+			EatAndAdvance(TokenType::LeftParen);
+			const size_t node = ParseAsExpr();
+			EatAndAdvance(TokenType::RightParen);
+			return node;
+		}
+		else if (m_currentToken.type == TokenType::Identifier)
+		{
+			const size_t var = ParseAsVariable();
+			const size_t node = MakeNode(NodeKind::Var);
+			m_nodes[node].var = var;
+			return node;
+		}
+		else if (m_currentToken.type == TokenType::Random || m_currentToken.type == TokenType::RandomNormal)
+		{
+			throw std::runtime_error("RANDOM is not supported in compile-time programs");
+		}
+		throw std::runtime_error("can't parse as factor");
+	}
+
+	constexpr size_t ParseAsTerm()
+	{
+		size_t node = ParseAsFactor();
+		while (m_currentToken.type == TokenType::Mul ||
+			m_currentToken.type == TokenType::IntegerDiv ||
+			m_currentToken.type == TokenType::FloatDiv)
+		{
+			const TokenType op = m_currentToken.type;
+			EatAndAdvance(op);
+			node = MakeBinOp(node, ParseAsFactor(), op);
+		}
+		return node;
+	}
+
+	constexpr size_t ParseAsExpr()
+	{
+		size_t node = ParseAsTerm();
+		while (m_currentToken.type == TokenType::Plus || m_currentToken.type == TokenType::Minus)
+		{
+			const TokenType op = m_currentToken.type;
+			EatAndAdvance(op);
+			node = MakeBinOp(node, ParseAsTerm(), op);
+		}
+		return node;
+	}
+
+	constexpr void EatAndAdvance(TokenType kind)
+	{
+		if (m_currentToken.type != kind)
+		{
+			throw std::runtime_error("unexpected token");
+		}
+		m_currentToken = m_lexer.Advance();
+	}
+
+	constexpr size_t MakeNode(NodeKind kind)
+	{
+		if (m_nodeCount == MaxNodes)
+		{
+			throw std::length_error("too many nodes for compile-time program");
+		}
+		m_nodes[m_nodeCount].kind = kind;
+		return m_nodeCount++;
+	}
+
+	constexpr size_t MakeBinOp(size_t left, size_t right, TokenType op)
+	{
+		const size_t node = MakeNode(NodeKind::BinOp);
+		m_nodes[node].op = op;
+		m_nodes[node].left = left;
+		m_nodes[node].right = right;
+		return node;
+	}
+
+	// Mirrors std::stoi: the value must fit into int
+	static constexpr double ParseInteger(std::string_view lexeme)
+	{
+		int64_t value = 0;
+		for (char ch : lexeme)
+		{
+			value = value * 10 + (ch - '0');
+			if (value > std::numeric_limits<int>::max())
+			{
+				throw std::out_of_range("integer constant is out of range");
+			}
+		}
+		return static_cast<double>(value);
+	}
+
+	// Correctly rounded while the digits fit into 2^53, like std::stod
+	static constexpr double ParseReal(std::string_view lexeme)
+	{
+		double mantissa = 0;
+		int fractionDigits = 0;
+		bool fraction = false;
+		for (char ch : lexeme)
+		{
+			if (ch == '.')
+			{
+				fraction = true;
+				continue;
+			}
+			mantissa = mantissa * 10 + (ch - '0');
+			fractionDigits += fraction ? 1 : 0;
+		}
+		return mantissa / detail::Pow10(fractionDigits);
+	}
+
+	constexpr double Calculate(size_t index, const ConstexprScope<MaxVars>& scope)const
+	{
+		const Node& node = m_nodes[index];
+		switch (node.kind)
+		{
+		case NodeKind::Num:
+			return node.value;
+		case NodeKind::Var:
+			return scope.Get(node.var);
+		case NodeKind::UnOp:
+			return node.op == TokenType::Minus
+				? -Calculate(node.left, scope)
+				: +Calculate(node.left, scope);
+		case NodeKind::BinOp:
+		{
+			const double left = Calculate(node.left, scope);
+			const double right = Calculate(node.right, scope);
+			switch (node.op)
+			{
+			case TokenType::Plus:
+				return left + right;
+			case TokenType::Minus:
+				return left - right;
+			case TokenType::Mul:
+				return left * right;
+			case TokenType::IntegerDiv:
+				return detail::Round(left / right);
+			case TokenType::FloatDiv:
+				return left / right;
+			default:
+				throw std::logic_error("undefined operator");
+			}
+		}
+		default:
+			throw std::logic_error("node is not an expression");
+		}
+	}
+
+	// Same as ExpressionCalculator for DECIMAL targets: exact constants and
+	// quotients with at least 'scale' fraction digits
+	constexpr Decimal CalculateDecimal(size_t index, const ConstexprScope<MaxVars>& scope, int scale)const
+	{
+		const Node& node = m_nodes[index];
+		switch (node.kind)
+		{
+		case NodeKind::Num:
+			if (!node.exact)
+			{
+				throw std::overflow_error("number constant does not fit into DECIMAL");
+			}
+			return node.decimal;
+		case NodeKind::Var:
+			return scope.GetDecimal(node.var);
+		case NodeKind::UnOp:
+			return node.op == TokenType::Minus
+				? -CalculateDecimal(node.left, scope, scale)
+				: +CalculateDecimal(node.left, scope, scale);
+		case NodeKind::BinOp:
+		{
+			const Decimal left = CalculateDecimal(node.left, scope, scale);
+			const Decimal right = CalculateDecimal(node.right, scope, scale);
+			switch (node.op)
+			{
+			case TokenType::Plus:
+				return left + right;
+			case TokenType::Minus:
+				return left - right;
+			case TokenType::Mul:
+				return left * right;
+			case TokenType::IntegerDiv:
+				return Decimal::Divide(left, right, 0);
+			case TokenType::FloatDiv:
+				return Decimal::Divide(left, right, Decimal::GetDivisionScale(left, right, scale));
+			default:
+				throw std::logic_error("undefined operator");
+			}
+		}
+		default:
+			throw std::logic_error("node is not an expression");
+		}
+	}
+
+	constexpr void Execute(size_t index, ConstexprScope<MaxVars>& scope)const
+	{
+		const Node& node = m_nodes[index];
+		switch (node.kind)
+		{
+		case NodeKind::Nop:
+			break;
+		case NodeKind::Assign:
+			if (m_types[node.var].decimal)
+			{
+				const VarType& type = m_types[node.var];
+				const Decimal value = CalculateDecimal(node.right, scope, type.scale).Rescale(type.scale);
+				value.CheckPrecision(type.precision);
+				scope.Set(node.var, m_vars[node.var], value);
+			}
+			else
+			{
+				scope.Set(node.var, m_vars[node.var], Calculate(node.right, scope));
+			}
+			break;
+		case NodeKind::Compound:
+			for (size_t child = node.left; child != npos; child = m_nodes[child].next)
+			{
+				Execute(child, scope);
+			}
+			break;
+		case NodeKind::For:
+		{
+			const double start = Calculate(node.left, scope);
+			const double end = Calculate(node.right, scope);
+			const double step = node.op == TokenType::To ? 1 : -1;
+			if (!((end - start) * step >= 0))
+			{
+				break;
+			}
+			if (!(start * step >= -EXACT_LIMIT && end * step <= EXACT_LIMIT))
+			{
+				throw std::runtime_error("FOR bounds are out of range");
+			}
+			for (double value = start; (end - value) * step >= 0; value += step)
+			{
+				const VarType& type = m_types[node.var];
+				if (type.decimal)
+				{
+					const Decimal counter = Decimal::FromDouble(value).Rescale(type.scale);
+					counter.CheckPrecision(type.precision);
+					scope.Set(node.var, m_vars[node.var], counter);
+				}
+				else
+				{
+					scope.Set(node.var, m_vars[node.var], value);
+				}
+				Execute(node.body, scope);
+			}
+			break;
+		}
+		default:
+			throw std::logic_error("node is not a statement");
+		}
+	}
+
+private:
+	ConstexprLexer m_lexer;
+	ConstexprToken m_currentToken;
+	std::string_view m_name;
+	std::array<Node, MaxNodes> m_nodes{};
+	size_t m_nodeCount = 0;
+	std::array<std::string_view, MaxVars> m_vars{};
+	std::array<VarType, MaxVars> m_types{};
+	size_t m_varCount = 0;
+	size_t m_root = npos;
+};
+
+template <size_t MaxNodes = 512, size_t MaxVars = 64>
+constexpr ConstexprProgram<MaxNodes, MaxVars> compile(std::string_view text)
+{
+	return ConstexprProgram<MaxNodes, MaxVars>(text);
+}
+}
@@ -0,0 +1,107 @@
+#include "Coverage.h"
+#include "Parser.h"
+#include <algorithm>
+#include <ostream>
+
+namespace
+{
+size_t GetLine(const std::vector<Token>& tokens, const std::vector<size_t>& lineStarts, const TokenRange& range)
+{
+	if (range.begin == range.end)
+	{
+		return 0;
+	}
+	const size_t offset = tokens[range.begin].offset;
+	const auto it = std::upper_bound(lineStarts.begin(), lineStarts.end(), offset);
+	return static_cast<size_t>(it - lineStarts.begin());
+}
+
+void AssignSlots(const CompoundLayout& layout, const std::vector<Token>& tokens,
+	const std::vector<size_t>& lineStarts, std::vector<size_t>& lines)
+{
+	layout.node->SetCoverageSlot(static_cast<uint32_t>(lines.size()));
+	for (const auto& statement : layout.statements)
+	{
+		lines.push_back(GetLine(tokens, lineStarts, statement.range));
+	}
+	for (const auto& statement : layout.statements)
+	{
+		for (const auto& nested : statement.compounds)
+		{
+			AssignSlots(nested, tokens, lineStarts, lines);
+		}
+	}
+}
+}
+
+std::unique_ptr<ProgramNode> StatementCoverage::Instrument(const std::string& text, StatementCoverage& coverage)
+{
+	std::vector<Token> tokens;
+	Lexer lexer(text);
+	do
+	{
+		tokens.push_back(lexer.Advance());
+	} while (tokens.back().type != TokenType::EndOfFile);
+
+	Parser parser(TokenStream(tokens, 0, tokens.size()));
+	parser.EnableLayoutRecording();
+	auto program = parser.ParseAsProgram();
+
+	std::vector<size_t> lineStarts = { 0 };
+	for (size_t i = 0; i < text.length(); ++i)
+	{
+		if (text[i] == '\n')
+		{
+			lineStarts.push_back(i + 1);
+		}
+	}
+
+	coverage.mLines.clear();
+	for (const auto& layout : parser.TakeLayouts())
+	{
+		AssignSlots(layout, tokens, lineStarts, coverage.mLines);
+	}
+	// Single statement bodies of loops follow all compounds
+	for (const auto& body : parser.TakeLoopBodies())
+	{
+		body.node->SetCoverageSlot(static_cast<uint32_t>(coverage.mLines.size()));
+		coverage.mLines.push_back(GetLine(tokens, lineStarts, body.range));
+	}
+	coverage.mCounters.assign(coverage.mLines.size(), 0);
+	return program;
+}
+
+uint64_t* StatementCoverage::GetCounters()
+{
+	return mCounters.data();
+}
+
+size_t StatementCoverage::GetSlotCount()const
+{
+	return mCounters.size();
+}
+
+void StatementCoverage::WriteLcov(std::ostream& out, const std::string& sourcePath)const
+{
+	// A line with several statements reports the most executed one
+	std::map<size_t, uint64_t> lineHits;
+	for (size_t slot = 0; slot < mLines.size(); ++slot)
+	{
+		if (mLines[slot] != 0)
+		{
+			auto& hits = lineHits[mLines[slot]];
+			hits = std::max(hits, mCounters[slot]);
+		}
+	}
+
+	size_t linesHit = 0;
+	out << "TN:\n" << "SF:" << sourcePath << "\n";
+	for (const auto& [line, hits] : lineHits)
+	{
+		out << "DA:" << line << "," << hits << "\n";
+		linesHit += hits != 0 ? 1 : 0;
+	}
+	out << "LF:" << lineHits.size() << "\n"
+		<< "LH:" << linesHit << "\n"
+		<< "end_of_record\n";
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "AST.h"
+#include <iosfwd>
+
+// Statement coverage for ExpressionCalculator. Every statement gets a slot
+// in one contiguous array of counters: the statements of a compound occupy
+// consecutive slots starting at CompoundNode::GetCoverageSlot(), so the
+// calculator bumps a counter without any lookup. A FOR body that is not a
+// compound has its own slot, ForNode::GetCoverageSlot().
+class StatementCoverage
+{
+public:
+	// Parses the program and assigns counter slots to all its statements
+	static std::unique_ptr<ProgramNode> Instrument(const std::string& text, StatementCoverage& coverage);
+
+	uint64_t* GetCounters();
+	size_t GetSlotCount()const;
+
+	// Writes per line execution counts in lcov tracefile format
+	void WriteLcov(std::ostream& out, const std::string& sourcePath)const;
+
+private:
+	// Line of the statement for every slot, 0 for empty statements
+	std::vector<size_t> mLines;
+	std::vector<uint64_t> mCounters;
+};
@@ -0,0 +1,448 @@
+#include "Csv.h"
+#include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define HAS_AVX2_CLASSIFY
+#endif
+
+namespace
+{
+// Bytes classified at a time, one bit each
+constexpr size_t BLOCK = 64;
+// Parts are not made smaller than this
+constexpr size_t MIN_PART = 1 << 20;
+
+struct Masks
+{
+	uint64_t delimiter;
+	uint64_t newline;
+	uint64_t quote;
+};
+
+Masks Classify(const char* block, char delimiter)
+{
+	Masks masks = { 0, 0, 0 };
+	for (size_t i = 0; i < BLOCK; ++i)
+	{
+		masks.delimiter |= uint64_t(block[i] == delimiter) << i;
+		masks.newline |= uint64_t(block[i] == '\n') << i;
+		masks.quote |= uint64_t(block[i] == '"') << i;
+	}
+	return masks;
+}
+
+#ifdef HAS_AVX2_CLASSIFY
+__attribute__((target("avx2")))
+uint64_t Match(__m256i low, __m256i high, char c)
+{
+	const __m256i pattern = _mm256_set1_epi8(c);
+	const uint32_t lowBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, pattern)));
+	const uint32_t highBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, pattern)));
+	return uint64_t(highBits) << 32 | lowBits;
+}
+
+__attribute__((target("avx2")))
+Masks ClassifyAvx2(const char* block, char delimiter)
+{
+	const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+	const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+	return { Match(low, high, delimiter), Match(low, high, '\n'), Match(low, high, '"') };
+}
+#endif
+
+bool HasAvx2()
+{
+#ifdef HAS_AVX2_CLASSIFY
+	static const bool supported = __builtin_cpu_supports("avx2");
+	return supported;
+#else
+	return false;
+#endif
+}
+
+// Bit i is the parity of the bits 0 to i: set between an opening quote and its closing one
+uint64_t PrefixXor(uint64_t bits)
+{
+	bits ^= bits << 1;
+	bits ^= bits << 2;
+	bits ^= bits << 4;
+	bits ^= bits << 8;
+	bits ^= bits << 16;
+	bits ^= bits << 32;
+	return bits;
+}
+
+uint64_t PopCount(uint64_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<uint64_t>(__builtin_popcountll(bits));
+#else
+	uint64_t count = 0;
+	for (; bits; bits &= bits - 1)
+	{
+		++count;
+	}
+	return count;
+#endif
+}
+
+// Of a non-zero value
+unsigned TrailingZeros(uint64_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+	unsigned count = 0;
+	for (; !(bits & 1); bits >>= 1)
+	{
+		++count;
+	}
+	return count;
+#endif
+}
+
+bool IsSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Exact powers of ten, a double holds up to 10^22
+constexpr double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+	1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+// Plain decimals of up to 15 digits: the digits and the power of ten are
+// exact doubles, so one division rounds like from_chars (Clinger's fast
+// path). False for anything else
+bool ParseSimple(const char* p, const char* end, double& value)
+{
+	const bool negative = *p == '-';
+	p += negative;
+	const size_t size = static_cast<size_t>(end - p);
+	if (size == 0 || size > 16)
+	{
+		return false;
+	}
+	uint64_t digits = 0;
+	const char* integerEnd = p;
+	for (; integerEnd != end && static_cast<unsigned char>(*integerEnd - '0') < 10; ++integerEnd)
+	{
+		digits = digits * 10 + static_cast<uint64_t>(*integerEnd - '0');
+	}
+	const char* fraction = integerEnd != end && *integerEnd == '.' ? integerEnd + 1 : integerEnd;
+	const char* fractionEnd = fraction;
+	for (; fractionEnd != end && static_cast<unsigned char>(*fractionEnd - '0') < 10; ++fractionEnd)
+	{
+		digits = digits * 10 + static_cast<uint64_t>(*fractionEnd - '0');
+	}
+	const size_t count = static_cast<size_t>((integerEnd - p) + (fractionEnd - fraction));
+	const size_t decimals = static_cast<size_t>(fractionEnd - fraction);
+	if (fractionEnd != end || count == 0 || count > 15)
+	{
+		return false;
+	}
+	const double magnitude = static_cast<double>(digits) / POWERS_OF_TEN[decimals];
+	value = negative ? -magnitude : magnitude;
+	return true;
+}
+
+// The field without blanks and quotes; empty reads as NaN
+bool ParseNumber(const char* begin, const char* end, double& value)
+{
+	while (begin != end && IsSpace(*begin))
+	{
+		++begin;
+	}
+	while (begin != end && IsSpace(end[-1]))
+	{
+		--end;
+	}
+	if (end - begin >= 2 && *begin == '"' && end[-1] == '"')
+	{
+		++begin;
+		--end;
+	}
+	if (begin == end)
+	{
+		value = std::nan("");
+		return true;
+	}
+	if (ParseSimple(begin, end, value))
+	{
+		return true;
+	}
+	const std::from_chars_result parsed = std::from_chars(begin, end, value);
+	return parsed.ec == std::errc() && parsed.ptr == end;
+}
+
+std::string Unquote(std::string name)
+{
+	boost::algorithm::trim(name);
+	if (name.size() >= 2 && name.front() == '"' && name.back() == '"')
+	{
+		name = name.substr(1, name.size() - 2);
+	}
+	return name;
+}
+}
+
+CsvReader::CsvReader(const std::string& path, char delimiter)
+	: m_delimiter(delimiter)
+	, m_avx2(HasAvx2())
+	, m_file(path)
+	, m_data(m_file.GetData())
+	, m_size(m_file.GetSize())
+{
+	if (delimiter == '\n' || delimiter == '"')
+	{
+		throw std::invalid_argument("the delimiter can't be a line end or a quote");
+	}
+	ParseHeader();
+}
+
+const std::vector<std::string>& CsvReader::GetHeader()const
+{
+	return m_header;
+}
+
+void CsvReader::SetAvx2(bool avx2)
+{
+	m_avx2 = avx2 && HasAvx2();
+}
+
+std::vector<std::vector<double>> CsvReader::Read(const std::vector<std::string>& columns, unsigned threads)
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<uint32_t> targets(m_header.size(), SKIPPED);
+	for (uint32_t i = 0; i < columns.size(); ++i)
+	{
+		auto field = std::find_if(m_header.begin(), m_header.end(), [&](const std::string& name) {
+			return boost::algorithm::iequals(name, columns[i]);
+		});
+		if (field == m_header.end())
+		{
+			throw std::invalid_argument("no column '" + columns[i] + "'");
+		}
+		targets[static_cast<size_t>(field - m_header.begin())] = i;
+	}
+
+	// Parts end after a line end, the last one at the end of the file
+	const char* const end = m_data + m_size;
+	const size_t body = static_cast<size_t>(end - m_body);
+	threads = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+	threads = static_cast<unsigned>(std::min<size_t>(threads, body / MIN_PART + 1));
+	std::vector<Part> parts;
+	const char* begin = m_body;
+	for (unsigned i = 1; i <= threads; ++i)
+	{
+		const char* split = i == threads ? end : m_body + body / threads * i;
+		if (split < begin)
+		{
+			split = begin;
+		}
+		const char* newline = static_cast<const char*>(std::memchr(split, '\n', static_cast<size_t>(end - split)));
+		split = i == threads || !newline ? end : newline + 1;
+		parts.push_back({ begin, split, 0, 0 });
+		begin = split;
+	}
+
+	std::exception_ptr error;
+	std::mutex mutex;
+	auto inParallel = [&](auto&& work) {
+		std::vector<std::thread> workers;
+		for (size_t i = 1; i < parts.size(); ++i)
+		{
+			workers.emplace_back([&, i]() {
+				try
+				{
+					work(parts[i]);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					error = error ? error : std::current_exception();
+				}
+			});
+		}
+		try
+		{
+			work(parts[0]);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			error = error ? error : std::current_exception();
+		}
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	};
+
+	inParallel([&](Part& part) { part.rows = CountRows(part.begin, part.end); });
+	uint64_t lines = 0;
+	for (Part& part : parts)
+	{
+		part.firstRow = lines;
+		lines += part.rows;
+	}
+	std::vector<std::vector<double>> values(columns.size(), std::vector<double>(lines));
+	inParallel([&](Part& part) { Parse(part, targets, values); });
+
+	// Blank lines were counted as rows
+	uint64_t rows = 0;
+	for (const Part& part : parts)
+	{
+		if (part.firstRow != rows)
+		{
+			for (std::vector<double>& column : values)
+			{
+				std::copy(column.begin() + part.firstRow, column.begin() + part.firstRow + part.rows, column.begin() + rows);
+			}
+		}
+		rows += part.rows;
+	}
+	for (std::vector<double>& column : values)
+	{
+		column.resize(rows);
+	}
+
+	m_stats.bytes += m_size;
+	m_stats.rows += rows;
+	m_stats.threads = threads;
+	m_stats.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return values;
+}
+
+const CsvReader::Stats& CsvReader::GetStats()const
+{
+	return m_stats;
+}
+
+void CsvReader::ParseHeader()
+{
+	const char* const end = m_data + m_size;
+	const char* newline = static_cast<const char*>(std::memchr(m_data, '\n', m_size));
+	m_body = newline ? newline + 1 : end;
+	std::string line(m_data, newline ? newline : end);
+	if (line.empty() || (line.size() == 1 && line[0] == '\r'))
+	{
+		throw std::invalid_argument("the first line has to name the columns");
+	}
+	// Delimiters in quotes are part of the name
+	bool inQuotes = false;
+	boost::algorithm::split(m_header, line, [&](char c) {
+		inQuotes ^= c == '"';
+		return c == m_delimiter && !inQuotes;
+	});
+	std::transform(m_header.begin(), m_header.end(), m_header.begin(), Unquote);
+}
+
+uint64_t CsvReader::CountRows(const char* begin, const char* end)const
+{
+	uint64_t rows = 0;
+	const char* p = begin;
+	for (; p + BLOCK <= end; p += BLOCK)
+	{
+#ifdef HAS_AVX2_CLASSIFY
+		const Masks masks = m_avx2 ? ClassifyAvx2(p, m_delimiter) : Classify(p, m_delimiter);
+#else
+		const Masks masks = Classify(p, m_delimiter);
+#endif
+		rows += PopCount(masks.newline);
+	}
+	rows += static_cast<uint64_t>(std::count(p, end, '\n'));
+	// A last line without its end
+	return rows + (end != begin && end[-1] != '\n');
+}
+
+void CsvReader::Parse(Part& part, const std::vector<uint32_t>& targets, std::vector<std::vector<double>>& columns)const
+{
+	const size_t fields = m_header.size();
+	uint64_t row = part.firstRow;
+	uint64_t line = part.firstRow;
+	size_t field = 0;
+	const char* fieldStart = part.begin;
+	bool inQuotes = false;
+
+	auto endField = [&](const char* fieldEnd) {
+		if (field < fields && targets[field] != SKIPPED
+			&& !ParseNumber(fieldStart, fieldEnd, columns[targets[field]][row]))
+		{
+			throw std::invalid_argument("line " + std::to_string(line + 2) + ", column '" + m_header[field]
+				+ "': not a number");
+		}
+		++field;
+	};
+	auto endLine = [&](const char* lineEnd) {
+		const bool blank = field == 0 && (lineEnd == fieldStart || (lineEnd == fieldStart + 1 && *fieldStart == '\r'));
+		if (!blank)
+		{
+			endField(lineEnd);
+			if (field != fields)
+			{
+				throw std::invalid_argument("line " + std::to_string(line + 2) + ": " + std::to_string(field)
+					+ " fields, the header has " + std::to_string(fields));
+			}
+			++row;
+		}
+		++line;
+		field = 0;
+	};
+
+	char tail[BLOCK];
+	for (const char* p = part.begin; p < part.end; p += BLOCK)
+	{
+		const size_t size = std::min<size_t>(BLOCK, static_cast<size_t>(part.end - p));
+		const char* block = p;
+		if (size < BLOCK)
+		{
+			std::memcpy(tail, p, size);
+			std::fill(tail + size, tail + BLOCK, '\0');
+			block = tail;
+		}
+#ifdef HAS_AVX2_CLASSIFY
+		const Masks masks = m_avx2 ? ClassifyAvx2(block, m_delimiter) : Classify(block, m_delimiter);
+#else
+		const Masks masks = Classify(block, m_delimiter);
+#endif
+		uint64_t structural = (masks.delimiter | masks.newline) & (size < BLOCK ? (uint64_t(1) << size) - 1 : ~uint64_t(0));
+		if (masks.quote || inQuotes)
+		{
+			const uint64_t quoted = PrefixXor(masks.quote) ^ (inQuotes ? ~uint64_t(0) : 0);
+			inQuotes = quoted >> 63;
+			structural &= ~quoted;
+		}
+		for (; structural; structural &= structural - 1)
+		{
+			const char* separator = p + TrailingZeros(structural);
+			if (*separator == '\n')
+			{
+				endLine(separator);
+			}
+			else
+			{
+				endField(separator);
+			}
+			fieldStart = separator + 1;
+		}
+	}
+	// A last line without its end, which may end with an empty field
+	if (fieldStart < part.end || field)
+	{
+		endLine(part.end);
+	}
+	part.rows = row - part.firstRow;
+}
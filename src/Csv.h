@@ -0,0 +1,64 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Reads numeric columns of a CSV file into one buffer of doubles per
+// column. The file is memory mapped, the first line names the columns.
+// The rows are split across threads at line boundaries; a first pass
+// counts the rows of every part, so a second one parses each straight into
+// its place in the columns. Delimiters, line ends and quotes are found 64
+// bytes at a time as bit masks (AVX2 where the CPU has it), the fields of
+// the columns read are parsed in place. Fields may be quoted but can't span
+// lines, blank lines are skipped and an empty field reads as NaN.
+class CsvReader
+{
+public:
+	struct Stats
+	{
+		uint64_t bytes = 0;
+		uint64_t rows = 0;
+		unsigned threads = 0;
+		double seconds = 0;
+	};
+
+	explicit CsvReader(const std::string& path, char delimiter = ',');
+
+	const std::vector<std::string>& GetHeader()const;
+	// Classifies with AVX2 where the CPU has it, the default, or with the
+	// portable loop; both give the same columns
+	void SetAvx2(bool avx2);
+	// Columns by header name, ignoring case, in the order given; 0 threads
+	// for one per hardware thread
+	std::vector<std::vector<double>> Read(const std::vector<std::string>& columns, unsigned threads = 0);
+	const Stats& GetStats()const;
+
+private:
+	// Where in the columns a part of the file goes
+	struct Part
+	{
+		const char* begin;
+		const char* end;
+		uint64_t firstRow;
+		uint64_t rows;
+	};
+
+	static constexpr uint32_t SKIPPED = UINT32_MAX;
+
+	void ParseHeader();
+	uint64_t CountRows(const char* begin, const char* end)const;
+	// 'targets' has the index in 'columns' of every field, or SKIPPED. Sets
+	// the rows of the part to those parsed, blank lines left out
+	void Parse(Part& part, const std::vector<uint32_t>& targets, std::vector<std::vector<double>>& columns)const;
+
+	char m_delimiter;
+	bool m_avx2;
+	MappedFile m_file;
+	const char* m_data;
+	size_t m_size;
+	// Of the rows, after the header
+	const char* m_body = nullptr;
+	std::vector<std::string> m_header;
+	Stats m_stats;
+};
@@ -0,0 +1,16 @@
+#include "Decimal.h"
+
+std::string Decimal::ToString()const
+{
+	const uint64_t magnitude = m_units < 0 ? 0 - static_cast<uint64_t>(m_units) : static_cast<uint64_t>(m_units);
+	std::string digits = std::to_string(magnitude);
+	if (m_scale > 0)
+	{
+		if (digits.length() <= static_cast<size_t>(m_scale))
+		{
+			digits.insert(0, m_scale + 1 - digits.length(), '0');
+		}
+		digits.insert(digits.length() - m_scale, 1, '.');
+	}
+	return m_units < 0 ? "-" + digits : digits;
+}
@@ -0,0 +1,314 @@
+#pragma once
+#include <string>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#if !defined(__SIZEOF_INT128__)
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+
+// Exact fixed-point number: units / 10^scale with 64-bit units.
+// Sums, products and quotients are computed with 128-bit intermediates and
+// rounded half away from zero when the scale has to shrink, so results are
+// exact until they need more than MAX_SCALE fraction digits. Results that
+// do not fit into 64-bit units throw std::overflow_error.
+// Everything except ToString is constexpr and shared with the compile-time engine.
+class Decimal
+{
+public:
+#if defined(__SIZEOF_INT128__)
+	using Int128 = __int128;
+#else
+	using Int128 = boost::multiprecision::int128_t;
+#endif
+
+	static constexpr int MAX_PRECISION = 18;
+	static constexpr int MAX_SCALE = 18;
+	// Fraction digits added to the operands' scale by a division
+	static constexpr int DIVISION_SCALE = 6;
+
+	constexpr Decimal() = default;
+
+	static constexpr Decimal FromUnits(int64_t units, int scale)
+	{
+		if (scale < 0 || scale > MAX_SCALE)
+		{
+			throw std::out_of_range("decimal scale is out of range");
+		}
+		Decimal result;
+		result.m_units = units;
+		result.m_scale = scale;
+		return result;
+	}
+
+	// Accepts a number constant lexeme: digits with an optional fraction.
+	// Fraction digits beyond MAX_SCALE are rounded, returns false on overflow.
+	static constexpr bool TryParse(std::string_view lexeme, Decimal& result)
+	{
+		Int128 units = 0;
+		int scale = 0;
+		bool fraction = false;
+		bool roundUp = false;
+		bool dropped = false;
+		for (char ch : lexeme)
+		{
+			if (ch == '.' && !fraction)
+			{
+				fraction = true;
+				continue;
+			}
+			if (ch < '0' || ch > '9')
+			{
+				throw std::invalid_argument("invalid decimal constant");
+			}
+			if (fraction && scale == MAX_SCALE)
+			{
+				roundUp = dropped ? roundUp : ch >= '5';
+				dropped = true;
+				continue;
+			}
+			units = units * 10 + (ch - '0');
+			scale += fraction ? 1 : 0;
+			if (units > std::numeric_limits<int64_t>::max())
+			{
+				return false;
+			}
+		}
+		units += roundUp ? 1 : 0;
+		if (units > std::numeric_limits<int64_t>::max())
+		{
+			return false;
+		}
+		result = FromUnits(static_cast<int64_t>(units), scale);
+		return true;
+	}
+
+	static constexpr Decimal Parse(std::string_view lexeme)
+	{
+		Decimal result;
+		if (!TryParse(lexeme, result))
+		{
+			throw std::overflow_error("decimal constant is out of range");
+		}
+		return result;
+	}
+
+	// Shortest scale that converts back to the same double, so that REAL 0.1
+	// becomes exactly 0.1; values needing more digits are rounded at MAX_SCALE
+	static constexpr Decimal FromDouble(double value)
+	{
+		if (!(value > -LIMIT && value < LIMIT))
+		{
+			throw std::overflow_error("value is out of decimal range");
+		}
+		Decimal result;
+		for (int scale = 0; scale <= MAX_SCALE; ++scale)
+		{
+			const double scaled = value * static_cast<double>(POW10[scale]);
+			if (!(scaled > -LIMIT && scaled < LIMIT))
+			{
+				break;
+			}
+			result = FromUnits(RoundToInt64(scaled), scale);
+			if (result.ToDouble() == value)
+			{
+				break;
+			}
+		}
+		return result;
+	}
+
+	constexpr int64_t GetUnits()const
+	{
+		return m_units;
+	}
+
+	constexpr int GetScale()const
+	{
+		return m_scale;
+	}
+
+	// Correctly rounded while the units fit into 2^53
+	constexpr double ToDouble()const
+	{
+		return static_cast<double>(m_units) / static_cast<double>(POW10[m_scale]);
+	}
+
+	// Changes the number of fraction digits, rounding half away from zero
+	constexpr Decimal Rescale(int scale)const
+	{
+		if (scale < 0 || scale > MAX_SCALE)
+		{
+			throw std::out_of_range("decimal scale is out of range");
+		}
+		if (scale >= m_scale)
+		{
+			return FromWide(Int128(m_units) * POW10[scale - m_scale], scale);
+		}
+		return FromWide(DivideRounded(m_units, POW10[m_scale - scale]), scale);
+	}
+
+	// Throws unless the value has at most 'precision' digits in total
+	constexpr void CheckPrecision(int precision)const
+	{
+		if (precision < MAX_PRECISION + 1 &&
+			(m_units >= POW10[precision] || m_units <= -POW10[precision]))
+		{
+			throw std::overflow_error("decimal value does not fit into its precision");
+		}
+	}
+
+	constexpr Decimal operator-()const
+	{
+		return FromWide(-Int128(m_units), m_scale);
+	}
+
+	constexpr Decimal operator+()const
+	{
+		return *this;
+	}
+
+	friend constexpr Decimal operator+(const Decimal& left, const Decimal& right)
+	{
+		const int scale = left.m_scale > right.m_scale ? left.m_scale : right.m_scale;
+		return FromWide(left.Widen(scale) + right.Widen(scale), scale);
+	}
+
+	friend constexpr Decimal operator-(const Decimal& left, const Decimal& right)
+	{
+		const int scale = left.m_scale > right.m_scale ? left.m_scale : right.m_scale;
+		return FromWide(left.Widen(scale) - right.Widen(scale), scale);
+	}
+
+	friend constexpr Decimal operator*(const Decimal& left, const Decimal& right)
+	{
+		const Int128 product = Int128(left.m_units) * right.m_units;
+		const int scale = left.m_scale + right.m_scale;
+		if (scale <= MAX_SCALE)
+		{
+			return FromWide(product, scale);
+		}
+		return FromWide(DivideRounded(product, POW10[scale - MAX_SCALE]), MAX_SCALE);
+	}
+
+	// Quotient rounded to 'scale' fraction digits
+	static constexpr Decimal Divide(const Decimal& left, const Decimal& right, int scale)
+	{
+		if (right.m_units == 0)
+		{
+			throw std::domain_error("decimal division by zero");
+		}
+		return DivideUnchecked(left, right, scale);
+	}
+
+	// Same as Divide for a divisor known to be non-zero
+	static constexpr Decimal DivideUnchecked(const Decimal& left, const Decimal& right, int scale)
+	{
+		// left * 10^exponent / right has the requested scale
+		const int exponent = scale + right.m_scale - left.m_scale;
+		if (exponent < 0)
+		{
+			return FromWide(DivideRounded(left.m_units, Int128(right.m_units) * POW10[-exponent]), scale);
+		}
+		Int128 dividend = Int128(left.m_units) * POW10[exponent < MAX_SCALE ? exponent : MAX_SCALE];
+		if (exponent > MAX_SCALE)
+		{
+			// Quotient exceeds 64 bits when the dividend does not fit here
+			const int64_t rest = POW10[exponent - MAX_SCALE];
+			if (dividend > WIDE_LIMIT / rest || dividend < -WIDE_LIMIT / rest)
+			{
+				throw std::overflow_error("decimal overflow");
+			}
+			dividend *= rest;
+		}
+		return FromWide(DivideRounded(dividend, right.m_units), scale);
+	}
+
+	// Scale of the quotient: DIVISION_SCALE digits more than the operands have,
+	// at least 'minimum' and at most MAX_SCALE
+	static constexpr int GetDivisionScale(const Decimal& left, const Decimal& right, int minimum = 0)
+	{
+		int scale = (left.m_scale > right.m_scale ? left.m_scale : right.m_scale) + DIVISION_SCALE;
+		scale = scale > minimum ? scale : minimum;
+		return scale < MAX_SCALE ? scale : MAX_SCALE;
+	}
+
+	friend constexpr Decimal operator/(const Decimal& left, const Decimal& right)
+	{
+		return Divide(left, right, GetDivisionScale(left, right));
+	}
+
+	friend constexpr bool operator==(const Decimal& left, const Decimal& right)
+	{
+		const int scale = left.m_scale > right.m_scale ? left.m_scale : right.m_scale;
+		return left.Widen(scale) == right.Widen(scale);
+	}
+
+	friend constexpr bool operator!=(const Decimal& left, const Decimal& right)
+	{
+		return !(left == right);
+	}
+
+	// All fraction digits of the scale are printed: 1.50 stays "1.50"
+	std::string ToString()const;
+
+private:
+	static constexpr int64_t POW10[MAX_SCALE + 1] = {
+		1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL, 100000000LL,
+		1000000000LL, 10000000000LL, 100000000000LL, 1000000000000LL, 10000000000000LL,
+		100000000000000LL, 1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+		1000000000000000000LL
+	};
+	// 2^63, doubles below it in magnitude convert to int64_t
+	static constexpr double LIMIT = 9223372036854775808.0;
+	// Quotients of greater dividends by 64-bit divisors need more than 64 bits
+	static constexpr Int128 WIDE_LIMIT = Int128(std::numeric_limits<int64_t>::max()) * std::numeric_limits<int64_t>::max();
+
+	static constexpr Decimal FromWide(Int128 units, int scale)
+	{
+		if (units > std::numeric_limits<int64_t>::max() || units < -std::numeric_limits<int64_t>::max())
+		{
+			throw std::overflow_error("decimal overflow");
+		}
+		return FromUnits(static_cast<int64_t>(units), scale);
+	}
+
+	static constexpr Int128 DivideRounded(Int128 dividend, Int128 divisor)
+	{
+		Int128 quotient = dividend / divisor;
+		Int128 remainder = dividend % divisor;
+		remainder = remainder < 0 ? -remainder : remainder;
+		const Int128 half = divisor < 0 ? -divisor : divisor;
+		if (remainder * 2 >= half)
+		{
+			quotient += (dividend < 0) != (divisor < 0) ? -1 : 1;
+		}
+		return quotient;
+	}
+
+	static constexpr int64_t RoundToInt64(double value)
+	{
+		const int64_t truncated = static_cast<int64_t>(value);
+		const double fraction = value - static_cast<double>(truncated);
+		if (fraction >= 0.5)
+		{
+			return truncated + 1;
+		}
+		if (fraction <= -0.5)
+		{
+			return truncated - 1;
+		}
+		return truncated;
+	}
+
+	// Units at a greater or equal scale, always fits into 128 bits
+	constexpr Int128 Widen(int scale)const
+	{
+		return Int128(m_units) * POW10[scale - m_scale];
+	}
+
+private:
+	int64_t m_units = 0;
+	int m_scale = 0;
+};
@@ -0,0 +1,770 @@
+#include "Differentiation.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// Integers doubles represent exactly, the FOR bounds ExpressionCalculator accepts
+const double EXACT_LIMIT = 9007199254740992.0;
+}
+
+ForwardDifferentiator::ForwardDifferentiator(const std::vector<std::string>& inputs)
+	: m_inputs(inputs)
+	, m_seeded(inputs.size(), false)
+{
+}
+
+void ForwardDifferentiator::SetVariable(const std::string& name, double value)
+{
+	const std::string varname = boost::algorithm::to_lower_copy(name);
+	Variable& variable = FindOrAdd(varname, name);
+	variable.value->second = value;
+	double* tangent = Row(variable.row);
+	std::fill(tangent, tangent + m_inputs.size(), 0.0);
+	for (size_t i = 0; i < m_inputs.size(); ++i)
+	{
+		if (boost::algorithm::to_lower_copy(m_inputs[i]) == varname)
+		{
+			tangent[i] = 1;
+			m_seeded[i] = true;
+		}
+	}
+}
+
+void ForwardDifferentiator::SetRandomStream(const RandomStream& random)
+{
+	m_random = random;
+}
+
+void ForwardDifferentiator::Run(const ProgramNode& program)
+{
+	for (size_t i = 0; i < m_inputs.size(); ++i)
+	{
+		if (!m_seeded[i])
+		{
+			throw std::invalid_argument("input '" + m_inputs[i] + "' is not set");
+		}
+	}
+	m_depth = 0;
+	Visit(program);
+}
+
+const std::map<std::string, double>& ForwardDifferentiator::GetScope()const
+{
+	return m_scope;
+}
+
+std::vector<double> ForwardDifferentiator::GetGradient(const std::string& name)const
+{
+	auto it = m_index.find(boost::algorithm::to_lower_copy(name));
+	if (it == m_index.end())
+	{
+		throw std::runtime_error("variable is not defined");
+	}
+	auto row = m_tangents.begin() + it->second.row * m_inputs.size();
+	return std::vector<double>(row, row + m_inputs.size());
+}
+
+void ForwardDifferentiator::Visit(const BinOpNode& binop)
+{
+	m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+		[this](const BinOpNode& node) { Combine(node); });
+}
+
+void ForwardDifferentiator::Combine(const BinOpNode& binop)
+{
+	const double left = m_acc;
+	const double right = Differentiate(binop.GetRight());
+	double* result = Top(1);
+	const double* tangent = Top();
+	const size_t width = m_inputs.size();
+	switch (binop.GetOperator())
+	{
+	case BinOpNode::Plus:
+		m_acc = left + right;
+		for (size_t i = 0; i < width; ++i)
+		{
+			result[i] += tangent[i];
+		}
+		break;
+	case BinOpNode::Minus:
+		m_acc = left - right;
+		for (size_t i = 0; i < width; ++i)
+		{
+			result[i] -= tangent[i];
+		}
+		break;
+	case BinOpNode::Mul:
+		m_acc = left * right;
+		for (size_t i = 0; i < width; ++i)
+		{
+			result[i] = result[i] * right + left * tangent[i];
+		}
+		break;
+	case BinOpNode::IntegerDiv:
+		// Rounded quotients are piecewise constant
+		m_acc = std::round(left / right);
+		std::fill(result, result + width, 0.0);
+		break;
+	case BinOpNode::FloatDiv:
+		m_acc = left / right;
+		for (size_t i = 0; i < width; ++i)
+		{
+			result[i] = (result[i] - m_acc * tangent[i]) / right;
+		}
+		break;
+	default:
+		throw std::logic_error("undefined operator");
+	}
+	Pop();
+}
+
+void ForwardDifferentiator::Visit(const LeafNumNode& num)
+{
+	m_acc = num.GetValue();
+	double* tangent = Push();
+	std::fill(tangent, tangent + m_inputs.size(), 0.0);
+}
+
+void ForwardDifferentiator::Visit(const UnOpNode& unop)
+{
+	const double value = Differentiate(unop.GetExpression());
+	switch (unop.GetOperator())
+	{
+	case UnOpNode::Plus:
+		m_acc = +value;
+		break;
+	case UnOpNode::Minus:
+	{
+		m_acc = -value;
+		double* tangent = Top();
+		for (size_t i = 0; i < m_inputs.size(); ++i)
+		{
+			tangent[i] = -tangent[i];
+		}
+		break;
+	}
+	default:
+		throw std::logic_error("undefined unary operator");
+	}
+}
+
+void ForwardDifferentiator::Visit(const LeafVarNode& var)
+{
+	auto it = m_index.find(boost::algorithm::to_lower_copy(var.GetName()));
+	if (it == m_index.end())
+	{
+		throw std::runtime_error("variable is not defined");
+	}
+	m_acc = it->second.value->second;
+	double* tangent = Push();
+	const double* source = Row(it->second.row);
+	std::copy(source, source + m_inputs.size(), tangent);
+}
+
+void ForwardDifferentiator::Visit(const LeafInvariantNode& invariant)
+{
+	// Hoisted by LoopOptimizer, recomputed with its tangent
+	invariant.GetExpression().Accept(*this);
+}
+
+void ForwardDifferentiator::Visit(const InductionNode& induction)
+{
+	// Equal to the sum ExpressionCalculator keeps while that is exact
+	induction.GetProduct().Accept(*this);
+}
+
+void ForwardDifferentiator::Visit(const RandomNode& random)
+{
+	m_acc = random.GetDistribution() == RandomNode::Normal ? m_random.Normal() : m_random.Uniform();
+	double* tangent = Push();
+	std::fill(tangent, tangent + m_inputs.size(), 0.0);
+}
+
+void ForwardDifferentiator::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void ForwardDifferentiator::Visit(const AssignNode& assign)
+{
+	const double value = Differentiate(assign.GetRight());
+	Variable& variable = FindOrAdd(boost::algorithm::to_lower_copy(assign.GetLeft()), assign.GetLeft());
+	variable.value->second = value;
+	std::copy(Top(), Top() + m_inputs.size(), Row(variable.row));
+	Pop();
+}
+
+void ForwardDifferentiator::Visit(const CompoundNode& compound)
+{
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void ForwardDifferentiator::Visit(const ForNode& loop)
+{
+	// The iteration count doesn't depend smoothly on the bounds
+	const double start = Differentiate(loop.GetStart());
+	Pop();
+	const double end = Differentiate(loop.GetEnd());
+	Pop();
+	const double step = loop.GetDirection() == ForNode::To ? 1 : -1;
+	if (!((end - start) * step >= 0))
+	{
+		return;
+	}
+	if (!(std::abs(start) <= EXACT_LIMIT && std::abs(end) <= EXACT_LIMIT))
+	{
+		throw std::runtime_error("FOR bounds are out of range");
+	}
+
+	Variable& counter = FindOrAdd(boost::algorithm::to_lower_copy(loop.GetVariable()), loop.GetVariable());
+	const double count = std::floor((end - start) * step) + 1;
+	double value = start;
+	for (double i = 0; i < count; ++i, value += step)
+	{
+		counter.value->second = value;
+		double* tangent = Row(counter.row);
+		std::fill(tangent, tangent + m_inputs.size(), 0.0);
+		loop.GetBody().Accept(*this);
+	}
+}
+
+void ForwardDifferentiator::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void ForwardDifferentiator::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode::Type type = vardecl.GetTypeNode().GetType();
+	if (type == TypeNode::Decimal || type == TypeNode::BigInt)
+	{
+		throw std::invalid_argument("only INTEGER and REAL programs are differentiated");
+	}
+}
+
+void ForwardDifferentiator::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	Visit(block.GetCompound());
+}
+
+void ForwardDifferentiator::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+double ForwardDifferentiator::Differentiate(const ASTNode& expression)
+{
+	expression.Accept(*this);
+	return m_acc;
+}
+
+double* ForwardDifferentiator::Push()
+{
+	++m_depth;
+	if (m_stack.size() < m_depth * m_inputs.size())
+	{
+		m_stack.resize(m_depth * m_inputs.size());
+	}
+	return Top();
+}
+
+void ForwardDifferentiator::Pop()
+{
+	--m_depth;
+}
+
+double* ForwardDifferentiator::Top(size_t depth)
+{
+	return m_stack.data() + (m_depth - 1 - depth) * m_inputs.size();
+}
+
+double* ForwardDifferentiator::Row(size_t row)
+{
+	return m_tangents.data() + row * m_inputs.size();
+}
+
+ForwardDifferentiator::Variable& ForwardDifferentiator::FindOrAdd(const std::string& varname, const std::string& name)
+{
+	auto it = m_index.find(varname);
+	if (it == m_index.end())
+	{
+		const size_t row = m_index.size();
+		m_tangents.resize((row + 1) * m_inputs.size(), 0.0);
+		it = m_index.emplace(varname, Variable{ m_scope.emplace(name, 0.0).first, row }).first;
+	}
+	return it->second;
+}
+
+Tape::Tape()
+{
+	Clear();
+}
+
+uint32_t Tape::Record(uint32_t left, double leftPartial, uint32_t right, double rightPartial)
+{
+	if (m_size == std::numeric_limits<uint32_t>::max())
+	{
+		throw std::length_error("tape is full");
+	}
+	if (m_size / BLOCK_SIZE == m_blocks.size())
+	{
+		m_blocks.push_back(std::make_unique<Entry[]>(BLOCK_SIZE));
+	}
+	m_blocks[m_size / BLOCK_SIZE][m_size % BLOCK_SIZE] = { { left, right }, { leftPartial, rightPartial } };
+	return m_size++;
+}
+
+const Tape::Entry& Tape::operator[](uint32_t slot)const
+{
+	return m_blocks[slot / BLOCK_SIZE][slot % BLOCK_SIZE];
+}
+
+uint32_t Tape::GetSize()const
+{
+	return m_size;
+}
+
+size_t Tape::GetCapacity()const
+{
+	return m_blocks.size() * BLOCK_SIZE;
+}
+
+void Tape::Clear()
+{
+	m_size = 1;
+	if (m_blocks.empty())
+	{
+		m_blocks.push_back(std::make_unique<Entry[]>(BLOCK_SIZE));
+	}
+	m_blocks[0][0] = { { 0, 0 }, { 0, 0 } };
+}
+
+void Tape::Sweep(std::vector<double>& adjoints, uint32_t begin, uint32_t end)const
+{
+	for (uint32_t slot = end; slot-- > begin;)
+	{
+		const double adjoint = adjoints[slot];
+		if (adjoint == 0)
+		{
+			continue;
+		}
+		const Entry& entry = (*this)[slot];
+		adjoints[entry.operands[0]] += adjoint * entry.partials[0];
+		adjoints[entry.operands[1]] += adjoint * entry.partials[1];
+	}
+}
+
+ReverseDifferentiator::ReverseDifferentiator(const std::vector<std::string>& inputs, uint64_t checkpointInterval)
+	: m_inputs(inputs)
+	, m_inputSlots(inputs.size(), 0)
+	, m_checkpointInterval(checkpointInterval)
+{
+}
+
+void ReverseDifferentiator::SetVariable(const std::string& name, double value)
+{
+	const std::string varname = boost::algorithm::to_lower_copy(name);
+	Variable& variable = FindOrAdd(varname, name);
+	variable.value->second = value;
+	variable.slot = 0;
+	for (size_t i = 0; i < m_inputs.size(); ++i)
+	{
+		if (boost::algorithm::to_lower_copy(m_inputs[i]) == varname)
+		{
+			if (!variable.slot)
+			{
+				variable.slot = m_tape.Record(0, 0, 0, 0);
+			}
+			m_inputSlots[i] = variable.slot;
+		}
+	}
+}
+
+void ReverseDifferentiator::SetRandomStream(const RandomStream& random)
+{
+	m_random = random;
+}
+
+void ReverseDifferentiator::Run(const ProgramNode& program)
+{
+	for (size_t i = 0; i < m_inputs.size(); ++i)
+	{
+		if (!m_inputSlots[i])
+		{
+			throw std::invalid_argument("input '" + m_inputs[i] + "' is not set");
+		}
+	}
+	Visit(program);
+}
+
+void ReverseDifferentiator::Reset()
+{
+	std::fill(m_inputSlots.begin(), m_inputSlots.end(), 0);
+	m_scope.clear();
+	m_index.clear();
+	m_tape.Clear();
+	m_replay.Clear();
+	m_loops.clear();
+	// A failed run may have stopped in a checkpointed loop
+	m_recorder = &m_tape;
+	m_recording = true;
+	m_loopDepth = 0;
+}
+
+const std::map<std::string, double>& ReverseDifferentiator::GetScope()const
+{
+	return m_scope;
+}
+
+std::vector<double> ReverseDifferentiator::GetGradient(const std::string& name)
+{
+	auto it = m_index.find(boost::algorithm::to_lower_copy(name));
+	if (it == m_index.end())
+	{
+		throw std::runtime_error("variable is not defined");
+	}
+	std::vector<double> adjoints(m_tape.GetSize(), 0.0);
+	adjoints[it->second.slot] = 1;
+
+	// Replays overwrite the variables and draw again, the values, slots and
+	// stream position after the run are restored
+	const uint64_t draws = m_random.GetPosition();
+	std::vector<std::pair<double, uint32_t>> saved;
+	for (const auto& [varname, variable] : m_index)
+	{
+		(void)varname;
+		saved.emplace_back(variable.value->second, variable.slot);
+	}
+	uint32_t end = m_tape.GetSize();
+	for (auto loop = m_loops.rbegin(); loop != m_loops.rend(); ++loop)
+	{
+		m_tape.Sweep(adjoints, loop->exit + static_cast<uint32_t>(loop->exitVariables.size()), end);
+		SweepLoop(*loop, adjoints);
+		end = loop->exit;
+	}
+	m_tape.Sweep(adjoints, 1, end);
+	auto restored = saved.begin();
+	for (auto& [varname, variable] : m_index)
+	{
+		(void)varname;
+		variable.value->second = restored->first;
+		variable.slot = restored->second;
+		++restored;
+	}
+	m_random.SetPosition(draws);
+
+	std::vector<double> gradient;
+	for (uint32_t slot : m_inputSlots)
+	{
+		gradient.push_back(adjoints[slot]);
+	}
+	return gradient;
+}
+
+size_t ReverseDifferentiator::GetTapeSize()const
+{
+	return m_tape.GetSize() + m_replay.GetSize() - 2;
+}
+
+void ReverseDifferentiator::Visit(const BinOpNode& binop)
+{
+	m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+		[this](const BinOpNode& node) { Combine(node); });
+}
+
+void ReverseDifferentiator::Combine(const BinOpNode& binop)
+{
+	const double left = m_acc;
+	const uint32_t leftSlot = m_slot;
+	const double right = Evaluate(binop.GetRight());
+	const uint32_t rightSlot = m_slot;
+	switch (binop.GetOperator())
+	{
+	case BinOpNode::Plus:
+		m_acc = left + right;
+		m_slot = Record(leftSlot, 1, rightSlot, 1);
+		break;
+	case BinOpNode::Minus:
+		m_acc = left - right;
+		m_slot = Record(leftSlot, 1, rightSlot, -1);
+		break;
+	case BinOpNode::Mul:
+		m_acc = left * right;
+		m_slot = Record(leftSlot, right, rightSlot, left);
+		break;
+	case BinOpNode::IntegerDiv:
+		// Rounded quotients are piecewise constant
+		m_acc = std::round(left / right);
+		m_slot = 0;
+		break;
+	case BinOpNode::FloatDiv:
+		m_acc = left / right;
+		m_slot = Record(leftSlot, 1 / right, rightSlot, -m_acc / right);
+		break;
+	default:
+		throw std::logic_error("undefined operator");
+	}
+}
+
+void ReverseDifferentiator::Visit(const LeafNumNode& num)
+{
+	m_acc = num.GetValue();
+	m_slot = 0;
+}
+
+void ReverseDifferentiator::Visit(const UnOpNode& unop)
+{
+	const double value = Evaluate(unop.GetExpression());
+	switch (unop.GetOperator())
+	{
+	case UnOpNode::Plus:
+		m_acc = +value;
+		break;
+	case UnOpNode::Minus:
+		m_acc = -value;
+		m_slot = Record(m_slot, -1, 0, 0);
+		break;
+	default:
+		throw std::logic_error("undefined unary operator");
+	}
+}
+
+void ReverseDifferentiator::Visit(const LeafVarNode& var)
+{
+	auto it = m_index.find(boost::algorithm::to_lower_copy(var.GetName()));
+	if (it == m_index.end())
+	{
+		throw std::runtime_error("variable is not defined");
+	}
+	m_acc = it->second.value->second;
+	m_slot = it->second.slot;
+}
+
+void ReverseDifferentiator::Visit(const LeafInvariantNode& invariant)
+{
+	invariant.GetExpression().Accept(*this);
+}
+
+void ReverseDifferentiator::Visit(const InductionNode& induction)
+{
+	induction.GetProduct().Accept(*this);
+}
+
+void ReverseDifferentiator::Visit(const RandomNode& random)
+{
+	m_acc = random.GetDistribution() == RandomNode::Normal ? m_random.Normal() : m_random.Uniform();
+	m_slot = 0;
+}
+
+void ReverseDifferentiator::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void ReverseDifferentiator::Visit(const AssignNode& assign)
+{
+	const double value = Evaluate(assign.GetRight());
+	Variable& variable = FindOrAdd(boost::algorithm::to_lower_copy(assign.GetLeft()), assign.GetLeft());
+	variable.value->second = value;
+	variable.slot = m_slot;
+}
+
+void ReverseDifferentiator::Visit(const CompoundNode& compound)
+{
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void ReverseDifferentiator::Visit(const ForNode& loop)
+{
+	const double start = Evaluate(loop.GetStart());
+	const double end = Evaluate(loop.GetEnd());
+	const double step = loop.GetDirection() == ForNode::To ? 1 : -1;
+	if (!((end - start) * step >= 0))
+	{
+		return;
+	}
+	if (!(std::abs(start) <= EXACT_LIMIT && std::abs(end) <= EXACT_LIMIT))
+	{
+		throw std::runtime_error("FOR bounds are out of range");
+	}
+
+	Variable& counter = FindOrAdd(boost::algorithm::to_lower_copy(loop.GetVariable()), loop.GetVariable());
+	const double count = std::floor((end - start) * step) + 1;
+	if (m_checkpointInterval && m_loopDepth == 0)
+	{
+		RunCheckpointed(loop, counter, start, step, count);
+		return;
+	}
+	++m_loopDepth;
+	RunIterations(loop, counter, start, step, count);
+	--m_loopDepth;
+}
+
+void ReverseDifferentiator::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void ReverseDifferentiator::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode::Type type = vardecl.GetTypeNode().GetType();
+	if (type == TypeNode::Decimal || type == TypeNode::BigInt)
+	{
+		throw std::invalid_argument("only INTEGER and REAL programs are differentiated");
+	}
+}
+
+void ReverseDifferentiator::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	Visit(block.GetCompound());
+}
+
+void ReverseDifferentiator::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+double ReverseDifferentiator::Evaluate(const ASTNode& expression)
+{
+	expression.Accept(*this);
+	return m_acc;
+}
+
+uint32_t ReverseDifferentiator::Record(uint32_t left, double leftPartial, uint32_t right, double rightPartial)
+{
+	if (!m_recording || (!left && !right))
+	{
+		return 0;
+	}
+	return m_recorder->Record(left, leftPartial, right, rightPartial);
+}
+
+double ReverseDifferentiator::RunIterations(const ForNode& loop, Variable& counter, double value, double step, double count)
+{
+	for (double i = 0; i < count; ++i, value += step)
+	{
+		counter.value->second = value;
+		counter.slot = 0;
+		loop.GetBody().Accept(*this);
+	}
+	return value;
+}
+
+void ReverseDifferentiator::RunCheckpointed(const ForNode& loop, Variable& counter, double value, double step, double count)
+{
+	CheckpointedLoop checkpointed{ &loop, step, {}, 0, {}, {} };
+	for (const auto& [varname, variable] : m_index)
+	{
+		checkpointed.entry.emplace_back(varname, variable.slot);
+	}
+
+	const bool recording = m_recording;
+	m_recording = false;
+	++m_loopDepth;
+	const double interval = static_cast<double>(m_checkpointInterval);
+	for (double i = 0; i < count; i += interval)
+	{
+		Checkpoint checkpoint{ value, static_cast<uint64_t>(std::min(interval, count - i)), m_random.GetPosition(), {} };
+		for (const auto& [varname, variable] : m_index)
+		{
+			checkpoint.values.emplace_back(varname, variable.value->second);
+		}
+		checkpointed.checkpoints.push_back(std::move(checkpoint));
+		value = RunIterations(loop, counter, value, step, std::min(interval, count - i));
+	}
+	--m_loopDepth;
+	m_recording = recording;
+
+	checkpointed.exit = m_tape.GetSize();
+	for (auto& [varname, variable] : m_index)
+	{
+		checkpointed.exitVariables.push_back(varname);
+		variable.slot = m_tape.Record(0, 0, 0, 0);
+	}
+	m_loops.push_back(std::move(checkpointed));
+}
+
+void ReverseDifferentiator::SweepLoop(const CheckpointedLoop& loop, std::vector<double>& adjoints)
+{
+	// Adjoints of the variables at the end of the interval being replayed
+	std::vector<std::pair<std::string, double>> after;
+	for (size_t i = 0; i < loop.exitVariables.size(); ++i)
+	{
+		after.emplace_back(loop.exitVariables[i], adjoints[loop.exit + i]);
+	}
+
+	Variable& counter = m_index.at(boost::algorithm::to_lower_copy(loop.loop->GetVariable()));
+	m_recorder = &m_replay;
+	++m_loopDepth;
+	std::vector<double> replayed;
+	for (auto checkpoint = loop.checkpoints.rbegin(); checkpoint != loop.checkpoints.rend(); ++checkpoint)
+	{
+		m_replay.Clear();
+		for (auto& [varname, variable] : m_index)
+		{
+			(void)varname;
+			variable.slot = 0;
+		}
+		std::vector<std::pair<std::string, uint32_t>> leaves;
+		for (const auto& [varname, value] : checkpoint->values)
+		{
+			Variable& variable = m_index.at(varname);
+			variable.value->second = value;
+			variable.slot = m_replay.Record(0, 0, 0, 0);
+			leaves.emplace_back(varname, variable.slot);
+		}
+		m_random.SetPosition(checkpoint->draws);
+		RunIterations(*loop.loop, counter, checkpoint->counter, loop.step, static_cast<double>(checkpoint->iterations));
+
+		replayed.assign(m_replay.GetSize(), 0.0);
+		for (const auto& [varname, adjoint] : after)
+		{
+			replayed[m_index.at(varname).slot] += adjoint;
+		}
+		m_replay.Sweep(replayed, 1, m_replay.GetSize());
+		after.clear();
+		for (const auto& [varname, slot] : leaves)
+		{
+			after.emplace_back(varname, replayed[slot]);
+		}
+	}
+	--m_loopDepth;
+	m_recorder = &m_tape;
+
+	// Variables assigned first in the loop have no slot before it
+	std::unordered_map<std::string, double> adjointsBefore(after.begin(), after.end());
+	for (const auto& [varname, slot] : loop.entry)
+	{
+		auto adjoint = adjointsBefore.find(varname);
+		if (adjoint != adjointsBefore.end())
+		{
+			adjoints[slot] += adjoint->second;
+		}
+	}
+}
+
+ReverseDifferentiator::Variable& ReverseDifferentiator::FindOrAdd(const std::string& varname, const std::string& name)
+{
+	auto it = m_index.find(varname);
+	if (it == m_index.end())
+	{
+		it = m_index.emplace(varname, Variable{ m_scope.emplace(name, 0.0).first, 0 }).first;
+	}
+	return it->second;
+}
@@ -0,0 +1,215 @@
+#pragma once
+#include "AST.h"
+#include <map>
+
+// Runs a program on dual numbers: every value carries its derivatives with
+// respect to the chosen inputs, so one run gives the outputs and all their
+// sensitivities instead of two bumped runs per input. Values are computed
+// exactly as by ExpressionCalculator. DIV rounds, its derivative is 0.
+// Tangents are stored contiguously, one row per variable and per operand on
+// the evaluation stack, and each operation is a loop over the row.
+// Only INTEGER and REAL programs are differentiated.
+class ForwardDifferentiator : public IASTNodeVisitor
+{
+public:
+	// Derivatives are taken with respect to these variables, in this order
+	explicit ForwardDifferentiator(const std::vector<std::string>& inputs);
+
+	// Sets a variable before the program runs, inputs have to be set
+	void SetVariable(const std::string& name, double value);
+	// RANDOM draws as by ExpressionCalculator, their derivatives are 0
+	void SetRandomStream(const RandomStream& random);
+	void Run(const ProgramNode& program);
+
+	// Assigned variables as ExpressionCalculator::GetScope
+	const std::map<std::string, double>& GetScope()const;
+	// Derivatives of the variable with respect to the inputs
+	std::vector<double> GetGradient(const std::string& name)const;
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	struct Variable
+	{
+		std::map<std::string, double>::iterator value;
+		size_t row;
+	};
+
+	// Value of the expression, its tangent is pushed on the stack
+	double Differentiate(const ASTNode& expression);
+	// Applies the operator to m_acc and the tangent on top, those of the left operand
+	void Combine(const BinOpNode& binop);
+	double* Push();
+	void Pop();
+	double* Top(size_t depth = 0);
+	double* Row(size_t row);
+	Variable& FindOrAdd(const std::string& varname, const std::string& name);
+
+private:
+	std::vector<std::string> m_inputs;
+	std::vector<bool> m_seeded;
+	std::map<std::string, double> m_scope;
+	// By lowercase name
+	std::unordered_map<std::string, Variable> m_index;
+	// Tangent rows of the variables, m_inputs.size() each
+	std::vector<double> m_tangents;
+	std::vector<double> m_stack;
+	size_t m_depth = 0;
+	RandomStream m_random;
+	double m_acc = 0;
+	ChainWalker m_chain;
+};
+
+// Operations recorded by ReverseDifferentiator: the operand slots of each
+// result and the partial derivatives by them. Entries are kept in blocks that
+// never move as the tape grows, Clear keeps the blocks for the next recording
+class Tape
+{
+public:
+	struct Entry
+	{
+		uint32_t operands[2];
+		double partials[2];
+	};
+
+	// Slot 0 is the constant slot, recording starts at 1
+	Tape();
+
+	uint32_t Record(uint32_t left, double leftPartial, uint32_t right, double rightPartial);
+	const Entry& operator[](uint32_t slot)const;
+	// Next slot to record
+	uint32_t GetSize()const;
+	size_t GetCapacity()const;
+	void Clear();
+	// Accumulates adjoints of the slots in [begin, end) into their operands, last first
+	void Sweep(std::vector<double>& adjoints, uint32_t begin, uint32_t end)const;
+
+private:
+	static constexpr uint32_t BLOCK_SIZE = 4096;
+
+	std::vector<std::unique_ptr<Entry[]>> m_blocks;
+	uint32_t m_size = 1;
+};
+
+// Reverse-mode counterpart of ForwardDifferentiator: a run records every
+// operation on REAL values on a Tape, then a backward sweep per output gives
+// its derivatives by all inputs at once, for a few times the cost of the
+// run whatever the number of inputs.
+// With a checkpoint interval, top-level FOR loops are not recorded: the
+// variables are saved every 'interval' iterations, and the backward sweep
+// replays and records one interval at a time on a second tape. The tape then
+// holds one interval of a long loop instead of all its iterations.
+class ReverseDifferentiator : public IASTNodeVisitor
+{
+public:
+	// Derivatives are taken with respect to these variables, in this order;
+	// 0 records loops in full
+	explicit ReverseDifferentiator(const std::vector<std::string>& inputs, uint64_t checkpointInterval = 0);
+
+	// Sets a variable before the program runs, inputs have to be set
+	void SetVariable(const std::string& name, double value);
+	// RANDOM draws as by ExpressionCalculator, their derivatives are 0
+	void SetRandomStream(const RandomStream& random);
+	void Run(const ProgramNode& program);
+	// Forgets the variables and the recording, keeps the memory of the tapes
+	void Reset();
+
+	// Assigned variables as ExpressionCalculator::GetScope
+	const std::map<std::string, double>& GetScope()const;
+	// Derivatives of the variable with respect to the inputs
+	std::vector<double> GetGradient(const std::string& name);
+	// Entries recorded, the replay tape of checkpointed loops included
+	size_t GetTapeSize()const;
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	struct Variable
+	{
+		std::map<std::string, double>::iterator value;
+		uint32_t slot;
+	};
+
+	// Variables by lowercase name at the start of an interval
+	struct Checkpoint
+	{
+		double counter;
+		uint64_t iterations;
+		// Position of the random stream, replays take the same draws
+		uint64_t draws;
+		std::vector<std::pair<std::string, double>> values;
+	};
+
+	// A top-level loop run without recording
+	struct CheckpointedLoop
+	{
+		const ForNode* loop;
+		double step;
+		// Slots of the variables before the loop, by lowercase name
+		std::vector<std::pair<std::string, uint32_t>> entry;
+		// The variables after the loop are recorded as new inputs from this slot on
+		uint32_t exit;
+		std::vector<std::string> exitVariables;
+		std::vector<Checkpoint> checkpoints;
+	};
+
+	// Value of the expression, its slot is left in m_slot
+	double Evaluate(const ASTNode& expression);
+	// Records the operator, m_acc and m_slot hold the left operand
+	void Combine(const BinOpNode& binop);
+	// Slot 0 when nothing is recorded or both operands are constant
+	uint32_t Record(uint32_t left, double leftPartial, uint32_t right, double rightPartial);
+	// Returns the counter value of the next iteration
+	double RunIterations(const ForNode& loop, Variable& counter, double value, double step, double count);
+	void RunCheckpointed(const ForNode& loop, Variable& counter, double value, double step, double count);
+	// Turns adjoints of the variables after the loop into adjoints of the slots before it
+	void SweepLoop(const CheckpointedLoop& loop, std::vector<double>& adjoints);
+	Variable& FindOrAdd(const std::string& varname, const std::string& name);
+
+private:
+	std::vector<std::string> m_inputs;
+	std::vector<uint32_t> m_inputSlots;
+	uint64_t m_checkpointInterval;
+	std::map<std::string, double> m_scope;
+	// By lowercase name
+	std::unordered_map<std::string, Variable> m_index;
+	Tape m_tape;
+	// Replays of checkpointed intervals
+	Tape m_replay;
+	Tape* m_recorder = &m_tape;
+	bool m_recording = true;
+	size_t m_loopDepth = 0;
+	std::vector<CheckpointedLoop> m_loops;
+	RandomStream m_random;
+	double m_acc = 0;
+	uint32_t m_slot = 0;
+	ChainWalker m_chain;
+};
@@ -0,0 +1,568 @@
+#include "IncrementalParser.h"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+// Initial amount of text re-lexed past the edit, doubled until tokens resynchronize
+const size_t RELEX_WINDOW = 64;
+
+// Tokens per piece of a parsed text; pieces grown past twice that are cut again
+const size_t PIECE_TOKENS = 256;
+
+bool SameToken(const Token& left, const Token& right)
+{
+	return left.type == right.type && left.value == right.value;
+}
+}
+
+IncrementalParser::PrefixSums::PrefixSums(const std::vector<size_t>& values)
+	: mTree(values.size() + 1)
+{
+	for (size_t i = 1; i < mTree.size(); ++i)
+	{
+		mTree[i] += values[i - 1];
+		mTotal += values[i - 1];
+		const size_t parent = i + (i & (0 - i));
+		if (parent < mTree.size())
+		{
+			mTree[parent] += mTree[i];
+		}
+	}
+}
+
+size_t IncrementalParser::PrefixSums::GetPrefix(size_t index)const
+{
+	size_t sum = 0;
+	for (size_t i = index; i > 0; i -= i & (0 - i))
+	{
+		sum += mTree[i];
+	}
+	return sum;
+}
+
+size_t IncrementalParser::PrefixSums::GetTotal()const
+{
+	return mTotal;
+}
+
+void IncrementalParser::PrefixSums::Add(size_t index, ptrdiff_t delta)
+{
+	// Unsigned wrap-around subtracts
+	for (size_t i = index + 1; i < mTree.size(); i += i & (0 - i))
+	{
+		mTree[i] += static_cast<size_t>(delta);
+	}
+	mTotal += static_cast<size_t>(delta);
+}
+
+size_t IncrementalParser::PrefixSums::Find(size_t position)const
+{
+	size_t step = 1;
+	while (step * 2 < mTree.size())
+	{
+		step *= 2;
+	}
+	size_t index = 0;
+	for (; step > 0; step /= 2)
+	{
+		if (index + step < mTree.size() && mTree[index + step] <= position)
+		{
+			index += step;
+			position -= mTree[index];
+		}
+	}
+	return index;
+}
+
+IncrementalParser::IncrementalParser(const std::string& text)
+	: mText(text)
+{
+	ParseFully();
+}
+
+void IncrementalParser::Edit(size_t offset, size_t length, const std::string& replacement)
+{
+	const size_t textLength = GetTextLength();
+	if (offset > textLength || length > textLength - offset)
+	{
+		throw std::out_of_range("edit is out of text bounds");
+	}
+	mStats = {};
+
+	// Previous text had errors, there is nothing to reuse
+	if (!mProgram)
+	{
+		mText.replace(offset, length, replacement);
+		ParseFully();
+		return;
+	}
+
+	try
+	{
+		const Damage damage = Relex(offset, length, replacement);
+		if (!Reparse(damage))
+		{
+			ParseFully();
+		}
+	}
+	catch (...)
+	{
+		// The pieces have the edited text, the tokens may not
+		GetText();
+		mProgram.reset();
+		mRoot = {};
+		throw;
+	}
+}
+
+const std::string& IncrementalParser::GetText()const
+{
+	if (!mTextValid)
+	{
+		mText.clear();
+		mText.reserve(GetTextLength());
+		for (const Piece& piece : mPieces)
+		{
+			mText += piece.text;
+		}
+		mTextValid = true;
+	}
+	return mText;
+}
+
+const ProgramNode& IncrementalParser::GetProgram()const
+{
+	if (!mProgram)
+	{
+		throw std::logic_error("text has not been parsed successfully");
+	}
+	return *mProgram;
+}
+
+const IncrementalParser::Stats& IncrementalParser::GetLastEditStats()const
+{
+	return mStats;
+}
+
+IncrementalParser::Damage IncrementalParser::Relex(size_t offset, size_t length, const std::string& replacement)
+{
+	const size_t editEnd = offset + replacement.length();
+
+	// Restart from the last token that begins before the edit: inserted text may extend it
+	const size_t low = FindToken(offset);
+	const size_t first = low == 0 ? 0 : low - 1;
+	const size_t restart = low == 0 ? 0 : GetOffset(first);
+	// Old tokens from here on begin after the replaced text and move with it
+	const size_t following = FindToken(offset + length);
+	ReplaceText(offset, length, replacement);
+
+	const size_t textLength = GetTextLength();
+	const size_t count = GetTokenCount();
+	for (size_t window = editEnd - restart + RELEX_WINDOW; ; window *= 2)
+	{
+		const size_t windowEnd = std::min(textLength, restart + window);
+		const bool complete = windowEnd == textLength;
+
+		Lexer lexer(GetText(restart, windowEnd));
+		std::vector<Token> tokens;
+		size_t old = following;
+		bool resynchronized = false;
+		while (true)
+		{
+			Token token = lexer.Advance();
+			token.offset += restart;
+
+			// Token touching the window end may continue beyond it
+			if (!complete && restart + lexer.GetPosition() >= windowEnd)
+			{
+				break;
+			}
+
+			// Lexer has no state between tokens, so once a new token matches the
+			// old one at the same place after the edit, the rest is the same too
+			if (token.offset >= editEnd)
+			{
+				while (old < count && GetOffset(old) < token.offset)
+				{
+					++old;
+				}
+				if (old < count && GetOffset(old) == token.offset && SameToken(GetToken(old), token))
+				{
+					resynchronized = true;
+					break;
+				}
+			}
+
+			const bool endOfFile = token.type == TokenType::EndOfFile;
+			tokens.push_back(std::move(token));
+			if (endOfFile)
+			{
+				old = count;
+				resynchronized = true;
+				break;
+			}
+		}
+		if (!resynchronized)
+		{
+			continue;
+		}
+
+		Damage damage{ first, old, tokens.size() };
+		damage.unchanged = damage.end - damage.begin == damage.count;
+		for (size_t i = 0; damage.unchanged && i < damage.count; ++i)
+		{
+			damage.unchanged = SameToken(tokens[i], GetToken(first + i));
+		}
+		// Unchanged tokens still take their new offsets
+		ReplaceTokens(damage.begin, damage.end, std::move(tokens));
+
+		mStats.relexedTokens = damage.count;
+		return damage;
+	}
+}
+
+bool IncrementalParser::Reparse(const Damage& damage)
+{
+	if (damage.unchanged)
+	{
+		return true;
+	}
+
+	// Collect the chain of statements enclosing the damaged tokens, outermost first
+	std::vector<Level> path;
+	Compound* compound = &mRoot;
+	size_t begin = mRoot.begin;
+	while (compound && damage.begin >= begin + compound->first)
+	{
+		const size_t index = std::min(compound->spans.Find(damage.begin - begin - compound->first),
+			compound->statements.size() - 1);
+		const size_t statementBegin = begin + compound->first + compound->spans.GetPrefix(index);
+		Statement& statement = compound->statements[index];
+		if (statement.length == 0 || statementBegin + statement.length < damage.end)
+		{
+			break;
+		}
+		path.push_back({ compound, index, statementBegin });
+
+		Compound* next = nullptr;
+		for (auto& nested : statement.compounds)
+		{
+			const size_t nestedBegin = statementBegin + nested.begin;
+			if (nestedBegin <= damage.begin && damage.end <= nestedBegin + nested.length)
+			{
+				next = &nested;
+				begin = nestedBegin;
+				break;
+			}
+		}
+		compound = next;
+	}
+
+	for (size_t depth = path.size(); depth-- > 0;)
+	{
+		if (ReparseStatement(path, depth, damage))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool IncrementalParser::ReparseStatement(const std::vector<Level>& path, size_t depth, const Damage& damage)
+{
+	const ptrdiff_t delta = static_cast<ptrdiff_t>(damage.count) - static_cast<ptrdiff_t>(damage.end - damage.begin);
+	const Level& level = path[depth];
+	Statement& statement = level.compound->statements[level.index];
+	const std::vector<Token> tokens = GetTokens(level.begin,
+		static_cast<size_t>(static_cast<ptrdiff_t>(level.begin + statement.length) + delta));
+
+	Parser parser(TokenStream(tokens, 0, tokens.size()));
+	parser.EnableLayoutRecording();
+	ASTNode::Ptr node;
+	try
+	{
+		node = parser.ParseAsStatement();
+	}
+	catch (const std::exception&)
+	{
+		return false;
+	}
+	// Statement must take exactly the same place between its separators
+	if (parser.GetTokenPosition() != tokens.size())
+	{
+		return false;
+	}
+
+	level.compound->node->ReplaceChild(level.index, std::move(node));
+	statement.compounds.clear();
+	for (auto& layout : parser.TakeLayouts())
+	{
+		statement.compounds.push_back(MakeCompound(std::move(layout), 0));
+	}
+	mStats.reparsedTokens = tokens.size();
+
+	// The statement and the enclosing ones grow by the number of inserted
+	// tokens, compounds following the damage within them move
+	for (size_t d = 0; delta != 0 && d <= depth; ++d)
+	{
+		Compound& compound = *path[d].compound;
+		Statement& enclosing = compound.statements[path[d].index];
+		enclosing.length += delta;
+		compound.spans.Add(path[d].index, delta);
+		compound.length += delta;
+		if (d == depth)
+		{
+			continue;
+		}
+		bool following = false;
+		for (auto& nested : enclosing.compounds)
+		{
+			if (following)
+			{
+				nested.begin += delta;
+			}
+			following = following || &nested == path[d + 1].compound;
+		}
+	}
+	return true;
+}
+
+void IncrementalParser::ParseFully()
+{
+	const std::string& text = GetText();
+	std::vector<Token> tokens;
+	Lexer lexer(text);
+	do
+	{
+		tokens.push_back(lexer.Advance());
+	} while (tokens.back().type != TokenType::EndOfFile);
+
+	Parser parser(TokenStream(tokens, 0, tokens.size()));
+	parser.EnableLayoutRecording();
+	mProgram = parser.ParseAsProgram();
+	auto layouts = parser.TakeLayouts();
+	assert(layouts.size() == 1);
+	mRoot = MakeCompound(std::move(layouts.front()), 0);
+
+	mStats.relexedTokens = tokens.size();
+	mStats.reparsedTokens = tokens.size();
+	mStats.fullReparse = true;
+	mPieces = Cut(text, std::move(tokens));
+	UpdateSums();
+}
+
+size_t IncrementalParser::GetTextLength()const
+{
+	return mTextValid ? mText.length() : mPieceLengths.GetTotal();
+}
+
+std::string IncrementalParser::GetText(size_t begin, size_t end)const
+{
+	std::string text;
+	size_t piece = mPieceLengths.Find(begin);
+	size_t offset = begin - mPieceLengths.GetPrefix(piece);
+	while (text.length() < end - begin)
+	{
+		text.append(mPieces[piece].text, offset, end - begin - text.length());
+		++piece;
+		offset = 0;
+	}
+	return text;
+}
+
+size_t IncrementalParser::GetTokenCount()const
+{
+	return mPieceTokens.GetTotal();
+}
+
+const Token& IncrementalParser::GetToken(size_t index)const
+{
+	const size_t piece = mPieceTokens.Find(index);
+	return mPieces[piece].tokens[index - mPieceTokens.GetPrefix(piece)];
+}
+
+size_t IncrementalParser::GetOffset(size_t index)const
+{
+	const size_t piece = mPieceTokens.Find(index);
+	return mPieceLengths.GetPrefix(piece) + mPieces[piece].tokens[index - mPieceTokens.GetPrefix(piece)].offset;
+}
+
+std::vector<Token> IncrementalParser::GetTokens(size_t begin, size_t end)const
+{
+	std::vector<Token> tokens;
+	tokens.reserve(end - begin);
+	size_t piece = mPieceTokens.Find(begin);
+	size_t index = begin - mPieceTokens.GetPrefix(piece);
+	size_t start = mPieceLengths.GetPrefix(piece);
+	while (tokens.size() < end - begin)
+	{
+		if (index == mPieces[piece].tokens.size())
+		{
+			start += mPieces[piece].text.length();
+			++piece;
+			index = 0;
+			continue;
+		}
+		tokens.push_back(mPieces[piece].tokens[index++]);
+		tokens.back().offset += start;
+	}
+	return tokens;
+}
+
+size_t IncrementalParser::FindToken(size_t offset)const
+{
+	const size_t piece = std::min(mPieceLengths.Find(offset), mPieces.size() - 1);
+	const size_t local = offset - mPieceLengths.GetPrefix(piece);
+	const std::vector<Token>& tokens = mPieces[piece].tokens;
+	auto it = std::lower_bound(tokens.begin(), tokens.end(), local,
+		[](const Token& token, size_t value) { return token.offset < value; });
+	return mPieceTokens.GetPrefix(piece) + static_cast<size_t>(it - tokens.begin());
+}
+
+void IncrementalParser::ReplaceText(size_t offset, size_t length, const std::string& replacement)
+{
+	const ptrdiff_t delta = static_cast<ptrdiff_t>(replacement.length()) - static_cast<ptrdiff_t>(length);
+	const size_t first = std::min(mPieceLengths.Find(offset), mPieces.size() - 1);
+	if (length > 0)
+	{
+		MergePieces(first, mPieceLengths.Find(offset + length - 1));
+	}
+
+	Piece& piece = mPieces[first];
+	const size_t local = offset - mPieceLengths.GetPrefix(first);
+	piece.text.replace(local, length, replacement);
+	for (Token& token : piece.tokens)
+	{
+		if (token.offset >= local + length)
+		{
+			token.offset = static_cast<size_t>(static_cast<ptrdiff_t>(token.offset) + delta);
+		}
+	}
+	mPieceLengths.Add(first, delta);
+	mTextValid = false;
+}
+
+void IncrementalParser::ReplaceTokens(size_t begin, size_t end, std::vector<Token>&& tokens)
+{
+	// Pieces of the old tokens and of the text of the new ones
+	const size_t first = mPieceTokens.Find(begin);
+	size_t last = end > begin ? mPieceTokens.Find(end - 1) : first;
+	if (!tokens.empty())
+	{
+		last = std::max(last, std::min(mPieceLengths.Find(tokens.back().offset), mPieces.size() - 1));
+	}
+	MergePieces(first, last);
+
+	Piece& piece = mPieces[first];
+	const size_t start = mPieceLengths.GetPrefix(first);
+	for (Token& token : tokens)
+	{
+		token.offset -= start;
+	}
+	const size_t index = begin - mPieceTokens.GetPrefix(first);
+	if (end - begin == tokens.size())
+	{
+		std::move(tokens.begin(), tokens.end(), piece.tokens.begin() + index);
+		return;
+	}
+	piece.tokens.erase(piece.tokens.begin() + index, piece.tokens.begin() + (index + end - begin));
+	piece.tokens.insert(piece.tokens.begin() + index,
+		std::make_move_iterator(tokens.begin()), std::make_move_iterator(tokens.end()));
+	mPieceTokens.Add(first, static_cast<ptrdiff_t>(tokens.size()) - static_cast<ptrdiff_t>(end - begin));
+	if (piece.tokens.size() > 2 * PIECE_TOKENS)
+	{
+		SplitPiece(first);
+	}
+}
+
+void IncrementalParser::MergePieces(size_t first, size_t last)
+{
+	if (last <= first)
+	{
+		return;
+	}
+	Piece& merged = mPieces[first];
+	for (size_t i = first + 1; i <= last; ++i)
+	{
+		const size_t start = merged.text.length();
+		merged.text += mPieces[i].text;
+		for (Token& token : mPieces[i].tokens)
+		{
+			token.offset += start;
+			merged.tokens.push_back(std::move(token));
+		}
+	}
+	mPieces.erase(mPieces.begin() + first + 1, mPieces.begin() + last + 1);
+	UpdateSums();
+}
+
+void IncrementalParser::SplitPiece(size_t index)
+{
+	std::vector<Piece> pieces = Cut(mPieces[index].text, std::move(mPieces[index].tokens));
+	mPieces[index] = std::move(pieces.front());
+	mPieces.insert(mPieces.begin() + index + 1,
+		std::make_move_iterator(pieces.begin() + 1), std::make_move_iterator(pieces.end()));
+	UpdateSums();
+}
+
+void IncrementalParser::UpdateSums()
+{
+	std::vector<size_t> lengths;
+	std::vector<size_t> counts;
+	lengths.reserve(mPieces.size());
+	counts.reserve(mPieces.size());
+	for (const Piece& piece : mPieces)
+	{
+		lengths.push_back(piece.text.length());
+		counts.push_back(piece.tokens.size());
+	}
+	mPieceLengths = PrefixSums(lengths);
+	mPieceTokens = PrefixSums(counts);
+}
+
+std::vector<IncrementalParser::Piece> IncrementalParser::Cut(const std::string& text, std::vector<Token>&& tokens)
+{
+	std::vector<Piece> pieces;
+	for (size_t first = 0; first < tokens.size(); first += PIECE_TOKENS)
+	{
+		const size_t last = std::min(first + PIECE_TOKENS, tokens.size());
+		const size_t begin = first == 0 ? 0 : tokens[first].offset;
+		const size_t end = last == tokens.size() ? text.length() : tokens[last].offset;
+		Piece& piece = pieces.emplace_back();
+		piece.text = text.substr(begin, end - begin);
+		piece.tokens.reserve(last - first);
+		for (size_t i = first; i < last; ++i)
+		{
+			piece.tokens.push_back(std::move(tokens[i]));
+			piece.tokens.back().offset -= begin;
+		}
+	}
+	return pieces;
+}
+
+IncrementalParser::Compound IncrementalParser::MakeCompound(CompoundLayout&& layout, size_t base)
+{
+	// Positions recorded by the parser are those of its token stream
+	Compound compound;
+	compound.node = layout.node;
+	compound.begin = layout.range.begin - base;
+	compound.length = layout.range.end - layout.range.begin;
+	compound.first = layout.statements.front().range.begin - layout.range.begin;
+	std::vector<size_t> spans;
+	spans.reserve(layout.statements.size());
+	for (size_t i = 0; i < layout.statements.size(); ++i)
+	{
+		CompoundLayout::Statement& recorded = layout.statements[i];
+		Statement& statement = compound.statements.emplace_back();
+		statement.length = recorded.range.end - recorded.range.begin;
+		for (auto& nested : recorded.compounds)
+		{
+			statement.compounds.push_back(MakeCompound(std::move(nested), recorded.range.begin));
+		}
+		const size_t next = i + 1 < layout.statements.size() ? layout.statements[i + 1].range.begin : layout.range.end;
+		spans.push_back(next - recorded.range.begin);
+	}
+	compound.spans = PrefixSums(spans);
+	return compound;
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include "Parser.h"
+
+// Keeps tokens and AST of an edited text in sync without reparsing it all.
+// An edit is re-lexed starting from the token preceding it until the new
+// tokens line up with the old ones again; then only the innermost statement
+// enclosing the changed tokens is reparsed and spliced into the tree, all
+// other nodes are reused. Falls back to a full parse when the change does
+// not fit into a single statement (declarations, separators, etc).
+// Text and tokens are split into pieces, token offsets are relative to their
+// piece and statement positions to their compound, so an edit costs time
+// proportional to the reparsed statement and the nesting depth, times the
+// logarithm of the program size. Nothing after the edit is moved.
+class IncrementalParser
+{
+public:
+	struct Stats
+	{
+		size_t relexedTokens = 0;
+		size_t reparsedTokens = 0;
+		bool fullReparse = false;
+	};
+
+	explicit IncrementalParser(const std::string& text);
+
+	// Replaces 'length' characters at 'offset' with 'replacement'
+	void Edit(size_t offset, size_t length, const std::string& replacement);
+
+	// Joins the pieces on the first call after an edit
+	const std::string& GetText()const;
+	const ProgramNode& GetProgram()const;
+	const Stats& GetLastEditStats()const;
+
+private:
+	// Fenwick tree: prefix sums of values that change one at a time
+	class PrefixSums
+	{
+	public:
+		PrefixSums() = default;
+		explicit PrefixSums(const std::vector<size_t>& values);
+
+		// Sum of the values before 'index'
+		size_t GetPrefix(size_t index)const;
+		size_t GetTotal()const;
+		void Add(size_t index, ptrdiff_t delta);
+		// Index of the value covering 'position' of the sums, the count if none does
+		size_t Find(size_t position)const;
+
+	private:
+		std::vector<size_t> mTree;
+		size_t mTotal = 0;
+	};
+
+	// Characters and tokens of the text, offsets of the tokens are relative
+	// to the piece. Pieces are cut before tokens
+	struct Piece
+	{
+		std::string text;
+		std::vector<Token> tokens;
+	};
+
+	struct Statement;
+
+	// Token positions of a compound: its BEGIN is relative to the enclosing
+	// statement (to the text for the program), statements to the BEGIN
+	struct Compound
+	{
+		CompoundNode* node = nullptr;
+		size_t begin = 0;
+		size_t length = 0; // up to and including END
+		size_t first = 0; // position of the first statement
+		std::vector<Statement> statements;
+		// Tokens from each statement to the next one, or to END for the last
+		PrefixSums spans;
+	};
+
+	struct Statement
+	{
+		size_t length = 0;
+		std::vector<Compound> compounds; // compounds nested into the statement
+	};
+
+	// Old tokens [begin, end) have been replaced with 'count' new tokens
+	struct Damage
+	{
+		size_t begin = 0;
+		size_t end = 0;
+		size_t count = 0;
+		bool unchanged = false;
+	};
+
+	// A statement enclosing the damage, 'begin' is its absolute position
+	struct Level
+	{
+		Compound* compound;
+		size_t index;
+		size_t begin;
+	};
+
+	Damage Relex(size_t offset, size_t length, const std::string& replacement);
+	bool Reparse(const Damage& damage);
+	bool ReparseStatement(const std::vector<Level>& path, size_t depth, const Damage& damage);
+	void ParseFully();
+
+	size_t GetTextLength()const;
+	std::string GetText(size_t begin, size_t end)const;
+	size_t GetTokenCount()const;
+	const Token& GetToken(size_t index)const;
+	size_t GetOffset(size_t index)const;
+	// Tokens [begin, end) with offsets in the text
+	std::vector<Token> GetTokens(size_t begin, size_t end)const;
+	// First token beginning at or after 'offset'
+	size_t FindToken(size_t offset)const;
+	// Tokens beginning after the replaced text move with it, others are kept
+	void ReplaceText(size_t offset, size_t length, const std::string& replacement);
+	void ReplaceTokens(size_t begin, size_t end, std::vector<Token>&& tokens);
+	// Joins pieces [first, last] into the first one
+	void MergePieces(size_t first, size_t last);
+	void SplitPiece(size_t index);
+	void UpdateSums();
+
+	static std::vector<Piece> Cut(const std::string& text, std::vector<Token>&& tokens);
+	static Compound MakeCompound(CompoundLayout&& layout, size_t base);
+
+private:
+	std::vector<Piece> mPieces;
+	PrefixSums mPieceLengths;
+	PrefixSums mPieceTokens;
+	// Whole text, joined on demand while the pieces are edited
+	mutable std::string mText;
+	mutable bool mTextValid = true;
+	std::unique_ptr<ProgramNode> mProgram;
+	Compound mRoot;
+	Stats mStats;
+};
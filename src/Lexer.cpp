@@ -1,20 +1,47 @@
 #include "Lexer.h"
 #include <cctype>
 #include <cassert>
-#include <unordered_map>
-#include <boost/algorithm/string.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace
 {
-const std::unordered_map<std::string, TokenType> RESERVED_KEYWORDS = {
+// Few enough to search in order, and looked up with no lowercase copy
+constexpr std::pair<std::string_view, TokenType> RESERVED_KEYWORDS[] = {
 	{ "begin", TokenType::Begin },
 	{ "end", TokenType::End },
 	{ "div", TokenType::IntegerDiv },
 	{ "program", TokenType::Program },
 	{ "var", TokenType::Var },
 	{ "integer", TokenType::Integer },
-	{ "real", TokenType::Real }
+	{ "real", TokenType::Real },
+	{ "decimal", TokenType::Decimal },
+	{ "bigint", TokenType::BigInt },
+	{ "for", TokenType::For },
+	{ "to", TokenType::To },
+	{ "downto", TokenType::DownTo },
+	{ "do", TokenType::Do },
+	{ "random", TokenType::Random },
+	{ "randomnormal", TokenType::RandomNormal }
 };
+
+// Whether 'chars' spells the lowercase 'keyword' in any case
+bool IsKeyword(std::string_view keyword, std::string_view chars)
+{
+	if (keyword.size() != chars.size())
+	{
+		return false;
+	}
+	for (size_t i = 0; i < chars.size(); ++i)
+	{
+		if (std::tolower(static_cast<unsigned char>(chars[i])) != keyword[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
 }
 
 Lexer::Lexer(const std::string & text)
@@ -30,6 +57,17 @@ void Lexer::SetText(const std::string & text)
 }
 
 Token Lexer::Advance()
+{
+	const TokenView view = AdvanceView();
+	Token token{ view.type, std::nullopt, view.offset };
+	if (!view.lexeme.empty())
+	{
+		token.value.emplace(view.lexeme);
+	}
+	return token;
+}
+
+TokenView Lexer::AdvanceView()
 {
 	while (mPos < mText.length())
 	{
@@ -43,6 +81,24 @@ Token Lexer::Advance()
 			SkipComment();
 			continue;
 		}
+		break;
+	}
+
+	const size_t offset = mPos;
+	TokenView token = ReadToken();
+	token.offset = offset;
+	return token;
+}
+
+size_t Lexer::GetPosition()const
+{
+	return mPos;
+}
+
+TokenView Lexer::ReadToken()
+{
+	if (mPos < mText.length())
+	{
 		if (std::isdigit(mText[mPos]))
 		{
 			return ReadAsNumberConstant();
@@ -108,52 +164,54 @@ Token Lexer::Advance()
 		}
 		throw std::invalid_argument("can't parse character at pos " + std::to_string(mPos) + ": '" + mText[mPos] + "'");
 	}
-	return Token{ TokenType::EndOfFile };
+	return { TokenType::EndOfFile };
 }
 
-Token Lexer::ReadAsNumberConstant()
+TokenView Lexer::ReadAsNumberConstant()
 {
 	assert(mPos < mText.length());
 	assert(std::isdigit(mText[mPos]));
 
-	std::string chars;
+	const size_t begin = mPos;
 	while (mPos < mText.length() && std::isdigit(mText[mPos]))
 	{
-		chars += mText[mPos++];
+		++mPos;
 	}
 
 	if (mPos < mText.length() && mText[mPos] == '.')
 	{
-		chars += mText[mPos++];
-
+		++mPos;
 		while (mPos < mText.length() && std::isdigit(mText[mPos]))
 		{
-			chars += mText[mPos++];
+			++mPos;
 		}
 
-		return { TokenType::RealConstant, std::move(chars) };
+		return { TokenType::RealConstant, std::string_view(mText).substr(begin, mPos - begin) };
 	}
 
-	return { TokenType::IntegerConstant, std::move(chars) };
+	return { TokenType::IntegerConstant, std::string_view(mText).substr(begin, mPos - begin) };
 }
 
-Token Lexer::ReadAsKeywordOrIdentifier()
+TokenView Lexer::ReadAsKeywordOrIdentifier()
 {
 	assert(mPos < mText.length());
 	assert(std::isalpha(mText[mPos]) || mText[mPos] == '_');
 
-	std::string chars;
+	const size_t begin = mPos;
 	while (mPos < mText.length() && (std::isalnum(mText[mPos]) || mText[mPos] == '_'))
 	{
-		chars += mText[mPos++];
+		++mPos;
 	}
 
-	auto it = RESERVED_KEYWORDS.find(boost::algorithm::to_lower_copy(chars));
-	if (it != RESERVED_KEYWORDS.end())
+	const std::string_view chars = std::string_view(mText).substr(begin, mPos - begin);
+	for (const auto& [keyword, type] : RESERVED_KEYWORDS)
 	{
-		return { it->second };
+		if (IsKeyword(keyword, chars))
+		{
+			return { type };
+		}
 	}
-	return { TokenType::Identifier, std::move(chars) };
+	return { TokenType::Identifier, chars };
 }
 
 void Lexer::SkipComment()
@@ -176,9 +234,3 @@ void Lexer::SkipWhitespaces()
 		++mPos;
 	}
 }
-
-bool Lexer::Lookahead(char ch)const
-{
-	const size_t lookahead = mPos + 1;
-	return lookahead < mText.length() && mText[lookahead] == ch;
-}
@@ -1,5 +1,15 @@
 #pragma once
 #include "Token.h"
+#include <string_view>
+
+// Token whose lexeme points into the text of the lexer, valid until the
+// text changes
+struct TokenView
+{
+	TokenType type;
+	std::string_view lexeme = {}; // identifiers and constants only
+	size_t offset = 0;
+};
 
 class Lexer
 {
@@ -9,14 +19,17 @@ public:
 
 	void SetText(const std::string& text);
 	Token Advance();
+	// Advance without copying the lexeme, for bulk consumers like TokenDumper
+	TokenView AdvanceView();
+	size_t GetPosition()const;
 
 private:
-	Token ReadAsNumberConstant();
-	Token ReadAsKeywordOrIdentifier();
+	TokenView ReadToken();
+	TokenView ReadAsNumberConstant();
+	TokenView ReadAsKeywordOrIdentifier();
 
 	void SkipComment();
 	void SkipWhitespaces();
-	bool Lookahead(char ch)const;
 
 private:
 	std::string mText;
@@ -0,0 +1,348 @@
+#include "LoopOptimizer.h"
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+// Collects targets of assignments and loop variables, expressions can't assign
+class AssignedVariablesCollector : public IASTNodeVisitor
+{
+public:
+	explicit AssignedVariablesCollector(std::unordered_set<std::string>& variables)
+		: m_variables(variables)
+	{
+	}
+
+	void Visit(const BinOpNode& binop) override
+	{
+		(void)binop;
+	}
+
+	void Visit(const LeafNumNode& num) override
+	{
+		(void)num;
+	}
+
+	void Visit(const UnOpNode& unop) override
+	{
+		(void)unop;
+	}
+
+	void Visit(const LeafVarNode& var) override
+	{
+		(void)var;
+	}
+
+	void Visit(const LeafInvariantNode& invariant) override
+	{
+		(void)invariant;
+	}
+
+	void Visit(const InductionNode& induction) override
+	{
+		(void)induction;
+	}
+
+	void Visit(const RandomNode& random) override
+	{
+		(void)random;
+	}
+
+	void Visit(const LeafNopNode& nop) override
+	{
+		(void)nop;
+	}
+
+	void Visit(const AssignNode& assign) override
+	{
+		m_variables.insert(boost::algorithm::to_lower_copy(assign.GetLeft()));
+	}
+
+	void Visit(const CompoundNode& compound) override
+	{
+		for (const auto& child : compound.GetChildren())
+		{
+			child->Accept(*this);
+		}
+	}
+
+	void Visit(const ForNode& loop) override
+	{
+		m_variables.insert(boost::algorithm::to_lower_copy(loop.GetVariable()));
+		loop.GetBody().Accept(*this);
+	}
+
+	void Visit(const TypeNode& type) override
+	{
+		(void)type;
+	}
+
+	void Visit(const VarDeclNode& vardecl) override
+	{
+		(void)vardecl;
+	}
+
+	void Visit(const BlockNode& block) override
+	{
+		(void)block;
+	}
+
+	void Visit(const ProgramNode& program) override
+	{
+		(void)program;
+	}
+
+private:
+	std::unordered_set<std::string>& m_variables;
+};
+
+// k of a constant divisor 2^k, 0 for other divisors
+uint8_t GetShift(const ASTNode& divisor)
+{
+	const auto* num = dynamic_cast<const LeafNumNode*>(&divisor);
+	if (!num)
+	{
+		return 0;
+	}
+	int exponent = 0;
+	const double mantissa = std::frexp(num->GetValue(), &exponent);
+	// 2^k is 0.5 * 2^(k + 1), BigInt shifts inline values by up to 62 bits
+	return mantissa == 0.5 && exponent >= 2 && exponent <= 63 ? static_cast<uint8_t>(exponent - 1) : 0;
+}
+}
+
+void LoopOptimizer::Run(ProgramNode& program)
+{
+	program.Accept(*this);
+}
+
+const LoopOptimizer::Stats& LoopOptimizer::GetStats()const
+{
+	return m_stats;
+}
+
+void LoopOptimizer::PrintStats(std::ostream& out)const
+{
+	out << "loops: " << m_stats.loops << std::endl;
+	out << "invariant expressions hoisted: " << m_stats.hoisted << std::endl;
+	out << "multiplications strength-reduced: " << m_stats.reduced << std::endl;
+	out << "divisions by a power of two: " << m_stats.shifts << std::endl;
+	out << "operations per loop iteration: " << m_stats.operationsBefore
+		<< " before, " << m_stats.operationsAfter << " after" << std::endl;
+}
+
+std::unordered_set<std::string> LoopOptimizer::GetAssignedVariables(const ASTNode& statement)
+{
+	std::unordered_set<std::string> variables;
+	AssignedVariablesCollector collector(variables);
+	statement.Accept(collector);
+	return variables;
+}
+
+void LoopOptimizer::Visit(const BinOpNode& binop)
+{
+	// The tree has been passed to Run as mutable, visitors just see it const
+	m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+		[this](const BinOpNode& node) { Combine(const_cast<BinOpNode&>(node)); });
+}
+
+void LoopOptimizer::Combine(BinOpNode& binop)
+{
+	// The left operand is in place yet, rewritten here like the right one
+	const Expression left = m_acc;
+	const Expression right = Analyze(binop.GetRight());
+	if (binop.GetOperator() == BinOpNode::IntegerDiv)
+	{
+		binop.SetShift(GetShift(binop.GetRight()));
+		m_stats.shifts += binop.GetShift() != 0 ? 1 : 0;
+	}
+	if (m_loop)
+	{
+		++m_stats.operationsBefore;
+		++m_stats.operationsAfter;
+	}
+
+	m_acc = Expression{ Expression::Variant, left.operations + right.operations + 1 };
+	if (left.kind == Expression::Invariant && right.kind == Expression::Invariant)
+	{
+		m_acc.kind = Expression::Invariant;
+		return;
+	}
+	if (m_loop && binop.GetOperator() == BinOpNode::Mul && !m_loop->variableAssigned)
+	{
+		auto isVariable = [this](const ASTNode& operand) {
+			const auto* var = dynamic_cast<const LeafVarNode*>(&operand);
+			return var && boost::algorithm::to_lower_copy(var->GetName()) == m_loop->variable;
+		};
+		if (isVariable(binop.GetLeft()) && right.kind == Expression::Invariant)
+		{
+			m_acc.kind = Expression::Induction;
+			m_acc.stride = &binop.GetRight();
+			return;
+		}
+		if (isVariable(binop.GetRight()) && left.kind == Expression::Invariant)
+		{
+			m_acc.kind = Expression::Induction;
+			m_acc.stride = &binop.GetLeft();
+			return;
+		}
+	}
+	Rewrite(left, [&binop](ASTNode::Ptr&& operand) { return binop.ReplaceLeft(std::move(operand)); });
+	Rewrite(right, [&binop](ASTNode::Ptr&& operand) { return binop.ReplaceRight(std::move(operand)); });
+}
+
+void LoopOptimizer::Visit(const LeafNumNode& num)
+{
+	(void)num;
+	m_acc = Expression{ Expression::Invariant };
+}
+
+void LoopOptimizer::Visit(const UnOpNode& node)
+{
+	UnOpNode& unop = const_cast<UnOpNode&>(node);
+	const Expression expression = Analyze(unop.GetExpression());
+	if (expression.kind == Expression::Invariant)
+	{
+		m_acc = expression;
+		return;
+	}
+	Rewrite(expression, [&unop](ASTNode::Ptr&& operand) { return unop.ReplaceExpression(std::move(operand)); });
+	m_acc = Expression{ Expression::Variant, expression.operations };
+}
+
+void LoopOptimizer::Visit(const LeafVarNode& var)
+{
+	const bool invariant = m_loop && m_loop->assigned.count(boost::algorithm::to_lower_copy(var.GetName())) == 0;
+	m_acc = Expression{ invariant ? Expression::Invariant : Expression::Variant };
+}
+
+void LoopOptimizer::Visit(const LeafInvariantNode& invariant)
+{
+	// Computed by an inner loop, which may not have run yet
+	(void)invariant;
+	m_acc = Expression{ Expression::Variant };
+}
+
+void LoopOptimizer::Visit(const InductionNode& induction)
+{
+	(void)induction;
+	m_acc = Expression{ Expression::Variant };
+}
+
+void LoopOptimizer::Visit(const RandomNode& random)
+{
+	// A new draw every iteration
+	(void)random;
+	m_acc = Expression{ Expression::Variant };
+}
+
+void LoopOptimizer::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void LoopOptimizer::Visit(const AssignNode& node)
+{
+	AssignNode& assign = const_cast<AssignNode&>(node);
+	m_rewrite = m_exact.count(boost::algorithm::to_lower_copy(assign.GetLeft())) == 0;
+	const Expression expression = Analyze(assign.GetRight());
+	Rewrite(expression, [&assign](ASTNode::Ptr&& right) { return assign.ReplaceRight(std::move(right)); });
+	m_rewrite = true;
+}
+
+void LoopOptimizer::Visit(const CompoundNode& compound)
+{
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void LoopOptimizer::Visit(const ForNode& node)
+{
+	ForNode& loop = const_cast<ForNode&>(node);
+	++m_stats.loops;
+	// Bounds are evaluated by the double engine once per run of the loop
+	const Expression start = Analyze(loop.GetStart());
+	Rewrite(start, [&loop](ASTNode::Ptr&& bound) { return loop.ReplaceStart(std::move(bound)); });
+	const Expression end = Analyze(loop.GetEnd());
+	Rewrite(end, [&loop](ASTNode::Ptr&& bound) { return loop.ReplaceEnd(std::move(bound)); });
+
+	Loop inner;
+	inner.node = &loop;
+	inner.variable = boost::algorithm::to_lower_copy(loop.GetVariable());
+	inner.assigned = GetAssignedVariables(loop.GetBody());
+	inner.variableAssigned = inner.assigned.count(inner.variable) != 0;
+	inner.assigned.insert(inner.variable);
+
+	Loop* outer = m_loop;
+	m_loop = &inner;
+	loop.GetBody().Accept(*this);
+	m_loop = outer;
+}
+
+void LoopOptimizer::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void LoopOptimizer::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode::Type type = vardecl.GetTypeNode().GetType();
+	if (type != TypeNode::Decimal && type != TypeNode::BigInt)
+	{
+		return;
+	}
+	for (const auto& var : vardecl.GetVariables())
+	{
+		m_exact.insert(boost::algorithm::to_lower_copy(var->GetName()));
+	}
+}
+
+void LoopOptimizer::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	Visit(block.GetCompound());
+}
+
+void LoopOptimizer::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+LoopOptimizer::Expression LoopOptimizer::Analyze(const ASTNode& expression)
+{
+	expression.Accept(*this);
+	return m_acc;
+}
+
+template <typename Replace>
+void LoopOptimizer::Rewrite(const Expression& expression, Replace&& replace)
+{
+	if (!m_loop || !m_rewrite)
+	{
+		return;
+	}
+	if (expression.kind == Expression::Invariant && expression.operations > 0)
+	{
+		const uint32_t slot = m_slots++;
+		ASTNode::Ptr hoisted = replace(nullptr);
+		replace(std::make_unique<LeafInvariantNode>(slot, *hoisted));
+		m_loop->node->AddInvariant(slot, std::move(hoisted));
+		++m_stats.hoisted;
+		m_stats.operationsAfter -= expression.operations;
+	}
+	else if (expression.kind == Expression::Induction)
+	{
+		// The product is replaced with an addition of the stride
+		const uint32_t slot = m_slots++;
+		ASTNode::Ptr product = replace(nullptr);
+		m_loop->node->AddInduction(slot, *expression.stride);
+		replace(std::make_unique<InductionNode>(slot, std::move(product)));
+		++m_stats.reduced;
+		m_stats.operationsAfter -= expression.operations - 1;
+	}
+}
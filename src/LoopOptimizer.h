@@ -0,0 +1,95 @@
+#pragma once
+#include "AST.h"
+#include <iosfwd>
+#include <unordered_set>
+
+// Rewrites the tree for cheaper evaluation of FOR loops:
+//  - binary operations whose variables the body does not assign are hoisted
+//    into the loop, which computes them once before the first iteration;
+//  - products of the loop variable and an invariant stride become an
+//    InductionNode, which the loop advances by the stride every iteration;
+//  - DIV by a constant power of two is marked with its shift, engines then
+//    multiply by the reciprocal or shift instead of dividing.
+// Only expressions evaluated by the double engine are rewritten: DECIMAL and
+// BIGINT assignments keep theirs, since hoisted values are stored as doubles.
+// Run it before RangeAnalysis, which has to see the rewritten tree.
+class LoopOptimizer : public IASTNodeVisitor
+{
+public:
+	struct Stats
+	{
+		size_t loops = 0;
+		size_t hoisted = 0;
+		size_t reduced = 0;
+		size_t shifts = 0;
+		// Binary operations in loop bodies, attributed to the innermost loop
+		size_t operationsBefore = 0;
+		size_t operationsAfter = 0;
+	};
+
+	void Run(ProgramNode& program);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+	// Lowercase names of variables assigned by the statement, loop variables included
+	static std::unordered_set<std::string> GetAssignedVariables(const ASTNode& statement);
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	struct Loop
+	{
+		ForNode* node = nullptr;
+		std::string variable;
+		// Variables changing between iterations, the loop variable included
+		std::unordered_set<std::string> assigned;
+		bool variableAssigned = false; // by the body
+	};
+
+	// What the innermost loop can do with the last visited expression
+	struct Expression
+	{
+		enum Kind
+		{
+			Variant,
+			Invariant,
+			Induction
+		};
+
+		Kind kind = Variant;
+		size_t operations = 0; // binary operations in the subtree
+		const ASTNode* stride = nullptr; // operand of an Induction product
+	};
+
+	Expression Analyze(const ASTNode& expression);
+	// Analyzes the operator and rewrites its operands, m_acc holds the left one
+	void Combine(BinOpNode& binop);
+	// Hoists an invariant computation or reduces an induction product, 'replace'
+	// swaps the expression in its parent and returns the previous one
+	template <typename Replace>
+	void Rewrite(const Expression& expression, Replace&& replace);
+
+private:
+	Expression m_acc;
+	Loop* m_loop = nullptr;
+	// Expressions of DECIMAL and BIGINT assignments are left as they are
+	bool m_rewrite = true;
+	std::unordered_set<std::string> m_exact;
+	uint32_t m_slots = 0;
+	Stats m_stats;
+	ChainWalker m_chain;
+};
@@ -0,0 +1,70 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#ifdef _WIN32
+#define MAPPED_FILE_NO_MMAP
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& path)
+{
+#ifndef MAPPED_FILE_NO_MMAP
+	const int file = open(path.c_str(), O_RDONLY);
+	if (file < 0)
+	{
+		throw std::runtime_error("can't open file '" + path + "'");
+	}
+	struct stat status;
+	if (fstat(file, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+	{
+		void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		if (data != MAP_FAILED)
+		{
+			// Readers go through the file front to back
+			madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+			m_data = static_cast<const char*>(data);
+			m_size = static_cast<size_t>(status.st_size);
+		}
+	}
+	close(file);
+	if (m_data)
+	{
+		return;
+	}
+#endif
+	std::ifstream input(path, std::ios::binary);
+	if (!input)
+	{
+		throw std::runtime_error("can't open file '" + path + "'");
+	}
+	std::ostringstream text;
+	text << input.rdbuf();
+	m_copy = text.str();
+	m_data = m_copy.data();
+	m_size = m_copy.size();
+}
+
+MappedFile::~MappedFile()
+{
+#ifndef MAPPED_FILE_NO_MMAP
+	if (m_data && m_data != m_copy.data())
+	{
+		munmap(const_cast<char*>(m_data), m_size);
+	}
+#endif
+}
+
+const char* MappedFile::GetData()const
+{
+	return m_data;
+}
+
+size_t MappedFile::GetSize()const
+{
+	return m_size;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+
+// Read-only view of a whole file: memory mapped where the platform allows
+// it, else, and for pipes and other files that can't be mapped, read into
+// memory. The bytes stay valid as long as the object
+class MappedFile
+{
+public:
+	explicit MappedFile(const std::string& path);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* GetData()const;
+	size_t GetSize()const;
+
+private:
+	const char* m_data = nullptr;
+	size_t m_size = 0;
+	// Owns the bytes where the file isn't mapped
+	std::string m_copy;
+};
@@ -0,0 +1,251 @@
+#include "MonteCarlo.h"
+#include "Peephole.h"
+#include "VirtualMachine.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+// Runs paths in the engine of the program, reusing its memory from path to path
+class MonteCarlo::Worker
+{
+public:
+	Worker(const MonteCarlo& runner, const std::vector<std::string>& outputs)
+		: m_runner(runner)
+		, m_outputs(outputs)
+	{
+		if (!runner.m_code)
+		{
+			return;
+		}
+		const BytecodeProgram& code = *runner.m_code;
+		m_machine = std::make_unique<VirtualMachine>(code);
+		for (const auto& [name, value] : runner.m_inputs)
+		{
+			const uint32_t index = code.FindVariable(name);
+			if (index != BytecodeProgram::NO_VARIABLE)
+			{
+				m_inputs.emplace_back(index, value);
+			}
+		}
+		for (const std::string& output : outputs)
+		{
+			m_outputIndices.push_back(code.FindVariable(output));
+		}
+	}
+
+	// Statistics of the paths in [begin, end)
+	void Run(uint64_t begin, uint64_t end, std::vector<RunningStatistics>& statistics)
+	{
+		const bool checks = m_runner.m_options.floatingPointChecks && m_machine;
+		if (checks)
+		{
+			std::feclearexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+		}
+		for (uint64_t path = begin; path < end; ++path)
+		{
+			Run(path, statistics);
+		}
+		if (!checks || !std::fetestexcept(ExpressionCalculator::FLOATING_POINT_ERRORS))
+		{
+			return;
+		}
+		// Throws for the first path raising an exception in a statement
+		for (uint64_t path = begin; path < end; ++path)
+		{
+			RunTreeWalker(path, nullptr);
+		}
+	}
+
+private:
+	void Run(uint64_t path, std::vector<RunningStatistics>& statistics)
+	{
+		if (m_machine)
+		{
+			const RandomStream random(m_runner.m_options.seed, path);
+			m_machine->Reset();
+			for (const auto& [index, value] : m_inputs)
+			{
+				m_machine->SetVariable(index, value);
+			}
+			m_machine->SetRandomStream(random);
+			m_machine->Run();
+			for (size_t i = 0; i < m_outputIndices.size(); ++i)
+			{
+				if (m_outputIndices[i] == BytecodeProgram::NO_VARIABLE)
+				{
+					continue;
+				}
+				if (const std::optional<double> value = m_machine->GetVariable(m_outputIndices[i]))
+				{
+					statistics[i].Add(*value);
+				}
+			}
+			return;
+		}
+		RunTreeWalker(path, &statistics);
+	}
+
+	// With the floating-point checks, 'statistics' may be null. Errors name the path
+	void RunTreeWalker(uint64_t path, std::vector<RunningStatistics>* statistics)
+	{
+		ExpressionCalculator calculator;
+		for (const auto& [name, value] : m_runner.m_inputs)
+		{
+			calculator.SetVariable(name, value);
+		}
+		calculator.SetRandomStream(RandomStream(m_runner.m_options.seed, path));
+		calculator.SetFloatingPointChecks(m_runner.m_options.floatingPointChecks);
+		try
+		{
+			calculator.Calculate(m_runner.m_program);
+		}
+		catch (const std::exception& ex)
+		{
+			throw std::runtime_error("path " + std::to_string(path) + ": " + ex.what());
+		}
+		if (!statistics)
+		{
+			return;
+		}
+		for (const auto& [name, value] : calculator.GetScope())
+		{
+			for (size_t i = 0; i < m_outputs.size(); ++i)
+			{
+				if (boost::algorithm::iequals(name, m_outputs[i]))
+				{
+					(*statistics)[i].Add(value);
+				}
+			}
+		}
+	}
+
+	const MonteCarlo& m_runner;
+	const std::vector<std::string>& m_outputs;
+	std::unique_ptr<VirtualMachine> m_machine;
+	std::vector<std::pair<uint32_t, double>> m_inputs;
+	std::vector<uint32_t> m_outputIndices;
+};
+
+MonteCarlo::MonteCarlo(const ProgramNode& program, Options options)
+	: m_program(program)
+	, m_options(options)
+{
+	try
+	{
+		m_code = std::make_unique<BytecodeProgram>(BytecodeCompiler().Compile(program));
+		PeepholeOptimizer(m_options.contract).Optimize(*m_code);
+		m_code->Assemble();
+	}
+	catch (const std::runtime_error&)
+	{
+		m_code.reset();
+	}
+}
+
+void MonteCarlo::SetVariable(const std::string& name, double value)
+{
+	m_inputs[name] = value;
+}
+
+std::vector<RunningStatistics> MonteCarlo::Run(uint64_t paths, const std::vector<std::string>& outputs)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const uint64_t chunks = (paths + CHUNK - 1) / CHUNK;
+	unsigned threads = m_options.threads ? m_options.threads : std::max(1u, std::thread::hardware_concurrency());
+	threads = static_cast<unsigned>(std::min<uint64_t>(threads, std::max<uint64_t>(chunks, 1)));
+
+	std::atomic<uint64_t> nextChunk{ 0 };
+	std::atomic<bool> failed{ false };
+	// Guards the members below, chunks finished ahead of the merge wait in
+	// 'pending'. A worker more than AHEAD chunks per thread ahead of the merge
+	// waits on 'mergedChanged', so a stalled one can't let 'pending' grow
+	std::mutex mutex;
+	std::condition_variable mergedChanged;
+	std::map<uint64_t, std::vector<RunningStatistics>> pending;
+	uint64_t merged = 0;
+	std::vector<RunningStatistics> total(outputs.size());
+	std::exception_ptr error;
+
+	auto work = [&]() {
+		try
+		{
+			Worker worker(*this, outputs);
+			for (uint64_t chunk = nextChunk++; chunk < chunks && !failed; chunk = nextChunk++)
+			{
+				{
+					// Chunks are taken in order, the one merged next is never waiting
+					std::unique_lock<std::mutex> lock(mutex);
+					mergedChanged.wait(lock, [&]() { return chunk < merged + AHEAD * threads || failed; });
+					if (failed)
+					{
+						break;
+					}
+				}
+				std::vector<RunningStatistics> statistics(outputs.size());
+				worker.Run(chunk * CHUNK, std::min(paths, (chunk + 1) * CHUNK), statistics);
+
+				std::lock_guard<std::mutex> lock(mutex);
+				pending.emplace(chunk, std::move(statistics));
+				const uint64_t before = merged;
+				for (auto next = pending.begin(); next != pending.end() && next->first == merged; next = pending.erase(next))
+				{
+					for (size_t i = 0; i < total.size(); ++i)
+					{
+						total[i].Merge(next->second[i]);
+					}
+					++merged;
+				}
+				if (merged != before)
+				{
+					mergedChanged.notify_all();
+				}
+			}
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!error)
+			{
+				error = std::current_exception();
+			}
+			failed = true;
+			mergedChanged.notify_all();
+		}
+	};
+	std::vector<std::thread> workers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		workers.emplace_back(work);
+	}
+	work();
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+
+	m_stats.paths += paths;
+	m_stats.threads = threads;
+	m_stats.bytecode = m_code != nullptr;
+	m_stats.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return total;
+}
+
+const MonteCarlo::Stats& MonteCarlo::GetStats()const
+{
+	return m_stats;
+}
+
+void MonteCarlo::PrintStats(std::ostream& out)const
+{
+	out << "paths: " << m_stats.paths << " on " << m_stats.threads << " threads, "
+		<< (m_stats.bytecode ? "bytecode" : "tree walker") << std::endl;
+	out << "elapsed: " << m_stats.seconds << " s, "
+		<< (m_stats.seconds > 0 ? static_cast<double>(m_stats.paths) / m_stats.seconds : 0) << " paths/s" << std::endl;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Bytecode.h"
+#include "Statistics.h"
+#include <iosfwd>
+
+// Runs one program many times across threads, as paths of a Monte Carlo
+// simulation: path n draws RANDOM from stream n of the seed, and only the
+// statistics of the chosen outputs are kept, never the values of the paths.
+// The program is compiled to bytecode once and every thread has its own
+// VirtualMachine; programs the bytecode can't express (DECIMAL, BIGINT) run
+// in the tree walker. Paths are taken in chunks, the statistics of each
+// chunk are merged in chunk order, so results do not depend on the number
+// of threads. A thread waits rather than run more than AHEAD chunks per
+// thread ahead of the merge, so memory holds at most that many chunks of
+// statistics per thread.
+class MonteCarlo
+{
+public:
+	struct Options
+	{
+		uint64_t seed = 0;
+		// 0 for one per hardware thread
+		unsigned threads = 0;
+		// See ExpressionCalculator::SetFloatingPointChecks. Bytecode tests
+		// the flags once per chunk, the paths of a chunk raising one are run
+		// again in the tree walker to report the path and the statement
+		bool floatingPointChecks = false;
+		// Fuses multiply-add in the bytecode, see PeepholeOptimizer
+		bool contract = false;
+	};
+
+	struct Stats
+	{
+		uint64_t paths = 0;
+		unsigned threads = 0;
+		bool bytecode = false;
+		double seconds = 0;
+	};
+
+	// The program is only read and has to outlive the runner
+	MonteCarlo(const ProgramNode& program, Options options);
+
+	// Sets a variable before every path, as an input fixed for the simulation
+	void SetVariable(const std::string& name, double value);
+	// Statistics of the outputs in their order, a variable a path leaves
+	// unassigned is not counted for it
+	std::vector<RunningStatistics> Run(uint64_t paths, const std::vector<std::string>& outputs);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+private:
+	class Worker;
+
+	static constexpr uint64_t CHUNK = 4096;
+	static constexpr uint64_t AHEAD = 2;
+
+	const ProgramNode& m_program;
+	Options m_options;
+	// Null when the program stays in the tree walker
+	std::unique_ptr<BytecodeProgram> m_code;
+	std::map<std::string, double> m_inputs;
+	Stats m_stats;
+};
@@ -0,0 +1,101 @@
+#include "OnStackReplacement.h"
+#include "Peephole.h"
+#include "VirtualMachine.h"
+#include <iostream>
+
+OsrCalculator::OsrCalculator(uint64_t threshold, bool contract)
+	: m_contract(contract)
+{
+	m_backEdgeLimit = threshold;
+}
+
+const OsrCalculator::Stats& OsrCalculator::GetStats()const
+{
+	return m_stats;
+}
+
+void OsrCalculator::PrintStats(std::ostream& out)const
+{
+	out << "loops replaced on stack: " << m_stats.replacements << ", " << m_stats.compiledLoops << " compiled" << std::endl;
+	out << "iterations run in bytecode: " << m_stats.replacedIterations << std::endl;
+}
+
+bool OsrCalculator::ReplaceLoop(const ForNode& loop, double next, double remaining)
+{
+	if (!m_decimals.empty() || !m_bigints.empty())
+	{
+		return false;
+	}
+	auto [compiled, inserted] = m_compiled.emplace(&loop, nullptr);
+	if (inserted)
+	{
+		try
+		{
+			BytecodeCompiler compiler;
+			compiler.SetCoverage(m_coverage != nullptr);
+			auto program = std::make_unique<BytecodeProgram>(compiler.CompileLoop(loop));
+			PeepholeOptimizer(m_contract).Optimize(*program);
+			program->Assemble();
+			compiled->second = std::move(program);
+			++m_stats.compiledLoops;
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+	}
+	if (!compiled->second)
+	{
+		return false;
+	}
+
+	// Hoisted values of inner loops may be stale, their ForEnter recomputes them
+	const BytecodeProgram& program = *compiled->second;
+	VirtualMachine machine(program);
+	for (uint32_t i = 0; i < program.variables.size(); ++i)
+	{
+		if (program.variables[i].empty())
+		{
+			continue;
+		}
+		auto var = m_index.find(SymbolTable::InternFolded(program.variables[i]));
+		if (var != m_index.end())
+		{
+			machine.SetVariable(i, var->second->second);
+		}
+	}
+	for (const auto& [slot, variable] : program.invariants)
+	{
+		if (slot < m_invariants.size())
+		{
+			machine.SetVariable(variable, m_invariants[slot]);
+		}
+	}
+	// The loop continues the draws of the run
+	machine.SetRandomStream(m_random);
+	if (m_floatingPointChecks)
+	{
+		std::feclearexcept(FLOATING_POINT_ERRORS);
+	}
+	machine.Resume(0, next, remaining);
+	if (m_floatingPointChecks && std::fetestexcept(FLOATING_POINT_ERRORS))
+	{
+		// The tree walker runs the iterations instead, its checks report the statement
+		compiled->second.reset();
+		return false;
+	}
+	for (const auto& [name, value] : machine.GetScope())
+	{
+		FindOrAdd(SymbolTable::InternFolded(name), name) = value;
+	}
+	m_random = machine.GetRandomStream();
+	if (m_coverage)
+	{
+		machine.AddCoverage(m_coverage);
+	}
+
+	m_loopIterations += static_cast<uint64_t>(remaining);
+	++m_stats.replacements;
+	m_stats.replacedIterations += static_cast<uint64_t>(remaining);
+	return true;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Bytecode.h"
+#include <iosfwd>
+
+// Tree walker that moves long-running FOR loops to the bytecode VM in the
+// middle of their execution. Once a loop has taken 'threshold' back-edges it
+// is compiled on its own; the variables and hoisted values it reads are
+// copied into a VirtualMachine, which runs the remaining iterations, and the
+// variables are copied back. Values are the same as in the tree walker
+// unless the bytecode is contracted (PeepholeOptimizer).
+// Programs with DECIMAL or BIGINT variables are not replaced, the bytecode has
+// neither; coverage counters are counted by the VM and added after it. With floating-point checks the flags
+// are tested once after the VM; a loop raising one is left to the tree walker.
+class OsrCalculator : public ExpressionCalculator
+{
+public:
+	struct Stats
+	{
+		size_t compiledLoops = 0;
+		size_t replacements = 0;
+		// Iterations of replaced loops run by the VM
+		uint64_t replacedIterations = 0;
+	};
+
+	explicit OsrCalculator(uint64_t threshold, bool contract = false);
+
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+protected:
+	bool ReplaceLoop(const ForNode& loop, double next, double remaining) override;
+
+private:
+	// Null for loops that failed to compile or raised a floating-point exception
+	std::unordered_map<const ForNode*, std::unique_ptr<BytecodeProgram>> m_compiled;
+	bool m_contract;
+	Stats m_stats;
+};
@@ -0,0 +1,431 @@
+#include "Parser.h"
+#include <cassert>
+#include <algorithm>
+#include <charconv>
+
+namespace
+{
+template <typename T>
+bool AnyOf(const T& value, const std::initializer_list<T> &container)
+{
+	return std::any_of(std::begin(container), std::end(container), [&value](const T& element) {
+		return value == element;
+	});
+}
+
+// Exact value of a number constant for DECIMAL arithmetic, if it fits
+std::optional<Decimal> ParseExactConstant(const std::string& lexeme)
+{
+	Decimal value;
+	if (Decimal::TryParse(lexeme, value))
+	{
+		return value;
+	}
+	return std::nullopt;
+}
+
+// Nearest double of a number constant, which has to be finite
+double ParseDouble(const Token& token)
+{
+	const std::string& lexeme = *token.value;
+	double value = 0;
+	const auto [end, error] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), value);
+	if (error == std::errc::result_out_of_range)
+	{
+		// Constants below 1 underflow to 0, the others overflow
+		if (lexeme.find_first_not_of("0.") < lexeme.find('.'))
+		{
+			throw std::runtime_error("number constant out of range at pos " + std::to_string(token.offset) + ": '"
+				+ lexeme + "'");
+		}
+		return 0;
+	}
+	return value;
+}
+
+// Integers up to 2^53 are exact doubles, greater ones keep their digits for BIGINT
+ASTNode::Ptr ParseIntegerConstant(const Token& token)
+{
+	constexpr int64_t MAX_EXACT = int64_t(1) << 53;
+	const std::string& lexeme = *token.value;
+	int64_t value = 0;
+	const auto [end, error] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), value);
+	if (error == std::errc() && value <= MAX_EXACT)
+	{
+		return LeafNumNode::Create(static_cast<double>(value), ParseExactConstant(lexeme));
+	}
+	return std::make_unique<LeafBigNumNode>(ParseDouble(token), BigInt::Parse(lexeme));
+}
+
+class NestingGuard
+{
+public:
+	explicit NestingGuard(size_t& depth)
+		: m_depth(depth)
+	{
+		if (++m_depth > Parser::MAX_NESTING_DEPTH)
+		{
+			--m_depth;
+			throw std::runtime_error("program is nested too deeply");
+		}
+	}
+
+	~NestingGuard()
+	{
+		--m_depth;
+	}
+
+private:
+	size_t& m_depth;
+};
+}
+
+Parser::Parser(std::unique_ptr<Lexer> && lexer)
+	: mTokens(std::move(lexer))
+{
+}
+
+Parser::Parser(TokenStream && tokens)
+	: mTokens(std::move(tokens))
+{
+}
+
+void Parser::EnableLayoutRecording()
+{
+	mRecordLayouts = true;
+}
+
+std::vector<CompoundLayout> Parser::TakeLayouts()
+{
+	return std::move(mLayouts);
+}
+
+std::vector<LoopBodyLayout> Parser::TakeLoopBodies()
+{
+	return std::move(mLoopBodies);
+}
+
+size_t Parser::GetTokenPosition()const
+{
+	return mTokens.GetPosition();
+}
+
+std::unique_ptr<ProgramNode> Parser::ParseAsProgram()
+{
+	EatAndAdvance(TokenType::Program);
+	const std::string programName = Peek().value.value_or("");
+	EatAndAdvance(TokenType::Identifier);
+	EatAndAdvance(TokenType::Semicolon);
+	auto block = ParseAsBlock();
+	auto program = std::make_unique<ProgramNode>(programName, std::move(block));
+	EatAndAdvance(TokenType::Dot);
+	EatAndAdvance(TokenType::EndOfFile);
+	return program;
+}
+
+// block:
+//  declarations compound_statement
+std::unique_ptr<BlockNode> Parser::ParseAsBlock()
+{
+	auto declarations = ParseAsDeclarations();
+	auto compound = ParseAsCompound();
+	return std::make_unique<BlockNode>(std::move(declarations), std::move(compound));
+}
+
+// declarations:
+//  VAR (variables_declaration SEMICOLON)+ |
+//  empty
+std::vector<std::unique_ptr<VarDeclNode>> Parser::ParseAsDeclarations()
+{
+	std::vector<std::unique_ptr<VarDeclNode>> declarations;
+	if (Peek().type == TokenType::Var)
+	{
+		EatAndAdvance(TokenType::Var);
+		while (Peek().type == TokenType::Identifier)
+		{
+			declarations.emplace_back(ParseAsVariablesDeclaration());
+			EatAndAdvance(TokenType::Semicolon);
+		}
+	}
+	return declarations;
+}
+
+// variables_declaration:
+//  ID (COMMA ID)* COLON type_spec
+std::unique_ptr<VarDeclNode> Parser::ParseAsVariablesDeclaration()
+{
+	std::vector<std::unique_ptr<LeafVarNode>> vars;
+	vars.push_back(ParseAsVariable());
+	while (Peek().type == TokenType::Comma)
+	{
+		EatAndAdvance(TokenType::Comma);
+		vars.emplace_back(ParseAsVariable());
+	}
+	EatAndAdvance(TokenType::Colon);
+	auto type = ParseAsTypeNode();
+	return std::make_unique<VarDeclNode>(std::move(vars), std::move(type));
+}
+
+std::unique_ptr<TypeNode> Parser::ParseAsTypeNode()
+{
+	if (Peek().type == TokenType::Integer)
+	{
+		EatAndAdvance(TokenType::Integer);
+		return std::make_unique<TypeNode>(TypeNode::Integer);
+	}
+	else if (Peek().type == TokenType::Real)
+	{
+		EatAndAdvance(TokenType::Real);
+		return std::make_unique<TypeNode>(TypeNode::Real);
+	}
+	else if (Peek().type == TokenType::Decimal)
+	{
+		return ParseAsDecimalType();
+	}
+	else if (Peek().type == TokenType::BigInt)
+	{
+		EatAndAdvance(TokenType::BigInt);
+		return std::make_unique<TypeNode>(TypeNode::BigInt);
+	}
+	throw std::runtime_error("invalid variable type");
+}
+
+// decimal_type:
+//  DECIMAL LPAREN INTEGER_CONST COMMA INTEGER_CONST RPAREN
+std::unique_ptr<TypeNode> Parser::ParseAsDecimalType()
+{
+	EatAndAdvance(TokenType::Decimal);
+	EatAndAdvance(TokenType::LeftParen);
+	const int precision = ParseAsTypeParameter();
+	EatAndAdvance(TokenType::Comma);
+	const int scale = ParseAsTypeParameter();
+	EatAndAdvance(TokenType::RightParen);
+	if (precision < 1 || precision > Decimal::MAX_PRECISION || scale > precision)
+	{
+		throw std::runtime_error("invalid DECIMAL precision or scale");
+	}
+	return std::make_unique<TypeNode>(TypeNode::Decimal, static_cast<uint8_t>(precision), static_cast<uint8_t>(scale));
+}
+
+int Parser::ParseAsTypeParameter()
+{
+	const Token& token = Peek();
+	if (token.type != TokenType::IntegerConstant || token.value->length() > 2)
+	{
+		throw std::runtime_error("invalid DECIMAL precision or scale");
+	}
+	const int value = std::stoi(*token.value);
+	EatAndAdvance(TokenType::IntegerConstant);
+	return value;
+}
+
+std::unique_ptr<CompoundNode> Parser::ParseAsCompound()
+{
+	NestingGuard guard(mNestingDepth);
+	if (mRecordLayouts)
+	{
+		mLayoutStack.emplace_back().range.begin = GetTokenPosition();
+	}
+
+	EatAndAdvance(TokenType::Begin);
+	auto node = ParseAsStatementList();
+	EatAndAdvance(TokenType::End);
+
+	if (mRecordLayouts)
+	{
+		CompoundLayout layout = std::move(mLayoutStack.back());
+		mLayoutStack.pop_back();
+		layout.node = node.get();
+		layout.range.end = GetTokenPosition();
+		auto& parent = mLayoutStack.empty() ? mLayouts : mLayoutStack.back().statements.back().compounds;
+		parent.push_back(std::move(layout));
+	}
+	return node;
+}
+
+std::unique_ptr<CompoundNode> Parser::ParseAsStatementList()
+{
+	auto node = std::make_unique<CompoundNode>();
+	node->AddChild(ParseAsRecordedStatement());
+	while (Peek().type == TokenType::Semicolon)
+	{
+		EatAndAdvance(TokenType::Semicolon);
+		node->AddChild(ParseAsRecordedStatement());
+	}
+	return node;
+}
+
+ASTNode::Ptr Parser::ParseAsStatement()
+{
+	if (Peek().type == TokenType::Begin)
+	{
+		return ParseAsCompound();
+	}
+	else if (Peek().type == TokenType::Identifier)
+	{
+		return ParseAsAssignment();
+	}
+	else if (Peek().type == TokenType::For)
+	{
+		return ParseAsFor();
+	}
+	else
+	{
+		return std::make_unique<LeafNopNode>();
+	}
+}
+
+ASTNode::Ptr Parser::ParseAsAssignment()
+{
+	auto left = ParseAsVariable();
+	EatAndAdvance(TokenType::Assign);
+	auto expr = ParseAsExpr();
+	return std::make_unique<AssignNode>(left->GetNameId(), std::move(expr));
+}
+
+// for_statement:
+//  FOR ID ASSIGN expr (TO | DOWNTO) expr DO statement
+ASTNode::Ptr Parser::ParseAsFor()
+{
+	NestingGuard guard(mNestingDepth);
+	EatAndAdvance(TokenType::For);
+	auto variable = ParseAsVariable();
+	EatAndAdvance(TokenType::Assign);
+	auto start = ParseAsExpr();
+	const TokenType direction = Peek().type;
+	if (direction != TokenType::To && direction != TokenType::DownTo)
+	{
+		throw std::runtime_error("can't parse as " + ToString(TokenType::To));
+	}
+	EatAndAdvance(direction);
+	auto end = ParseAsExpr();
+	EatAndAdvance(TokenType::Do);
+	const bool compound = Peek().type == TokenType::Begin;
+	const size_t bodyBegin = GetTokenPosition();
+	auto body = ParseAsStatement();
+	auto node = std::make_unique<ForNode>(variable->GetNameId(), std::move(start), std::move(end),
+		direction == TokenType::To ? ForNode::To : ForNode::DownTo, std::move(body));
+	if (mRecordLayouts && !compound)
+	{
+		mLoopBodies.push_back({ node.get(), { bodyBegin, GetTokenPosition() } });
+	}
+	return node;
+}
+
+std::unique_ptr<LeafVarNode> Parser::ParseAsVariable()
+{
+	const Token& token = Peek();
+	if (token.type != TokenType::Identifier)
+	{
+		throw std::runtime_error("can't parse as " + ToString(TokenType::Identifier));
+	}
+	auto node = std::make_unique<LeafVarNode>(*token.value);
+	EatAndAdvance(TokenType::Identifier);
+	return node;
+}
+
+ASTNode::Ptr Parser::ParseAsFactor()
+{
+	NestingGuard guard(mNestingDepth);
+	const Token& token = Peek();
+	if (token.type == TokenType::Minus)
+	{
+		EatAndAdvance(TokenType::Minus);
+		auto node = ParseAsFactor();
+		return std::make_unique<UnOpNode>(std::move(node), UnOpNode::Minus);
+	}
+	else if (token.type == TokenType::Plus)
+	{
+		EatAndAdvance(TokenType::Plus);
+		auto node = ParseAsFactor();
+		return std::make_unique<UnOpNode>(std::move(node), UnOpNode::Plus);
+	}
+	else if (token.type == TokenType::IntegerConstant)
+	{
+		auto node = ParseIntegerConstant(token);
+		EatAndAdvance(TokenType::IntegerConstant);
+		return node;
+	}
+	else if (token.type == TokenType::RealConstant)
+	{
+		auto node = LeafNumNode::Create(ParseDouble(token), ParseExactConstant(*token.value));
+		EatAndAdvance(TokenType::RealConstant);
+		return node;
+	}
+	else if (token.type == TokenType::LeftParen)
+	{
+		EatAndAdvance(TokenType::LeftParen);
+		auto node = ParseAsExpr();
+		EatAndAdvance(TokenType::RightParen);
+		return node;
+	}
+	else if (token.type == TokenType::Identifier)
+	{
+		return ParseAsVariable();
+	}
+	else if (token.type == TokenType::Random || token.type == TokenType::RandomNormal)
+	{
+		const TokenType type = token.type;
+		EatAndAdvance(type);
+		return std::make_unique<RandomNode>(type == TokenType::Random ? RandomNode::Uniform : RandomNode::Normal);
+	}
+	throw std::runtime_error("can't parse as factor");
+}
+
+ASTNode::Ptr Parser::ParseAsTerm()
+{
+	auto node = ParseAsFactor();
+	while (AnyOf(Peek().type, { TokenType::Mul, TokenType::IntegerDiv, TokenType::FloatDiv }))
+	{
+		const TokenType op = Peek().type;
+		EatAndAdvance(op);
+		node = std::make_unique<BinOpNode>(std::move(node), ParseAsFactor(),
+			op == TokenType::Mul ? BinOpNode::Mul :
+			op == TokenType::IntegerDiv ? BinOpNode::IntegerDiv : BinOpNode::FloatDiv);
+	}
+	return node;
+}
+
+ASTNode::Ptr Parser::ParseAsExpr()
+{
+	auto node = ParseAsTerm();
+	while (Peek().type == TokenType::Plus || Peek().type == TokenType::Minus)
+	{
+		const TokenType op = Peek().type;
+		EatAndAdvance(op);
+		node = std::make_unique<BinOpNode>(std::move(node), ParseAsTerm(),
+			op == TokenType::Plus ? BinOpNode::Plus : BinOpNode::Minus);
+	}
+	return node;
+}
+
+ASTNode::Ptr Parser::ParseAsRecordedStatement()
+{
+	if (!mRecordLayouts || mLayoutStack.empty())
+	{
+		return ParseAsStatement();
+	}
+
+	const size_t depth = mLayoutStack.size() - 1;
+	mLayoutStack[depth].statements.emplace_back().range.begin = GetTokenPosition();
+	auto statement = ParseAsStatement();
+	mLayoutStack[depth].statements.back().range.end = GetTokenPosition();
+	return statement;
+}
+
+const Token& Parser::Peek(size_t k)
+{
+	return mTokens.Peek(k);
+}
+
+void Parser::EatAndAdvance(TokenType kind)
+{
+	if (Peek().type == kind)
+	{
+		mTokens.Advance();
+	}
+	else
+	{
+		throw std::runtime_error("can't parse as " + ToString(kind));
+	}
+}
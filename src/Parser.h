@@ -0,0 +1,80 @@
+#pragma once
+#include "TokenStream.h"
+#include "AST.h"
+
+// Half-open range of token indices [begin, end)
+struct TokenRange
+{
+	size_t begin = 0;
+	size_t end = 0;
+};
+
+// Token layout of a parsed compound statement, mirrors the AST shape
+// down to statement granularity so that single statements can be reparsed
+struct CompoundLayout
+{
+	struct Statement
+	{
+		TokenRange range;
+		std::vector<CompoundLayout> compounds; // compounds nested into the statement
+	};
+
+	CompoundNode* node = nullptr;
+	TokenRange range;
+	std::vector<Statement> statements;
+};
+
+// Token range of a FOR body that is not a compound, whose statements have their own layouts
+struct LoopBodyLayout
+{
+	ForNode* node = nullptr;
+	TokenRange range;
+};
+
+class Parser
+{
+public:
+	// Limits recursion on nested parentheses, unary operators, compounds and
+	// loops. Chains like a + b + ... + z take no levels, the passes walk them
+	// without recursion
+	static constexpr size_t MAX_NESTING_DEPTH = 2048;
+
+	Parser(std::unique_ptr<Lexer> && lexer);
+	Parser(TokenStream && tokens);
+
+	// Records layouts of compounds and loop bodies with token positions relative to the stream start
+	void EnableLayoutRecording();
+	std::vector<CompoundLayout> TakeLayouts();
+	std::vector<LoopBodyLayout> TakeLoopBodies();
+	size_t GetTokenPosition()const;
+
+	std::unique_ptr<ProgramNode> ParseAsProgram();
+	std::unique_ptr<BlockNode> ParseAsBlock();
+	std::vector<std::unique_ptr<VarDeclNode>> ParseAsDeclarations();
+	std::unique_ptr<VarDeclNode> ParseAsVariablesDeclaration();
+	std::unique_ptr<TypeNode> ParseAsTypeNode();
+	std::unique_ptr<TypeNode> ParseAsDecimalType();
+	std::unique_ptr<CompoundNode> ParseAsCompound();
+	std::unique_ptr<CompoundNode> ParseAsStatementList();
+	ASTNode::Ptr ParseAsStatement();
+	ASTNode::Ptr ParseAsAssignment();
+	ASTNode::Ptr ParseAsFor();
+	std::unique_ptr<LeafVarNode> ParseAsVariable();
+	ASTNode::Ptr ParseAsFactor();
+	ASTNode::Ptr ParseAsTerm();
+	ASTNode::Ptr ParseAsExpr();
+
+private:
+	ASTNode::Ptr ParseAsRecordedStatement();
+	int ParseAsTypeParameter();
+	const Token& Peek(size_t k = 0);
+	void EatAndAdvance(TokenType kind);
+
+private:
+	TokenStream mTokens;
+	size_t mNestingDepth = 0;
+	bool mRecordLayouts = false;
+	std::vector<CompoundLayout> mLayoutStack;
+	std::vector<CompoundLayout> mLayouts;
+	std::vector<LoopBodyLayout> mLoopBodies;
+};
@@ -0,0 +1,330 @@
+#include "PartialEvaluator.h"
+#include "LoopOptimizer.h"
+#include "RangeAnalysis.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+const LeafNumNode* AsConstant(const ASTNode::Ptr& expression)
+{
+	return dynamic_cast<const LeafNumNode*>(expression.get());
+}
+
+ASTNode::Ptr MakeConstant(double value)
+{
+	return std::make_unique<LeafNumNode>(value, false);
+}
+
+// Value of the operation on constants, empty when it raises a floating-point
+// exception: the residual program keeps it for the checks of the engines
+std::optional<double> Fold(BinOpNode::Operator op, double left, double right)
+{
+	std::feclearexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+	const double value = ExpressionCalculator::Apply(op, left, right);
+	if (std::fetestexcept(ExpressionCalculator::FLOATING_POINT_ERRORS))
+	{
+		return std::nullopt;
+	}
+	return value;
+}
+}
+
+std::unique_ptr<ProgramNode> PartialEvaluator::Specialize(const ProgramNode& program, const Values& known)
+{
+	m_known.clear();
+	m_names.clear();
+	m_exact.clear();
+	m_declarations.clear();
+	for (const auto& [name, value] : known)
+	{
+		const std::string varname = boost::algorithm::to_lower_copy(name);
+		// Set in the scope before the residual program runs
+		m_known[varname] = { value, true };
+		m_names.emplace(varname, SymbolTable::Intern(name));
+	}
+
+	auto compound = std::make_unique<CompoundNode>();
+	m_output = compound.get();
+	Visit(program);
+	// Values the program ends with
+	std::vector<std::string> pending;
+	for (const auto& [varname, value] : m_known)
+	{
+		if (!value.stored)
+		{
+			pending.push_back(varname);
+		}
+	}
+	std::sort(pending.begin(), pending.end());
+	for (const std::string& varname : pending)
+	{
+		Materialize(varname);
+	}
+	m_output = nullptr;
+
+	auto block = std::make_unique<BlockNode>(std::move(m_declarations), std::move(compound));
+	return std::make_unique<ProgramNode>(program.GetName(), std::move(block));
+}
+
+void PartialEvaluator::Visit(const BinOpNode& binop)
+{
+	m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+		[this](const BinOpNode& node) { Combine(node); });
+}
+
+void PartialEvaluator::Combine(const BinOpNode& binop)
+{
+	auto left = std::move(m_acc);
+	auto right = Residualize(binop.GetRight());
+	const LeafNumNode* leftConstant = AsConstant(left);
+	const LeafNumNode* rightConstant = AsConstant(right);
+	const std::optional<double> folded = m_fold && leftConstant && rightConstant
+		? Fold(binop.GetOperator(), leftConstant->GetValue(), rightConstant->GetValue())
+		: std::nullopt;
+	if (folded)
+	{
+		m_acc = MakeConstant(*folded);
+		return;
+	}
+	m_acc = std::make_unique<BinOpNode>(std::move(left), std::move(right), binop.GetOperator());
+}
+
+void PartialEvaluator::Visit(const LeafNumNode& num)
+{
+	// Copied with its decimal digits for the exact engines
+	if (const BigInt* integer = num.GetExactInteger())
+	{
+		m_acc = std::make_unique<LeafBigNumNode>(num.GetValue(), *integer);
+		return;
+	}
+	std::optional<Decimal> exact;
+	try
+	{
+		exact = num.GetDecimal();
+	}
+	catch (const std::overflow_error&)
+	{
+	}
+	m_acc = LeafNumNode::Create(num.GetValue(), exact);
+}
+
+void PartialEvaluator::Visit(const UnOpNode& unop)
+{
+	auto expression = Residualize(unop.GetExpression());
+	const LeafNumNode* constant = AsConstant(expression);
+	if (m_fold && constant)
+	{
+		m_acc = MakeConstant(unop.GetOperator() == UnOpNode::Minus ? -constant->GetValue() : +constant->GetValue());
+		return;
+	}
+	m_acc = std::make_unique<UnOpNode>(std::move(expression), unop.GetOperator());
+}
+
+void PartialEvaluator::Visit(const LeafVarNode& var)
+{
+	const std::string varname = boost::algorithm::to_lower_copy(var.GetName());
+	auto known = m_known.find(varname);
+	if (known != m_known.end() && m_fold)
+	{
+		m_acc = MakeConstant(known->second.value);
+		return;
+	}
+	Materialize(varname);
+	m_acc = std::make_unique<LeafVarNode>(var.GetName());
+}
+
+void PartialEvaluator::Visit(const LeafInvariantNode& invariant)
+{
+	(void)invariant;
+	throw std::logic_error("partial evaluation needs the tree before LoopOptimizer");
+}
+
+void PartialEvaluator::Visit(const InductionNode& induction)
+{
+	(void)induction;
+	throw std::logic_error("partial evaluation needs the tree before LoopOptimizer");
+}
+
+void PartialEvaluator::Visit(const RandomNode& random)
+{
+	// Drawn at run time, in the order of the source
+	m_acc = std::make_unique<RandomNode>(random.GetDistribution());
+}
+
+void PartialEvaluator::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void PartialEvaluator::Visit(const AssignNode& assign)
+{
+	const std::string varname = boost::algorithm::to_lower_copy(assign.GetLeft());
+	m_names.emplace(varname, assign.GetLeftId());
+	const bool exact = m_exact.count(varname) != 0;
+	m_fold = !exact;
+	auto right = Residualize(assign.GetRight());
+	m_fold = true;
+
+	const LeafNumNode* constant = exact ? nullptr : AsConstant(right);
+	if (constant)
+	{
+		// A value not stored yet is overwritten before anything reads it
+		m_known[varname] = { constant->GetValue(), false };
+		return;
+	}
+	Forget(varname);
+	m_output->AddChild(std::make_unique<AssignNode>(m_names.at(varname), std::move(right)));
+}
+
+void PartialEvaluator::Visit(const CompoundNode& compound)
+{
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void PartialEvaluator::Visit(const ForNode& loop)
+{
+	const std::string varname = boost::algorithm::to_lower_copy(loop.GetVariable());
+	m_names.emplace(varname, loop.GetVariableId());
+	auto start = Residualize(loop.GetStart());
+	auto end = Residualize(loop.GetEnd());
+	const LeafNumNode* startConstant = AsConstant(start);
+	const LeafNumNode* endConstant = AsConstant(end);
+	const double step = loop.GetDirection() == ForNode::To ? 1 : -1;
+	if (startConstant && endConstant && !((endConstant->GetValue() - startConstant->GetValue()) * step >= 0))
+	{
+		return;
+	}
+
+	// The body may run no times, so values it reads unfolded or overwrites
+	// are stored before it: DECIMAL and BIGINT arithmetic may read any of them
+	auto assigned = LoopOptimizer::GetAssignedVariables(loop.GetBody());
+	assigned.insert(varname);
+	for (auto& [name, known] : m_known)
+	{
+		(void)known;
+		if (!m_exact.empty() || assigned.count(name))
+		{
+			Materialize(name);
+		}
+	}
+	for (const std::string& variable : assigned)
+	{
+		Forget(variable);
+	}
+
+	auto body = std::make_unique<CompoundNode>();
+	CompoundNode* outer = m_output;
+	m_output = body.get();
+	loop.GetBody().Accept(*this);
+	// Constants assigned by the body are stored every iteration
+	for (const std::string& variable : assigned)
+	{
+		Materialize(variable);
+		Forget(variable);
+	}
+	m_output = outer;
+	m_output->AddChild(std::make_unique<ForNode>(m_names.at(varname), std::move(start), std::move(end),
+		loop.GetDirection(), std::move(body)));
+}
+
+void PartialEvaluator::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void PartialEvaluator::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode& type = vardecl.GetTypeNode();
+	std::vector<std::unique_ptr<LeafVarNode>> vars;
+	for (const auto& var : vardecl.GetVariables())
+	{
+		vars.push_back(std::make_unique<LeafVarNode>(var->GetName()));
+		if (type.GetType() == TypeNode::Decimal || type.GetType() == TypeNode::BigInt)
+		{
+			m_exact.insert(boost::algorithm::to_lower_copy(var->GetName()));
+		}
+	}
+	auto typeCopy = std::make_unique<TypeNode>(type.GetType(), type.GetPrecision(), type.GetScale());
+	m_declarations.push_back(std::make_unique<VarDeclNode>(std::move(vars), std::move(typeCopy)));
+}
+
+void PartialEvaluator::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	for (const auto& [varname, known] : m_known)
+	{
+		(void)known;
+		if (m_exact.count(varname))
+		{
+			throw std::invalid_argument("known values must be INTEGER or REAL variables");
+		}
+	}
+	Visit(block.GetCompound());
+}
+
+void PartialEvaluator::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+ASTNode::Ptr PartialEvaluator::Residualize(const ASTNode& expression)
+{
+	expression.Accept(*this);
+	return std::move(m_acc);
+}
+
+void PartialEvaluator::Materialize(const std::string& varname)
+{
+	auto known = m_known.find(varname);
+	if (known == m_known.end() || known->second.stored)
+	{
+		return;
+	}
+	m_output->AddChild(std::make_unique<AssignNode>(m_names.at(varname), MakeConstant(known->second.value)));
+	known->second.stored = true;
+}
+
+void PartialEvaluator::Forget(const std::string& varname)
+{
+	m_known.erase(varname);
+}
+
+SpecializationCache::SpecializationCache(const ProgramNode& program)
+	: m_program(program)
+{
+}
+
+std::shared_ptr<const ProgramNode> SpecializationCache::Get(const PartialEvaluator::Values& known)
+{
+	Key key;
+	for (const auto& [name, value] : known)
+	{
+		uint64_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		key.emplace_back(boost::algorithm::to_lower_copy(name), bits);
+	}
+	std::sort(key.begin(), key.end());
+	auto cached = m_cache.find(key);
+	if (cached != m_cache.end())
+	{
+		return cached->second;
+	}
+
+	auto residual = PartialEvaluator().Specialize(m_program, known);
+	LoopOptimizer().Run(*residual);
+	RangeAnalysis().Run(*residual);
+	return m_cache.emplace(std::move(key), std::move(residual)).first->second;
+}
+
+size_t SpecializationCache::GetSize()const
+{
+	return m_cache.size();
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "AST.h"
+#include <map>
+#include <unordered_set>
+
+// Specializes a program for known values of some of its INTEGER or REAL
+// variables, typically inputs fixed per deployment. Run with the known values
+// set beforehand (ExpressionCalculator::SetVariable), once per deployment, the
+// residual program computes the same variables as the original run with the
+// same values; the other inputs are still set per run:
+//  - known values are propagated through assignments and folded into the
+//    expressions reading them, with the arithmetic of ExpressionCalculator;
+//  - known values the program does not change are never stored again;
+//  - assignments of constants are delayed until a loop overwrites them,
+//    DECIMAL or BIGINT arithmetic needs them, or the program ends, so
+//    constants overwritten in between are never stored;
+//  - FOR loops whose known bounds leave them empty are removed.
+// Expressions of DECIMAL and BIGINT assignments are copied as they are, the
+// exact engines do their own arithmetic. Specialize the tree as parsed, before
+// LoopOptimizer.
+class PartialEvaluator : public IASTNodeVisitor
+{
+public:
+	using Values = std::map<std::string, double>;
+
+	std::unique_ptr<ProgramNode> Specialize(const ProgramNode& program, const Values& known);
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	struct Known
+	{
+		double value;
+		bool stored; // by the residual program, or set before it
+	};
+
+	// Residual expression, folded when m_fold is set
+	ASTNode::Ptr Residualize(const ASTNode& expression);
+	// Residual operator, m_acc holds its residual left operand
+	void Combine(const BinOpNode& binop);
+	// Stores the value of the variable if it is known and not stored yet
+	void Materialize(const std::string& varname);
+	void Forget(const std::string& varname);
+
+private:
+	// By lowercase name
+	std::unordered_map<std::string, Known> m_known;
+	// Spelling of the first assignment, which names the variable in the scope
+	std::unordered_map<std::string, SymbolTable::Id> m_names;
+	std::unordered_set<std::string> m_exact;
+	bool m_fold = true;
+	ASTNode::Ptr m_acc;
+	CompoundNode* m_output = nullptr;
+	std::vector<std::unique_ptr<VarDeclNode>> m_declarations;
+	ChainWalker m_chain;
+};
+
+// Residual programs of one program by known values, specialized on the first
+// request and optimized with LoopOptimizer and RangeAnalysis
+class SpecializationCache
+{
+public:
+	explicit SpecializationCache(const ProgramNode& program);
+
+	std::shared_ptr<const ProgramNode> Get(const PartialEvaluator::Values& known);
+	size_t GetSize()const;
+
+private:
+	// Lowercase names and bit patterns of the values
+	using Key = std::vector<std::pair<std::string, uint64_t>>;
+
+	const ProgramNode& m_program;
+	std::map<Key, std::shared_ptr<const ProgramNode>> m_cache;
+};
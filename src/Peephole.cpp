@@ -0,0 +1,262 @@
+#include "Peephole.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+using Replacement = boost::container::small_vector<Instruction, 2>;
+
+struct Pattern
+{
+	static constexpr size_t MAX_LENGTH = 3;
+
+	const char* name;
+	// Opcodes of the window, the first 'length' ones are used
+	std::array<OpCode, MAX_LENGTH> match;
+	size_t length;
+	// Extra condition on the window, null when the opcodes are enough
+	bool (*applies)(const Instruction* window, const BytecodeProgram& program);
+	// The replacement is at most as long as the window
+	void (*rewrite)(const Instruction* window, BytecodeProgram& program, Replacement& replacement);
+};
+
+bool SameOperand(const Instruction* window, const BytecodeProgram& program)
+{
+	(void)program;
+	return window[0].operand == window[1].operand;
+}
+
+bool PushesOne(const Instruction* window, const BytecodeProgram& program)
+{
+	return program.constants[window[0].operand] == 1;
+}
+
+void Remove(const Instruction* window, BytecodeProgram& program, Replacement& replacement)
+{
+	(void)window;
+	(void)program;
+	(void)replacement;
+}
+
+// Same arithmetic as VirtualMachine
+double Apply(OpCode op, double left, double right)
+{
+	switch (op)
+	{
+	case OpCode::Add:
+		return left + right;
+	case OpCode::Sub:
+		return left - right;
+	case OpCode::Mul:
+		return left * right;
+	case OpCode::Div:
+		return left / right;
+	case OpCode::IntDiv:
+		return std::round(left / right);
+	default:
+		throw std::logic_error("undefined operator");
+	}
+}
+
+// A folded operation raising a floating-point exception would not raise it
+// in the VM, where the checks could see it
+bool FoldsQuietly(const Instruction* window, const BytecodeProgram& program)
+{
+	std::feclearexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+	volatile double value = Apply(window[2].op, program.constants[window[0].operand], program.constants[window[1].operand]);
+	(void)value;
+	return !std::fetestexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+}
+
+void Fold(const Instruction* window, BytecodeProgram& program, Replacement& replacement)
+{
+	const double value = Apply(window[2].op, program.constants[window[0].operand], program.constants[window[1].operand]);
+	replacement.push_back({ OpCode::PushConst, program.AddConstant(value) });
+}
+
+const Pattern PATTERNS[] = {
+	// Value of an assignment dropped by the statement
+	{ "tee-pop", { OpCode::Tee, OpCode::Pop }, 2, nullptr,
+		[](const Instruction* window, BytecodeProgram&, Replacement& replacement) {
+			replacement.push_back({ OpCode::Store, window[0].operand });
+		} },
+	// Variable read right after it has been assigned
+	{ "store-load", { OpCode::Store, OpCode::Load }, 2, SameOperand,
+		[](const Instruction* window, BytecodeProgram&, Replacement& replacement) {
+			replacement.push_back({ OpCode::Tee, window[0].operand });
+		} },
+	{ "dup-pop", { OpCode::Dup, OpCode::Pop }, 2, nullptr, Remove },
+	{ "push-pop", { OpCode::PushConst, OpCode::Pop }, 2, nullptr, Remove },
+	{ "pos", { OpCode::Pos }, 1, nullptr, Remove },
+	{ "neg-neg", { OpCode::Neg, OpCode::Neg }, 2, nullptr, Remove },
+	{ "neg-const", { OpCode::PushConst, OpCode::Neg }, 2, nullptr,
+		[](const Instruction* window, BytecodeProgram& program, Replacement& replacement) {
+			replacement.push_back({ OpCode::PushConst, program.AddConstant(-program.constants[window[0].operand]) });
+		} },
+	{ "mul-one", { OpCode::PushConst, OpCode::Mul }, 2, PushesOne, Remove },
+	{ "div-one", { OpCode::PushConst, OpCode::Div }, 2, PushesOne, Remove },
+	{ "fold-add", { OpCode::PushConst, OpCode::PushConst, OpCode::Add }, 3, FoldsQuietly, Fold },
+	{ "fold-sub", { OpCode::PushConst, OpCode::PushConst, OpCode::Sub }, 3, FoldsQuietly, Fold },
+	{ "fold-mul", { OpCode::PushConst, OpCode::PushConst, OpCode::Mul }, 3, FoldsQuietly, Fold },
+	{ "fold-div", { OpCode::PushConst, OpCode::PushConst, OpCode::Div }, 3, FoldsQuietly, Fold },
+	{ "fold-intdiv", { OpCode::PushConst, OpCode::PushConst, OpCode::IntDiv }, 3, FoldsQuietly, Fold },
+	{ "fold-shift", { OpCode::PushConst, OpCode::IntDivByPowerOfTwo }, 2, nullptr,
+		[](const Instruction* window, BytecodeProgram& program, Replacement& replacement) {
+			const double value = std::round(program.constants[window[0].operand] * program.constants[window[1].operand]);
+			replacement.push_back({ OpCode::PushConst, program.AddConstant(value) });
+		} },
+};
+
+// Multiplications followed by an addition or subtraction of their product,
+// either after pushing the other operand or with it below on the stack
+template <OpCode FUSED>
+void Contract(const Instruction* window, BytecodeProgram& program, Replacement& replacement)
+{
+	(void)program;
+	if (window[1].op == OpCode::Load || window[1].op == OpCode::PushConst)
+	{
+		replacement.push_back(window[1]);
+	}
+	replacement.push_back({ FUSED });
+}
+
+const Pattern CONTRACTIONS[] = {
+	{ "fma-mul-add", { OpCode::Mul, OpCode::Load, OpCode::Add }, 3, nullptr, Contract<OpCode::MulAdd> },
+	{ "fma-mul-add", { OpCode::Mul, OpCode::PushConst, OpCode::Add }, 3, nullptr, Contract<OpCode::MulAdd> },
+	{ "fma-mul-sub", { OpCode::Mul, OpCode::Load, OpCode::Sub }, 3, nullptr, Contract<OpCode::MulSub> },
+	{ "fma-mul-sub", { OpCode::Mul, OpCode::PushConst, OpCode::Sub }, 3, nullptr, Contract<OpCode::MulSub> },
+	{ "fma-add-mul", { OpCode::Mul, OpCode::Add }, 2, nullptr, Contract<OpCode::AddMul> },
+	{ "fma-sub-mul", { OpCode::Mul, OpCode::Sub }, 2, nullptr, Contract<OpCode::SubMul> },
+};
+
+template <size_t N>
+const Pattern* FindPattern(const Pattern (&patterns)[N], const Instruction* window, size_t available, const BytecodeProgram& program)
+{
+	for (const Pattern& pattern : patterns)
+	{
+		if (pattern.length > available)
+		{
+			continue;
+		}
+		bool matches = true;
+		for (size_t i = 0; i < pattern.length && matches; ++i)
+		{
+			matches = window[i].op == pattern.match[i];
+		}
+		if (matches && (!pattern.applies || pattern.applies(window, program)))
+		{
+			return &pattern;
+		}
+	}
+	return nullptr;
+}
+
+size_t CountInstructions(const BytecodeProgram& program)
+{
+	size_t count = 0;
+	for (const Instruction& instruction : program.code)
+	{
+		count += instruction.op != OpCode::Label ? 1 : 0;
+	}
+	return count;
+}
+}
+
+PeepholeOptimizer::PeepholeOptimizer(bool contract)
+	: m_contract(contract && HasFusedMultiplyAdd())
+{
+}
+
+bool PeepholeOptimizer::HasFusedMultiplyAdd()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	return __builtin_cpu_supports("fma");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	// FMA and OSXSAVE, the OS has to save the AVX registers FMA uses
+	int info[4] = {};
+	__cpuid(info, 1);
+	const int mask = (1 << 12) | (1 << 27);
+	return (info[2] & mask) == mask;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	return true;
+#else
+	return false;
+#endif
+}
+
+void PeepholeOptimizer::Optimize(BytecodeProgram& program)
+{
+	if (program.assembled)
+	{
+		throw std::logic_error("peephole optimizer needs bytecode with labels");
+	}
+	m_stats.instructionsBefore += CountInstructions(program);
+	do
+	{
+		++m_stats.passes;
+	} while (RunPass(program));
+	m_stats.instructionsAfter += CountInstructions(program);
+}
+
+const PeepholeOptimizer::Stats& PeepholeOptimizer::GetStats()const
+{
+	return m_stats;
+}
+
+void PeepholeOptimizer::PrintStats(std::ostream& out)const
+{
+	out << "peephole passes: " << m_stats.passes << ", rewrites " << m_stats.rewrites << std::endl;
+	for (const auto& [name, count] : m_stats.patterns)
+	{
+		out << "  " << name << ": " << count << std::endl;
+	}
+	out << "instructions: " << m_stats.instructionsBefore << " before, "
+		<< m_stats.instructionsAfter << " after" << std::endl;
+}
+
+bool PeepholeOptimizer::RunPass(BytecodeProgram& program)
+{
+	// Rewrites in place: code[0, written) is done, code[next, end) is left to
+	// match. A replacement goes to the end of its window and the instructions
+	// before it are matched again with it, so a chain like 1 + 1 + ... + 1
+	// folds in one pass instead of one pass per operation
+	std::vector<Instruction>& code = program.code;
+	size_t written = 0;
+	bool changed = false;
+	for (size_t next = 0; next < code.size();)
+	{
+		const Instruction* window = &code[next];
+		const Pattern* pattern = FindPattern(PATTERNS, window, code.size() - next, program);
+		if (!pattern && m_contract)
+		{
+			pattern = FindPattern(CONTRACTIONS, window, code.size() - next, program);
+		}
+		if (!pattern)
+		{
+			code[written++] = code[next++];
+			continue;
+		}
+		Replacement replacement;
+		pattern->rewrite(window, program, replacement);
+		if (replacement.size() > pattern->length)
+		{
+			throw std::logic_error("peephole replacement is longer than its pattern");
+		}
+		next += pattern->length - replacement.size();
+		std::copy(replacement.begin(), replacement.end(), code.begin() + next);
+		const size_t rematched = std::min(written, Pattern::MAX_LENGTH - 1);
+		std::copy_backward(code.begin() + (written - rematched), code.begin() + written, code.begin() + next);
+		written -= rematched;
+		next -= rematched;
+		++m_stats.rewrites;
+		++m_stats.patterns[pattern->name];
+		changed = true;
+	}
+	code.resize(written);
+	return changed;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Bytecode.h"
+#include <iosfwd>
+
+// Rewrites short instruction sequences of unassembled bytecode by the table
+// of patterns in Peephole.cpp, pass after pass until none applies. Patterns
+// never match across labels, so jumps keep their targets. Every rewrite
+// computes bit-identical results and keeps reads of undefined variables:
+// a + -b is not turned into a - b, which differs in the sign of a NaN b.
+// Constants are not folded when the operation raises a floating-point
+// exception, the checks of the engines see it at run time.
+// Contraction, which is off by default and only done on CPUs with FMA, also
+// fuses a multiplication and the addition or subtraction of its product into
+// one of the MulAdd family. Fused instructions round a * b + c once instead
+// of twice: results may differ in the last bit from the tree walker and from
+// uncontracted bytecode, and more when the addition cancels, e.g.
+// x * x - x * x is the rounding error of x * x rather than 0.
+class PeepholeOptimizer
+{
+public:
+	struct Stats
+	{
+		size_t passes = 0;
+		size_t rewrites = 0;
+		size_t instructionsBefore = 0;
+		size_t instructionsAfter = 0;
+		// Rewrites by pattern name
+		std::map<std::string, size_t> patterns;
+	};
+
+	// Contraction is ignored without HasFusedMultiplyAdd
+	explicit PeepholeOptimizer(bool contract = false);
+
+	// Whether the CPU fuses multiply-add in hardware, VirtualMachine only
+	// runs fused instructions then
+	static bool HasFusedMultiplyAdd();
+
+	void Optimize(BytecodeProgram& program);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+private:
+	// Returns true when anything changed
+	bool RunPass(BytecodeProgram& program);
+
+private:
+	bool m_contract;
+	Stats m_stats;
+};
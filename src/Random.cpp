@@ -0,0 +1,148 @@
+#include "Random.h"
+#include <algorithm>
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define HAS_AVX2_ROUNDS
+#endif
+
+namespace
+{
+// Counters generated together, 32-bit words in 64-bit lanes
+constexpr size_t GROUP = 16;
+using Group = uint64_t[4][GROUP];
+// Draws converted at a time by the bulk functions
+constexpr size_t CHUNK = 256;
+
+void Rounds(Group& counter, uint64_t key0, uint64_t key1)
+{
+	for (int round = 0; round < RandomStream::ROUNDS; ++round)
+	{
+		for (size_t j = 0; j < GROUP; ++j)
+		{
+			const uint64_t first = RandomStream::MULTIPLIERS[0] * counter[0][j];
+			const uint64_t second = RandomStream::MULTIPLIERS[1] * counter[2][j];
+			const uint64_t mixed0 = (second >> 32) ^ counter[1][j] ^ key0;
+			const uint64_t mixed2 = (first >> 32) ^ counter[3][j] ^ key1;
+			counter[0][j] = mixed0;
+			counter[1][j] = second & 0xFFFFFFFF;
+			counter[2][j] = mixed2;
+			counter[3][j] = first & 0xFFFFFFFF;
+		}
+		key0 = (key0 + RandomStream::WEYL[0]) & 0xFFFFFFFF;
+		key1 = (key1 + RandomStream::WEYL[1]) & 0xFFFFFFFF;
+	}
+}
+
+#ifdef HAS_AVX2_ROUNDS
+// Same rounds four lanes at a time, _mm256_mul_epu32 multiplies the low
+// halves of the lanes into 64-bit products
+__attribute__((target("avx2")))
+void RoundsAvx2(Group& counter, uint64_t key0, uint64_t key1)
+{
+	const __m256i mask = _mm256_set1_epi64x(0xFFFFFFFF);
+	const __m256i multiplier0 = _mm256_set1_epi64x(RandomStream::MULTIPLIERS[0]);
+	const __m256i multiplier1 = _mm256_set1_epi64x(RandomStream::MULTIPLIERS[1]);
+	for (size_t lane = 0; lane < GROUP; lane += 4)
+	{
+		__m256i words[4];
+		for (size_t i = 0; i < 4; ++i)
+		{
+			words[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&counter[i][lane]));
+		}
+		uint64_t keys[2] = { key0, key1 };
+		for (int round = 0; round < RandomStream::ROUNDS; ++round)
+		{
+			const __m256i first = _mm256_mul_epu32(words[0], multiplier0);
+			const __m256i second = _mm256_mul_epu32(words[2], multiplier1);
+			words[0] = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(second, 32), words[1]),
+				_mm256_set1_epi64x(static_cast<long long>(keys[0])));
+			words[1] = _mm256_and_si256(second, mask);
+			words[2] = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(first, 32), words[3]),
+				_mm256_set1_epi64x(static_cast<long long>(keys[1])));
+			words[3] = _mm256_and_si256(first, mask);
+			keys[0] = (keys[0] + RandomStream::WEYL[0]) & 0xFFFFFFFF;
+			keys[1] = (keys[1] + RandomStream::WEYL[1]) & 0xFFFFFFFF;
+		}
+		for (size_t i = 0; i < 4; ++i)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&counter[i][lane]), words[i]);
+		}
+	}
+}
+#endif
+
+bool HasAvx2()
+{
+#ifdef HAS_AVX2_ROUNDS
+	static const bool supported = __builtin_cpu_supports("avx2");
+	return supported;
+#else
+	return false;
+#endif
+}
+}
+
+void RandomStream::GenerateHalves(uint64_t seed, uint64_t stream, uint64_t position, size_t count,
+	uint64_t* high, uint64_t* low)
+{
+	const bool avx2 = HasAvx2();
+	for (size_t begin = 0; begin < count; begin += GROUP)
+	{
+		Group counter;
+		for (size_t j = 0; j < GROUP; ++j)
+		{
+			const uint64_t laneStream = stream + begin + j;
+			counter[0][j] = position & 0xFFFFFFFF;
+			counter[1][j] = position >> 32;
+			counter[2][j] = laneStream & 0xFFFFFFFF;
+			counter[3][j] = laneStream >> 32;
+		}
+#ifdef HAS_AVX2_ROUNDS
+		if (avx2)
+		{
+			RoundsAvx2(counter, seed & 0xFFFFFFFF, seed >> 32);
+		}
+		else
+#endif
+		{
+			Rounds(counter, seed & 0xFFFFFFFF, seed >> 32);
+		}
+		const size_t generated = std::min(GROUP, count - begin);
+		for (size_t j = 0; j < generated; ++j)
+		{
+			high[begin + j] = counter[0][j] << 32 | counter[1][j];
+			low[begin + j] = counter[2][j] << 32 | counter[3][j];
+		}
+	}
+}
+
+void RandomStream::UniformLanes(uint64_t seed, uint64_t first, uint64_t position, double* out, size_t count)
+{
+	uint64_t high[CHUNK];
+	uint64_t low[CHUNK];
+	for (size_t begin = 0; begin < count; begin += CHUNK)
+	{
+		const size_t chunk = std::min(CHUNK, count - begin);
+		GenerateHalves(seed, first + begin, position, chunk, high, low);
+		for (size_t i = 0; i < chunk; ++i)
+		{
+			out[begin + i] = static_cast<double>(high[i] >> 11) * 0x1p-53;
+		}
+	}
+}
+
+void RandomStream::NormalLanes(uint64_t seed, uint64_t first, uint64_t position, double* out, size_t count)
+{
+	uint64_t high[CHUNK];
+	uint64_t low[CHUNK];
+	for (size_t begin = 0; begin < count; begin += CHUNK)
+	{
+		const size_t chunk = std::min(CHUNK, count - begin);
+		GenerateHalves(seed, first + begin, position, chunk, high, low);
+		for (size_t i = 0; i < chunk; ++i)
+		{
+			out[begin + i] = ToNormal({ static_cast<uint32_t>(high[i] >> 32), static_cast<uint32_t>(high[i]),
+				static_cast<uint32_t>(low[i] >> 32), static_cast<uint32_t>(low[i]) });
+		}
+	}
+}
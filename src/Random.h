@@ -0,0 +1,118 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Counter-based random numbers, Philox4x32-10 (Salmon et al., "Parallel
+// random numbers: as easy as 1, 2, 3"). Draw n of a stream is a function of
+// the seed, the stream id and n only: a stream is just a position, streams
+// are independent of each other, and any draw can be computed without the
+// ones before it. Values are the same on every thread and in every engine.
+// A uniform draw takes the upper 53 bits of the first half of a block, a
+// normal one is Box-Muller of both halves.
+class RandomStream
+{
+public:
+	using Block = std::array<uint32_t, 4>;
+
+	// Philox4x32-10 parameters
+	static constexpr int ROUNDS = 10;
+	static constexpr uint64_t MULTIPLIERS[2] = { 0xD2511F53, 0xCD9E8D57 };
+	static constexpr uint32_t WEYL[2] = { 0x9E3779B9, 0xBB67AE85 };
+
+	explicit RandomStream(uint64_t seed = 0, uint64_t stream = 0)
+		: m_seed(seed)
+		, m_stream(stream)
+	{
+	}
+
+	// In [0, 1)
+	double Uniform()
+	{
+		return ToUniform(Generate(m_seed, m_stream, m_position++));
+	}
+
+	// Standard normal
+	double Normal()
+	{
+		return ToNormal(Generate(m_seed, m_stream, m_position++));
+	}
+
+	uint64_t GetSeed()const
+	{
+		return m_seed;
+	}
+
+	uint64_t GetStream()const
+	{
+		return m_stream;
+	}
+
+	// Draws taken so far
+	uint64_t GetPosition()const
+	{
+		return m_position;
+	}
+
+	void SetPosition(uint64_t position)
+	{
+		m_position = position;
+	}
+
+	// Draw 'position' of the streams first to first + count - 1, one per row
+	// of a batch, computed several streams at a time (four per AVX2 register)
+	static void UniformLanes(uint64_t seed, uint64_t first, uint64_t position, double* out, size_t count);
+	static void NormalLanes(uint64_t seed, uint64_t first, uint64_t position, double* out, size_t count);
+
+	static constexpr Block Generate(uint64_t seed, uint64_t stream, uint64_t position)
+	{
+		Block counter = { static_cast<uint32_t>(position), static_cast<uint32_t>(position >> 32),
+			static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32) };
+		uint32_t key[2] = { static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+		for (int round = 0; round < ROUNDS; ++round)
+		{
+			const uint64_t first = MULTIPLIERS[0] * counter[0];
+			const uint64_t second = MULTIPLIERS[1] * counter[2];
+			counter = { static_cast<uint32_t>(second >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(second),
+				static_cast<uint32_t>(first >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(first) };
+			key[0] += WEYL[0];
+			key[1] += WEYL[1];
+		}
+		return counter;
+	}
+
+	static double ToUniform(const Block& block)
+	{
+		return static_cast<double>(High(block) >> 11) * 0x1p-53;
+	}
+
+	static double ToNormal(const Block& block)
+	{
+		// In (0, 1], the logarithm stays finite
+		const double radius = static_cast<double>((High(block) >> 11) + 1) * 0x1p-53;
+		const double angle = static_cast<double>(Low(block) >> 11) * 0x1p-53;
+		return std::sqrt(-2 * std::log(radius)) * std::cos(TWO_PI * angle);
+	}
+
+private:
+	// Halves of the blocks of 'count' streams from 'stream' on at 'position'
+	static void GenerateHalves(uint64_t seed, uint64_t stream, uint64_t position, size_t count,
+		uint64_t* high, uint64_t* low);
+
+	static constexpr double TWO_PI = 6.283185307179586;
+
+	static constexpr uint64_t High(const Block& block)
+	{
+		return uint64_t(block[0]) << 32 | block[1];
+	}
+
+	static constexpr uint64_t Low(const Block& block)
+	{
+		return uint64_t(block[2]) << 32 | block[3];
+	}
+
+	uint64_t m_seed;
+	uint64_t m_stream;
+	uint64_t m_position = 0;
+};
@@ -0,0 +1,303 @@
+#include "RangeAnalysis.h"
+#include "LoopOptimizer.h"
+#include <limits>
+#include <iostream>
+#include <algorithm>
+
+namespace
+{
+using Interval = RangeAnalysis::Interval;
+using Int128 = Decimal::Int128;
+
+// Integers doubles represent exactly
+const int64_t DOUBLE_EXACT_LIMIT = int64_t(1) << 53;
+// Rounding of a double quotient can't move it across a half for smaller operands
+const int64_t DOUBLE_DIVISION_LIMIT = int64_t(1) << 24;
+// Values BigInt keeps inline
+const int64_t INLINE_LIMIT = int64_t(1) << 62;
+
+std::optional<Interval> MakeInterval(Int128 low, Int128 high)
+{
+	if (low < std::numeric_limits<int64_t>::min() || high > std::numeric_limits<int64_t>::max())
+	{
+		return std::nullopt;
+	}
+	return Interval{ static_cast<int64_t>(low), static_cast<int64_t>(high) };
+}
+
+bool IsWithin(const std::optional<Interval>& interval, int64_t limit)
+{
+	return interval && interval->low >= -limit && interval->high <= limit;
+}
+
+bool ContainsZero(const Interval& interval)
+{
+	return interval.low <= 0 && interval.high >= 0;
+}
+
+// DIV of all engines: quotient rounded half away from zero
+Int128 DivideRounded(Int128 dividend, Int128 divisor)
+{
+	Int128 quotient = dividend / divisor;
+	Int128 remainder = dividend % divisor;
+	remainder = remainder < 0 ? -remainder : remainder;
+	if (remainder * 2 >= (divisor < 0 ? -divisor : divisor))
+	{
+		quotient += (dividend < 0) != (divisor < 0) ? -1 : 1;
+	}
+	return quotient;
+}
+
+// Smallest and greatest of f(l, r) over the corners, f must be monotonic in both arguments
+template <typename Function>
+std::optional<Interval> Corners(const Interval& left, const Interval& right, Function&& function)
+{
+	const Int128 values[] = {
+		function(left.low, right.low),
+		function(left.low, right.high),
+		function(left.high, right.low),
+		function(left.high, right.high)
+	};
+	return MakeInterval(*std::min_element(std::begin(values), std::end(values)),
+		*std::max_element(std::begin(values), std::end(values)));
+}
+}
+
+void RangeAnalysis::Run(ProgramNode& program)
+{
+	program.Accept(*this);
+}
+
+const RangeAnalysis::Stats& RangeAnalysis::GetStats()const
+{
+	return m_stats;
+}
+
+void RangeAnalysis::PrintStats(std::ostream& out)const
+{
+	out << "overflow checks: " << m_stats.overflowChecks
+		<< ", removed " << m_stats.overflowChecksRemoved << std::endl;
+	out << "division checks: " << m_stats.divisionChecks
+		<< ", removed " << m_stats.divisionChecksRemoved << std::endl;
+}
+
+void RangeAnalysis::Visit(const BinOpNode& binop)
+{
+	m_chain.Walk(binop, [this](const ASTNode& left) { left.Accept(*this); },
+		[this](const BinOpNode& node) { Combine(node); });
+}
+
+void RangeAnalysis::Combine(const BinOpNode& binop)
+{
+	const std::optional<Interval> left = m_acc;
+	const std::optional<Interval> right = Analyze(binop.GetRight());
+	const BinOpNode::Operator op = binop.GetOperator();
+	const bool division = op == BinOpNode::IntegerDiv || op == BinOpNode::FloatDiv;
+
+	std::optional<Interval> result;
+	if (left && right)
+	{
+		switch (op)
+		{
+		case BinOpNode::Plus:
+			result = MakeInterval(Int128(left->low) + right->low, Int128(left->high) + right->high);
+			break;
+		case BinOpNode::Minus:
+			result = MakeInterval(Int128(left->low) - right->high, Int128(left->high) - right->low);
+			break;
+		case BinOpNode::Mul:
+			result = Corners(*left, *right, [](Int128 l, Int128 r) { return l * r; });
+			break;
+		case BinOpNode::IntegerDiv:
+			// Rounded quotient is monotonic in both operands while the divisor keeps its sign
+			if (!ContainsZero(*right) && (m_mode != Mode::Double ||
+				(IsWithin(left, DOUBLE_DIVISION_LIMIT) && IsWithin(right, DOUBLE_DIVISION_LIMIT))))
+			{
+				result = Corners(*left, *right, DivideRounded);
+			}
+			break;
+		default:
+			// Quotient of '/' is not integral in general
+			break;
+		}
+	}
+	m_acc = Limit(result);
+
+	uint8_t proofs = 0;
+	if (!division && IsWithin(left, INLINE_LIMIT - 1) && IsWithin(right, INLINE_LIMIT - 1) && IsWithin(m_acc, INLINE_LIMIT - 1))
+	{
+		proofs |= BinOpNode::NoOverflow;
+	}
+	if (division && right && !ContainsZero(*right))
+	{
+		proofs |= BinOpNode::NonZeroDivisor;
+	}
+	// The tree has been passed to Run as mutable, visitors just see it const
+	const_cast<BinOpNode&>(binop).SetProofs(proofs);
+
+	if (m_mode == Mode::BigInt && !division)
+	{
+		++m_stats.overflowChecks;
+		m_stats.overflowChecksRemoved += (proofs & BinOpNode::NoOverflow) ? 1 : 0;
+	}
+	if (m_mode != Mode::Double && division)
+	{
+		++m_stats.divisionChecks;
+		m_stats.divisionChecksRemoved += (proofs & BinOpNode::NonZeroDivisor) ? 1 : 0;
+	}
+}
+
+void RangeAnalysis::Visit(const LeafNumNode& num)
+{
+	m_acc = std::nullopt;
+	try
+	{
+		const Decimal value = num.GetDecimal();
+		const Decimal integral = value.Rescale(0);
+		if (integral == value)
+		{
+			m_acc = Limit(Interval{ integral.GetUnits(), integral.GetUnits() });
+		}
+	}
+	catch (const std::overflow_error&)
+	{
+		// Constant does not fit into 64 bits, its value stays unknown
+	}
+}
+
+void RangeAnalysis::Visit(const UnOpNode& unop)
+{
+	const std::optional<Interval> value = Analyze(unop.GetExpression());
+	if (value && unop.GetOperator() == UnOpNode::Minus)
+	{
+		m_acc = MakeInterval(-Int128(value->high), -Int128(value->low));
+	}
+	else
+	{
+		m_acc = value;
+	}
+}
+
+void RangeAnalysis::Visit(const LeafVarNode& var)
+{
+	auto it = m_values.find(boost::algorithm::to_lower_copy(var.GetName()));
+	m_acc = it == m_values.end() ? std::nullopt : Limit(it->second);
+}
+
+void RangeAnalysis::Visit(const LeafInvariantNode& invariant)
+{
+	auto it = m_invariants.find(invariant.GetSlot());
+	m_acc = it == m_invariants.end() ? std::nullopt : Limit(it->second);
+}
+
+void RangeAnalysis::Visit(const InductionNode& induction)
+{
+	m_acc = Analyze(induction.GetProduct());
+}
+
+void RangeAnalysis::Visit(const RandomNode& random)
+{
+	// Not integral
+	(void)random;
+	m_acc = std::nullopt;
+}
+
+void RangeAnalysis::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void RangeAnalysis::Visit(const AssignNode& assign)
+{
+	const std::string varname = boost::algorithm::to_lower_copy(assign.GetLeft());
+	auto type = m_types.find(varname);
+	m_mode = type == m_types.end() ? Mode::Double : type->second;
+	// Integral values keep their value when rounded to a DECIMAL scale
+	m_values[varname] = Analyze(assign.GetRight());
+	m_mode = Mode::Double;
+}
+
+void RangeAnalysis::Visit(const CompoundNode& compound)
+{
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void RangeAnalysis::Visit(const ForNode& loop)
+{
+	const std::optional<Interval> start = Analyze(loop.GetStart());
+	const std::optional<Interval> end = Analyze(loop.GetEnd());
+	const auto assigned = LoopOptimizer::GetAssignedVariables(loop.GetBody());
+	for (const auto& varname : assigned)
+	{
+		m_values[varname] = std::nullopt;
+	}
+	for (const auto& invariant : loop.GetInvariants())
+	{
+		m_invariants[invariant.slot] = Analyze(*invariant.expression);
+	}
+
+	const std::string varname = boost::algorithm::to_lower_copy(loop.GetVariable());
+	const std::optional<Interval>& low = loop.GetDirection() == ForNode::To ? start : end;
+	const std::optional<Interval>& high = loop.GetDirection() == ForNode::To ? end : start;
+	// Bounds of a loop that never runs may cross
+	m_values[varname] = low && high && low->low <= high->high
+		? std::optional<Interval>(Interval{ low->low, high->high })
+		: std::nullopt;
+	loop.GetBody().Accept(*this);
+
+	// The body may have run any number of times
+	for (const auto& name : assigned)
+	{
+		m_values[name] = std::nullopt;
+	}
+	m_values[varname] = std::nullopt;
+}
+
+void RangeAnalysis::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void RangeAnalysis::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode::Type type = vardecl.GetTypeNode().GetType();
+	const Mode mode = type == TypeNode::Decimal ? Mode::Decimal
+		: type == TypeNode::BigInt ? Mode::BigInt
+		: Mode::Double;
+	for (const auto& var : vardecl.GetVariables())
+	{
+		m_types[boost::algorithm::to_lower_copy(var->GetName())] = mode;
+	}
+}
+
+void RangeAnalysis::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	Visit(block.GetCompound());
+}
+
+void RangeAnalysis::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+std::optional<RangeAnalysis::Interval> RangeAnalysis::Analyze(const ASTNode& expression)
+{
+	expression.Accept(*this);
+	return m_acc;
+}
+
+std::optional<RangeAnalysis::Interval> RangeAnalysis::Limit(const std::optional<Interval>& interval)const
+{
+	if (m_mode == Mode::Double && !IsWithin(interval, DOUBLE_EXACT_LIMIT))
+	{
+		return std::nullopt;
+	}
+	return interval;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "AST.h"
+#include <iosfwd>
+
+// Abstract interpretation of a program over integer intervals. Every
+// expression gets the interval of values it can produce, seeded from number
+// constants and propagated through assignments in statement order; REAL
+// division and non-integral constants make the value unknown. The results
+// are stored in BinOpNode proofs, so that BIGINT arithmetic proven to stay
+// within 63 bits skips its overflow checks and DIV or '/' by a divisor that
+// can't be zero skips the division check.
+// Variables assigned in a FOR body are unknown at the start of each
+// iteration, the loop variable stays between the bounds.
+// Proofs describe the tree as analyzed: run it again after the tree changes.
+class RangeAnalysis : public IASTNodeVisitor
+{
+public:
+	struct Interval
+	{
+		int64_t low = 0;
+		int64_t high = 0;
+	};
+
+	// Checks made by the DECIMAL and BIGINT engines, double arithmetic has none
+	struct Stats
+	{
+		size_t overflowChecks = 0;
+		size_t overflowChecksRemoved = 0;
+		size_t divisionChecks = 0;
+		size_t divisionChecksRemoved = 0;
+	};
+
+	// Replaces proofs of all BinOpNode of the program
+	void Run(ProgramNode& program);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	// Engine evaluating the current assignment, see ExpressionCalculator
+	enum class Mode
+	{
+		Double,
+		Decimal,
+		BigInt
+	};
+
+	std::optional<Interval> Analyze(const ASTNode& expression);
+	// Proofs and interval of the operator, m_acc holds the one of its left operand
+	void Combine(const BinOpNode& binop);
+	// Drops intervals the current engine can't compute exactly
+	std::optional<Interval> Limit(const std::optional<Interval>& interval)const;
+
+private:
+	std::optional<Interval> m_acc;
+	Mode m_mode = Mode::Double;
+	// Both by lowercase variable name
+	std::unordered_map<std::string, Mode> m_types;
+	std::unordered_map<std::string, std::optional<Interval>> m_values;
+	// Values of loop-invariant expressions by slot
+	std::unordered_map<uint32_t, std::optional<Interval>> m_invariants;
+	Stats m_stats;
+	ChainWalker m_chain;
+};
@@ -0,0 +1,263 @@
+#include "Reassociation.h"
+#include <iostream>
+
+namespace
+{
+bool IsAssociative(BinOpNode::Operator op)
+{
+	return op == BinOpNode::Plus || op == BinOpNode::Mul;
+}
+
+// Operation of the chain, as opposed to one of its operands
+const BinOpNode* AsLink(const ASTNode& node, BinOpNode::Operator op)
+{
+	const auto* binop = dynamic_cast<const BinOpNode*>(&node);
+	return binop && binop->GetOperator() == op ? binop : nullptr;
+}
+
+struct Chain
+{
+	size_t operands = 0;
+	size_t depth = 0; // operations on the longest path to an operand
+};
+
+// Walks the chain without recursion, left-deep chains are as long as programs
+Chain Measure(const BinOpNode& root)
+{
+	Chain chain;
+	std::vector<std::pair<const ASTNode*, size_t>> pending{ { &root, 0 } };
+	while (!pending.empty())
+	{
+		const auto [node, level] = pending.back();
+		pending.pop_back();
+		if (const BinOpNode* link = AsLink(*node, root.GetOperator()))
+		{
+			pending.emplace_back(&link->GetRight(), level + 1);
+			pending.emplace_back(&link->GetLeft(), level + 1);
+			continue;
+		}
+		++chain.operands;
+		chain.depth = std::max(chain.depth, level);
+	}
+	return chain;
+}
+
+size_t GetBalancedDepth(size_t operands)
+{
+	size_t depth = 0;
+	while ((size_t(1) << depth) < operands)
+	{
+		++depth;
+	}
+	return depth;
+}
+
+// The chain rooted at the expression when it is deeper than balanced, no
+// operands when the expression is no chain of '+' or '*' or shallow enough
+Chain FindUnbalanced(const ASTNode& expression)
+{
+	const BinOpNode* root = expression.AsBinOp();
+	if (!root || !IsAssociative(root->GetOperator()))
+	{
+		return Chain{};
+	}
+	const Chain chain = Measure(*root);
+	return GetBalancedDepth(chain.operands) < chain.depth ? chain : Chain{};
+}
+
+ASTNode::Ptr Build(std::vector<ASTNode::Ptr>& operands, size_t begin, size_t end, BinOpNode::Operator op)
+{
+	if (end - begin == 1)
+	{
+		return std::move(operands[begin]);
+	}
+	const size_t middle = begin + (end - begin + 1) / 2;
+	auto left = Build(operands, begin, middle, op);
+	auto right = Build(operands, middle, end, op);
+	return std::make_unique<BinOpNode>(std::move(left), std::move(right), op);
+}
+}
+
+void Reassociation::Run(ProgramNode& program)
+{
+	program.Accept(*this);
+}
+
+const Reassociation::Stats& Reassociation::GetStats()const
+{
+	return m_stats;
+}
+
+void Reassociation::PrintStats(std::ostream& out)const
+{
+	out << "reassociated chains: " << m_stats.chains << ", " << m_stats.operands << " operands" << std::endl;
+	out << "deepest chain: " << m_stats.depthBefore << " levels before, "
+		<< m_stats.depthAfter << " after" << std::endl;
+}
+
+void Reassociation::Visit(const BinOpNode& node)
+{
+	// Left operands Balance would just visit are walked in a loop: a chain
+	// mixing '+' and '-' is none to rebalance and as deep as it is long.
+	// The tree has been passed to Run as mutable, visitors just see it const
+	std::vector<BinOpNode*> chain{ const_cast<BinOpNode*>(&node) };
+	for (const BinOpNode* left = node.GetLeft().AsBinOp(); left && !(m_rewrite && FindUnbalanced(*left).operands);
+		left = left->GetLeft().AsBinOp())
+	{
+		chain.push_back(const_cast<BinOpNode*>(left));
+	}
+	BinOpNode& innermost = *chain.back();
+	Balance(innermost.GetLeft(), [&innermost](ASTNode::Ptr&& operand) { return innermost.ReplaceLeft(std::move(operand)); });
+	for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+	{
+		BinOpNode& binop = **it;
+		Balance(binop.GetRight(), [&binop](ASTNode::Ptr&& operand) { return binop.ReplaceRight(std::move(operand)); });
+	}
+}
+
+void Reassociation::Visit(const LeafNumNode& num)
+{
+	(void)num;
+}
+
+void Reassociation::Visit(const UnOpNode& node)
+{
+	UnOpNode& unop = const_cast<UnOpNode&>(node);
+	Balance(unop.GetExpression(), [&unop](ASTNode::Ptr&& operand) { return unop.ReplaceExpression(std::move(operand)); });
+}
+
+void Reassociation::Visit(const LeafVarNode& var)
+{
+	(void)var;
+}
+
+void Reassociation::Visit(const LeafInvariantNode& invariant)
+{
+	// Made by LoopOptimizer, which runs later
+	(void)invariant;
+}
+
+void Reassociation::Visit(const InductionNode& induction)
+{
+	(void)induction;
+}
+
+void Reassociation::Visit(const RandomNode& random)
+{
+	(void)random;
+}
+
+void Reassociation::Visit(const LeafNopNode& nop)
+{
+	(void)nop;
+}
+
+void Reassociation::Visit(const AssignNode& node)
+{
+	AssignNode& assign = const_cast<AssignNode&>(node);
+	m_rewrite = m_exact.count(boost::algorithm::to_lower_copy(assign.GetLeft())) == 0;
+	Balance(assign.GetRight(), [&assign](ASTNode::Ptr&& right) { return assign.ReplaceRight(std::move(right)); });
+	m_rewrite = true;
+}
+
+void Reassociation::Visit(const CompoundNode& compound)
+{
+	for (const auto& child : compound.GetChildren())
+	{
+		child->Accept(*this);
+	}
+}
+
+void Reassociation::Visit(const ForNode& node)
+{
+	// Bounds are evaluated by the double engine
+	ForNode& loop = const_cast<ForNode&>(node);
+	Balance(loop.GetStart(), [&loop](ASTNode::Ptr&& bound) { return loop.ReplaceStart(std::move(bound)); });
+	Balance(loop.GetEnd(), [&loop](ASTNode::Ptr&& bound) { return loop.ReplaceEnd(std::move(bound)); });
+	loop.GetBody().Accept(*this);
+}
+
+void Reassociation::Visit(const TypeNode& type)
+{
+	(void)type;
+}
+
+void Reassociation::Visit(const VarDeclNode& vardecl)
+{
+	const TypeNode::Type type = vardecl.GetTypeNode().GetType();
+	if (type != TypeNode::Decimal && type != TypeNode::BigInt)
+	{
+		return;
+	}
+	for (const auto& var : vardecl.GetVariables())
+	{
+		m_exact.insert(boost::algorithm::to_lower_copy(var->GetName()));
+	}
+}
+
+void Reassociation::Visit(const BlockNode& block)
+{
+	for (const auto& declaration : block.GetDeclarations())
+	{
+		Visit(*declaration);
+	}
+	Visit(block.GetCompound());
+}
+
+void Reassociation::Visit(const ProgramNode& program)
+{
+	Visit(program.GetBlock());
+}
+
+void Reassociation::BalanceOperand(ASTNode::Ptr& operand)
+{
+	Balance(*operand, [&operand](ASTNode::Ptr&& replacement) {
+		std::swap(operand, replacement);
+		return std::move(replacement);
+	});
+}
+
+template <typename Replace>
+void Reassociation::Balance(const ASTNode& expression, Replace&& replace)
+{
+	const Chain chain = m_rewrite ? FindUnbalanced(expression) : Chain{};
+	if (!chain.operands)
+	{
+		expression.Accept(*this);
+		return;
+	}
+	const BinOpNode::Operator op = expression.AsBinOp()->GetOperator();
+	const size_t depth = GetBalancedDepth(chain.operands);
+
+	// Takes the operands out in order, the operations of the chain are dropped
+	std::vector<ASTNode::Ptr> operands;
+	operands.reserve(chain.operands);
+	std::vector<ASTNode::Ptr> pending;
+	pending.push_back(replace(nullptr));
+	while (!pending.empty())
+	{
+		ASTNode::Ptr node = std::move(pending.back());
+		pending.pop_back();
+		if (AsLink(*node, op))
+		{
+			auto& link = static_cast<BinOpNode&>(*node);
+			pending.push_back(link.ReplaceRight(nullptr));
+			pending.push_back(link.ReplaceLeft(nullptr));
+			continue;
+		}
+		operands.push_back(std::move(node));
+	}
+	for (auto& operand : operands)
+	{
+		BalanceOperand(operand);
+	}
+
+	++m_stats.chains;
+	m_stats.operands += operands.size();
+	if (chain.depth > m_stats.depthBefore)
+	{
+		m_stats.depthBefore = chain.depth;
+		m_stats.depthAfter = depth;
+	}
+	replace(Build(operands, 0, operands.size(), op));
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "AST.h"
+#include <iosfwd>
+#include <unordered_set>
+
+// Rebalances chains of '+' and of '*', which the parser builds left-deep,
+// into balanced trees: a + b + c + d becomes (a + b) + (c + d). Operands keep
+// their order, so the first undefined variable read is the same, but sums
+// and products of REALs are rounded differently, hence the pass only runs
+// on request (--fast-math). Independent halves of a chain no longer wait for
+// each other.
+// Only expressions evaluated by the double engine are rewritten, DECIMAL and
+// BIGINT assignments keep theirs. Run it before LoopOptimizer and RangeAnalysis.
+class Reassociation : public IASTNodeVisitor
+{
+public:
+	struct Stats
+	{
+		size_t chains = 0; // rebalanced ones
+		size_t operands = 0;
+		// Levels of the deepest rebalanced chain
+		size_t depthBefore = 0;
+		size_t depthAfter = 0;
+	};
+
+	void Run(ProgramNode& program);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+	void Visit(const BinOpNode& binop) override;
+	void Visit(const LeafNumNode& num) override;
+	void Visit(const UnOpNode& unop) override;
+	void Visit(const LeafVarNode& var) override;
+	void Visit(const LeafInvariantNode& invariant) override;
+	void Visit(const InductionNode& induction) override;
+	void Visit(const RandomNode& random) override;
+	void Visit(const LeafNopNode& nop) override;
+	void Visit(const AssignNode& assign) override;
+	void Visit(const CompoundNode& compound) override;
+	void Visit(const ForNode& loop) override;
+	void Visit(const TypeNode& type) override;
+	void Visit(const VarDeclNode& vardecl) override;
+	void Visit(const BlockNode& block) override;
+	void Visit(const ProgramNode& program) override;
+
+private:
+	// Rebalances the chain rooted at the expression, or visits it when it is
+	// not a chain worth it; 'replace' swaps the expression in its parent and
+	// returns the previous one
+	template <typename Replace>
+	void Balance(const ASTNode& expression, Replace&& replace);
+	// Same for an operand taken out of a chain
+	void BalanceOperand(ASTNode::Ptr& operand);
+
+private:
+	bool m_rewrite = true;
+	std::unordered_set<std::string> m_exact;
+	Stats m_stats;
+};
@@ -0,0 +1,194 @@
+#include "Statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+const double GAMMA = (1 + QuantileSketch::ACCURACY) / (1 - QuantileSketch::ACCURACY);
+const double LOG_GAMMA = std::log(GAMMA);
+}
+
+void QuantileSketch::Add(double value)
+{
+	if (!std::isfinite(value))
+	{
+		return;
+	}
+	if (value > 0)
+	{
+		m_positive.Add(GetIndex(value), 1);
+	}
+	else if (value < 0)
+	{
+		m_negative.Add(GetIndex(-value), 1);
+	}
+	else
+	{
+		++m_zeros;
+	}
+}
+
+void QuantileSketch::Merge(const QuantileSketch& other)
+{
+	m_positive.Merge(other.m_positive);
+	m_negative.Merge(other.m_negative);
+	m_zeros += other.m_zeros;
+}
+
+uint64_t QuantileSketch::GetCount()const
+{
+	return m_positive.total + m_negative.total + m_zeros;
+}
+
+double QuantileSketch::GetQuantile(double q)const
+{
+	const uint64_t count = GetCount();
+	if (count == 0)
+	{
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	const double rank = std::clamp(q, 0.0, 1.0) * static_cast<double>(count - 1);
+	double seen = 0;
+	// Most negative first
+	for (size_t i = m_negative.counts.size(); i-- > 0;)
+	{
+		seen += static_cast<double>(m_negative.counts[i]);
+		if (seen > rank)
+		{
+			return -GetValue(m_negative.offset + static_cast<int32_t>(i));
+		}
+	}
+	seen += static_cast<double>(m_zeros);
+	if (seen > rank)
+	{
+		return 0;
+	}
+	for (size_t i = 0; i < m_positive.counts.size(); ++i)
+	{
+		seen += static_cast<double>(m_positive.counts[i]);
+		if (seen > rank)
+		{
+			return GetValue(m_positive.offset + static_cast<int32_t>(i));
+		}
+	}
+	return GetValue(m_positive.offset + static_cast<int32_t>(m_positive.counts.size()) - 1);
+}
+
+void QuantileSketch::Store::Add(int32_t index, uint64_t count)
+{
+	total += count;
+	if (counts.empty())
+	{
+		offset = index;
+		counts.assign(1, count);
+		return;
+	}
+	const int32_t high = offset + static_cast<int32_t>(counts.size()) - 1;
+	if (index > high)
+	{
+		Resize(std::max(offset, index - MAX_BUCKETS + 1), index);
+	}
+	else if (index < offset)
+	{
+		Resize(std::max(index, high - MAX_BUCKETS + 1), high);
+	}
+	counts[std::max(index, offset) - offset] += count;
+}
+
+void QuantileSketch::Store::Merge(const Store& other)
+{
+	for (size_t i = 0; i < other.counts.size(); ++i)
+	{
+		if (other.counts[i])
+		{
+			Add(other.offset + static_cast<int32_t>(i), other.counts[i]);
+		}
+	}
+}
+
+void QuantileSketch::Store::Resize(int32_t low, int32_t high)
+{
+	std::vector<uint64_t> resized(static_cast<size_t>(high - low) + 1);
+	for (size_t i = 0; i < counts.size(); ++i)
+	{
+		resized[std::max(offset + static_cast<int32_t>(i), low) - low] += counts[i];
+	}
+	counts.swap(resized);
+	offset = low;
+}
+
+int32_t QuantileSketch::GetIndex(double magnitude)
+{
+	return static_cast<int32_t>(std::ceil(std::log(magnitude) / LOG_GAMMA));
+}
+
+double QuantileSketch::GetValue(int32_t index)
+{
+	// Within ACCURACY of both ends of the bucket (gamma^(index - 1), gamma^index]
+	return 2 * std::pow(GAMMA, index) / (GAMMA + 1);
+}
+
+void RunningStatistics::Add(double value)
+{
+	++m_count;
+	const double delta = value - m_mean;
+	m_mean += delta / static_cast<double>(m_count);
+	m_m2 += delta * (value - m_mean);
+	m_min = m_count == 1 ? value : std::min(m_min, value);
+	m_max = m_count == 1 ? value : std::max(m_max, value);
+	m_sketch.Add(value);
+}
+
+void RunningStatistics::Merge(const RunningStatistics& other)
+{
+	if (other.m_count == 0)
+	{
+		return;
+	}
+	if (m_count == 0)
+	{
+		*this = other;
+		return;
+	}
+	const double count = static_cast<double>(m_count + other.m_count);
+	const double delta = other.m_mean - m_mean;
+	m_mean += delta * static_cast<double>(other.m_count) / count;
+	m_m2 += other.m_m2 + delta * delta * static_cast<double>(m_count) * static_cast<double>(other.m_count) / count;
+	m_count += other.m_count;
+	m_min = std::min(m_min, other.m_min);
+	m_max = std::max(m_max, other.m_max);
+	m_sketch.Merge(other.m_sketch);
+}
+
+uint64_t RunningStatistics::GetCount()const
+{
+	return m_count;
+}
+
+double RunningStatistics::GetMean()const
+{
+	return m_mean;
+}
+
+double RunningStatistics::GetVariance()const
+{
+	return m_count > 1 ? m_m2 / static_cast<double>(m_count - 1) : 0;
+}
+
+double RunningStatistics::GetMin()const
+{
+	return m_min;
+}
+
+double RunningStatistics::GetMax()const
+{
+	return m_max;
+}
+
+double RunningStatistics::GetQuantile(double q)const
+{
+	// Bucket values may lie past the extremes
+	const double value = m_sketch.GetQuantile(q);
+	return std::isnan(value) ? value : std::min(std::max(value, m_min), m_max);
+}
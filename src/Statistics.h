@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Mergeable quantile sketch with relative error (Masson et al., "DDSketch"):
+// a value v is counted in the bucket ceil(log_gamma |v|), so every quantile
+// is within ACCURACY of a value it summarizes. Memory is bounded by
+// MAX_BUCKETS per sign; past that the buckets of the smallest magnitudes
+// are collapsed. Counts are integers, so merging is exact and the result
+// does not depend on the order of merges.
+class QuantileSketch
+{
+public:
+	static constexpr double ACCURACY = 0.01;
+	static constexpr int32_t MAX_BUCKETS = 4096;
+
+	// Non-finite values are not counted
+	void Add(double value);
+	void Merge(const QuantileSketch& other);
+	uint64_t GetCount()const;
+	// q in [0, 1], NaN when nothing is counted
+	double GetQuantile(double q)const;
+
+private:
+	// Counts of consecutive bucket indices from 'offset' on
+	struct Store
+	{
+		std::vector<uint64_t> counts;
+		int32_t offset = 0;
+		uint64_t total = 0;
+
+		void Add(int32_t index, uint64_t count);
+		void Merge(const Store& other);
+		// Covers [low, high], lower indices are collapsed into low
+		void Resize(int32_t low, int32_t high);
+	};
+
+	static int32_t GetIndex(double magnitude);
+	static double GetValue(int32_t index);
+
+	Store m_positive;
+	// By magnitude
+	Store m_negative;
+	uint64_t m_zeros = 0;
+};
+
+// Count, mean, variance, extremes and quantiles of a stream of values in
+// constant memory. Moments are accumulated with Welford's update and merged
+// with the formulas of Chan et al., merging the same statistics in the same
+// order gives bit-identical results.
+class RunningStatistics
+{
+public:
+	void Add(double value);
+	void Merge(const RunningStatistics& other);
+
+	uint64_t GetCount()const;
+	double GetMean()const;
+	// Sample variance, 0 for fewer than two values
+	double GetVariance()const;
+	double GetMin()const;
+	double GetMax()const;
+	// Of the finite values, see QuantileSketch
+	double GetQuantile(double q)const;
+
+private:
+	uint64_t m_count = 0;
+	double m_mean = 0;
+	double m_m2 = 0;
+	double m_min = 0;
+	double m_max = 0;
+	QuantileSketch m_sketch;
+};
@@ -0,0 +1,342 @@
+#include "Streaming.h"
+#include "Peephole.h"
+#include "VirtualMachine.h"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+// Returns as soon as anything is available, 0 at the end of the input
+long ReadSome(int input, char* buffer, size_t size)
+{
+#ifdef _WIN32
+	return _read(input, buffer, static_cast<unsigned>(size));
+#else
+	return static_cast<long>(read(input, buffer, size));
+#endif
+}
+
+bool IsBlank(char c)
+{
+	return c == ' ' || c == '\t';
+}
+
+const char* SkipBlanks(const char* p, const char* end)
+{
+	while (p != end && IsBlank(*p))
+	{
+		++p;
+	}
+	return p;
+}
+}
+
+RecordWriter::RecordWriter(std::FILE* out, size_t flushBytes, std::chrono::microseconds flushInterval)
+	: m_out(out)
+	, m_flushBytes(std::max<size_t>(flushBytes, 1))
+	, m_flushInterval(flushInterval)
+	, m_capacity(std::max<size_t>(m_flushBytes, 4096))
+{
+	m_buffer = std::make_unique<char[]>(m_capacity);
+}
+
+RecordWriter::~RecordWriter()
+{
+	try
+	{
+		Flush();
+	}
+	catch (const std::exception&)
+	{
+	}
+}
+
+char* RecordWriter::Reserve(size_t size)
+{
+	if (m_size + size > m_capacity)
+	{
+		Flush();
+		if (size > m_capacity)
+		{
+			throw std::length_error("output record is longer than the output buffer");
+		}
+	}
+	return m_buffer.get() + m_size;
+}
+
+void RecordWriter::Commit(size_t size, Clock::time_point now)
+{
+	if (m_size == 0)
+	{
+		m_oldest = now;
+	}
+	m_size += size;
+	if (m_size >= m_flushBytes || now - m_oldest >= m_flushInterval)
+	{
+		Flush();
+	}
+}
+
+void RecordWriter::Flush()
+{
+	if (m_size == 0)
+	{
+		return;
+	}
+	const size_t size = m_size;
+	m_size = 0;
+	++m_flushes;
+	if (std::fwrite(m_buffer.get(), 1, size, m_out) != size || std::fflush(m_out) != 0)
+	{
+		throw std::runtime_error("can't write the output");
+	}
+}
+
+uint64_t RecordWriter::GetFlushCount()const
+{
+	return m_flushes;
+}
+
+StreamingEvaluator::StreamingEvaluator(const ProgramNode& program, const std::vector<std::string>& inputs,
+	const std::vector<std::string>& outputs, Options options)
+	: m_program(program)
+	, m_inputs(inputs)
+	, m_options(options)
+	, m_inputValues(inputs.size())
+	, m_outputValues(outputs.size())
+	, m_buffer(std::make_unique<char[]>(BUFFER_SIZE + 1))
+{
+	try
+	{
+		m_code = std::make_unique<BytecodeProgram>(BytecodeCompiler().Compile(program));
+	}
+	catch (const std::runtime_error& ex)
+	{
+		throw std::runtime_error(std::string("streaming needs a program the bytecode can express: ") + ex.what());
+	}
+	PeepholeOptimizer(m_options.contract).Optimize(*m_code);
+	m_code->Assemble();
+	m_machine = std::make_unique<VirtualMachine>(*m_code);
+	for (const std::string& input : inputs)
+	{
+		m_inputIndices.push_back(m_code->FindVariable(input));
+	}
+	for (const std::string& output : outputs)
+	{
+		m_outputIndices.push_back(m_code->FindVariable(output));
+	}
+	if (m_options.format == Binary && inputs.empty())
+	{
+		throw std::invalid_argument("binary records need at least one input");
+	}
+}
+
+StreamingEvaluator::~StreamingEvaluator() = default;
+
+void StreamingEvaluator::Evaluate(const double* inputs, double* outputs)
+{
+	m_machine->Reset();
+	for (size_t i = 0; i < m_inputIndices.size(); ++i)
+	{
+		if (m_inputIndices[i] != BytecodeProgram::NO_VARIABLE)
+		{
+			m_machine->SetVariable(m_inputIndices[i], inputs[i]);
+		}
+	}
+	const RandomStream random(m_options.seed, m_stats.records);
+	m_machine->SetRandomStream(random);
+	if (m_options.floatingPointChecks)
+	{
+		std::feclearexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+	}
+	try
+	{
+		m_machine->Run();
+		if (m_options.floatingPointChecks && std::fetestexcept(ExpressionCalculator::FLOATING_POINT_ERRORS))
+		{
+			// Throws for the statement raising the exception
+			ExpressionCalculator calculator;
+			for (size_t i = 0; i < m_inputs.size(); ++i)
+			{
+				calculator.SetVariable(m_inputs[i], inputs[i]);
+			}
+			calculator.SetRandomStream(random);
+			calculator.SetFloatingPointChecks(true);
+			calculator.Calculate(m_program);
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		throw std::runtime_error("record " + std::to_string(m_stats.records + 1) + ": " + ex.what());
+	}
+	for (size_t i = 0; i < m_outputIndices.size(); ++i)
+	{
+		const std::optional<double> value = m_outputIndices[i] != BytecodeProgram::NO_VARIABLE
+			? m_machine->GetVariable(m_outputIndices[i])
+			: std::nullopt;
+		outputs[i] = value ? *value : std::nan("");
+	}
+	++m_stats.records;
+}
+
+size_t StreamingEvaluator::Consume(const char* data, size_t size, RecordWriter& writer)
+{
+	const char* const end = data + size;
+	const char* next = data;
+	// Records after the first were waiting in the buffer while the one before ran
+	auto start = RecordWriter::Clock::now();
+	for (;;)
+	{
+		const char* record = m_options.format == Text ? ParseText(next, end) : ParseBinary(next, end);
+		if (!record)
+		{
+			return static_cast<size_t>(next - data);
+		}
+		Evaluate(m_inputValues.data(), m_outputValues.data());
+		start = Write(writer, start);
+		next = record;
+	}
+}
+
+void StreamingEvaluator::Run(int input, RecordWriter& writer)
+{
+	char* const buffer = m_buffer.get();
+	size_t size = 0;
+	for (;;)
+	{
+		if (size == BUFFER_SIZE)
+		{
+			throw std::length_error("record " + std::to_string(m_stats.records + 1) + " is longer than the input buffer");
+		}
+		writer.Flush();
+		const long count = ReadSome(input, buffer + size, BUFFER_SIZE - size);
+		if (count < 0)
+		{
+			throw std::runtime_error("can't read the input");
+		}
+		if (count == 0)
+		{
+			break;
+		}
+		size += static_cast<size_t>(count);
+		const size_t consumed = Consume(buffer, size, writer);
+		std::memmove(buffer, buffer + consumed, size - consumed);
+		size -= consumed;
+	}
+	if (size && m_options.format == Text)
+	{
+		// The last line has no end, the buffer has room for one
+		buffer[size++] = '\n';
+		size -= Consume(buffer, size, writer);
+	}
+	if (size)
+	{
+		throw std::runtime_error("the input ends in the middle of record " + std::to_string(m_stats.records + 1));
+	}
+	writer.Flush();
+	m_stats.flushes = writer.GetFlushCount();
+}
+
+const StreamingEvaluator::Stats& StreamingEvaluator::GetStats()const
+{
+	return m_stats;
+}
+
+void StreamingEvaluator::PrintStats(std::ostream& out)const
+{
+	out << "records: " << m_stats.records << ", flushes: " << m_stats.flushes << std::endl;
+	out << "latency: mean " << (m_stats.records ? m_stats.seconds / static_cast<double>(m_stats.records) * 1e6 : 0)
+		<< " us, max " << m_stats.maxLatency * 1e6 << " us" << std::endl;
+}
+
+const char* StreamingEvaluator::ParseText(const char* data, const char* end)
+{
+	const char* newline = static_cast<const char*>(std::memchr(data, '\n', static_cast<size_t>(end - data)));
+	if (!newline)
+	{
+		return nullptr;
+	}
+	const char* lineEnd = newline != data && newline[-1] == '\r' ? newline - 1 : newline;
+	const char delimiter = m_options.delimiter;
+	const char* p = data;
+	size_t fields = 0;
+	for (; fields < m_inputValues.size(); ++fields)
+	{
+		p = SkipBlanks(p, lineEnd);
+		if (p == lineEnd)
+		{
+			break;
+		}
+		const std::from_chars_result parsed = std::from_chars(p, lineEnd, m_inputValues[fields]);
+		if (parsed.ec != std::errc())
+		{
+			throw std::invalid_argument("record " + std::to_string(m_stats.records + 1) + ": field "
+				+ std::to_string(fields + 1) + " is not a number");
+		}
+		p = SkipBlanks(parsed.ptr, lineEnd);
+		if (fields + 1 < m_inputValues.size() && !IsBlank(delimiter))
+		{
+			if (p == lineEnd || *p != delimiter)
+			{
+				++fields;
+				break;
+			}
+			++p;
+		}
+	}
+	if (fields != m_inputValues.size() || p != lineEnd)
+	{
+		throw std::invalid_argument("record " + std::to_string(m_stats.records + 1) + ": expected "
+			+ std::to_string(m_inputValues.size()) + " fields");
+	}
+	return newline + 1;
+}
+
+const char* StreamingEvaluator::ParseBinary(const char* data, const char* end)
+{
+	const size_t size = m_inputValues.size() * sizeof(double);
+	if (static_cast<size_t>(end - data) < size)
+	{
+		return nullptr;
+	}
+	std::memcpy(m_inputValues.data(), data, size);
+	return data + size;
+}
+
+RecordWriter::Clock::time_point StreamingEvaluator::Write(RecordWriter& writer, RecordWriter::Clock::time_point start)
+{
+	size_t size = 0;
+	if (m_options.format == Binary)
+	{
+		size = m_outputValues.size() * sizeof(double);
+		std::memcpy(writer.Reserve(size), m_outputValues.data(), size);
+	}
+	else
+	{
+		char* const out = writer.Reserve(m_outputValues.size() * (MAX_FIELD + 1) + 1);
+		char* p = out;
+		for (size_t i = 0; i < m_outputValues.size(); ++i)
+		{
+			if (i)
+			{
+				*p++ = m_options.delimiter;
+			}
+			p = std::to_chars(p, p + MAX_FIELD, m_outputValues[i]).ptr;
+		}
+		*p++ = '\n';
+		size = static_cast<size_t>(p - out);
+	}
+	const auto now = RecordWriter::Clock::now();
+	writer.Commit(size, now);
+	const double latency = std::chrono::duration<double>(now - start).count();
+	m_stats.seconds += latency;
+	m_stats.maxLatency = std::max(m_stats.maxLatency, latency);
+	return now;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "Bytecode.h"
+#include <chrono>
+#include <cstdio>
+#include <iosfwd>
+
+class VirtualMachine;
+
+// Output of StreamingEvaluator, kept in a buffer allocated once and written
+// when it holds 'flushBytes' or its oldest record has waited 'flushInterval'
+class RecordWriter
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	explicit RecordWriter(std::FILE* out, size_t flushBytes = 64 * 1024,
+		std::chrono::microseconds flushInterval = std::chrono::microseconds(1000));
+	~RecordWriter();
+
+	RecordWriter(const RecordWriter&) = delete;
+	RecordWriter& operator=(const RecordWriter&) = delete;
+
+	// Room for 'size' bytes, flushes first when the buffer has less
+	char* Reserve(size_t size);
+	// Ends a record of 'size' bytes written at Reserve, at time 'now'
+	void Commit(size_t size, Clock::time_point now);
+	// Writes what is buffered, if anything
+	void Flush();
+	uint64_t GetFlushCount()const;
+
+private:
+	std::FILE* m_out;
+	size_t m_flushBytes;
+	Clock::duration m_flushInterval;
+	std::unique_ptr<char[]> m_buffer;
+	size_t m_capacity;
+	size_t m_size = 0;
+	Clock::time_point m_oldest;
+	uint64_t m_flushes = 0;
+};
+
+// Evaluates a program once per record of a stream, for event-driven use
+// where each record has to be answered as soon as it arrives. A record sets
+// the input variables, the program runs, and the outputs are written as one
+// record. The program is compiled to bytecode once and runs in one
+// VirtualMachine whose frame is reused, records are parsed in place in a
+// fixed buffer, so nothing is allocated per record.
+// Text records are lines of fields separated by the delimiter, read with
+// from_chars and written with to_chars; blanks around fields are skipped,
+// a blank delimiter takes runs of blanks. Binary records are the doubles of
+// the inputs, then of the outputs, in host byte order. An output the record
+// leaves unassigned is NaN. Record n draws RANDOM from stream n of the seed.
+class StreamingEvaluator
+{
+public:
+	enum Format
+	{
+		Text,
+		Binary
+	};
+
+	struct Options
+	{
+		Format format = Text;
+		char delimiter = ',';
+		uint64_t seed = 0;
+		// See ExpressionCalculator::SetFloatingPointChecks. Bytecode tests
+		// the flags after every record, a record raising one is run again in
+		// the tree walker to report the statement
+		bool floatingPointChecks = false;
+		// Fuses multiply-add in the bytecode, see PeepholeOptimizer
+		bool contract = false;
+	};
+
+	struct Stats
+	{
+		uint64_t records = 0;
+		// From the start of parsing a record to its output being buffered
+		double seconds = 0;
+		double maxLatency = 0;
+		uint64_t flushes = 0;
+	};
+
+	// The program has to be expressible in bytecode and, with the
+	// floating-point checks, outlive the evaluator
+	StreamingEvaluator(const ProgramNode& program, const std::vector<std::string>& inputs,
+		const std::vector<std::string>& outputs, Options options);
+	~StreamingEvaluator();
+
+	// One record: values of the inputs and of the outputs in their order
+	void Evaluate(const double* inputs, double* outputs);
+	// Evaluates the complete records at the start of 'data', returns the bytes they take
+	size_t Consume(const char* data, size_t size, RecordWriter& writer);
+	// Evaluates the records of the file descriptor until its end. Output left
+	// once the records read are evaluated is flushed before waiting for more
+	void Run(int input, RecordWriter& writer);
+	const Stats& GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+private:
+	static constexpr size_t BUFFER_SIZE = 64 * 1024;
+	// Longest to_chars output of a double
+	static constexpr size_t MAX_FIELD = 32;
+
+	// Ends of the records, null for an incomplete one
+	const char* ParseText(const char* data, const char* end);
+	const char* ParseBinary(const char* data, const char* end);
+	// Returns the time the record is buffered
+	RecordWriter::Clock::time_point Write(RecordWriter& writer, RecordWriter::Clock::time_point start);
+
+	const ProgramNode& m_program;
+	std::vector<std::string> m_inputs;
+	Options m_options;
+	std::unique_ptr<BytecodeProgram> m_code;
+	std::unique_ptr<VirtualMachine> m_machine;
+	std::vector<uint32_t> m_inputIndices;
+	std::vector<uint32_t> m_outputIndices;
+	// Frame of the record being evaluated
+	std::vector<double> m_inputValues;
+	std::vector<double> m_outputValues;
+	std::unique_ptr<char[]> m_buffer;
+	Stats m_stats;
+};
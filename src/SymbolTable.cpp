@@ -0,0 +1,144 @@
+#include "SymbolTable.h"
+#include <boost/algorithm/string.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+struct Entry
+{
+	std::string name;
+	SymbolTable::Id folded;
+};
+
+// Entries are kept in chunks that never move, so a reader holding an id
+// finds its entry without the lock. Chunk k holds FIRST_CHUNK << k entries,
+// the entry of id i is at i + FIRST_CHUNK - (FIRST_CHUNK << k) in chunk k
+constexpr uint32_t FIRST_CHUNK_BITS = 4;
+constexpr uint32_t FIRST_CHUNK = 1u << FIRST_CHUNK_BITS;
+constexpr uint32_t CHUNKS = 32 - FIRST_CHUNK_BITS;
+
+struct Storage
+{
+	std::mutex mutex;
+	std::unique_ptr<Entry[]> chunks[CHUNKS];
+	// Written under the lock once the entry is complete
+	std::atomic<uint32_t> count{ 0 };
+	std::unordered_map<std::string_view, SymbolTable::Id> ids;
+};
+
+Storage& GetStorage()
+{
+	static Storage storage;
+	return storage;
+}
+
+uint32_t HighestBit(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return 31 - static_cast<uint32_t>(__builtin_clz(value));
+#else
+	uint32_t bit = 0;
+	while (value >>= 1)
+	{
+		++bit;
+	}
+	return bit;
+#endif
+}
+
+Entry& GetEntry(Storage& storage, SymbolTable::Id id)
+{
+	const uint32_t index = id + FIRST_CHUNK;
+	const uint32_t chunk = HighestBit(index) - FIRST_CHUNK_BITS;
+	return storage.chunks[chunk][index - (FIRST_CHUNK << chunk)];
+}
+
+// With the lock held
+SymbolTable::Id InternLocked(Storage& storage, const std::string& name)
+{
+	auto it = storage.ids.find(name);
+	if (it != storage.ids.end())
+	{
+		return it->second;
+	}
+	const std::string lower = boost::algorithm::to_lower_copy(name);
+	const SymbolTable::Id folded = lower == name ? storage.count.load(std::memory_order_relaxed) : InternLocked(storage, lower);
+
+	const SymbolTable::Id id = storage.count.load(std::memory_order_relaxed);
+	if (id > UINT32_MAX - FIRST_CHUNK)
+	{
+		throw std::length_error("too many identifiers");
+	}
+	const uint32_t chunk = HighestBit(id + FIRST_CHUNK) - FIRST_CHUNK_BITS;
+	if (!storage.chunks[chunk])
+	{
+		storage.chunks[chunk] = std::make_unique<Entry[]>(size_t(FIRST_CHUNK) << chunk);
+	}
+	Entry& entry = GetEntry(storage, id);
+	entry = { name, folded };
+	storage.ids.emplace(entry.name, id);
+	storage.count.store(id + 1, std::memory_order_release);
+	return id;
+}
+}
+
+SymbolTable::Id SymbolTable::Intern(const std::string& name)
+{
+	auto& storage = GetStorage();
+	std::lock_guard lock(storage.mutex);
+	return InternLocked(storage, name);
+}
+
+const std::string& SymbolTable::GetName(Id id)
+{
+	auto& storage = GetStorage();
+	if (id >= storage.count.load(std::memory_order_acquire))
+	{
+		throw std::out_of_range("unknown symbol id");
+	}
+	return GetEntry(storage, id).name;
+}
+
+SymbolTable::Id SymbolTable::GetFoldedId(Id id)
+{
+	auto& storage = GetStorage();
+	if (id >= storage.count.load(std::memory_order_acquire))
+	{
+		throw std::out_of_range("unknown symbol id");
+	}
+	return GetEntry(storage, id).folded;
+}
+
+SymbolTable::Id SymbolTable::InternFolded(const std::string& name)
+{
+	return GetFoldedId(Intern(name));
+}
+
+size_t SymbolTable::GetCount()
+{
+	auto& storage = GetStorage();
+	std::lock_guard lock(storage.mutex);
+	return storage.count;
+}
+
+size_t SymbolTable::GetMemoryUsage()
+{
+	auto& storage = GetStorage();
+	std::lock_guard lock(storage.mutex);
+	size_t bytes = 0;
+	for (uint32_t chunk = 0; chunk < CHUNKS && storage.chunks[chunk]; ++chunk)
+	{
+		bytes += (size_t(FIRST_CHUNK) << chunk) * sizeof(Entry);
+	}
+	for (Id id = 0; id < storage.count; ++id)
+	{
+		const std::string& name = GetEntry(storage, id).name;
+		bytes += name.capacity() > std::string().capacity() ? name.capacity() + 1 : 0;
+	}
+	return bytes + storage.ids.size() * (sizeof(std::string_view) + sizeof(Id) + sizeof(void*));
+}
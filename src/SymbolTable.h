@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+#include <cstdint>
+
+// Process-wide table of identifier spellings. AST nodes keep 32-bit ids
+// instead of their own copies of the names. Every spelling also has the id
+// of its lowercase form, so engines key case-insensitive scopes by id.
+// Interning takes a lock, ids are only appended and reading them does not.
+class SymbolTable
+{
+public:
+	using Id = uint32_t;
+
+	static Id Intern(const std::string& name);
+	static const std::string& GetName(Id id);
+	// Id of the lowercase spelling, equal for names differing only in case
+	static Id GetFoldedId(Id id);
+	// GetFoldedId(Intern(name))
+	static Id InternFolded(const std::string& name);
+
+	static size_t GetCount();
+	static size_t GetMemoryUsage();
+};
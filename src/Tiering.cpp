@@ -0,0 +1,176 @@
+#include "Tiering.h"
+#include "OnStackReplacement.h"
+#include "Peephole.h"
+#include "VirtualMachine.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+TieredExecutor::TieredExecutor()
+	: TieredExecutor(Thresholds())
+{
+}
+
+TieredExecutor::TieredExecutor(Thresholds thresholds)
+	: m_thresholds(thresholds)
+{
+}
+
+TieredExecutor::~TieredExecutor()
+{
+	Wait();
+}
+
+size_t TieredExecutor::Load(std::unique_ptr<ProgramNode>&& program, uint64_t* coverage)
+{
+	auto loaded = std::make_unique<Program>();
+	loaded->tree = std::move(program);
+	loaded->coverage = coverage;
+	m_programs.push_back(std::move(loaded));
+	return m_programs.size() - 1;
+}
+
+void TieredExecutor::SetRandomSeed(uint64_t seed)
+{
+	m_seed = seed;
+}
+
+void TieredExecutor::SetFloatingPointChecks(bool checks)
+{
+	m_floatingPointChecks = checks;
+}
+
+void TieredExecutor::SetContraction(bool contract)
+{
+	m_contract = contract;
+}
+
+std::map<std::string, double> TieredExecutor::Run(size_t index)
+{
+	Program& program = *m_programs.at(index);
+	const RandomStream random(m_seed, program.runs++);
+	if (const auto code = std::atomic_load(&program.code))
+	{
+		VirtualMachine machine(*code);
+		machine.SetRandomStream(random);
+		if (m_floatingPointChecks)
+		{
+			std::feclearexcept(ExpressionCalculator::FLOATING_POINT_ERRORS);
+		}
+		machine.Run();
+		if (!m_floatingPointChecks || !std::fetestexcept(ExpressionCalculator::FLOATING_POINT_ERRORS))
+		{
+			if (program.coverage)
+			{
+				machine.AddCoverage(program.coverage);
+			}
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_stats.bytecodeRuns;
+			return machine.GetScope();
+		}
+	}
+
+	OsrCalculator calculator(m_thresholds.loopIterations, m_contract);
+	calculator.SetRandomStream(random);
+	calculator.SetFloatingPointChecks(m_floatingPointChecks);
+	calculator.SetCoverageCounters(program.coverage);
+	auto account = [&]() {
+		program.loopIterations += calculator.GetLoopIterations();
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_stats.treeWalkerRuns;
+			m_stats.loopsReplacedOnStack += calculator.GetStats().replacements;
+		}
+		Promote(index);
+	};
+	try
+	{
+		calculator.Calculate(*program.tree);
+	}
+	catch (const std::exception&)
+	{
+		account();
+		throw;
+	}
+	account();
+	return calculator.GetScope();
+}
+
+TieredExecutor::Tier TieredExecutor::GetTier(size_t index)const
+{
+	return std::atomic_load(&m_programs.at(index)->code) ? Bytecode : TreeWalker;
+}
+
+void TieredExecutor::Wait()
+{
+	for (const auto& program : m_programs)
+	{
+		if (program->compilation.valid())
+		{
+			program->compilation.wait();
+		}
+	}
+}
+
+TieredExecutor::Stats TieredExecutor::GetStats()const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+void TieredExecutor::PrintStats(std::ostream& out)const
+{
+	const Stats stats = GetStats();
+	out << "runs: " << stats.treeWalkerRuns << " tree walker, " << stats.bytecodeRuns << " bytecode" << std::endl;
+	out << "promotions: " << stats.promotions << ", compile failures " << stats.compileFailures << std::endl;
+	out << "loops replaced on stack: " << stats.loopsReplacedOnStack << std::endl;
+	for (const std::string& line : stats.log)
+	{
+		out << "  " << line << std::endl;
+	}
+}
+
+void TieredExecutor::Promote(size_t index)
+{
+	Program& program = *m_programs[index];
+	if (program.promoted ||
+		(program.runs < m_thresholds.runs && program.loopIterations < m_thresholds.loopIterations))
+	{
+		return;
+	}
+	program.promoted = true;
+
+	std::ostringstream reason;
+	reason << "program " << index << " after " << program.runs << " runs, "
+		<< program.loopIterations << " loop iterations";
+	// The tree is only read from now on, by the compiler and the tree walker alike
+	Program* target = &program;
+	program.compilation = std::async(std::launch::async, [this, target, contract = m_contract, reason = reason.str()]() {
+		const auto start = std::chrono::steady_clock::now();
+		try
+		{
+			BytecodeCompiler compiler;
+			compiler.SetCoverage(target->coverage != nullptr);
+			auto code = std::make_shared<BytecodeProgram>(compiler.Compile(*target->tree));
+			PeepholeOptimizer(contract).Optimize(*code);
+			code->Assemble();
+			std::atomic_store(&target->code, std::shared_ptr<const BytecodeProgram>(std::move(code)));
+		}
+		catch (const std::exception& ex)
+		{
+			Log(reason + ": stays in the tree walker, " + ex.what(), false);
+			return;
+		}
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		std::ostringstream line;
+		line << reason << ": bytecode, compiled in " << elapsed.count() << " ms";
+		Log(line.str(), true);
+	});
+}
+
+void TieredExecutor::Log(const std::string& line, bool compiled)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	++(compiled ? m_stats.promotions : m_stats.compileFailures);
+	m_stats.log.push_back(line);
+}
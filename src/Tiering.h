@@ -0,0 +1,96 @@
+#pragma once
+#include "Bytecode.h"
+#include <future>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+
+// Runs programs many times, each in the cheapest engine worth it. A program
+// starts in the tree walker, which costs nothing to prepare; once it has run
+// or iterated FOR bodies often enough, it is compiled to bytecode on a
+// background thread. The compiled code is published atomically and takes
+// over from the next run, the run in progress finishes in the tree walker.
+// A single long run is not stuck in the tree walker either: its loops are
+// replaced on stack (OsrCalculator) after the loop iteration threshold.
+// Both tiers compute the same values unless contraction is set, and
+// programs the bytecode can't express (DECIMAL, BIGINT) stay in the tree
+// walker.
+// RANDOM draws of run n of a program come from stream n - 1 of the seed,
+// whichever tier runs it.
+class TieredExecutor
+{
+public:
+	enum Tier
+	{
+		TreeWalker,
+		Bytecode
+	};
+
+	// A program is promoted when it reaches either of them
+	struct Thresholds
+	{
+		uint64_t runs = 10;
+		uint64_t loopIterations = 100000;
+	};
+
+	struct Stats
+	{
+		uint64_t treeWalkerRuns = 0;
+		uint64_t bytecodeRuns = 0;
+		size_t promotions = 0;
+		size_t compileFailures = 0;
+		size_t loopsReplacedOnStack = 0;
+		// One line per promotion or failed compilation
+		std::vector<std::string> log;
+	};
+
+	TieredExecutor();
+	explicit TieredExecutor(Thresholds thresholds);
+	~TieredExecutor();
+
+	// Takes a parsed and optimized program, returns its handle. Every run of
+	// a program instrumented by StatementCoverage adds to its 'coverage'
+	size_t Load(std::unique_ptr<ProgramNode>&& program, uint64_t* coverage = nullptr);
+	// Seed of the streams of RANDOM, 0 by default
+	void SetRandomSeed(uint64_t seed);
+	// See ExpressionCalculator::SetFloatingPointChecks. Bytecode runs test
+	// the flags once at the end, a run raising one is repeated in the tree
+	// walker to report the statement
+	void SetFloatingPointChecks(bool checks);
+	// Fuses multiply-add in the bytecode, which then may round differently
+	// from the tree walker, see PeepholeOptimizer. Off by default
+	void SetContraction(bool contract);
+	// Runs the program once and returns its variables
+	std::map<std::string, double> Run(size_t program);
+	Tier GetTier(size_t program)const;
+	// Blocks until background compilations finish
+	void Wait();
+	Stats GetStats()const;
+	void PrintStats(std::ostream& out)const;
+
+private:
+	struct Program
+	{
+		std::unique_ptr<ProgramNode> tree;
+		uint64_t* coverage = nullptr;
+		uint64_t runs = 0;
+		uint64_t loopIterations = 0;
+		bool promoted = false; // compilation has started
+		// Null until compiled, read and published with atomic_load/atomic_store
+		std::shared_ptr<const BytecodeProgram> code;
+		std::future<void> compilation;
+	};
+
+	void Promote(size_t index);
+	void Log(const std::string& line, bool compiled);
+
+private:
+	Thresholds m_thresholds;
+	uint64_t m_seed = 0;
+	bool m_floatingPointChecks = false;
+	bool m_contract = false;
+	std::vector<std::unique_ptr<Program>> m_programs;
+	// Guards m_stats, compile threads report into it
+	mutable std::mutex m_mutex;
+	Stats m_stats;
+};
@@ -6,6 +6,7 @@ struct Token
 {
 	TokenType type;
 	std::optional<std::string> value;
+	size_t offset = 0; // position of the first character in the text
 };
 
 std::string ToString(const Token& token);
@@ -0,0 +1,96 @@
+#include "TokenDumper.h"
+#include <ostream>
+#include <cstring>
+
+TokenDumper::TokenDumper(std::ostream& out, Format format)
+	: mOut(out)
+	, mFormat(format)
+	, mBuffer(std::make_unique<char[]>(BUFFER_SIZE))
+{
+	if (mFormat == Binary)
+	{
+		Write("LSBT", 4);
+		Put(static_cast<char>(BINARY_VERSION));
+	}
+}
+
+TokenDumper::~TokenDumper()
+{
+	try
+	{
+		Flush();
+	}
+	catch (...)
+	{
+	}
+}
+
+void TokenDumper::Dump(const TokenView& token)
+{
+	const bool lexeme = !token.lexeme.empty();
+	if (mFormat == Binary)
+	{
+		Put(static_cast<char>(token.type));
+		PutVarint(token.offset - mLastOffset);
+		mLastOffset = token.offset;
+		if (lexeme)
+		{
+			PutVarint(token.lexeme.size());
+			Write(token.lexeme.data(), token.lexeme.size());
+		}
+		return;
+	}
+
+	const std::string_view name = GetTokenName(token.type);
+	Write("Token(", 6);
+	Write(name.data(), name.size());
+	if (lexeme)
+	{
+		Write(", ", 2);
+		Write(token.lexeme.data(), token.lexeme.size());
+	}
+	Write(")\n", 2);
+}
+
+void TokenDumper::Flush()
+{
+	mOut.write(mBuffer.get(), mSize);
+	mOut.flush();
+	mSize = 0;
+}
+
+void TokenDumper::Write(const char* data, size_t size)
+{
+	if (mSize + size > BUFFER_SIZE)
+	{
+		mOut.write(mBuffer.get(), mSize);
+		mSize = 0;
+		if (size > BUFFER_SIZE)
+		{
+			mOut.write(data, size);
+			return;
+		}
+	}
+	std::memcpy(mBuffer.get() + mSize, data, size);
+	mSize += size;
+}
+
+void TokenDumper::Put(char ch)
+{
+	if (mSize == BUFFER_SIZE)
+	{
+		mOut.write(mBuffer.get(), mSize);
+		mSize = 0;
+	}
+	mBuffer[mSize++] = ch;
+}
+
+void TokenDumper::PutVarint(uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		Put(static_cast<char>((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	Put(static_cast<char>(value));
+}
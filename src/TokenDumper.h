@@ -0,0 +1,48 @@
+#pragma once
+#include "Lexer.h"
+#include <iosfwd>
+#include <memory>
+#include <cstdint>
+
+// Writes lexer output for external tools through a single buffer.
+//
+// Text format is one "Token(Type[, value])" line per token, same as ToString.
+// Binary format starts with the "LSBT" magic and a version byte, then for
+// every token: type byte, varint offset delta from the previous token and,
+// for identifiers and constants, varint length followed by the lexeme.
+class TokenDumper
+{
+public:
+	enum Format
+	{
+		Text,
+		Binary
+	};
+
+	// Type bytes are TokenType values, the version changes with the enum
+	static constexpr unsigned char BINARY_VERSION = 5;
+
+	TokenDumper(std::ostream& out, Format format);
+	~TokenDumper();
+
+	TokenDumper(const TokenDumper&) = delete;
+	TokenDumper& operator=(const TokenDumper&) = delete;
+
+	// The lexeme is copied straight from the text, see Lexer::AdvanceView
+	void Dump(const TokenView& token);
+	void Flush();
+
+private:
+	void Write(const char* data, size_t size);
+	void Put(char ch);
+	void PutVarint(uint64_t value);
+
+private:
+	static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+	std::ostream& mOut;
+	Format mFormat;
+	std::unique_ptr<char[]> mBuffer;
+	size_t mSize = 0;
+	size_t mLastOffset = 0;
+};
@@ -0,0 +1,73 @@
+#include "TokenStream.h"
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+TokenStream::TokenStream(std::unique_ptr<Lexer>&& lexer)
+	: mLexer(std::move(lexer))
+{
+}
+
+TokenStream::TokenStream(const std::vector<Token>& tokens, size_t begin, size_t end)
+	: mTokens(&tokens)
+	, mNext(begin)
+	, mEnd(end)
+{
+	assert(begin <= end && end <= tokens.size());
+}
+
+const Token& TokenStream::Peek(size_t k)
+{
+	// Past the window the ring would wrap onto tokens not consumed yet
+	if (k >= MAX_LOOKAHEAD)
+	{
+		throw std::out_of_range("lookahead of " + std::to_string(k) + " tokens, at most "
+			+ std::to_string(MAX_LOOKAHEAD - 1) + " are buffered");
+	}
+	Fill(k + 1);
+	return mRing[(mHead + k) & (MAX_LOOKAHEAD - 1)];
+}
+
+void TokenStream::Advance()
+{
+	Fill(1);
+	mHead = (mHead + 1) & (MAX_LOOKAHEAD - 1);
+	--mCount;
+	++mPosition;
+}
+
+size_t TokenStream::GetPosition()const
+{
+	return mPosition;
+}
+
+TokenStream::Iterator TokenStream::begin()
+{
+	return Iterator(*this);
+}
+
+TokenStream::Sentinel TokenStream::end()const
+{
+	return {};
+}
+
+void TokenStream::Fill(size_t count)
+{
+	while (mCount < count)
+	{
+		Token& slot = mRing[(mHead + mCount) & (MAX_LOOKAHEAD - 1)];
+		if (mLexer)
+		{
+			slot = mLexer->Advance();
+		}
+		else if (mNext < mEnd)
+		{
+			slot = (*mTokens)[mNext++];
+		}
+		else
+		{
+			slot = Token{ TokenType::EndOfFile, std::nullopt, mNext < mTokens->size() ? (*mTokens)[mNext].offset : 0 };
+		}
+		++mCount;
+	}
+}
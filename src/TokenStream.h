@@ -0,0 +1,98 @@
+#pragma once
+#include "Lexer.h"
+#include <array>
+#include <memory>
+#include <vector>
+#include <iterator>
+
+// Pull-based view of the lexer output with a fixed-size lookahead window.
+// Tokens are lexed on demand into a ring buffer, so Peek(k) is O(1) and
+// returns a reference into the buffer instead of a copy. The reference
+// stays valid until the token is consumed by Advance().
+class TokenStream
+{
+public:
+	static constexpr size_t MAX_LOOKAHEAD = 4;
+
+	class Iterator;
+	struct Sentinel
+	{
+	};
+
+	explicit TokenStream(std::unique_ptr<Lexer>&& lexer);
+
+	// Replays already lexed tokens [begin, end), followed by EndOfFile
+	TokenStream(const std::vector<Token>& tokens, size_t begin, size_t end);
+
+	// Throws std::out_of_range for k >= MAX_LOOKAHEAD
+	const Token& Peek(size_t k = 0);
+	void Advance();
+
+	// Number of tokens consumed so far
+	size_t GetPosition()const;
+
+	// Range interface, yields tokens up to and including EndOfFile
+	Iterator begin();
+	Sentinel end()const;
+
+private:
+	void Fill(size_t count);
+
+private:
+	static_assert((MAX_LOOKAHEAD & (MAX_LOOKAHEAD - 1)) == 0, "lookahead must be a power of two");
+
+	std::unique_ptr<Lexer> mLexer;
+	const std::vector<Token>* mTokens = nullptr;
+	size_t mNext = 0;
+	size_t mEnd = 0;
+	std::array<Token, MAX_LOOKAHEAD> mRing;
+	size_t mHead = 0;
+	size_t mCount = 0;
+	size_t mPosition = 0;
+};
+
+class TokenStream::Iterator
+{
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = Token;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Token*;
+	using reference = const Token&;
+
+	explicit Iterator(TokenStream& stream)
+		: mStream(&stream)
+	{
+	}
+
+	const Token& operator*()const
+	{
+		return mStream->Peek();
+	}
+
+	const Token* operator->()const
+	{
+		return &mStream->Peek();
+	}
+
+	Iterator& operator++()
+	{
+		mDone = mStream->Peek().type == TokenType::EndOfFile;
+		mStream->Advance();
+		return *this;
+	}
+
+	bool operator==(Sentinel)const
+	{
+		return mDone;
+	}
+
+	bool operator!=(Sentinel sentinel)const
+	{
+		return !(*this == sentinel);
+	}
+
+private:
+	TokenStream* mStream;
+	bool mDone = false;
+};
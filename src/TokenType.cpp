@@ -1,51 +1,70 @@
 #include "TokenType.h"
-#include <unordered_map>
+#include <stdexcept>
 #include <cassert>
 
 namespace
 {
-const std::unordered_map<TokenType, std::string> TOKEN_KIND_MAP = {
+// Indexed by TokenType, must follow the order of the enum
+constexpr std::string_view TOKEN_NAMES[] = {
 	// keywords
-	{ TokenType::Program, "Program" },
-	{ TokenType::Var, "Var" },
-	{ TokenType::Begin, "Begin" },
-	{ TokenType::End, "End" },
-	{ TokenType::Integer, "Integer" },
-	{ TokenType::Real, "Real" },
-	{ TokenType::IntegerDiv, "Div" },
+	"Program",
+	"Var",
+	"Begin",
+	"End",
+	"Integer",
+	"Real",
+	"Decimal",
+	"BigInt",
+	"For",
+	"To",
+	"DownTo",
+	"Do",
+	"Div",
+	"Random",
+	"RandomNormal",
 
 	// mutable
-	{ TokenType::Identifier, "Identifier" },
-	{ TokenType::IntegerConstant, "IntegerConstant" },
-	{ TokenType::RealConstant, "RealConstant" },
+	"Identifier",
+	"IntegerConstant",
+	"RealConstant",
 
 	// separators
-	{ TokenType::Dot, "Dot" },
-	{ TokenType::Assign, "Assign" },
-	{ TokenType::Semicolon, "Semicolon" },
-	{ TokenType::LeftParen, "LeftParen" },
-	{ TokenType::RightParen, "RightParen" },
-	{ TokenType::Colon, "Colon" },
-	{ TokenType::Comma, "Comma" },
+	"Dot",
+	"Assign",
+	"Semicolon",
+	"LeftParen",
+	"RightParen",
+	"Colon",
+	"Comma",
 
 	// operators
-	{ TokenType::Plus, "Plus" },
-	{ TokenType::Minus, "Minus" },
-	{ TokenType::Mul, "Mul" },
-	{ TokenType::FloatDiv, "FloatDiv" },
+	"Plus",
+	"Minus",
+	"Mul",
+	"FloatDiv",
 
 	// meta
-	{ TokenType::EndOfFile, "EndOfFile" }
+	"EndOfFile"
 };
+
+constexpr size_t TOKEN_NAMES_COUNT = sizeof(TOKEN_NAMES) / sizeof(TOKEN_NAMES[0]);
+static_assert(TOKEN_NAMES_COUNT == static_cast<size_t>(TokenType::EndOfFile) + 1, "every token type must have a name");
+static_assert(TOKEN_NAMES[static_cast<size_t>(TokenType::IntegerDiv)] == "Div");
+static_assert(TOKEN_NAMES[static_cast<size_t>(TokenType::FloatDiv)] == "FloatDiv");
 }
 
-std::string ToString(TokenType type)
+std::string_view GetTokenName(TokenType type)
 {
-	auto it = TOKEN_KIND_MAP.find(type);
-	if (it != TOKEN_KIND_MAP.end())
+	const auto index = static_cast<size_t>(type);
+	if (index < TOKEN_NAMES_COUNT)
 	{
-		return it->second;
+		return TOKEN_NAMES[index];
 	}
 	assert(false);
 	throw std::logic_error("undefined token kind");
 }
+
+std::string ToString(TokenType type)
+{
+	return std::string(GetTokenName(type));
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 enum class TokenType
 {
@@ -10,7 +11,15 @@ enum class TokenType
 	End,
 	Integer,
 	Real,
+	Decimal,
+	BigInt,
+	For,
+	To,
+	DownTo,
+	Do,
 	IntegerDiv,
+	Random,
+	RandomNormal,
 
 	// mutable
 	Identifier,
@@ -36,4 +45,7 @@ enum class TokenType
 	EndOfFile
 };
 
+// Name of the token type without allocation, table lookup by enum value
+std::string_view GetTokenName(TokenType type);
+
 std::string ToString(TokenType type);
@@ -0,0 +1,273 @@
+#include "VirtualMachine.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Integers doubles represent exactly, FOR bounds must stay within
+const double EXACT_LIMIT = 9007199254740992.0;
+
+// Compiled for the FMA extension, PeepholeOptimizer only emits fused
+// instructions after checking the CPU has it
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+__attribute__((target("fma")))
+#endif
+double FusedMultiplyAdd(double a, double b, double c)
+{
+	return std::fma(a, b, c);
+}
+}
+
+VirtualMachine::VirtualMachine(const BytecodeProgram& program)
+	: m_program(program)
+	, m_values(program.variables.size())
+	, m_defined(program.variables.size())
+	, m_blockCounts(program.coverageBlocks.size())
+{
+	if (!program.assembled)
+	{
+		throw std::logic_error("bytecode is not assembled");
+	}
+}
+
+void VirtualMachine::Run()
+{
+	Execute(0);
+}
+
+void VirtualMachine::Reset()
+{
+	std::fill(m_defined.begin(), m_defined.end(), 0);
+	m_stack.clear();
+	m_loops.clear();
+	std::fill(m_blockCounts.begin(), m_blockCounts.end(), 0);
+}
+
+void VirtualMachine::Resume(uint32_t loop, double value, double remaining)
+{
+	const BytecodeProgram::Loop& resumed = m_program.loops.at(loop);
+	m_loops.push_back({ value, resumed.step, remaining });
+	SetVariable(resumed.variable, value);
+	Execute(resumed.body);
+}
+
+void VirtualMachine::SetVariable(uint32_t index, double value)
+{
+	m_values.at(index) = value;
+	m_defined[index] = true;
+}
+
+std::optional<double> VirtualMachine::GetVariable(uint32_t index)const
+{
+	if (!m_defined.at(index))
+	{
+		return std::nullopt;
+	}
+	return m_values[index];
+}
+
+void VirtualMachine::SetRandomStream(const RandomStream& random)
+{
+	m_random = random;
+}
+
+const RandomStream& VirtualMachine::GetRandomStream()const
+{
+	return m_random;
+}
+
+void VirtualMachine::SetDraws(const double* draws, size_t stride)
+{
+	m_draws = draws;
+	m_drawStride = stride;
+}
+
+void VirtualMachine::Execute(size_t pc)
+{
+	const std::vector<Instruction>& code = m_program.code;
+	const std::vector<double>& constants = m_program.constants;
+	for (; pc < code.size(); ++pc)
+	{
+		++m_dispatched;
+		const Instruction& instruction = code[pc];
+		switch (instruction.op)
+		{
+		case OpCode::PushConst:
+			m_stack.push_back(constants[instruction.operand]);
+			break;
+		case OpCode::Load:
+			if (!m_defined[instruction.operand])
+			{
+				throw std::runtime_error("variable is not defined");
+			}
+			m_stack.push_back(m_values[instruction.operand]);
+			break;
+		case OpCode::Store:
+			m_values[instruction.operand] = Pop();
+			m_defined[instruction.operand] = true;
+			break;
+		case OpCode::Tee:
+			m_values[instruction.operand] = m_stack.back();
+			m_defined[instruction.operand] = true;
+			break;
+		case OpCode::Pop:
+			m_stack.pop_back();
+			break;
+		case OpCode::Dup:
+			m_stack.push_back(m_stack.back());
+			break;
+		case OpCode::Add:
+		{
+			const double right = Pop();
+			m_stack.back() += right;
+			break;
+		}
+		case OpCode::Sub:
+		{
+			const double right = Pop();
+			m_stack.back() -= right;
+			break;
+		}
+		case OpCode::Mul:
+		{
+			const double right = Pop();
+			m_stack.back() *= right;
+			break;
+		}
+		case OpCode::Div:
+		{
+			const double right = Pop();
+			m_stack.back() /= right;
+			break;
+		}
+		case OpCode::IntDiv:
+		{
+			const double right = Pop();
+			m_stack.back() = std::round(m_stack.back() / right);
+			break;
+		}
+		case OpCode::IntDivByPowerOfTwo:
+			m_stack.back() = std::round(m_stack.back() * constants[instruction.operand]);
+			break;
+		case OpCode::Neg:
+			m_stack.back() = -m_stack.back();
+			break;
+		case OpCode::Pos:
+			m_stack.back() = +m_stack.back();
+			break;
+		case OpCode::Random:
+			if (m_draws)
+			{
+				m_stack.push_back(*m_draws);
+				m_draws += m_drawStride;
+				break;
+			}
+			m_stack.push_back(instruction.operand == RandomNode::Normal ? m_random.Normal() : m_random.Uniform());
+			break;
+		case OpCode::MulAdd:
+		{
+			const double c = Pop();
+			const double b = Pop();
+			m_stack.back() = FusedMultiplyAdd(m_stack.back(), b, c);
+			break;
+		}
+		case OpCode::MulSub:
+		{
+			const double c = Pop();
+			const double b = Pop();
+			m_stack.back() = FusedMultiplyAdd(m_stack.back(), b, -c);
+			break;
+		}
+		case OpCode::AddMul:
+		{
+			const double b = Pop();
+			const double a = Pop();
+			m_stack.back() = FusedMultiplyAdd(a, b, m_stack.back());
+			break;
+		}
+		case OpCode::SubMul:
+		{
+			const double b = Pop();
+			const double a = Pop();
+			m_stack.back() = FusedMultiplyAdd(-a, b, m_stack.back());
+			break;
+		}
+		case OpCode::ForEnter:
+		{
+			const BytecodeProgram::Loop& loop = m_program.loops[instruction.operand];
+			const double end = Pop();
+			const double start = Pop();
+			if (!((end - start) * loop.step >= 0))
+			{
+				pc = loop.exit - 1;
+				break;
+			}
+			if (!(std::abs(start) <= EXACT_LIMIT && std::abs(end) <= EXACT_LIMIT))
+			{
+				throw std::runtime_error("FOR bounds are out of range");
+			}
+			m_loops.push_back({ start, loop.step, std::floor((end - start) * loop.step) + 1 });
+			m_values[loop.variable] = start;
+			m_defined[loop.variable] = true;
+			break;
+		}
+		case OpCode::ForNext:
+		{
+			const BytecodeProgram::Loop& loop = m_program.loops[instruction.operand];
+			LoopState& state = m_loops.back();
+			if (--state.remaining > 0)
+			{
+				state.value += state.step;
+				m_values[loop.variable] = state.value;
+				pc = loop.body - 1;
+			}
+			else
+			{
+				m_loops.pop_back();
+			}
+			break;
+		}
+		case OpCode::Count:
+			++m_blockCounts[instruction.operand];
+			break;
+		default:
+			throw std::logic_error("undefined instruction");
+		}
+	}
+}
+
+uint64_t VirtualMachine::GetDispatchCount()const
+{
+	return m_dispatched;
+}
+
+void VirtualMachine::AddCoverage(uint64_t* counters)const
+{
+	for (size_t block = 0; block < m_blockCounts.size(); ++block)
+	{
+		for (uint32_t slot : m_program.coverageBlocks[block])
+		{
+			counters[slot] += m_blockCounts[block];
+		}
+	}
+}
+
+std::map<std::string, double> VirtualMachine::GetScope()const
+{
+	std::map<std::string, double> scope;
+	for (size_t i = 0; i < m_values.size(); ++i)
+	{
+		if (m_defined[i] && !m_program.variables[i].empty())
+		{
+			scope.emplace(m_program.variables[i], m_values[i]);
+		}
+	}
+	return scope;
+}
+
+double VirtualMachine::Pop()
+{
+	const double value = m_stack.back();
+	m_stack.pop_back();
+	return value;
+}
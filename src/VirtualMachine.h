@@ -0,0 +1,61 @@
+#pragma once
+#include "Bytecode.h"
+#include <map>
+#include <optional>
+
+// Executes an assembled BytecodeProgram with the semantics of
+// ExpressionCalculator: reading a variable before its first assignment
+// throws, FOR loops evaluate their bounds once.
+class VirtualMachine
+{
+public:
+	explicit VirtualMachine(const BytecodeProgram& program);
+
+	void Run();
+	// Forgets the variables of the previous run, keeps the memory
+	void Reset();
+	// Continues loops[loop] of the program, which has 'remaining' iterations
+	// to run with its variable set to 'value' for the first one. Variables
+	// the loop reads have to be set first
+	void Resume(uint32_t loop, double value, double remaining);
+	void SetVariable(uint32_t index, double value);
+	// Empty while the variable is not assigned
+	std::optional<double> GetVariable(uint32_t index)const;
+	// Stream of the Random instruction, as ExpressionCalculator::SetRandomStream
+	void SetRandomStream(const RandomStream& random);
+	const RandomStream& GetRandomStream()const;
+	// Values the Random instructions of the next run push instead of drawing
+	// from the stream, the n-th at draws[n * stride]. Null draws from the stream
+	void SetDraws(const double* draws, size_t stride);
+	// Instructions executed so far
+	uint64_t GetDispatchCount()const;
+	// Adds the statements counted since the last Reset to the counters of
+	// StatementCoverage, for programs compiled with BytecodeCompiler::SetCoverage
+	void AddCoverage(uint64_t* counters)const;
+	// Assigned variables by name, hidden ones excluded
+	std::map<std::string, double> GetScope()const;
+
+private:
+	struct LoopState
+	{
+		double value;
+		double step;
+		double remaining;
+	};
+
+	void Execute(size_t pc);
+	double Pop();
+
+private:
+	const BytecodeProgram& m_program;
+	std::vector<double> m_values;
+	std::vector<uint8_t> m_defined;
+	std::vector<double> m_stack;
+	std::vector<LoopState> m_loops;
+	// Runs of each coverage block
+	std::vector<uint64_t> m_blockCounts;
+	RandomStream m_random;
+	const double* m_draws = nullptr;
+	size_t m_drawStride = 0;
+	uint64_t m_dispatched = 0;
+};
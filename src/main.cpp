@@ -1,339 +1,809 @@
-#include "Lexer.h"
-#include "AST.h"
+#include "Parser.h"
+#include "IncrementalParser.h"
+#include "ASTStats.h"
+#include "TokenDumper.h"
+#include "Coverage.h"
+#include "LoopOptimizer.h"
+#include "Peephole.h"
+#include "VirtualMachine.h"
+#include "RangeAnalysis.h"
+#include "Reassociation.h"
+#include "Tiering.h"
+#include "OnStackReplacement.h"
+#include "PartialEvaluator.h"
+#include "Differentiation.h"
+#include "MonteCarlo.h"
+#include "Streaming.h"
+#include "Batch.h"
+#include "Columnar.h"
+#include "CompileTime.h"
 
 #include <cctype>
+#include <cstring>
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <cassert>
 #include <algorithm>
+#include <random>
 
-namespace
+// Passes run on every tree before it is evaluated, fastMath allows those
+// that change how REAL results are rounded
+void Optimize(ProgramNode& root, bool fastMath)
 {
-template <typename T>
-bool AnyOf(const T& value, const std::initializer_list<T> &container)
-{
-	return std::any_of(std::begin(container), std::end(container), [&value](const T& element) {
-		return value == element;
-	});
-}
+	if (fastMath)
+	{
+		Reassociation().Run(root);
+	}
+	LoopOptimizer().Run(root);
+	RangeAnalysis().Run(root);
 }
 
-class Parser
+// FOR loops taking this many back-edges continue in bytecode
+const uint64_t OSR_THRESHOLD = 10000;
+
+class Interpreter : private OsrCalculator
 {
 public:
-	Parser(std::unique_ptr<Lexer> && lexer)
-		: mLexer(std::move(lexer))
-		, mCurrentToken(mLexer->Advance())
+	Interpreter(uint64_t osrThreshold, bool contract)
+		: OsrCalculator(osrThreshold, contract)
 	{
 	}
 
-	ASTNode::Ptr ParseAsProgram()
+	Interpreter(std::unique_ptr<Parser> && parser, bool fastMath, uint64_t osrThreshold, bool contract)
+		: OsrCalculator(osrThreshold, contract)
+		, mParser(std::move(parser))
+		, mFastMath(fastMath)
 	{
-		EatAndAdvance(TokenType::Program);
-		auto programNameToken = mCurrentToken;
-		EatAndAdvance(TokenType::Identifier);
-		EatAndAdvance(TokenType::Semicolon);
-		auto block = ParseAsBlock();
-		auto program = std::make_unique<ProgramNode>(*programNameToken.value, std::move(block));
-		EatAndAdvance(TokenType::Dot);
-		EatAndAdvance(TokenType::EndOfFile);
-		return program;
 	}
 
-	// block:
-	//  declarations compound_statement
-	std::unique_ptr<BlockNode> ParseAsBlock()
+	void Interpret()
 	{
-		auto declarations = ParseAsDeclarations();
-		auto compound = ParseAsCompound();
-		return std::make_unique<BlockNode>(std::move(declarations), std::move(compound));
+		auto root = mParser->ParseAsProgram();
+		Optimize(*root, mFastMath);
+		Interpret(*root);
 	}
 
-	// declarations:
-	//  VAR (variables_declaration SEMICOLON)+ |
-	//  empty
-	std::vector<std::unique_ptr<VarDeclNode>> ParseAsDeclarations()
+	void Interpret(const ASTNode& root)
 	{
-		std::vector<std::unique_ptr<VarDeclNode>> declarations;
-		if (mCurrentToken.type == TokenType::Var)
+		root.Accept(*this);
+
+		std::cout << "Tree has been traversed!" << std::endl;
+		for (const auto& [name, value] : m_scope)
 		{
-			EatAndAdvance(TokenType::Var);
-			while (mCurrentToken.type == TokenType::Identifier)
+			auto decimal = m_decimals.find(SymbolTable::InternFolded(name));
+			if (decimal != m_decimals.end() && decimal->second.value)
+			{
+				std::cout << name << " = " << decimal->second.value->ToString() << std::endl;
+				continue;
+			}
+			auto bigint = m_bigints.find(SymbolTable::InternFolded(name));
+			if (bigint != m_bigints.end() && bigint->second)
 			{
-				declarations.emplace_back(ParseAsVariablesDeclaration());
-				EatAndAdvance(TokenType::Semicolon);
+				std::cout << name << " = " << bigint->second->ToString() << std::endl;
+				continue;
 			}
+			std::cout << name << " = " << value << std::endl;
 		}
-		return declarations;
 	}
 
-	// variables_declaration:
-	//  ID (COMMA ID)* COLON type_spec
-	std::unique_ptr<VarDeclNode> ParseAsVariablesDeclaration()
+	using ExpressionCalculator::SetCoverageCounters;
+	using ExpressionCalculator::SetRandomStream;
+	using ExpressionCalculator::SetFloatingPointChecks;
+
+private:
+	std::unique_ptr<Parser> mParser;
+	bool mFastMath = false;
+};
+
+void DebugLexer(const std::string& text, TokenDumper::Format format)
+{
+	TokenDumper dumper(std::cout, format);
+	Lexer lexer(text);
+	TokenView token;
+	do
 	{
-		std::vector<std::unique_ptr<LeafVarNode>> vars;
-		vars.push_back(ParseAsVariable());
-		while (mCurrentToken.type == TokenType::Comma)
-		{
-			EatAndAdvance(TokenType::Comma);
-			vars.emplace_back(ParseAsVariable());
-		}
-		EatAndAdvance(TokenType::Colon);
-		auto type = ParseAsTypeNode();
-		return std::make_unique<VarDeclNode>(std::move(vars), std::move(type));
+		token = lexer.AdvanceView();
+		dumper.Dump(token);
+	} while (token.type != TokenType::EndOfFile);
+}
+
+// Formulas known at build time are parsed and folded by the compiler
+constexpr auto CONSTANT_PROGRAM = lsbasi::compile(R"(
+PROGRAM Constant;
+VAR
+   a, b : INTEGER;
+   y    : REAL;
+BEGIN
+   a := 2;
+   b := 10 * a + 10 * a DIV 4;
+   y := 20 / 8 + - b
+END.
+)");
+static_assert(CONSTANT_PROGRAM.Evaluate().Get("b") == 25);
+static_assert(CONSTANT_PROGRAM.Evaluate().Get("Y") == -22.5);
+
+// DECIMAL variables are computed exactly, even when the formula is folded by the compiler
+constexpr auto BILLING_PROGRAM = lsbasi::compile(R"(
+PROGRAM Billing;
+VAR
+   price, total : DECIMAL(12, 2);
+   share        : DECIMAL(10, 8);
+BEGIN
+   price := 0.1 + 0.2;
+   total := price * 3 + price * 0.0825;
+   share := 1 / 3
+END.
+)");
+static_assert(BILLING_PROGRAM.Evaluate().GetDecimal("price") == Decimal::Parse("0.3"));
+static_assert(BILLING_PROGRAM.Evaluate().GetDecimal("total") == Decimal::Parse("0.92"));
+static_assert(BILLING_PROGRAM.Evaluate().GetDecimal("share") == Decimal::Parse("0.33333333"));
+
+constexpr auto LOOP_PROGRAM = lsbasi::compile(R"(
+PROGRAM Loop;
+VAR
+   i, sum, product : INTEGER;
+BEGIN
+   sum := 0;
+   product := 1;
+   FOR i := 1 TO 10 DO sum := sum + i * 3;
+   FOR i := 5 DOWNTO 1 DO product := product * i
+END.
+)");
+static_assert(LOOP_PROGRAM.Evaluate().Get("sum") == 165);
+static_assert(LOOP_PROGRAM.Evaluate().Get("product") == 120);
+static_assert(LOOP_PROGRAM.Evaluate().Get("i") == 1);
+
+const char SAMPLE_PROGRAM[] = R"(
+PROGRAM Part10;
+VAR
+   number     : INTEGER;
+   a, b, c, x : INTEGER;
+   y          : REAL;
+
+BEGIN {Part10}
+   BEGIN
+      number := 2;
+      a := number;
+      b := 10 * a + 10 * number DIV 4;
+      c := a - - b
+   END;
+   x := 11;
+   y := 20 / 7 + 3.14;
+   { writeln('a = ', a); }
+   { writeln('b = ', b); }
+   { writeln('c = ', c); }
+   { writeln('number = ', number); }
+   { writeln('x = ', x); }
+   { writeln('y = ', y); }
+END.  {Part10}
+)";
+
+std::string ReadFile(const std::string& path)
+{
+	std::ifstream input(path, std::ios::binary);
+	if (!input)
+	{
+		throw std::runtime_error("can't open file '" + path + "'");
 	}
+	std::ostringstream text;
+	text << input.rdbuf();
+	return text.str();
+}
 
-	std::unique_ptr<TypeNode> ParseAsTypeNode()
+void InterpretWithCoverage(const std::string& text, const std::string& sourcePath, const std::string& lcovPath, bool fastMath,
+	uint64_t osrThreshold, bool contract)
+{
+	StatementCoverage coverage;
+	auto root = StatementCoverage::Instrument(text, coverage);
+	Optimize(*root, fastMath);
+	Interpreter interpreter(osrThreshold, contract);
+	interpreter.SetCoverageCounters(coverage.GetCounters());
+	interpreter.Interpret(*root);
+
+	std::ofstream output(lcovPath);
+	if (!output)
 	{
-		if (mCurrentToken.type == TokenType::Integer)
-		{
-			EatAndAdvance(TokenType::Integer);
-			return std::make_unique<TypeNode>(TypeNode::Integer);
-		}
-		else if (mCurrentToken.type == TokenType::Real)
-		{
-			EatAndAdvance(TokenType::Real);
-			return std::make_unique<TypeNode>(TypeNode::Real);
-		}
-		throw std::runtime_error("invalid variable type");
+		throw std::runtime_error("can't open file '" + lcovPath + "'");
 	}
+	coverage.WriteLcov(output, sourcePath);
+}
 
-	std::unique_ptr<CompoundNode> ParseAsCompound()
+void PrintOptimizationStats(const std::string& text, bool fastMath)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	if (fastMath)
 	{
-		EatAndAdvance(TokenType::Begin);
-		auto node = ParseAsStatementList();
-		EatAndAdvance(TokenType::End);
-		return node;
+		Reassociation reassociation;
+		reassociation.Run(*root);
+		reassociation.PrintStats(std::cout);
 	}
+	LoopOptimizer optimizer;
+	optimizer.Run(*root);
+	RangeAnalysis analysis;
+	analysis.Run(*root);
+	optimizer.PrintStats(std::cout);
+	analysis.PrintStats(std::cout);
+}
 
-	std::unique_ptr<CompoundNode> ParseAsStatementList()
+// Listings of the program before and after the peephole pass, then both are
+// run to compare the number of dispatched instructions
+void DumpBytecode(const std::string& text, bool fastMath, bool contract)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	Optimize(*root, fastMath);
+	BytecodeProgram naive = BytecodeCompiler().Compile(*root);
+	BytecodeProgram optimized = naive;
+	PeepholeOptimizer peephole(contract);
+	peephole.Optimize(optimized);
+
+	std::cout << "; before peephole" << std::endl;
+	naive.Print(std::cout);
+	std::cout << "; after peephole" << std::endl;
+	optimized.Print(std::cout);
+	peephole.PrintStats(std::cout);
+
+	naive.Assemble();
+	optimized.Assemble();
+	VirtualMachine before(naive);
+	before.Run();
+	VirtualMachine after(optimized);
+	after.Run();
+	std::cout << "dispatched instructions: " << before.GetDispatchCount()
+		<< " before, " << after.GetDispatchCount() << " after" << std::endl;
+}
+
+// Runs the program repeatedly, as a host embedding the interpreter would,
+// and prints the variables of the last run and how the program was tiered
+void RunTiered(const std::string& text, uint64_t runs, TieredExecutor::Thresholds thresholds, bool fastMath, uint64_t seed,
+	bool floatingPointChecks, bool contract)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	Optimize(*root, fastMath);
+	TieredExecutor executor(thresholds);
+	executor.SetRandomSeed(seed);
+	executor.SetFloatingPointChecks(floatingPointChecks);
+	executor.SetContraction(contract);
+	const size_t program = executor.Load(std::move(root));
+	std::map<std::string, double> scope;
+	for (uint64_t i = 0; i < runs; ++i)
 	{
-		auto node = std::make_unique<CompoundNode>();
-		node->AddChild(ParseAsStatement());
-		while (mCurrentToken.type == TokenType::Semicolon)
-		{
-			EatAndAdvance(TokenType::Semicolon);
-			node->AddChild(ParseAsStatement());
-		}
-		return node;
+		scope = executor.Run(program);
 	}
+	executor.Wait();
 
-	ASTNode::Ptr ParseAsStatement()
+	for (const auto& [name, value] : scope)
 	{
-		if (mCurrentToken.type == TokenType::Begin)
-		{
-			return ParseAsCompound();
-		}
-		else if (mCurrentToken.type == TokenType::Identifier)
-		{
-			return ParseAsAssignment();
-		}
-		else
+		std::cout << name << " = " << value << std::endl;
+	}
+	executor.PrintStats(std::cout);
+}
+
+// Instructions the bytecode of the program dispatches with the inputs set
+uint64_t CountDispatches(const ProgramNode& program, const PartialEvaluator::Values& inputs, bool contract)
+{
+	BytecodeProgram code = BytecodeCompiler().Compile(program);
+	PeepholeOptimizer(contract).Optimize(code);
+	code.Assemble();
+	VirtualMachine machine(code);
+	for (uint32_t i = 0; i < code.variables.size(); ++i)
+	{
+		auto input = inputs.find(boost::algorithm::to_lower_copy(code.variables[i]));
+		if (input != inputs.end())
 		{
-			return std::make_unique<LeafNopNode>();
+			machine.SetVariable(i, input->second);
 		}
 	}
+	machine.Run();
+	return machine.GetDispatchCount();
+}
 
-	ASTNode::Ptr ParseAsAssignment()
+// Specializes the program for the known values, runs it with them set and
+// compares the work with the original program run with the same values
+void RunSpecialized(const std::string& text, const PartialEvaluator::Values& known, bool contract)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto source = parser.ParseAsProgram();
+	SpecializationCache cache(*source);
+	auto residual = cache.Get(known);
+	PartialEvaluator::Values inputs;
+	ExpressionCalculator calculator;
+	for (const auto& [name, value] : known)
 	{
-		auto left = ParseAsVariable();
-		EatAndAdvance(TokenType::Assign);
-		auto expr = ParseAsExpr();
-		return std::make_unique<AssignNode>(left->GetName(), std::move(expr));
+		inputs[boost::algorithm::to_lower_copy(name)] = value;
+		calculator.SetVariable(name, value);
 	}
-
-	std::unique_ptr<LeafVarNode> ParseAsVariable()
+	calculator.Calculate(*residual);
+	for (const auto& [name, value] : calculator.GetScope())
 	{
-		assert(mCurrentToken.type == TokenType::Identifier);
-		auto identifier = *mCurrentToken.value;
-		EatAndAdvance(TokenType::Identifier);
-		return std::make_unique<LeafVarNode>(identifier);
+		std::cout << name << " = " << value << std::endl;
 	}
 
-	ASTNode::Ptr ParseAsFactor()
+	Parser original(std::make_unique<Lexer>(text));
+	auto root = original.ParseAsProgram();
+	Optimize(*root, false);
+	std::cout << "dispatched instructions: " << CountDispatches(*root, inputs, contract) << " original, "
+		<< CountDispatches(*residual, inputs, contract) << " specialized" << std::endl;
+}
+
+template <typename Differentiator>
+void PrintGradients(Differentiator& differentiator, const std::vector<std::string>& inputs)
+{
+	for (const auto& [name, value] : differentiator.GetScope())
 	{
-		if (mCurrentToken.type == TokenType::Minus)
-		{
-			EatAndAdvance(TokenType::Minus);
-			auto node = ParseAsFactor();
-			return std::make_unique<UnOpNode>(std::move(node), UnOpNode::Minus);
-		}
-		else if (mCurrentToken.type == TokenType::Plus)
-		{
-			EatAndAdvance(TokenType::Plus);
-			auto node = ParseAsFactor();
-			return std::make_unique<UnOpNode>(std::move(node), UnOpNode::Plus);
-		}
-		else if (mCurrentToken.type == TokenType::IntegerConstant)
-		{
-			const std::string lexeme = *mCurrentToken.value;
-			EatAndAdvance(TokenType::IntegerConstant);
-			return std::make_unique<LeafNumNode>(std::stoi(lexeme));
-		}
-		else if (mCurrentToken.type == TokenType::RealConstant)
+		std::cout << name << " = " << value << std::endl;
+		const std::vector<double> gradient = differentiator.GetGradient(name);
+		for (size_t i = 0; i < inputs.size(); ++i)
 		{
-			const std::string lexeme = *mCurrentToken.value;
-			EatAndAdvance(TokenType::RealConstant);
-			return std::make_unique<LeafNumNode>(std::stod(lexeme), false);
+			std::cout << "   d/d " << inputs[i] << " = " << gradient[i] << std::endl;
 		}
-		else if (mCurrentToken.type == TokenType::LeftParen)
-		{
-			EatAndAdvance(TokenType::LeftParen);
-			auto node = ParseAsExpr();
-			EatAndAdvance(TokenType::RightParen);
-			return node;
-		}
-		else if (mCurrentToken.type == TokenType::Identifier)
+	}
+}
+
+// Runs the program once with the inputs set, prints the variables and their
+// derivatives with respect to the inputs. Forward mode unless reverse is set,
+// checkpointInterval applies to reverse mode
+void RunDifferentiated(const std::string& text, const PartialEvaluator::Values& inputs, bool reverse, uint64_t checkpointInterval,
+	uint64_t seed)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	std::vector<std::string> names;
+	for (const auto& [name, value] : inputs)
+	{
+		(void)value;
+		names.push_back(name);
+	}
+	if (!reverse)
+	{
+		ForwardDifferentiator differentiator(names);
+		differentiator.SetRandomStream(RandomStream(seed));
+		for (const auto& [name, value] : inputs)
 		{
-			return ParseAsVariable();
+			differentiator.SetVariable(name, value);
 		}
-		throw std::runtime_error("can't parse as factor");
+		differentiator.Run(*root);
+		PrintGradients(differentiator, names);
+		return;
 	}
 
-	ASTNode::Ptr ParseAsTerm()
+	ReverseDifferentiator differentiator(names, checkpointInterval);
+	differentiator.SetRandomStream(RandomStream(seed));
+	for (const auto& [name, value] : inputs)
 	{
-		auto node = ParseAsFactor();
-		while (AnyOf(mCurrentToken.type, { TokenType::Mul, TokenType::IntegerDiv, TokenType::FloatDiv }))
+		differentiator.SetVariable(name, value);
+	}
+	differentiator.Run(*root);
+	PrintGradients(differentiator, names);
+	std::cout << "tape entries: " << differentiator.GetTapeSize() << std::endl;
+}
+
+// Runs the program as 'paths' Monte Carlo paths and prints the statistics of
+// the outputs, all declared variables when none are given
+void RunMonteCarlo(const std::string& text, uint64_t paths, std::vector<std::string> outputs, MonteCarlo::Options options,
+	bool fastMath)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	Optimize(*root, fastMath);
+	if (outputs.empty())
+	{
+		for (const auto& declaration : root->GetBlock().GetDeclarations())
 		{
-			const auto op = mCurrentToken;
-			if (mCurrentToken.type == TokenType::Mul)
-			{
-				EatAndAdvance(TokenType::Mul);
-			}
-			else if (mCurrentToken.type == TokenType::IntegerDiv)
+			for (const auto& var : declaration->GetVariables())
 			{
-				EatAndAdvance(TokenType::IntegerDiv);
+				outputs.push_back(var->GetName());
 			}
-			else if (mCurrentToken.type == TokenType::FloatDiv)
-			{
-				EatAndAdvance(TokenType::FloatDiv);
-			}
-			node = std::make_unique<BinOpNode>(std::move(node), ParseAsFactor(),
-				op.type == TokenType::Mul ? BinOpNode::Mul :
-				op.type == TokenType::IntegerDiv ? BinOpNode::IntegerDiv : BinOpNode::FloatDiv);
 		}
-		return node;
 	}
+	MonteCarlo simulation(*root, options);
+	const std::vector<RunningStatistics> statistics = simulation.Run(paths, outputs);
+	for (size_t i = 0; i < outputs.size(); ++i)
+	{
+		const RunningStatistics& output = statistics[i];
+		std::cout << outputs[i] << ": mean = " << output.GetMean() << ", stddev = " << std::sqrt(output.GetVariance())
+			<< ", min = " << output.GetMin() << ", p5 = " << output.GetQuantile(0.05) << ", p50 = " << output.GetQuantile(0.5)
+			<< ", p95 = " << output.GetQuantile(0.95) << ", max = " << output.GetMax() << " (" << output.GetCount() << " paths)"
+			<< std::endl;
+	}
+	simulation.PrintStats(std::cout);
+}
 
-	ASTNode::Ptr ParseAsExpr()
+// Records on stdin, outputs on stdout, statistics on stderr
+void RunStreaming(const std::string& text, const std::vector<std::string>& inputs, std::vector<std::string> outputs,
+	StreamingEvaluator::Options options, std::chrono::microseconds flushInterval, bool fastMath)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	Optimize(*root, fastMath);
+	if (outputs.empty())
 	{
-		auto node = ParseAsTerm();
-		while (mCurrentToken.type == TokenType::Plus || mCurrentToken.type == TokenType::Minus)
+		for (const auto& declaration : root->GetBlock().GetDeclarations())
 		{
-			const auto op = mCurrentToken;
-			if (mCurrentToken.type == TokenType::Plus)
-			{
-				EatAndAdvance(TokenType::Plus);
-			}
-			else if (mCurrentToken.type == TokenType::Minus)
+			for (const auto& var : declaration->GetVariables())
 			{
-				EatAndAdvance(TokenType::Minus);
+				const bool input = std::any_of(inputs.begin(), inputs.end(), [&](const std::string& name) {
+					return boost::algorithm::iequals(name, var->GetName());
+				});
+				if (!input)
+				{
+					outputs.push_back(var->GetName());
+				}
 			}
-			node = std::make_unique<BinOpNode>(std::move(node), ParseAsTerm(),
-				op.type == TokenType::Plus ? BinOpNode::Plus : BinOpNode::Minus);
 		}
-		return node;
 	}
+	StreamingEvaluator evaluator(*root, inputs, outputs, options);
+	RecordWriter writer(stdout, 64 * 1024, flushInterval);
+	evaluator.Run(0, writer);
+	evaluator.PrintStats(std::cerr);
+}
 
-private:
-	void EatAndAdvance(TokenType kind)
+// Outputs as CSV on stdout or to a columnar file, statistics on stderr
+void RunBatch(const std::string& text, const std::string& inputPath, const std::vector<std::string>& outputs,
+	const std::string& outputPath, BatchEvaluator::Options options, bool fastMath)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	Optimize(*root, fastMath);
+	BatchEvaluator evaluator(*root, options);
+	if (outputPath.empty())
 	{
-		if (mCurrentToken.type == kind)
-		{
-			mCurrentToken = mLexer->Advance();
-		}
-		else
-		{
-			throw std::runtime_error("can't parse as " + ToString(kind));
-		}
+		evaluator.Run(inputPath, outputs, stdout);
 	}
+	else
+	{
+		evaluator.Run(inputPath, outputs, outputPath);
+	}
+	evaluator.PrintStats(std::cerr);
+}
 
-private:
-	std::unique_ptr<Lexer> mLexer;
-	Token mCurrentToken;
-};
-
-class Interpreter : private ExpressionCalculator
+// Columnar files to CSV, anything else from CSV to columnar, only the
+// given columns if any
+void Convert(const std::string& from, const std::string& to, const std::vector<std::string>& columns, char delimiter,
+	unsigned threads)
 {
-public:
-	Interpreter(std::unique_ptr<Parser> && parser)
-		: mParser(std::move(parser))
+	if (ColumnarFile::IsColumnar(from))
 	{
+		ColumnarFile(from).ToCsv(to, delimiter);
 	}
-
-	void Interpret()
+	else
 	{
-		auto root = mParser->ParseAsProgram();
-		root->Accept(*this);
+		ColumnarFile::FromCsv(from, to, columns, delimiter, threads);
+	}
+}
 
-		std::cout << "Tree has been traversed!" << std::endl;
-		for (const auto& [name, value] : m_scope)
+// Retypes random number constants of the program, timing IncrementalParser
+// against parsing the whole edited text
+void RunReparseBenchmark(const std::string& text, uint64_t edits, uint64_t seed)
+{
+	IncrementalParser incremental(text);
+	std::string current = text;
+	std::mt19937_64 random(seed);
+	std::chrono::duration<double> incrementalTime(0);
+	std::chrono::duration<double> fullTime(0);
+	uint64_t fullReparses = 0;
+	for (uint64_t edit = 0; edit < edits; ++edit)
+	{
+		std::vector<Token> numbers;
+		Lexer lexer(current);
+		for (Token token = lexer.Advance(); token.type != TokenType::EndOfFile; token = lexer.Advance())
 		{
-			std::cout << name << " = " << value << std::endl;
+			if (token.type == TokenType::IntegerConstant)
+			{
+				numbers.push_back(std::move(token));
+			}
 		}
+		if (numbers.empty())
+		{
+			throw std::invalid_argument("the program has no integer constants to edit");
+		}
+		const Token& number = numbers[random() % numbers.size()];
+		const std::string replacement = std::to_string(random() % 1000);
+		current.replace(number.offset, number.value->length(), replacement);
+
+		auto start = std::chrono::steady_clock::now();
+		incremental.Edit(number.offset, number.value->length(), replacement);
+		auto end = std::chrono::steady_clock::now();
+		incrementalTime += end - start;
+		fullReparses += incremental.GetLastEditStats().fullReparse;
+
+		start = end;
+		Parser parser(std::make_unique<Lexer>(current));
+		parser.ParseAsProgram();
+		fullTime += std::chrono::steady_clock::now() - start;
 	}
+	const double count = static_cast<double>(std::max<uint64_t>(edits, 1));
+	std::cout << "edits: " << edits << ", full reparses: " << fullReparses << std::endl;
+	std::cout << "incremental: " << incrementalTime.count() / count * 1e6 << " us per edit" << std::endl;
+	std::cout << "full parse: " << fullTime.count() / count * 1e6 << " us per edit" << std::endl;
+}
 
-private:
-	std::unique_ptr<Parser> mParser;
-};
+void PrintASTStats(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto root = parser.ParseAsProgram();
+	ASTStatsCollector collector;
+	collector.Collect(*root);
+	collector.Print(std::cout);
+}
 
-std::vector<Token> Tokenize(const std::string& text)
+// Values given as name=value,...
+PartialEvaluator::Values ParseValues(const std::string& list)
 {
-	auto lexer = std::make_unique<Lexer>(text);
-	std::vector<Token> tokens;
-	while (true)
+	PartialEvaluator::Values values;
+	std::vector<std::string> items;
+	boost::algorithm::split(items, list, boost::algorithm::is_any_of(","));
+	for (const std::string& item : items)
 	{
-		tokens.push_back(lexer->Advance());
-		if (tokens.back().type == TokenType::EndOfFile)
+		const size_t equals = item.find('=');
+		if (equals != std::string::npos)
 		{
-			break;
+			values[item.substr(0, equals)] = std::strtod(item.c_str() + equals + 1, nullptr);
 		}
 	}
-	return tokens;
+	return values;
 }
 
-void DebugLexer(const std::string& text)
+// Usage: lsbasi [--fast-math] [--contract] [--ast-stats | --stats | --dump-tokens[=binary] | --dump-bytecode | --coverage=<lcov.info>
+//               | --tiered=<runs> [--tier-runs=<n>] [--tier-iterations=<n>] | --specialize=<name>=<value>[,...]
+//               | --gradient=<name>=<value>[,...] [--reverse [--checkpoint=<iterations>]]]
+//               | --montecarlo=<paths> [--outputs=<name>[,...]] [--threads=<n>]
+//               | --stream=<name>[,...] [--outputs=<name>[,...]] [--binary-records] [--delimiter=<c>]
+//                 [--flush-interval=<us>]
+//               | --batch=<file.csv|file.lsbc> [--batch-output=<file.lsbc>] [--outputs=<name>[,...]]
+//                 [--delimiter=<c>] [--threads=<n>]
+//               | --reparse-bench=<edits>
+//               | --convert=<from>,<to> [--outputs=<column>[,...]] [--delimiter=<c>] [--threads=<n>]]
+//               [--osr-threshold=<n>] [--seed=<n>] [--fp-checks] [program.pas]
+int main(int argc, char* argv[])
 {
-	for (auto&& token : Tokenize(text))
+	bool astStats = false;
+	bool optimizationStats = false;
+	bool dumpBytecode = false;
+	bool fastMath = false;
+	bool contract = false;
+	uint64_t tieredRuns = 0;
+	TieredExecutor::Thresholds thresholds;
+	uint64_t osrThreshold = OSR_THRESHOLD;
+	std::optional<PartialEvaluator::Values> known;
+	std::optional<PartialEvaluator::Values> gradientInputs;
+	bool reverse = false;
+	uint64_t checkpointInterval = 0;
+	uint64_t seed = 0;
+	uint64_t monteCarloPaths = 0;
+	std::vector<std::string> outputs;
+	unsigned threads = 0;
+	bool floatingPointChecks = false;
+	std::optional<std::vector<std::string>> streamInputs;
+	StreamingEvaluator::Options streamOptions;
+	std::string batchPath;
+	std::string batchOutputPath;
+	std::vector<std::string> convertPaths;
+	uint64_t reparseEdits = 0;
+	char delimiter = ',';
+	std::chrono::microseconds flushInterval(1000);
+	std::optional<TokenDumper::Format> dumpTokens;
+	std::string lcovPath;
+	std::string path;
+	for (int i = 1; i < argc; ++i)
 	{
-		std::cout << ToString(token) << std::endl;
+		const std::string arg = argv[i];
+		if (arg == "--ast-stats")
+		{
+			astStats = true;
+		}
+		else if (arg == "--stats")
+		{
+			optimizationStats = true;
+		}
+		else if (arg == "--fast-math")
+		{
+			fastMath = true;
+		}
+		else if (arg == "--contract")
+		{
+			contract = true;
+		}
+		else if (arg == "--dump-bytecode")
+		{
+			dumpBytecode = true;
+		}
+		else if (arg == "--dump-tokens")
+		{
+			dumpTokens = TokenDumper::Text;
+		}
+		else if (arg == "--dump-tokens=binary")
+		{
+			dumpTokens = TokenDumper::Binary;
+		}
+		else if (arg.rfind("--coverage=", 0) == 0)
+		{
+			lcovPath = arg.substr(std::strlen("--coverage="));
+		}
+		else if (arg.rfind("--tiered=", 0) == 0)
+		{
+			tieredRuns = std::strtoull(arg.c_str() + std::strlen("--tiered="), nullptr, 10);
+		}
+		else if (arg.rfind("--tier-runs=", 0) == 0)
+		{
+			thresholds.runs = std::strtoull(arg.c_str() + std::strlen("--tier-runs="), nullptr, 10);
+		}
+		else if (arg.rfind("--specialize=", 0) == 0)
+		{
+			known = ParseValues(arg.substr(std::strlen("--specialize=")));
+		}
+		else if (arg.rfind("--gradient=", 0) == 0)
+		{
+			gradientInputs = ParseValues(arg.substr(std::strlen("--gradient=")));
+		}
+		else if (arg == "--fp-checks")
+		{
+			// Division by zero, invalid operations and overflow of REAL values throw
+			floatingPointChecks = true;
+		}
+		else if (arg == "--reverse")
+		{
+			reverse = true;
+		}
+		else if (arg.rfind("--checkpoint=", 0) == 0)
+		{
+			checkpointInterval = std::strtoull(arg.c_str() + std::strlen("--checkpoint="), nullptr, 10);
+		}
+		else if (arg.rfind("--osr-threshold=", 0) == 0)
+		{
+			// 0 keeps loops in the tree walker
+			osrThreshold = std::strtoull(arg.c_str() + std::strlen("--osr-threshold="), nullptr, 10);
+		}
+		else if (arg.rfind("--tier-iterations=", 0) == 0)
+		{
+			thresholds.loopIterations = std::strtoull(arg.c_str() + std::strlen("--tier-iterations="), nullptr, 10);
+		}
+		else if (arg.rfind("--seed=", 0) == 0)
+		{
+			// Of the streams of RANDOM and RANDOMNORMAL
+			seed = std::strtoull(arg.c_str() + std::strlen("--seed="), nullptr, 10);
+		}
+		else if (arg.rfind("--montecarlo=", 0) == 0)
+		{
+			monteCarloPaths = std::strtoull(arg.c_str() + std::strlen("--montecarlo="), nullptr, 10);
+		}
+		else if (arg.rfind("--outputs=", 0) == 0)
+		{
+			boost::algorithm::split(outputs, arg.substr(std::strlen("--outputs=")), boost::algorithm::is_any_of(","));
+		}
+		else if (arg.rfind("--stream=", 0) == 0)
+		{
+			// Input variables, in the order of the fields of a record
+			streamInputs.emplace();
+			const std::string list = arg.substr(std::strlen("--stream="));
+			if (!list.empty())
+			{
+				boost::algorithm::split(*streamInputs, list, boost::algorithm::is_any_of(","));
+			}
+		}
+		else if (arg == "--binary-records")
+		{
+			streamOptions.format = StreamingEvaluator::Binary;
+		}
+		else if (arg.rfind("--delimiter=", 0) == 0 && arg.size() == std::strlen("--delimiter=") + 1)
+		{
+			delimiter = arg.back();
+		}
+		else if (arg.rfind("--flush-interval=", 0) == 0)
+		{
+			flushInterval = std::chrono::microseconds(std::strtoull(arg.c_str() + std::strlen("--flush-interval="), nullptr, 10));
+		}
+		else if (arg.rfind("--batch=", 0) == 0)
+		{
+			// CSV or columnar file, the columns named like declared variables are the inputs
+			batchPath = arg.substr(std::strlen("--batch="));
+		}
+		else if (arg.rfind("--batch-output=", 0) == 0)
+		{
+			batchOutputPath = arg.substr(std::strlen("--batch-output="));
+		}
+		else if (arg.rfind("--convert=", 0) == 0)
+		{
+			boost::algorithm::split(convertPaths, arg.substr(std::strlen("--convert=")), boost::algorithm::is_any_of(","));
+		}
+		else if (arg.rfind("--reparse-bench=", 0) == 0)
+		{
+			reparseEdits = std::strtoull(arg.c_str() + std::strlen("--reparse-bench="), nullptr, 10);
+		}
+		else if (arg.rfind("--threads=", 0) == 0)
+		{
+			threads = static_cast<unsigned>(std::strtoul(arg.c_str() + std::strlen("--threads="), nullptr, 10));
+		}
+		else
+		{
+			path = arg;
+		}
 	}
-}
-
-int main()
-{
-	const std::string text = R"(
-PROGRAM Part10;
-VAR
-   number     : INTEGER;
-   a, b, c, x : INTEGER;
-   y          : REAL;
-
-BEGIN {Part10}
-   BEGIN
-      number := 2;
-      a := number;
-      b := 10 * a + 10 * number DIV 4;
-      c := a - - b
-   END;
-   x := 11;
-   y := 20 / 7 + 3.14;
-   { writeln('a = ', a); }
-   { writeln('b = ', b); }
-   { writeln('c = ', c); }
-   { writeln('number = ', number); }
-   { writeln('x = ', x); }
-   { writeln('y = ', y); }
-END.  {Part10}
-)";
 
 	try
 	{
-#if 1
-		Interpreter interpreter(std::make_unique<Parser>(std::make_unique<Lexer>(text)));
+		if (!convertPaths.empty())
+		{
+			if (convertPaths.size() != 2)
+			{
+				throw std::invalid_argument("--convert takes a source and a target file");
+			}
+			Convert(convertPaths[0], convertPaths[1], outputs, delimiter, threads);
+			return 0;
+		}
+		const std::string text = path.empty() ? SAMPLE_PROGRAM : ReadFile(path);
+		if (astStats)
+		{
+			PrintASTStats(text);
+			return 0;
+		}
+		if (optimizationStats)
+		{
+			PrintOptimizationStats(text, fastMath);
+			return 0;
+		}
+		if (reparseEdits)
+		{
+			RunReparseBenchmark(text, reparseEdits, seed);
+			return 0;
+		}
+		if (dumpBytecode)
+		{
+			DumpBytecode(text, fastMath, contract);
+			return 0;
+		}
+		if (known)
+		{
+			RunSpecialized(text, *known, contract);
+			return 0;
+		}
+		if (gradientInputs)
+		{
+			RunDifferentiated(text, *gradientInputs, reverse, checkpointInterval, seed);
+			return 0;
+		}
+		if (monteCarloPaths)
+		{
+			RunMonteCarlo(text, monteCarloPaths, outputs, { seed, threads, floatingPointChecks, contract }, fastMath);
+			return 0;
+		}
+		if (!batchPath.empty())
+		{
+			RunBatch(text, batchPath, outputs, batchOutputPath, { delimiter, threads, seed, floatingPointChecks, contract }, fastMath);
+			return 0;
+		}
+		if (streamInputs)
+		{
+			streamOptions.seed = seed;
+			streamOptions.delimiter = delimiter;
+			streamOptions.floatingPointChecks = floatingPointChecks;
+			streamOptions.contract = contract;
+			RunStreaming(text, *streamInputs, outputs, streamOptions, flushInterval, fastMath);
+			return 0;
+		}
+		if (tieredRuns)
+		{
+			RunTiered(text, tieredRuns, thresholds, fastMath, seed, floatingPointChecks, contract);
+			return 0;
+		}
+		if (dumpTokens)
+		{
+			std::ios::sync_with_stdio(false);
+			DebugLexer(text, *dumpTokens);
+			return 0;
+		}
+		if (!lcovPath.empty())
+		{
+			InterpretWithCoverage(text, path.empty() ? "<sample>" : path, lcovPath, fastMath, osrThreshold, contract);
+			return 0;
+		}
+		Interpreter interpreter(std::make_unique<Parser>(std::make_unique<Lexer>(text)), fastMath, osrThreshold, contract);
+		interpreter.SetRandomStream(RandomStream(seed));
+		interpreter.SetFloatingPointChecks(floatingPointChecks);
 		interpreter.Interpret();
-#else
-		DebugLexer(text);
-#endif
 	}
 	catch (const std::exception& ex)
 	{
@@ -0,0 +1,174 @@
+#include "../src/Parser.h"
+#include "../src/BigInt.h"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+// Reads the exact values the scope keeps as doubles
+class ExactCalculator : public ExpressionCalculator
+{
+public:
+	std::string GetBigInt(const std::string& name)const
+	{
+		return m_bigints.at(SymbolTable::InternFolded(name))->ToString();
+	}
+};
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+// Runs 'statements' in a program declaring k and w as BIGINT, r as REAL
+ExactCalculator Run(const std::string& statements)
+{
+	auto program = Parse("PROGRAM Big;\nVAR\n   k, w : BIGINT;\n   r : REAL;\nBEGIN\n" + statements + "\nEND.\n");
+	ExactCalculator calculator;
+	program->Accept(calculator);
+	return calculator;
+}
+
+// Greatest and least values stored inline
+const int64_t INLINE_MAX = (int64_t(1) << 62) - 1;
+const int64_t INLINE_MIN = -(int64_t(1) << 62);
+
+void CheckValue(const BigInt& value, const std::string& text, bool small)
+{
+	BOOST_CHECK_EQUAL(value.ToString(), text);
+	BOOST_CHECK_EQUAL(value.IsSmall(), small);
+	BOOST_CHECK(BigInt::Parse(text) == value);
+}
+
+BigInt Divide(int64_t left, int64_t right)
+{
+	return BigInt::DivideRounded(BigInt(left), BigInt(right));
+}
+}
+
+BOOST_AUTO_TEST_SUITE(BigIntTests)
+
+BOOST_AUTO_TEST_CASE(ConstantsKeepTheirDigits)
+{
+	const ExactCalculator calculator = Run("   k := 9223372036854775807;\n"
+		"   w := 123456789012345678901234567890 * 10 + 1;\n"
+		"   r := 9007199254740993");
+	BOOST_CHECK_EQUAL(calculator.GetBigInt("k"), "9223372036854775807");
+	BOOST_CHECK_EQUAL(calculator.GetBigInt("w"), "1234567890123456789012345678901");
+	// Doubles get the nearest value
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("k"), 9223372036854775808.0);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("r"), 9007199254740992.0);
+}
+
+BOOST_AUTO_TEST_CASE(ConstantsBeyondDoublesAreParseErrors)
+{
+	const std::string digits(400, '9');
+	try
+	{
+		Parse("PROGRAM Big; VAR k : BIGINT; BEGIN k := " + digits + " END.");
+		BOOST_ERROR("the constant has been accepted");
+	}
+	catch (const std::runtime_error& error)
+	{
+		BOOST_CHECK_EQUAL(error.what(), "number constant out of range at pos 40: '" + digits + "'");
+	}
+	BOOST_CHECK_THROW(Parse("PROGRAM Big; VAR r : REAL; BEGIN r := " + digits + ".5 END."), std::runtime_error);
+	// Constants below the least double are 0
+	const ExactCalculator calculator = Run("   r := 0." + std::string(400, '0') + "1");
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("r"), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(ValuesSpillAndReturnAtSixtyThreeBits)
+{
+	const BigInt one(1);
+	CheckValue(BigInt(INLINE_MAX), "4611686018427387903", true);
+	CheckValue(BigInt(INLINE_MAX) + one, "4611686018427387904", false);
+	CheckValue(BigInt(INLINE_MAX) + one - one, "4611686018427387903", true);
+	CheckValue(BigInt(INLINE_MIN), "-4611686018427387904", true);
+	CheckValue(BigInt(INLINE_MIN) - one, "-4611686018427387905", false);
+	CheckValue(BigInt(INLINE_MIN) - one + one, "-4611686018427387904", true);
+	CheckValue(-BigInt(INLINE_MIN), "4611686018427387904", false);
+	CheckValue(-(-BigInt(INLINE_MIN)), "-4611686018427387904", true);
+	CheckValue(BigInt(int64_t(1) << 31) * BigInt(int64_t(1) << 30), "2305843009213693952", true);
+	CheckValue(BigInt(int64_t(1) << 31) * BigInt(int64_t(1) << 31), "4611686018427387904", false);
+	CheckValue(BigInt(std::numeric_limits<int64_t>::min()), "-9223372036854775808", false);
+
+	int64_t value = 0;
+	BOOST_CHECK(BigInt(std::numeric_limits<int64_t>::max()).TryGetInt64(value));
+	BOOST_CHECK_EQUAL(value, std::numeric_limits<int64_t>::max());
+	BOOST_CHECK(!(BigInt(std::numeric_limits<int64_t>::max()) + one).TryGetInt64(value));
+	BOOST_CHECK_EQUAL(BigInt::FromDouble(4611686018427387904.0).ToString(), "4611686018427387904");
+	BOOST_CHECK_EQUAL((BigInt(INLINE_MAX) + one).ToDouble(), 4611686018427387904.0);
+}
+
+BOOST_AUTO_TEST_CASE(DivisionRoundsHalfAwayFromZero)
+{
+	// The language has DIV only, no MOD
+	CheckValue(Divide(-7, 2), "-4", true);
+	CheckValue(Divide(7, 2), "4", true);
+	CheckValue(Divide(7, -2), "-4", true);
+	CheckValue(Divide(-7, -2), "4", true);
+	CheckValue(Divide(-5, 3), "-2", true);
+	CheckValue(Divide(4, -3), "-1", true);
+	CheckValue(BigInt::DivideRoundedByPowerOfTwo(BigInt(-7), 1), "-4", true);
+	CheckValue(BigInt::DivideRoundedByPowerOfTwo(BigInt(-6), 2), "-2", true);
+	CheckValue(BigInt::DivideRoundedByPowerOfTwo(BigInt(5), 2), "1", true);
+	BOOST_CHECK_THROW(Divide(1, 0), std::domain_error);
+
+	// Heap operands, and quotients that fit inline again
+	const BigInt large = BigInt::Parse("-100000000000000000000000000000000000001");
+	CheckValue(BigInt::DivideRounded(large, BigInt(2)), "-50000000000000000000000000000000000001", false);
+	CheckValue(BigInt::DivideRoundedByPowerOfTwo(large, 1), "-50000000000000000000000000000000000001", false);
+	CheckValue(BigInt::DivideRounded(large, BigInt::Parse("-20000000000000000000000000000000000000")), "5", true);
+	CheckValue(BigInt::DivideRounded(large, BigInt::Parse("40000000000000000000000000000000000000")), "-3", true);
+
+	// The same in programs, which also round INTEGER DIV so
+	const ExactCalculator calculator = Run("   k := -7 DIV 2;\n   w := -100000000000000000000000000000000000001 DIV 2;\n"
+		"   r := -7 DIV 2");
+	BOOST_CHECK_EQUAL(calculator.GetBigInt("k"), "-4");
+	BOOST_CHECK_EQUAL(calculator.GetBigInt("w"), "-50000000000000000000000000000000000001");
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("r"), -4.0);
+}
+
+BOOST_AUTO_TEST_CASE(ProductsCarryAcrossLimbs)
+{
+	CheckValue(BigInt(0xFFFFFFFF) * BigInt(0xFFFFFFFF), "18446744065119617025", false);
+	const BigInt word = BigInt::Parse("18446744073709551615");
+	CheckValue(word * word, "340282366920938463426481119284349108225", false);
+	CheckValue(word * -word, "-340282366920938463426481119284349108225", false);
+	CheckValue(word * BigInt(0), "0", true);
+
+	// (10^n - 1)^2 = 9...980...01, with operands of more than
+	// KARATSUBA_THRESHOLD limbs for n = 400
+	for (size_t digits : { 19, 40, 400 })
+	{
+		BOOST_TEST_CONTEXT(digits)
+		{
+			const BigInt nines = BigInt::Parse(std::string(digits, '9'));
+			const std::string square = std::string(digits - 1, '9') + "8" + std::string(digits - 1, '0') + "1";
+			CheckValue(nines * nines, square, false);
+			CheckValue(nines * nines - nines * nines, "0", true);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ParseReadsSignsAndDigits)
+{
+	CheckValue(BigInt::Parse("0"), "0", true);
+	CheckValue(BigInt::Parse("-0"), "0", true);
+	CheckValue(BigInt::Parse("000123"), "123", true);
+	CheckValue(BigInt::Parse("-4611686018427387904"), "-4611686018427387904", true);
+	CheckValue(BigInt::Parse("4611686018427387904"), "4611686018427387904", false);
+	// Chunks of nine digits
+	CheckValue(BigInt::Parse("1000000000"), "1000000000", true);
+	CheckValue(BigInt::Parse("-123456789123456789123456789"), "-123456789123456789123456789", false);
+	for (const char* text : { "", "-", "12a", "+5", "1.5", " 1" })
+	{
+		BOOST_TEST_CONTEXT(text)
+		{
+			BOOST_CHECK_THROW(BigInt::Parse(text), std::invalid_argument);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
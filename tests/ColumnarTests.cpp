@@ -0,0 +1,116 @@
+#include "TemporaryFile.h"
+#include "../src/Columnar.h"
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+
+namespace
+{
+// Offset of the first column header, and of its offset field; the second
+// one follows 24 bytes later, after the padded name "a"
+constexpr size_t FIRST_COLUMN = 24;
+
+const double A[] = { 1, 2, 3 };
+const double B[] = { -0.5, 0.25, 1e300 };
+
+// Columns "a" and "b" of three rows
+std::string WriteSample()
+{
+	const TemporaryFile file("sample.lsbc");
+	ColumnarFile::Write(file.GetPath(), { "a", "b" }, { A, B }, 3);
+	return file.Read();
+}
+
+template <typename T>
+void Patch(std::string& bytes, size_t position, T value)
+{
+	std::memcpy(&bytes[position], &value, sizeof(value));
+}
+
+template <typename T>
+void Append(std::string& bytes, T value)
+{
+	bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Checks that reading 'bytes' fails with a message containing 'reason'
+void CheckRejected(const std::string& bytes, const std::string& reason)
+{
+	const TemporaryFile file("rejected.lsbc", bytes);
+	try
+	{
+		ColumnarFile columnar(file.GetPath());
+		BOOST_ERROR("the file has been accepted");
+	}
+	catch (const std::runtime_error& error)
+	{
+		BOOST_CHECK_MESSAGE(std::string(error.what()).find(reason) != std::string::npos, error.what());
+	}
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ColumnarTests)
+
+BOOST_AUTO_TEST_CASE(WrittenColumnsAreReadBack)
+{
+	const TemporaryFile file("sample.lsbc", WriteSample());
+	const ColumnarFile columnar(file.GetPath());
+	BOOST_CHECK_EQUAL(columnar.GetRowCount(), 3u);
+	BOOST_REQUIRE_EQUAL(columnar.GetColumns().size(), 2u);
+	std::vector<double> storage;
+	const double* b = columnar.GetDoubles("B", storage);
+	BOOST_CHECK_EQUAL_COLLECTIONS(b, b + 3, std::begin(B), std::end(B));
+	BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(b) % ColumnarFile::ALIGNMENT, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedFilesAreRejected)
+{
+	const std::string bytes = WriteSample();
+	// Up to the end of the values of "b", the last column; the padding after
+	// them is not needed
+	uint64_t last;
+	std::memcpy(&last, &bytes[FIRST_COLUMN + 24], sizeof(last));
+	const size_t end = static_cast<size_t>(last) + sizeof(B);
+	BOOST_REQUIRE_LE(end, bytes.size());
+	for (size_t size = 0; size < end; ++size)
+	{
+		BOOST_TEST_CONTEXT(size)
+		{
+			CheckRejected(bytes.substr(0, size), "not a columnar file");
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(NamesCutInTheirPaddingAreRejected)
+{
+	// Two columns declared, the file ends after the first name and before its
+	// padding, past which the second header would be read
+	std::string bytes(ColumnarFile::MAGIC, sizeof(ColumnarFile::MAGIC));
+	Append<uint32_t>(bytes, ColumnarFile::VERSION);
+	Append<uint64_t>(bytes, 0);
+	Append<uint32_t>(bytes, 2);
+	Append<uint32_t>(bytes, 0);
+	Append<uint64_t>(bytes, 0);
+	Append<uint32_t>(bytes, ColumnarFile::Float64);
+	Append<uint32_t>(bytes, 3);
+	bytes += "abc";
+	CheckRejected(bytes, "the column headers are cut");
+
+	// A name longer than the file
+	Patch<uint32_t>(bytes, FIRST_COLUMN + 12, 0xFFFFFFFF);
+	CheckRejected(bytes, "the column headers are cut");
+}
+
+BOOST_AUTO_TEST_CASE(MisalignedDataIsRejected)
+{
+	std::string bytes = WriteSample();
+	uint64_t offset;
+	std::memcpy(&offset, &bytes[FIRST_COLUMN], sizeof(offset));
+	// Still a multiple of 8 and within the file
+	Patch<uint64_t>(bytes, FIRST_COLUMN, offset + 8);
+	CheckRejected(bytes, "the data of column 'a' is not aligned");
+
+	Patch<uint64_t>(bytes, FIRST_COLUMN, offset + ColumnarFile::ALIGNMENT * 1000);
+	CheckRejected(bytes, "the data of column 'a' is not in the file");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+#include "TemporaryFile.h"
+#include "../src/Parser.h"
+#include "../src/Batch.h"
+#include "../src/MonteCarlo.h"
+#include "../src/OnStackReplacement.h"
+#include "../src/Peephole.h"
+#include "../src/Streaming.h"
+#include "../src/Tiering.h"
+#include "../src/VirtualMachine.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+namespace
+{
+// x * x is 1 + 2^-29 + 2^-60 exactly, rounded it loses the 2^-60. Apart
+// x * x - x * x is 0, contracted one product stays exact and the difference
+// is that rounding error
+const double X = 1 + 1 / 1073741824.0;
+const double ROUNDING_ERROR = 1 / 1152921504606846976.0;
+
+const char* const PROGRAM = "PROGRAM Contraction;\nVAR\n   x, y : REAL;\n   i : INTEGER;\nBEGIN\n"
+	"   FOR i := 1 TO 3 DO\n      y := x * x - x * x\nEND.\n";
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+// With x assigned first, for the engines that take no inputs
+std::unique_ptr<ProgramNode> ParseWithInput()
+{
+	std::string text = PROGRAM;
+	text.insert(text.find("   FOR"), "   x := 1 + 1 / 1073741824;\n");
+	return Parse(text);
+}
+
+// What y has to be with the bytecode contracted or not
+double Expected(bool contract)
+{
+	return contract && PeepholeOptimizer::HasFusedMultiplyAdd() ? ROUNDING_ERROR : 0;
+}
+
+void CheckValue(double y, bool contract)
+{
+	BOOST_CHECK_EQUAL(std::abs(y), Expected(contract));
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ContractionTests)
+
+BOOST_AUTO_TEST_CASE(TreeWalkerRoundsEveryOperation)
+{
+	auto program = ParseWithInput();
+	ExpressionCalculator calculator;
+	program->Accept(calculator);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("x"), X);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("y"), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(VirtualMachineRoundsLikeThePeepholeOptimizer)
+{
+	for (bool contract : { false, true })
+	{
+		auto program = ParseWithInput();
+		BytecodeProgram code = BytecodeCompiler().Compile(*program);
+		PeepholeOptimizer(contract).Optimize(code);
+		code.Assemble();
+		VirtualMachine vm(code);
+		vm.Run();
+		CheckValue(vm.GetScope().at("y"), contract);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ReplacedLoopsAreContracted)
+{
+	for (bool contract : { false, true })
+	{
+		auto program = ParseWithInput();
+		OsrCalculator calculator(1, contract);
+		program->Accept(calculator);
+		BOOST_CHECK_EQUAL(calculator.GetStats().replacements, 1u);
+		CheckValue(calculator.GetScope().at("y"), contract);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PromotedProgramsAreContracted)
+{
+	for (bool contract : { false, true })
+	{
+		TieredExecutor::Thresholds thresholds;
+		thresholds.runs = 1;
+		TieredExecutor executor(thresholds);
+		executor.SetContraction(contract);
+		const size_t program = executor.Load(ParseWithInput());
+		BOOST_CHECK_EQUAL(executor.Run(program).at("y"), 0.0);
+		executor.Wait();
+		BOOST_REQUIRE_EQUAL(executor.GetTier(program), TieredExecutor::Bytecode);
+		CheckValue(executor.Run(program).at("y"), contract);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MonteCarloPathsAreContracted)
+{
+	for (bool contract : { false, true })
+	{
+		auto program = Parse(PROGRAM);
+		MonteCarlo::Options options;
+		options.threads = 2;
+		options.contract = contract;
+		MonteCarlo runner(*program, options);
+		runner.SetVariable("x", X);
+		const auto statistics = runner.Run(100, { "y" });
+		BOOST_REQUIRE(runner.GetStats().bytecode);
+		BOOST_CHECK_EQUAL(statistics[0].GetMin(), statistics[0].GetMax());
+		CheckValue(statistics[0].GetMean(), contract);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(StreamedRecordsAreContracted)
+{
+	for (bool contract : { false, true })
+	{
+		auto program = Parse(PROGRAM);
+		StreamingEvaluator::Options options;
+		options.contract = contract;
+		StreamingEvaluator evaluator(*program, { "x" }, { "y" }, options);
+		double y = -1;
+		evaluator.Evaluate(&X, &y);
+		CheckValue(y, contract);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BatchRowsAreContracted)
+{
+	const TemporaryFile input("contraction.csv", "x\n1.000000000931322574615478515625\n1.000000000931322574615478515625\n");
+	for (bool contract : { false, true })
+	{
+		auto program = Parse(PROGRAM);
+		BatchEvaluator::Options options;
+		options.threads = 1;
+		options.contract = contract;
+		BatchEvaluator evaluator(*program, options);
+		TemporaryFile output("contraction-output.csv");
+		std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+		BOOST_REQUIRE(out);
+		evaluator.Run(input.GetPath(), { "y" }, out);
+		std::fclose(out);
+
+		std::istringstream rows(output.Read());
+		std::string row;
+		BOOST_REQUIRE(std::getline(rows, row));
+		BOOST_CHECK_EQUAL(row, "y");
+		for (int i = 0; i < 2; ++i)
+		{
+			BOOST_REQUIRE(std::getline(rows, row));
+			CheckValue(std::strtod(row.c_str(), nullptr), contract);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+#include "../src/Coverage.h"
+#include "../src/LoopOptimizer.h"
+#include "../src/OnStackReplacement.h"
+#include "../src/RangeAnalysis.h"
+#include "../src/Tiering.h"
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+namespace
+{
+// Statements on lines 4 to 11, the loop on line 7 never runs its body
+const char* const PROGRAM = "PROGRAM Loops;\n"
+	"VAR i, j, s : INTEGER;\n"
+	"BEGIN\n"
+	"   s := 0;\n"
+	"   FOR i := 1 TO 3 DO\n"
+	"      s := s + i;\n"
+	"   FOR i := 3 TO 1 DO\n"
+	"      s := 0;\n"
+	"   FOR i := 1 TO 2 DO\n"
+	"      FOR j := 1 TO 2 DO\n"
+	"         s := s + j\n"
+	"END.\n";
+
+// Of one run of PROGRAM
+const char* const LINE_HITS = "DA:4,1\nDA:5,1\nDA:6,3\nDA:7,1\nDA:8,0\nDA:9,1\nDA:10,2\nDA:11,4\nLF:8\nLH:7\n";
+
+// Parsed and optimized as main does without --fast-math
+std::unique_ptr<ProgramNode> Instrument(StatementCoverage& coverage)
+{
+	auto program = StatementCoverage::Instrument(PROGRAM, coverage);
+	LoopOptimizer().Run(*program);
+	RangeAnalysis().Run(*program);
+	return program;
+}
+
+// Line hits of the lcov tracefile
+std::string GetLineHits(const StatementCoverage& coverage)
+{
+	std::ostringstream lcov;
+	coverage.WriteLcov(lcov, "loops.pas");
+	std::istringstream lines(lcov.str());
+	std::string hits;
+	for (std::string line; std::getline(lines, line);)
+	{
+		if (line.rfind("DA:", 0) == 0 || line.rfind("LF:", 0) == 0 || line.rfind("LH:", 0) == 0)
+		{
+			hits += line + "\n";
+		}
+	}
+	return hits;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(CoverageTests)
+
+BOOST_AUTO_TEST_CASE(SingleStatementLoopBodiesHaveLines)
+{
+	StatementCoverage coverage;
+	auto program = Instrument(coverage);
+	ExpressionCalculator calculator;
+	calculator.SetCoverageCounters(coverage.GetCounters());
+	program->Accept(calculator);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("s"), 12.0);
+	BOOST_CHECK_EQUAL(GetLineHits(coverage), LINE_HITS);
+}
+
+BOOST_AUTO_TEST_CASE(ReplacedLoopsCountTheirStatements)
+{
+	StatementCoverage coverage;
+	auto program = Instrument(coverage);
+	OsrCalculator calculator(1);
+	calculator.SetCoverageCounters(coverage.GetCounters());
+	program->Accept(calculator);
+	BOOST_CHECK_GT(calculator.GetStats().replacements, 0u);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("s"), 12.0);
+	BOOST_CHECK_EQUAL(GetLineHits(coverage), LINE_HITS);
+}
+
+BOOST_AUTO_TEST_CASE(PromotedProgramsCountTheirStatements)
+{
+	StatementCoverage coverage;
+	auto instrumented = Instrument(coverage);
+	TieredExecutor::Thresholds thresholds;
+	thresholds.runs = 1;
+	TieredExecutor executor(thresholds);
+	const size_t program = executor.Load(std::move(instrumented), coverage.GetCounters());
+	executor.Run(program);
+	executor.Wait();
+	BOOST_REQUIRE_EQUAL(executor.GetTier(program), TieredExecutor::Bytecode);
+	BOOST_CHECK_EQUAL(executor.Run(program).at("s"), 12.0);
+	BOOST_CHECK_EQUAL(executor.GetStats().bytecodeRuns, 1u);
+	BOOST_CHECK_EQUAL(GetLineHits(coverage),
+		"DA:4,2\nDA:5,2\nDA:6,6\nDA:7,2\nDA:8,0\nDA:9,2\nDA:10,4\nDA:11,8\nLF:8\nLH:7\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
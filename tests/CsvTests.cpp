@@ -0,0 +1,108 @@
+#include "TemporaryFile.h"
+#include "../src/Csv.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+using Columns = std::vector<std::vector<double>>;
+
+// Columns of the file read with AVX2 if the CPU has it, and with the
+// portable loop, which have to be the same bits
+Columns Read(const std::string& text, const std::vector<std::string>& columns)
+{
+	const TemporaryFile file("read.csv", text);
+	CsvReader reader(file.GetPath());
+	const Columns values = reader.Read(columns, 1);
+	reader.SetAvx2(false);
+	const Columns scalar = reader.Read(columns, 1);
+	BOOST_REQUIRE_EQUAL(scalar.size(), values.size());
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		BOOST_REQUIRE_EQUAL(scalar[i].size(), values[i].size());
+		BOOST_CHECK(std::memcmp(scalar[i].data(), values[i].data(), values[i].size() * sizeof(double)) == 0);
+	}
+	return values;
+}
+
+void CheckColumn(const std::vector<double>& actual, const std::vector<double>& expected)
+{
+	BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+// Message of the exception Read throws, empty if none
+std::string GetReadError(const std::string& text, const std::vector<std::string>& columns)
+{
+	try
+	{
+		Read(text, columns);
+	}
+	catch (const std::exception& ex)
+	{
+		return ex.what();
+	}
+	return std::string();
+}
+}
+
+BOOST_AUTO_TEST_SUITE(CsvTests)
+
+BOOST_AUTO_TEST_CASE(QuotedFieldsAreUnquoted)
+{
+	// Delimiters in quotes are not fields, a column that isn't read may hold text
+	const Columns columns = Read("\"a\", \"name, first\" ,c\n"
+		"\"1.5\",\"Smith, John\", 2\n"
+		" \"-3\" ,\"\",\"4e2\"\n", { "C", "a" });
+	BOOST_REQUIRE_EQUAL(columns.size(), 2u);
+	CheckColumn(columns[0], { 2, 400 });
+	CheckColumn(columns[1], { 1.5, -3 });
+}
+
+BOOST_AUTO_TEST_CASE(LineEndsAreOptional)
+{
+	// CRLF, blank lines and a last line without its end
+	const Columns columns = Read("a,b\r\n1,2\r\n\r\n\n3,4\r\n5,", { "a", "b" });
+	CheckColumn(columns[0], { 1, 3, 5 });
+	BOOST_REQUIRE_EQUAL(columns[1].size(), 3u);
+	BOOST_CHECK_EQUAL(columns[1][1], 4);
+	// An empty field reads as NaN
+	BOOST_CHECK(std::isnan(columns[1][2]));
+
+	CheckColumn(Read("a\n7", { "a" })[0], { 7 });
+	CheckColumn(Read("a\n", { "a" })[0], {});
+}
+
+BOOST_AUTO_TEST_CASE(FieldsCrossTheBlockBoundaries)
+{
+	// Every row a byte longer than the one before, so the fields and the
+	// quoted delimiters start at every offset of the 64-byte blocks and of
+	// their 32-byte AVX2 halves
+	std::string text = "a,text,b\n";
+	std::vector<double> a;
+	std::vector<double> b;
+	for (int row = 0; row < 200; ++row)
+	{
+		a.push_back(row + 0.125);
+		b.push_back(-1234567.5 * row);
+		char line[128];
+		std::snprintf(line, sizeof(line), "%.3f,\"%.*s,\",%.1f\n", a.back(), row % 67, "x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x",
+			b.back());
+		text += line;
+	}
+	const Columns columns = Read(text, { "a", "b" });
+	CheckColumn(columns[0], a);
+	CheckColumn(columns[1], b);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedRowsAreRejected)
+{
+	BOOST_CHECK_EQUAL(GetReadError("a,b\n1,2\n3,x\n", { "b" }), "line 3, column 'b': not a number");
+	BOOST_CHECK_EQUAL(GetReadError("a,b\n1,2\n3\n", { "a" }), "line 3: 1 fields, the header has 2");
+	BOOST_CHECK_EQUAL(GetReadError("a,b\n1,2,3\n", { "a" }), "line 2: 3 fields, the header has 2");
+	BOOST_CHECK_EQUAL(GetReadError("a,b\n1,2\n", { "c" }), "no column 'c'");
+	// A quote left open hides the delimiters after it
+	BOOST_CHECK_EQUAL(GetReadError("a,b\n\"1,2\n", { "a" }), "line 2, column 'a': not a number");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
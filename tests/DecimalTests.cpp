@@ -0,0 +1,110 @@
+#include "../src/Decimal.h"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+Decimal D(const char* lexeme)
+{
+	return Decimal::Parse(lexeme);
+}
+
+void CheckDecimal(const Decimal& value, const std::string& text, int scale)
+{
+	BOOST_CHECK_EQUAL(value.ToString(), text);
+	BOOST_CHECK_EQUAL(value.GetScale(), scale);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(DecimalTests)
+
+BOOST_AUTO_TEST_CASE(RoundingIsHalfAwayFromZero)
+{
+	CheckDecimal(D("1.25").Rescale(1), "1.3", 1);
+	CheckDecimal((-D("1.25")).Rescale(1), "-1.3", 1);
+	CheckDecimal(D("1.249").Rescale(1), "1.2", 1);
+	CheckDecimal(D("2.5").Rescale(0), "3", 0);
+	CheckDecimal(D("1.5").Rescale(4), "1.5000", 4);
+	// Fraction digits past MAX_SCALE are rounded by the first dropped one
+	CheckDecimal(D("0.1234567890123456785"), "0.123456789012345679", 18);
+	CheckDecimal(D("0.1234567890123456784999"), "0.123456789012345678", 18);
+
+	CheckDecimal(Decimal::Divide(D("1"), D("8"), 2), "0.13", 2);
+	CheckDecimal(Decimal::Divide(-D("1"), D("8"), 2), "-0.13", 2);
+	CheckDecimal(Decimal::Divide(D("1"), -D("8"), 2), "-0.13", 2);
+	CheckDecimal(D("2") / D("3"), "0.666667", 6);
+	CheckDecimal(-D("2") / D("3"), "-0.666667", 6);
+	// Exact where doubles are not
+	BOOST_CHECK(D("0.1") + D("0.2") == D("0.3"));
+}
+
+BOOST_AUTO_TEST_CASE(ScalesPropagateThroughProductsAndQuotients)
+{
+	CheckDecimal(D("1.5") * D("0.25"), "0.375", 3);
+	CheckDecimal(D("1.50") * D("2.0"), "3.000", 3);
+	CheckDecimal(D("1.5") + D("0.25"), "1.75", 2);
+	// Products needing more than MAX_SCALE digits are rounded to it
+	CheckDecimal(D("0.000000001") * D("0.0000000015"), "0.000000000000000002", 18);
+
+	// DIVISION_SCALE digits more than the operands, at least the minimum, at most MAX_SCALE
+	CheckDecimal(D("1.50") / D("3"), "0.50000000", 8);
+	CheckDecimal(D("1") / D("3"), "0.333333", 6);
+	BOOST_CHECK_EQUAL(Decimal::GetDivisionScale(D("1"), D("3"), 10), 10);
+	BOOST_CHECK_EQUAL(Decimal::GetDivisionScale(D("0.000000000000001"), D("3")), Decimal::MAX_SCALE);
+	CheckDecimal(D("0.000000000000001") / D("3"), "0.000000000000000333", 18);
+	// Quotients with fewer digits than the dividend
+	CheckDecimal(Decimal::Divide(D("10.75"), D("0.5"), 0), "22", 0);
+}
+
+BOOST_AUTO_TEST_CASE(OverflowThrows)
+{
+	const Decimal largest = D("9223372036854775807");
+	BOOST_CHECK_EQUAL(largest.GetUnits(), std::numeric_limits<int64_t>::max());
+	BOOST_CHECK_THROW(largest + D("1"), std::overflow_error);
+	BOOST_CHECK_THROW(-largest - D("1"), std::overflow_error);
+	BOOST_CHECK_THROW(D("4294967296") * D("4294967296"), std::overflow_error);
+	BOOST_CHECK_THROW(D("92233720368547758.07").Rescale(3), std::overflow_error);
+	BOOST_CHECK_THROW(Decimal::Divide(D("1"), D("0.000000000000000001"), 18), std::overflow_error);
+	BOOST_CHECK_THROW(D("1") / D("0.00"), std::domain_error);
+
+	BOOST_CHECK_THROW(D("9223372036854775808"), std::overflow_error);
+	Decimal parsed;
+	BOOST_CHECK(!Decimal::TryParse("922337203685477580.8", parsed));
+	BOOST_CHECK_THROW(Decimal::FromDouble(1e19), std::overflow_error);
+	BOOST_CHECK_THROW(Decimal::FromDouble(std::numeric_limits<double>::quiet_NaN()), std::overflow_error);
+
+	BOOST_CHECK_NO_THROW(D("123.45").CheckPrecision(5));
+	BOOST_CHECK_THROW(D("123.45").CheckPrecision(4), std::overflow_error);
+	BOOST_CHECK_THROW((-D("123.45")).CheckPrecision(4), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(ParsedAndPrintedValuesRoundTrip)
+{
+	for (const char* text : { "0", "7", "1.50", "123.456", "0.05", "0.000000000000000001",
+		"9223372036854775807", "922337203685477.5807", "0.999999999999999999" })
+	{
+		BOOST_TEST_CONTEXT(text)
+		{
+			BOOST_CHECK_EQUAL(D(text).ToString(), text);
+			BOOST_CHECK_EQUAL((-D(text)).ToString(), std::string(D(text).GetUnits() ? "-" : "") + text);
+			BOOST_CHECK(D(D(text).ToString().c_str()) == D(text));
+		}
+	}
+
+	// Doubles get the shortest scale that converts back to them
+	CheckDecimal(Decimal::FromDouble(0.1), "0.1", 1);
+	CheckDecimal(Decimal::FromDouble(-2.5), "-2.5", 1);
+	CheckDecimal(Decimal::FromDouble(1e15), "1000000000000000", 0);
+	for (double value : { 0.1, 0.7, 123.456, -98765.4321, 4503599627370497.0 })
+	{
+		BOOST_TEST_CONTEXT(value)
+		{
+			BOOST_CHECK_EQUAL(Decimal::FromDouble(value).ToDouble(), value);
+		}
+	}
+
+	// Usable at compile time
+	static_assert((Decimal::Parse("1.5") * Decimal::Parse("0.25")).GetUnits() == 375);
+	static_assert(Decimal::Parse("2.5").Rescale(0).GetUnits() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+#include "../src/Parser.h"
+#include "../src/Differentiation.h"
+#include "../src/LoopOptimizer.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+namespace
+{
+// Inputs in the order of the gradients
+using Inputs = std::vector<std::pair<std::string, double>>;
+
+struct Sample
+{
+	const char* name;
+	const char* text;
+	Inputs inputs;
+	const char* output;
+};
+
+// Products and quotients of the inputs, a loop compounding them with
+// invariants LoopOptimizer hoists, DIV away from its jumps, RANDOM draws and
+// nested loops. Their top-level loops run an odd number of iterations, so
+// checkpoints every 2 end with a shorter interval
+const Sample SAMPLES[] = {
+	{ "polynomial",
+		"PROGRAM Polynomial;\nVAR\n   x, z, y : REAL;\nBEGIN\n"
+		"   y := x * x * x - 2 * x * z + z / x - -z\nEND.\n",
+		{ { "x", 1.5 }, { "z", -0.75 } }, "y" },
+	{ "annuity",
+		"PROGRAM Annuity;\nVAR\n   rate, payment, v : REAL;\n   i : INTEGER;\nBEGIN\n"
+		"   v := 1000;\n"
+		"   FOR i := 1 TO 20 DO v := v * (1 + rate) - payment / i\nEND.\n",
+		{ { "rate", 0.05 }, { "payment", 30 } }, "v" },
+	{ "rounded",
+		"PROGRAM Rounded;\nVAR\n   x, z, y : REAL;\nBEGIN\n"
+		"   y := (x * 10) DIV 3 * z + x / z\nEND.\n",
+		{ { "x", 1.5 }, { "z", -0.75 } }, "y" },
+	{ "random",
+		"PROGRAM Drawn;\nVAR\n   x, y : REAL;\n   i : INTEGER;\nBEGIN\n"
+		"   y := 0;\n"
+		"   FOR i := 1 TO 5 DO y := y + x * RANDOM + RANDOMNORMAL\nEND.\n",
+		{ { "x", 2 } }, "y" },
+	{ "nested",
+		"PROGRAM Nested;\nVAR\n   a, b, s, t : REAL;\n   i, j : INTEGER;\nBEGIN\n"
+		"   s := a; t := 0;\n"
+		"   FOR i := 1 TO 5 DO\n   BEGIN\n"
+		"      t := t + s * b;\n"
+		"      FOR j := 1 TO i DO s := s * 0.5 + b / j;\n"
+		"      s := s + t * a\n"
+		"   END\nEND.\n",
+		{ { "a", 0.3 }, { "b", -1.25 } }, "s" },
+};
+
+const uint64_t SEED = 7;
+
+std::unique_ptr<ProgramNode> Parse(const Sample& sample, bool optimize)
+{
+	Parser parser(std::make_unique<Lexer>(sample.text));
+	auto program = parser.ParseAsProgram();
+	if (optimize)
+	{
+		LoopOptimizer().Run(*program);
+	}
+	return program;
+}
+
+std::vector<std::string> GetNames(const Inputs& inputs)
+{
+	std::vector<std::string> names;
+	for (const auto& input : inputs)
+	{
+		names.push_back(input.first);
+	}
+	return names;
+}
+
+double RunTreeWalker(const ProgramNode& program, const Inputs& inputs, const char* output)
+{
+	ExpressionCalculator calculator;
+	calculator.SetRandomStream(RandomStream(SEED));
+	for (const auto& [name, value] : inputs)
+	{
+		calculator.SetVariable(name, value);
+	}
+	program.Accept(calculator);
+	return calculator.GetScope().at(output);
+}
+
+// Derivatives of the output by central differences of tree walker runs
+std::vector<double> GetCentralDifferences(const ProgramNode& program, const Sample& sample)
+{
+	std::vector<double> differences;
+	for (size_t i = 0; i < sample.inputs.size(); ++i)
+	{
+		const double step = 1e-6 * std::max(1.0, std::abs(sample.inputs[i].second));
+		Inputs bumped = sample.inputs;
+		bumped[i].second = sample.inputs[i].second + step;
+		const double up = RunTreeWalker(program, bumped, sample.output);
+		bumped[i].second = sample.inputs[i].second - step;
+		const double down = RunTreeWalker(program, bumped, sample.output);
+		differences.push_back((up - down) / (2 * step));
+	}
+	return differences;
+}
+
+void CheckGradient(const std::vector<double>& gradient, const std::vector<double>& differences)
+{
+	BOOST_REQUIRE_EQUAL(gradient.size(), differences.size());
+	for (size_t i = 0; i < gradient.size(); ++i)
+	{
+		BOOST_TEST_CONTEXT("input " << i)
+		{
+			BOOST_CHECK_SMALL(gradient[i] - differences[i], 1e-8 * (1 + std::abs(differences[i])));
+		}
+	}
+}
+}
+
+BOOST_AUTO_TEST_SUITE(DifferentiationTests)
+
+BOOST_AUTO_TEST_CASE(ForwardGradientsMatchCentralDifferences)
+{
+	for (const Sample& sample : SAMPLES)
+	{
+		for (bool optimize : { false, true })
+		{
+			BOOST_TEST_CONTEXT(sample.name << (optimize ? ", optimized" : ""))
+			{
+				auto program = Parse(sample, optimize);
+				ForwardDifferentiator differentiator(GetNames(sample.inputs));
+				differentiator.SetRandomStream(RandomStream(SEED));
+				for (const auto& [name, value] : sample.inputs)
+				{
+					differentiator.SetVariable(name, value);
+				}
+				differentiator.Run(*program);
+				BOOST_CHECK_EQUAL(differentiator.GetScope().at(sample.output),
+					RunTreeWalker(*program, sample.inputs, sample.output));
+				CheckGradient(differentiator.GetGradient(sample.output), GetCentralDifferences(*program, sample));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ReverseGradientsMatchCentralDifferences)
+{
+	for (const Sample& sample : SAMPLES)
+	{
+		for (bool optimize : { false, true })
+		{
+			auto program = Parse(sample, optimize);
+			const std::vector<double> differences = GetCentralDifferences(*program, sample);
+			const double expected = RunTreeWalker(*program, sample.inputs, sample.output);
+			for (uint64_t checkpoint : { 0, 1, 2 })
+			{
+				BOOST_TEST_CONTEXT(sample.name << (optimize ? ", optimized" : "") << ", checkpoint " << checkpoint)
+				{
+					// Run twice, the second time on the tapes the first one left
+					ReverseDifferentiator differentiator(GetNames(sample.inputs), checkpoint);
+					for (int run = 0; run < 2; ++run)
+					{
+						differentiator.Reset();
+						differentiator.SetRandomStream(RandomStream(SEED));
+						for (const auto& [name, value] : sample.inputs)
+						{
+							differentiator.SetVariable(name, value);
+						}
+						differentiator.Run(*program);
+						BOOST_CHECK_EQUAL(differentiator.GetScope().at(sample.output), expected);
+						CheckGradient(differentiator.GetGradient(sample.output), differences);
+					}
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(CheckpointsBoundTheTape)
+{
+	const Sample& annuity = SAMPLES[1];
+	auto program = Parse(annuity, false);
+	size_t sizes[3];
+	for (uint64_t checkpoint : { 0, 1, 2 })
+	{
+		ReverseDifferentiator differentiator(GetNames(annuity.inputs), checkpoint);
+		for (const auto& [name, value] : annuity.inputs)
+		{
+			differentiator.SetVariable(name, value);
+		}
+		differentiator.Run(*program);
+		differentiator.GetGradient(annuity.output);
+		sizes[checkpoint] = differentiator.GetTapeSize();
+	}
+	// 20 iterations recorded, then one or two at a time
+	BOOST_CHECK_LT(sizes[1], sizes[2]);
+	BOOST_CHECK_LT(sizes[2] * 4, sizes[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,149 @@
+#include "../src/Parser.h"
+#include "../src/LoopOptimizer.h"
+#include "../src/OnStackReplacement.h"
+#include "../src/RangeAnalysis.h"
+#include "../src/Tiering.h"
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+// Programs whose loops the engines have to agree on: DIV of negative values
+// and by powers of two, which LoopOptimizer turns into shifts, inductions
+// and hoisted invariants, DOWNTO loops, empty ranges and fractional bounds
+const std::pair<const char*, const char*> PROGRAMS[] = {
+	{ "divisions",
+		"PROGRAM Divisions;\nVAR\n   a, b, s, i, j : INTEGER;\n   r : REAL;\nBEGIN\n"
+		"   a := 1000; s := 0; r := 0;\n"
+		"   FOR i := 1 TO 50 DO\n   BEGIN\n"
+		"      s := s + (a * i) DIV 7 - i DIV 4 + (-i) DIV 8 + (i - 25) DIV 3 + (i - 25) DIV 16;\n"
+		"      b := (s DIV i) DIV (i DIV 2 + 1);\n"
+		"      r := r + i / 3 + (r * 0.5) DIV 2;\n"
+		"      FOR j := -i TO i DO b := b + j DIV 2 - (j * a) DIV 64\n"
+		"   END\nEND.\n" },
+	{ "downwards",
+		"PROGRAM Downwards;\nVAR\n   i, j, s, step : INTEGER;\n   t : REAL;\nBEGIN\n"
+		"   s := 0; t := 1; step := 3;\n"
+		"   FOR i := 20 DOWNTO -20 DO\n   BEGIN\n"
+		"      s := s + i DIV 4 + step * i;\n"
+		"      FOR j := i DOWNTO i - 3 DO t := t * 0.5 + j / 7 + step * j\n"
+		"   END\nEND.\n" },
+	{ "empty",
+		"PROGRAM Empty;\nVAR\n   i, j, n, s : INTEGER;\n   t : REAL;\nBEGIN\n"
+		"   n := 0; s := 0; t := 0.25;\n"
+		"   FOR i := 1 TO n DO s := s + 1;\n"
+		"   FOR i := 5 TO 1 DO s := s + 100;\n"
+		"   FOR j := 1 DOWNTO 5 DO s := s + 1000;\n"
+		"   FOR i := 1 TO 10 DO\n   BEGIN\n"
+		"      FOR j := i + 1 TO i DO s := s + 1;\n"
+		"      FOR j := i DOWNTO i + 1 DO s := s - 1;\n"
+		"      FOR j := 5 DOWNTO i DO t := t + j * 0.1;\n"
+		"      s := s + j DIV 2\n"
+		"   END\nEND.\n" },
+	{ "fractional",
+		"PROGRAM Fractional;\nVAR\n   i, j : INTEGER;\n   x : REAL;\nBEGIN\n"
+		"   x := 0;\n"
+		"   FOR i := 0.5 TO 7.25 DO\n      FOR j := i DOWNTO i - 2.5 DO x := x + i / 10 - j DIV 2\n"
+		"END.\n" },
+};
+
+using Scope = std::map<std::string, double>;
+
+// Parsed and optimized as main does without --fast-math
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto program = parser.ParseAsProgram();
+	LoopOptimizer().Run(*program);
+	RangeAnalysis().Run(*program);
+	return program;
+}
+
+Scope RunTreeWalker(const std::string& text)
+{
+	auto program = Parse(text);
+	ExpressionCalculator calculator;
+	program->Accept(calculator);
+	return calculator.GetScope();
+}
+
+std::string Format(double value)
+{
+	char text[32];
+	std::snprintf(text, sizeof(text), "%a", value);
+	return text;
+}
+
+// Values have to be the same bits, which also tells -0 from 0
+void CheckSame(const Scope& expected, const Scope& actual)
+{
+	BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
+	for (const auto& [name, value] : expected)
+	{
+		BOOST_TEST_CONTEXT(name)
+		{
+			BOOST_REQUIRE_EQUAL(actual.count(name), 1u);
+			BOOST_CHECK_EQUAL(Format(actual.at(name)), Format(value));
+			BOOST_CHECK(std::memcmp(&actual.at(name), &value, sizeof(double)) == 0);
+		}
+	}
+}
+}
+
+BOOST_AUTO_TEST_SUITE(EngineTests)
+
+BOOST_AUTO_TEST_CASE(ReplacedLoopsMatchTreeWalker)
+{
+	for (const auto& [name, text] : PROGRAMS)
+	{
+		BOOST_TEST_CONTEXT(name)
+		{
+			const Scope expected = RunTreeWalker(text);
+			// Loops are replaced after their first back-edge, or in their second run
+			for (uint64_t threshold : { 1, 2, 7 })
+			{
+				auto program = Parse(text);
+				OsrCalculator calculator(threshold);
+				program->Accept(calculator);
+				BOOST_CHECK_GT(calculator.GetStats().replacements, 0u);
+				CheckSame(expected, calculator.GetScope());
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(TieredRunsMatchTreeWalker)
+{
+	for (const auto& [name, text] : PROGRAMS)
+	{
+		BOOST_TEST_CONTEXT(name)
+		{
+			const Scope expected = RunTreeWalker(text);
+			// Promoted after the first run, or by loop iterations with the first run replaced on stack
+			TieredExecutor::Thresholds byRuns;
+			byRuns.runs = 1;
+			TieredExecutor::Thresholds byIterations;
+			byIterations.runs = 1000;
+			byIterations.loopIterations = 1;
+			for (const auto& thresholds : { byRuns, byIterations })
+			{
+				TieredExecutor executor(thresholds);
+				const size_t program = executor.Load(Parse(text));
+				CheckSame(expected, executor.Run(program));
+				executor.Wait();
+				BOOST_REQUIRE_EQUAL(executor.GetTier(program), TieredExecutor::Bytecode);
+				for (int run = 0; run < 3; ++run)
+				{
+					CheckSame(expected, executor.Run(program));
+				}
+				const TieredExecutor::Stats stats = executor.GetStats();
+				BOOST_CHECK_EQUAL(stats.treeWalkerRuns, 1u);
+				BOOST_CHECK_EQUAL(stats.bytecodeRuns, 3u);
+				BOOST_CHECK_EQUAL(stats.loopsReplacedOnStack > 0, thresholds.loopIterations == 1);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,187 @@
+#include "TemporaryFile.h"
+#include "../src/Parser.h"
+#include "../src/Batch.h"
+#include "../src/MonteCarlo.h"
+#include "../src/OnStackReplacement.h"
+#include "../src/Streaming.h"
+#include "../src/Tiering.h"
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const char* const DIVISION = "PROGRAM Division;\nVAR\n   a, b, c : REAL;\nBEGIN\n   c := a / b\nEND.\n";
+
+// Loops raising each flag past the first iteration, after which
+// OsrCalculator(1) runs the loop in the VM
+const struct Fault
+{
+	const char* name;
+	const char* statements;
+	const char* error;
+} FAULTS[] = {
+	{ "division by zero", "   a := 1; b := 5;\n   FOR i := 1 TO 9 DO c := a / (b - i)",
+		"division by zero in 1 / 0, assignment to c" },
+	{ "overflow", "   a := 100000000000000000000; b := 1;\n   FOR i := 1 TO 20 DO c := c * a",
+		"overflow in 1e+300 * 1e+20, assignment to c" },
+	{ "invalid operation", "   a := 5; b := 5;\n   FOR i := 1 TO 9 DO c := (a - i) / (b - i)",
+		"invalid operation in 0 / 0, assignment to c" },
+};
+
+std::string MakeProgram(const Fault& fault)
+{
+	return std::string("PROGRAM Fault;\nVAR\n   a, b, c : REAL;\n   i : INTEGER;\nBEGIN\n   c := 1;\n")
+		+ fault.statements + "\nEND.\n";
+}
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+// Message of the exception 'run' throws, empty if none
+template <typename Function>
+std::string GetError(Function run)
+{
+	try
+	{
+		run();
+	}
+	catch (const std::exception& ex)
+	{
+		return ex.what();
+	}
+	return std::string();
+}
+
+// CSV of a and b with 'rows' rows dividing by 2, but row 'zero' (from 1) by 0
+std::string MakeRows(size_t rows, size_t zero)
+{
+	std::string text = "a,b\n";
+	for (size_t row = 1; row <= rows; ++row)
+	{
+		text += std::to_string(row) + (row == zero ? ",0\n" : ",2\n");
+	}
+	return text;
+}
+
+std::string RunBatch(const std::string& rows, unsigned threads, bool checks)
+{
+	const TemporaryFile input("fp-checks.csv", rows);
+	const TemporaryFile output("fp-checks-output.csv");
+	auto program = Parse(DIVISION);
+	BatchEvaluator::Options options;
+	options.threads = threads;
+	options.floatingPointChecks = checks;
+	BatchEvaluator evaluator(*program, options);
+	std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+	BOOST_REQUIRE(out);
+	const std::string error = GetError([&]() { evaluator.Run(input.GetPath(), { "c" }, out); });
+	std::fclose(out);
+	return error.empty() ? output.Read() : error;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(FloatingPointTests)
+
+BOOST_AUTO_TEST_CASE(BatchReportsTheRow)
+{
+	BOOST_CHECK_EQUAL(RunBatch(MakeRows(2, 2), 1, true), "row 2: division by zero in 2 / 0, assignment to c");
+	BOOST_CHECK_EQUAL(RunBatch(MakeRows(2, 2), 1, false), "c\n0.5\ninf\n");
+	BOOST_CHECK_EQUAL(RunBatch(MakeRows(2, 0), 1, true), "c\n0.5\n1\n");
+	// In a later chunk of the second thread
+	BOOST_CHECK_EQUAL(RunBatch(MakeRows(20000, 19000), 2, true), "row 19000: division by zero in 19000 / 0, assignment to c");
+}
+
+BOOST_AUTO_TEST_CASE(StreamingReportsTheRecord)
+{
+	auto program = Parse(DIVISION);
+	for (bool checks : { false, true })
+	{
+		StreamingEvaluator::Options options;
+		options.floatingPointChecks = checks;
+		StreamingEvaluator evaluator(*program, { "a", "b" }, { "c" }, options);
+		const double records[][2] = { { 1, 2 }, { 3, 0 } };
+		double c = 0;
+		evaluator.Evaluate(records[0], &c);
+		BOOST_CHECK_EQUAL(c, 0.5);
+		const std::string error = GetError([&]() { evaluator.Evaluate(records[1], &c); });
+		if (checks)
+		{
+			BOOST_CHECK_EQUAL(error, "record 2: division by zero in 3 / 0, assignment to c");
+		}
+		else
+		{
+			BOOST_CHECK(error.empty() && std::isinf(c));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EveryEngineReportsTheStatement)
+{
+	for (const Fault& fault : FAULTS)
+	{
+		BOOST_TEST_CONTEXT(fault.name)
+		{
+			const std::string text = MakeProgram(fault);
+			auto program = Parse(text);
+
+			ExpressionCalculator calculator;
+			calculator.SetFloatingPointChecks(true);
+			BOOST_CHECK_EQUAL(GetError([&]() { program->Accept(calculator); }), fault.error);
+
+			OsrCalculator replaced(1);
+			replaced.SetFloatingPointChecks(true);
+			BOOST_CHECK_EQUAL(GetError([&]() { program->Accept(replaced); }), fault.error);
+			BOOST_CHECK_EQUAL(replaced.GetStats().compiledLoops, 1u);
+
+			// Tree walker first, then bytecode
+			TieredExecutor::Thresholds thresholds;
+			thresholds.runs = 1;
+			TieredExecutor executor(thresholds);
+			executor.SetFloatingPointChecks(true);
+			const size_t loaded = executor.Load(Parse(text));
+			BOOST_CHECK_EQUAL(GetError([&]() { executor.Run(loaded); }), fault.error);
+			executor.Wait();
+			BOOST_REQUIRE_EQUAL(executor.GetTier(loaded), TieredExecutor::Bytecode);
+			BOOST_CHECK_EQUAL(GetError([&]() { executor.Run(loaded); }), fault.error);
+
+			for (bool decimal : { false, true })
+			{
+				// DECIMAL keeps the paths in the tree walker
+				std::string paths = text;
+				if (decimal)
+				{
+					paths.insert(paths.find("BEGIN"), "   d : DECIMAL(10, 2);\n");
+				}
+				MonteCarlo::Options options;
+				options.threads = 2;
+				options.floatingPointChecks = true;
+				auto simulated = Parse(paths);
+				MonteCarlo runner(*simulated, options);
+				BOOST_CHECK_EQUAL(GetError([&]() { runner.Run(10, { "c" }); }), std::string("path 0: ") + fault.error);
+			}
+
+			StreamingEvaluator::Options streaming;
+			streaming.floatingPointChecks = true;
+			StreamingEvaluator evaluator(*program, { "b" }, { "c" }, streaming);
+			double c = 0;
+			const double b = 5;
+			BOOST_CHECK_EQUAL(GetError([&]() { evaluator.Evaluate(&b, &c); }), std::string("record 1: ") + fault.error);
+
+			const TemporaryFile input("fp-statement.csv", "b\n5\n");
+			const TemporaryFile output("fp-statement-output.csv");
+			BatchEvaluator::Options batch;
+			batch.threads = 1;
+			batch.floatingPointChecks = true;
+			BatchEvaluator rows(*program, batch);
+			std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+			BOOST_REQUIRE(out);
+			BOOST_CHECK_EQUAL(GetError([&]() { rows.Run(input.GetPath(), { "c" }, out); }), std::string("row 1: ") + fault.error);
+			std::fclose(out);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
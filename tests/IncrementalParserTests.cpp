@@ -0,0 +1,190 @@
+#include "TreePrinter.h"
+#include "../src/IncrementalParser.h"
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <random>
+
+namespace
+{
+std::string MakeProgram(size_t statements)
+{
+	std::string text = "PROGRAM Edits;\nVAR\n   a, b, i, j : INTEGER;\n   x : REAL;\nBEGIN\n";
+	for (size_t i = 0; i < statements; ++i)
+	{
+		const std::string n = std::to_string(i + 1);
+		switch (i % 4)
+		{
+		case 0:
+			text += "   a := " + n + " * (b + 7) DIV 3;\n";
+			break;
+		case 1:
+			text += "   BEGIN\n      b := a - " + n + ";\n      x := b / 2.5\n   END;\n";
+			break;
+		case 2:
+			text += "   FOR i := 1 TO " + n + " DO\n      BEGIN\n         j := j + i;\n         a := -a\n      END;\n";
+			break;
+		default:
+			text += "   FOR j := " + n + " DOWNTO 0 DO x := x + 1.5 * j;\n";
+			break;
+		}
+	}
+	return text + "   b := 0\nEND.\n";
+}
+
+std::string FullParse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return TreePrinter().Print(*parser.ParseAsProgram());
+}
+
+// Offsets and lengths of the number constants of the text
+std::vector<std::pair<size_t, size_t>> FindNumbers(const std::string& text)
+{
+	std::vector<std::pair<size_t, size_t>> numbers;
+	Lexer lexer(text);
+	for (Token token = lexer.Advance(); token.type != TokenType::EndOfFile; token = lexer.Advance())
+	{
+		if (token.type == TokenType::IntegerConstant || token.type == TokenType::RealConstant)
+		{
+			numbers.emplace_back(token.offset, token.value->length());
+		}
+	}
+	return numbers;
+}
+
+// Applies the edit to both, the trees have to match or both texts be invalid
+void CheckEdit(IncrementalParser& incremental, std::string& text, size_t offset, size_t length, const std::string& replacement)
+{
+	text.replace(offset, length, replacement);
+	std::optional<std::string> expected;
+	try
+	{
+		expected = FullParse(text);
+	}
+	catch (const std::exception&)
+	{
+	}
+	try
+	{
+		incremental.Edit(offset, length, replacement);
+	}
+	catch (const std::exception&)
+	{
+		BOOST_REQUIRE_MESSAGE(!expected, "the incremental parser rejects a valid text:\n" + text);
+		return;
+	}
+	BOOST_REQUIRE_MESSAGE(expected, "the incremental parser accepts an invalid text:\n" + text);
+	BOOST_REQUIRE_EQUAL(TreePrinter().Print(incremental.GetProgram()), *expected);
+	BOOST_REQUIRE_EQUAL(incremental.GetText(), text);
+}
+
+// Microseconds per edit retyping random numbers of a program, checking
+// that every edit reparses one statement
+double TimeRetyping(size_t statements, int edits)
+{
+	std::string text = MakeProgram(statements);
+	IncrementalParser incremental(text);
+	auto numbers = FindNumbers(text);
+	std::mt19937_64 random(3);
+	std::chrono::duration<double, std::micro> elapsed(0);
+	for (int edit = 0; edit < edits; ++edit)
+	{
+		const size_t number = random() % numbers.size();
+		const auto [offset, length] = numbers[number];
+		const std::string replacement = std::to_string(random() % 100000);
+		const auto start = std::chrono::steady_clock::now();
+		incremental.Edit(offset, length, replacement);
+		elapsed += std::chrono::steady_clock::now() - start;
+		BOOST_REQUIRE(!incremental.GetLastEditStats().fullReparse);
+		BOOST_REQUIRE_LT(incremental.GetLastEditStats().reparsedTokens, 30u);
+
+		numbers[number].second = replacement.length();
+		for (size_t i = number + 1; i < numbers.size(); ++i)
+		{
+			numbers[i].first = numbers[i].first + replacement.length() - length;
+		}
+	}
+	return elapsed.count() / edits;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(IncrementalParserTests)
+
+BOOST_AUTO_TEST_CASE(RetypedNumbersReparseOneStatement)
+{
+	std::string text = MakeProgram(200);
+	IncrementalParser incremental(text);
+	std::mt19937_64 random(1);
+	for (int edit = 0; edit < 500; ++edit)
+	{
+		const auto numbers = FindNumbers(text);
+		const auto [offset, length] = numbers[random() % numbers.size()];
+		// Numbers get longer and shorter, so the following offsets move both ways
+		const std::string replacement = std::to_string(random() % 1000000 / (1 + random() % 10000));
+		CheckEdit(incremental, text, offset, length, replacement);
+		BOOST_CHECK(!incremental.GetLastEditStats().fullReparse);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(RandomEditsMatchFullParse)
+{
+	const std::vector<std::string> pieces = { "", " ", ";", "a", "x1", "7", "2.5", "+", "-", "*", "/", " DIV ",
+		":=", "(", ")", "BEGIN ", " END", "FOR i := 1 TO 3 DO ", "b := a;", "{c}" };
+	std::mt19937_64 random(2);
+	for (int program = 0; program < 20; ++program)
+	{
+		std::string text = MakeProgram(2 + program * 3);
+		IncrementalParser incremental(text);
+		for (int edit = 0; edit < 200; ++edit)
+		{
+			const size_t offset = random() % (text.length() + 1);
+			const size_t length = std::min<size_t>(random() % 4, text.length() - offset);
+			CheckEdit(incremental, text, offset, length, pieces[random() % pieces.size()]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ShrinkingEditsKeepLaterOffsets)
+{
+	std::string text = MakeProgram(40);
+	IncrementalParser incremental(text);
+	// Every edit moves the tail back, then one after it has to land in place
+	for (int edit = 0; edit < 30; ++edit)
+	{
+		const auto numbers = FindNumbers(text);
+		const auto [offset, length] = numbers[edit % 4];
+		CheckEdit(incremental, text, offset, length, "1");
+		CheckEdit(incremental, text, offset, 1, "100000");
+		CheckEdit(incremental, text, offset, 6, "2");
+		const auto last = FindNumbers(text).back();
+		CheckEdit(incremental, text, last.first, last.second, std::to_string(edit));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EditsAcrossPiecesMatchFullParse)
+{
+	// Long deletions and insertions join and cut the pieces of the text
+	const std::vector<std::string> pieces = { "", ";", "a", "7", " DIV ", "BEGIN ", " END", "FOR i := 1 TO 3 DO ",
+		"b := a;", std::string(200, ' '), "x := 1.5;\n   a := 2;\n   b := 3;\n   j := 4;\n" };
+	std::mt19937_64 random(4);
+	std::string text = MakeProgram(150);
+	IncrementalParser incremental(text);
+	for (int edit = 0; edit < 400; ++edit)
+	{
+		const size_t offset = random() % (text.length() + 1);
+		const size_t length = std::min<size_t>(random() % 4 == 0 ? random() % 300 : random() % 4, text.length() - offset);
+		CheckEdit(incremental, text, offset, length, pieces[random() % pieces.size()]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EditCostDoesNotGrowWithTheProgram)
+{
+	// Edits of a 100k statement program cost about as much as those of a
+	// small one, moving everything after the edit would make it 100 times
+	const double small = TimeRetyping(1000, 2000);
+	const double large = TimeRetyping(100000, 2000);
+	BOOST_TEST_MESSAGE("us per edit: " << small << " at 1000 statements, " << large << " at 100000");
+	BOOST_CHECK_LT(large, 10 * small);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
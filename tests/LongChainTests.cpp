@@ -0,0 +1,94 @@
+#include "../src/Parser.h"
+#include "../src/LoopOptimizer.h"
+#include "../src/RangeAnalysis.h"
+#include "../src/Reassociation.h"
+#include "../src/Peephole.h"
+#include "../src/VirtualMachine.h"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+// x is a sum of 'terms' ones, y adds -1 * 1 + 2 DIV 1 to it terms / 4 times
+std::string MakeProgram(size_t terms)
+{
+	std::string text = "PROGRAM Chains;\nVAR\n   x, y, i : INTEGER;\nBEGIN\n   x := 1";
+	for (size_t i = 1; i < terms; ++i)
+	{
+		text += " + 1";
+	}
+	text += ";\n   FOR i := 1 TO 2 DO\n      y := x";
+	static const char* const OPERATIONS[] = { " - 1", " * 1", " + 2", " DIV 1" };
+	for (size_t i = 0; i < terms; ++i)
+	{
+		text += OPERATIONS[i % 4];
+	}
+	return text + "\nEND.\n";
+}
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+void CheckScope(const std::map<std::string, double>& scope, size_t terms)
+{
+	BOOST_REQUIRE_EQUAL(scope.count("x"), 1u);
+	BOOST_REQUIRE_EQUAL(scope.count("y"), 1u);
+	BOOST_CHECK_EQUAL(scope.at("x"), double(terms));
+	BOOST_CHECK_EQUAL(scope.at("y"), double(terms + terms / 4));
+}
+
+void CheckEngines(size_t terms)
+{
+	const std::string text = MakeProgram(terms);
+	{
+		auto program = Parse(text);
+		ExpressionCalculator calculator;
+		program->Accept(calculator);
+		CheckScope(calculator.GetScope(), terms);
+	}
+	for (bool fastMath : { false, true })
+	{
+		auto program = Parse(text);
+		if (fastMath)
+		{
+			Reassociation().Run(*program);
+		}
+		LoopOptimizer().Run(*program);
+		RangeAnalysis().Run(*program);
+		ExpressionCalculator calculator;
+		program->Accept(calculator);
+		CheckScope(calculator.GetScope(), terms);
+
+		BytecodeProgram bytecode = BytecodeCompiler().Compile(*program);
+		PeepholeOptimizer().Optimize(bytecode);
+		bytecode.Assemble();
+		VirtualMachine vm(bytecode);
+		vm.Run();
+		CheckScope(vm.GetScope(), terms);
+	}
+}
+}
+
+BOOST_AUTO_TEST_SUITE(LongChainTests)
+
+BOOST_AUTO_TEST_CASE(ChainsTakeNoNestingLevels)
+{
+	CheckEngines(Parser::MAX_NESTING_DEPTH + 1000);
+}
+
+BOOST_AUTO_TEST_CASE(MillionOperatorChainsRunEverywhere)
+{
+	CheckEngines(1000000);
+}
+
+BOOST_AUTO_TEST_CASE(ParenthesesAreStillLimited)
+{
+	const std::string open(Parser::MAX_NESTING_DEPTH + 1, '(');
+	const std::string close(Parser::MAX_NESTING_DEPTH + 1, ')');
+	BOOST_CHECK_THROW(Parse("PROGRAM P; BEGIN x := " + open + "1" + close + " END."), std::runtime_error);
+	BOOST_CHECK_NO_THROW(Parse("PROGRAM P; BEGIN x := " + open.substr(100) + "1" + close.substr(100) + " END."));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+#include "TreePrinter.h"
+#include "../src/Parser.h"
+#include "../src/TokenStream.h"
+#include "../src/VirtualMachine.h"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ParserTests)
+
+BOOST_AUTO_TEST_CASE(RealLiteralsKeepTheirFraction)
+{
+	// Number leaves once took an int, which cut 3.14 to 3
+	auto program = Parse("PROGRAM Reals;\nVAR\n   r, s : REAL;\n   i : INTEGER;\nBEGIN\n"
+		"   r := 3.14;\n   s := 0.5 * 2.75 - 0.999;\n   i := 7\nEND.\n");
+	const auto& statements = program->GetBlock().GetCompound();
+	const auto& assign = static_cast<const AssignNode&>(statements.GetChild(0));
+	BOOST_CHECK_EQUAL(TreePrinter().Print(assign.GetRight()), TreePrinter().Print(LeafNumNode(3.14, false)));
+
+	const double s = 0.5 * 2.75 - 0.999;
+	ExpressionCalculator calculator;
+	program->Accept(calculator);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("r"), 3.14);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("s"), s);
+	BOOST_CHECK_EQUAL(calculator.GetScope().at("i"), 7.0);
+
+	BytecodeProgram code = BytecodeCompiler().Compile(*program);
+	code.Assemble();
+	VirtualMachine machine(code);
+	machine.Run();
+	BOOST_CHECK_EQUAL(machine.GetScope().at("r"), 3.14);
+	BOOST_CHECK_EQUAL(machine.GetScope().at("s"), s);
+}
+
+BOOST_AUTO_TEST_CASE(TokenViewsMatchTokens)
+{
+	const std::string text = "program X; VAR aB_1 : Real; BEGIN aB_1 := 12.50 DIV 3 { note } ;\n"
+		"For i := 1 DownTo 0 do x := RandomNormal END.";
+	Lexer tokens(text);
+	Lexer views(text);
+	Token token;
+	do
+	{
+		token = tokens.Advance();
+		const TokenView view = views.AdvanceView();
+		BOOST_CHECK(view.type == token.type);
+		BOOST_CHECK_EQUAL(view.lexeme, token.value.value_or(""));
+		BOOST_CHECK_EQUAL(view.offset, token.offset);
+	} while (token.type != TokenType::EndOfFile);
+}
+
+BOOST_AUTO_TEST_CASE(LookaheadIsBoundedInEveryBuild)
+{
+	TokenStream tokens(std::make_unique<Lexer>("PROGRAM Ahead; BEGIN END."));
+	const size_t last = TokenStream::MAX_LOOKAHEAD - 1;
+	BOOST_CHECK(tokens.Peek(last).type == TokenType::Begin);
+	BOOST_CHECK_THROW(tokens.Peek(TokenStream::MAX_LOOKAHEAD), std::out_of_range);
+	// The window is left as it was
+	BOOST_CHECK(tokens.Peek().type == TokenType::Program);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
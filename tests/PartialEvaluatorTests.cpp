@@ -0,0 +1,142 @@
+#include "../src/Parser.h"
+#include "../src/LoopOptimizer.h"
+#include "../src/PartialEvaluator.h"
+#include "../src/Peephole.h"
+#include "../src/RangeAnalysis.h"
+#include "../src/VirtualMachine.h"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct Sample
+{
+	const char* name;
+	const char* text;
+	PartialEvaluator::Values known;
+	bool bytecode; // has no DECIMAL or BIGINT variables
+};
+
+// Known inputs never read, read in loops, overwritten, bounding an empty loop
+// and read by DECIMAL arithmetic
+const Sample SAMPLES[] = {
+	{ "unread",
+		"PROGRAM Unread;\nVAR\n   x, y : REAL;\nBEGIN\n   y := 3\nEND.\n",
+		{ { "x", 2 } }, true },
+	{ "tax",
+		"PROGRAM Tax;\nVAR\n   rate, threshold, income, tax, net : REAL;\n   i : INTEGER;\nBEGIN\n"
+		"   tax := 0;\n"
+		"   FOR i := 1 TO 10 DO\n   BEGIN\n"
+		"      income := i * 1000;\n"
+		"      tax := tax + (income - threshold) * rate\n"
+		"   END;\n"
+		"   net := income - tax\nEND.\n",
+		{ { "Rate", 0.2 }, { "threshold", 500 } }, true },
+	{ "overwritten",
+		"PROGRAM Overwritten;\nVAR\n   n, s, i : INTEGER;\nBEGIN\n"
+		"   s := 0;\n   n := n * 2;\n"
+		"   FOR i := 1 TO n DO s := s + n;\n"
+		"   n := 0\nEND.\n",
+		{ { "n", 3 } }, true },
+	{ "empty",
+		"PROGRAM Empty;\nVAR\n   n, s, i : INTEGER;\nBEGIN\n"
+		"   s := 0;\n   FOR i := 1 TO n DO s := s + 1\nEND.\n",
+		{ { "n", 0 } }, true },
+	{ "exact",
+		"PROGRAM Exact;\nVAR\n   d : DECIMAL(10, 2);\n   r : REAL;\n   i : INTEGER;\nBEGIN\n"
+		"   d := r * 3;\n   FOR i := 1 TO 3 DO d := d + r\nEND.\n",
+		{ { "r", 1.25 } }, false },
+};
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+std::map<std::string, double> RunTreeWalker(const ProgramNode& program, const PartialEvaluator::Values& known)
+{
+	ExpressionCalculator calculator;
+	for (const auto& [name, value] : known)
+	{
+		calculator.SetVariable(name, value);
+	}
+	program.Accept(calculator);
+	return calculator.GetScope();
+}
+
+// Instructions the bytecode dispatches with the known values set, as main
+// counts them for --specialize
+uint64_t CountDispatches(const ProgramNode& program, const PartialEvaluator::Values& known)
+{
+	BytecodeProgram code = BytecodeCompiler().Compile(program);
+	PeepholeOptimizer().Optimize(code);
+	code.Assemble();
+	VirtualMachine machine(code);
+	for (const auto& [name, value] : known)
+	{
+		auto variable = std::find_if(code.variables.begin(), code.variables.end(), [&](const std::string& candidate) {
+			return boost::algorithm::iequals(candidate, name);
+		});
+		if (variable != code.variables.end())
+		{
+			machine.SetVariable(static_cast<uint32_t>(variable - code.variables.begin()), value);
+		}
+	}
+	machine.Run();
+	return machine.GetDispatchCount();
+}
+}
+
+BOOST_AUTO_TEST_SUITE(PartialEvaluatorTests)
+
+BOOST_AUTO_TEST_CASE(ResidualProgramsMatchTheOriginal)
+{
+	for (const Sample& sample : SAMPLES)
+	{
+		BOOST_TEST_CONTEXT(sample.name)
+		{
+			auto program = Parse(sample.text);
+			SpecializationCache cache(*program);
+			const auto expected = RunTreeWalker(*program, sample.known);
+			const auto actual = RunTreeWalker(*cache.Get(sample.known), sample.known);
+			BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+			for (const auto& [name, value] : expected)
+			{
+				BOOST_TEST_CONTEXT(name)
+				{
+					BOOST_REQUIRE_EQUAL(actual.count(name), 1u);
+					BOOST_CHECK_EQUAL(actual.at(name), value);
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ResidualProgramsDispatchNoMoreThanTheOriginal)
+{
+	for (const Sample& sample : SAMPLES)
+	{
+		if (!sample.bytecode)
+		{
+			continue;
+		}
+		BOOST_TEST_CONTEXT(sample.name)
+		{
+			auto program = Parse(sample.text);
+			SpecializationCache cache(*program);
+			auto residual = cache.Get(sample.known);
+			LoopOptimizer().Run(*program);
+			RangeAnalysis().Run(*program);
+			BOOST_CHECK_LE(CountDispatches(*residual, sample.known), CountDispatches(*program, sample.known));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(UnchangedInputsAreNotStored)
+{
+	auto program = Parse(SAMPLES[0].text);
+	auto residual = PartialEvaluator().Specialize(*program, SAMPLES[0].known);
+	BOOST_CHECK_EQUAL(residual->GetBlock().GetCompound().GetChildren().size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
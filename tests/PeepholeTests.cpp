@@ -0,0 +1,184 @@
+#include "../src/Parser.h"
+#include "../src/LoopOptimizer.h"
+#include "../src/Peephole.h"
+#include "../src/VirtualMachine.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+namespace
+{
+struct Sample
+{
+	const char* pattern;
+	const char* statements;
+	// Listing of the optimized code, see GetListing
+	const char* listing;
+	// Whether LoopOptimizer turns DIV by powers of two into shifts first
+	bool shifts;
+};
+
+// Statements of a program declaring x, y and z as REAL, x = 3 and z = -0.75
+// on input. Every pattern of Peephole.cpp that compiled programs produce
+const Sample SAMPLES[] = {
+	{ "tee-pop", "y := x", "Load x; Store y", false },
+	{ "store-load", "y := x;\n   z := y", "Load x; Tee y; Store z", false },
+	{ "pos", "y := +x", "Load x; Store y", false },
+	{ "neg-neg", "y := -(-x)", "Load x; Store y", false },
+	{ "neg-const", "y := -(2.5)", "PushConst -2.5; Store y", false },
+	{ "mul-one", "y := x * 1", "Load x; Store y", false },
+	{ "div-one", "y := x / 1", "Load x; Store y", false },
+	{ "fold-add", "y := 1 + 2 + x", "PushConst 3; Load x; Add; Store y", false },
+	{ "fold-sub", "y := 5 - 7", "PushConst -2; Store y", false },
+	{ "fold-mul", "y := 1.5 * 4", "PushConst 6; Store y", false },
+	{ "fold-div", "y := 1 / 4", "PushConst 0.25; Store y", false },
+	{ "fold-intdiv", "y := 7 DIV 2", "PushConst 4; Store y", false },
+	{ "fold-shift", "y := 7 DIV 2 + x DIV 4", "PushConst 4; Load x; IntDivByPowerOfTwo 0.25; Add; Store y", true },
+};
+
+const double X = 3;
+const double Z = -0.75;
+
+std::unique_ptr<ProgramNode> Parse(const std::string& statements, bool shifts)
+{
+	Parser parser(std::make_unique<Lexer>("PROGRAM Peephole;\nVAR\n   x, y, z : REAL;\nBEGIN\n   "
+		+ statements + "\nEND.\n"));
+	auto program = parser.ParseAsProgram();
+	if (shifts)
+	{
+		LoopOptimizer().Run(*program);
+	}
+	return program;
+}
+
+// Instructions separated by "; ", without the indices of Print
+std::string GetListing(const BytecodeProgram& code)
+{
+	std::ostringstream printed;
+	code.Print(printed);
+	std::istringstream lines(printed.str());
+	std::string listing;
+	for (std::string line; std::getline(lines, line);)
+	{
+		std::istringstream words(line);
+		std::string word;
+		words >> word;
+		for (bool first = true; words >> word; first = false)
+		{
+			listing += (first ? (listing.empty() ? "" : "; ") : " ") + word;
+		}
+	}
+	return listing;
+}
+
+std::map<std::string, double> RunTreeWalker(const ProgramNode& program, double z)
+{
+	ExpressionCalculator calculator;
+	calculator.SetVariable("x", X);
+	calculator.SetVariable("z", z);
+	program.Accept(calculator);
+	return calculator.GetScope();
+}
+
+std::map<std::string, double> RunVirtualMachine(const BytecodeProgram& code, double z)
+{
+	VirtualMachine machine(code);
+	for (const auto& [name, value] : { std::make_pair("x", X), std::make_pair("z", z) })
+	{
+		const uint32_t variable = code.FindVariable(name);
+		if (variable != BytecodeProgram::NO_VARIABLE)
+		{
+			machine.SetVariable(variable, value);
+		}
+	}
+	machine.Run();
+	return machine.GetScope();
+}
+
+// Values of the variables the code uses have to be the same bits, which also
+// tells the signs of NaN apart
+void CheckSame(const std::map<std::string, double>& expected, const std::map<std::string, double>& actual)
+{
+	BOOST_CHECK(!actual.empty());
+	for (const auto& [name, value] : actual)
+	{
+		BOOST_TEST_CONTEXT(name)
+		{
+			BOOST_REQUIRE_EQUAL(expected.count(name), 1u);
+			BOOST_CHECK(std::memcmp(&expected.at(name), &value, sizeof(double)) == 0);
+		}
+	}
+}
+}
+
+BOOST_AUTO_TEST_SUITE(PeepholeTests)
+
+BOOST_AUTO_TEST_CASE(PatternsRewriteTheirWindows)
+{
+	for (const Sample& sample : SAMPLES)
+	{
+		BOOST_TEST_CONTEXT(sample.pattern)
+		{
+			auto program = Parse(sample.statements, sample.shifts);
+			BytecodeProgram code = BytecodeCompiler().Compile(*program);
+			PeepholeOptimizer optimizer;
+			optimizer.Optimize(code);
+			BOOST_CHECK_EQUAL(GetListing(code), sample.listing);
+			BOOST_CHECK_EQUAL(optimizer.GetStats().patterns.count(sample.pattern), 1u);
+
+			code.Assemble();
+			CheckSame(RunTreeWalker(*program, Z), RunVirtualMachine(code, Z));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(DeadValuesAreRemoved)
+{
+	// The compiler never emits these windows, y := x with a constant and a
+	// copy of x dropped before
+	BytecodeProgram code;
+	code.variables = { "x", "y" };
+	code.code = { { OpCode::PushConst, code.AddConstant(1) }, { OpCode::Pop }, { OpCode::Load, 0 },
+		{ OpCode::Dup }, { OpCode::Pop }, { OpCode::Store, 1 } };
+	PeepholeOptimizer optimizer;
+	optimizer.Optimize(code);
+	BOOST_CHECK_EQUAL(GetListing(code), "Load x; Store y");
+	BOOST_CHECK_EQUAL(optimizer.GetStats().patterns.at("push-pop"), 1u);
+	BOOST_CHECK_EQUAL(optimizer.GetStats().patterns.at("dup-pop"), 1u);
+
+	code.Assemble();
+	CheckSame(RunTreeWalker(*Parse("y := x", false), Z), RunVirtualMachine(code, Z));
+}
+
+BOOST_AUTO_TEST_CASE(FoldsRaisingExceptionsAreLeftToRunTime)
+{
+	auto program = Parse("y := 1 / 0;\n   x := 0 DIV 0", false);
+	BytecodeProgram code = BytecodeCompiler().Compile(*program);
+	PeepholeOptimizer().Optimize(code);
+	BOOST_CHECK_EQUAL(GetListing(code), "PushConst 1; PushConst 0; Div; Store y; "
+		"PushConst 0; PushConst 0; IntDiv; Store x");
+}
+
+BOOST_AUTO_TEST_CASE(NegatedOperandsKeepTheSignOfNaN)
+{
+	// a + -b as a - b would take the NaN b with its sign instead of negated
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	auto program = Parse("y := x + -z;\n   x := x - -z", false);
+	BytecodeProgram code = BytecodeCompiler().Compile(*program);
+	PeepholeOptimizer().Optimize(code);
+	BOOST_CHECK_EQUAL(GetListing(code), "Load x; Load z; Neg; Add; Store y; "
+		"Load x; Load z; Neg; Sub; Store x");
+
+	code.Assemble();
+	for (double z : { Z, nan, -nan })
+	{
+		BOOST_TEST_CONTEXT(z)
+		{
+			CheckSame(RunTreeWalker(*program, z), RunVirtualMachine(code, z));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
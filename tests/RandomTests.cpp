@@ -0,0 +1,125 @@
+#include "TemporaryFile.h"
+#include "../src/Parser.h"
+#include "../src/Batch.h"
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+// Draws of the scalar stream, RandomStream::Generate one at a time
+double Scalar(uint64_t seed, uint64_t stream, uint64_t position, bool normal)
+{
+	RandomStream random(seed, stream);
+	random.SetPosition(position);
+	return normal ? random.Normal() : random.Uniform();
+}
+
+bool SameBits(double left, double right)
+{
+	return std::memcmp(&left, &right, sizeof(double)) == 0;
+}
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+// Output rows of the batch evaluator for 'rows' rows of x
+std::vector<std::string> RunBatch(const ProgramNode& program, uint64_t rows, uint64_t seed, unsigned threads)
+{
+	std::string csv = "x\n";
+	for (uint64_t row = 0; row < rows; ++row)
+	{
+		csv += std::to_string(row) + "\n";
+	}
+	const TemporaryFile input("random.csv", csv);
+	TemporaryFile output("random-output.csv");
+	BatchEvaluator::Options options;
+	options.threads = threads;
+	options.seed = seed;
+	BatchEvaluator evaluator(program, options);
+	std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+	BOOST_REQUIRE(out);
+	evaluator.Run(input.GetPath(), { "u", "n", "s" }, out);
+	std::fclose(out);
+
+	std::istringstream lines(output.Read());
+	std::vector<std::string> result;
+	for (std::string line; std::getline(lines, line);)
+	{
+		result.push_back(line);
+	}
+	return result;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(RandomTests)
+
+BOOST_AUTO_TEST_CASE(LanesMatchScalarStreams)
+{
+	// Counts that are no multiple of the vector width or the group of 16,
+	// stream ids and positions with their upper words set
+	const uint64_t seeds[] = { 0, 1, 0x0123456789ABCDEF };
+	const uint64_t firsts[] = { 0, 7, 0xFFFFFFFF - 20, 0x1234567800000000 };
+	const uint64_t positions[] = { 0, 3, 0x100000001 };
+	for (uint64_t seed : seeds)
+	{
+		for (uint64_t first : firsts)
+		{
+			for (uint64_t position : positions)
+			{
+				BOOST_TEST_CONTEXT("seed " << seed << ", first " << first << ", position " << position)
+				{
+					double uniform[301];
+					double normal[301];
+					RandomStream::UniformLanes(seed, first, position, uniform, 301);
+					RandomStream::NormalLanes(seed, first, position, normal, 301);
+					for (uint64_t i = 0; i < 301; ++i)
+					{
+						BOOST_REQUIRE(SameBits(uniform[i], Scalar(seed, first + i, position, false)));
+						BOOST_REQUIRE(SameBits(normal[i], Scalar(seed, first + i, position, true)));
+					}
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BatchRowsDrawTheirStreams)
+{
+	// Drawn for blocks of rows outside loops, one at a time in them
+	const char* const programs[] = {
+		"PROGRAM Draws;\nVAR\n   x, u, n, s : REAL;\nBEGIN\n"
+		"   u := RANDOM;\n   n := RANDOMNORMAL + x;\n   s := RANDOM * RANDOMNORMAL\nEND.\n",
+		"PROGRAM Draws;\nVAR\n   x, u, n, s : REAL;\n   i : INTEGER;\nBEGIN\n"
+		"   u := RANDOM;\n   s := 0;\n   FOR i := 1 TO 2 DO s := s + RANDOM;\n   n := RANDOMNORMAL + x\nEND.\n",
+	};
+	const uint64_t rows = 700;
+	for (const char* text : programs)
+	{
+		auto program = Parse(text);
+		const std::vector<std::string> lines = RunBatch(*program, rows, 42, 3);
+		BOOST_REQUIRE_EQUAL(lines.size(), rows + 1);
+		for (uint64_t row = 0; row < rows; ++row)
+		{
+			ExpressionCalculator calculator;
+			calculator.SetVariable("x", static_cast<double>(row));
+			calculator.SetRandomStream(RandomStream(42, row));
+			program->Accept(calculator);
+			const auto& scope = calculator.GetScope();
+
+			std::istringstream fields(lines[row + 1]);
+			for (const char* name : { "u", "n", "s" })
+			{
+				std::string field;
+				std::getline(fields, field, ',');
+				BOOST_REQUIRE(SameBits(std::strtod(field.c_str(), nullptr), scope.at(name)));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
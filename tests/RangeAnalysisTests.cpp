@@ -0,0 +1,151 @@
+#include "../src/Parser.h"
+#include "../src/RangeAnalysis.h"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+// Reads the exact values the scope keeps as doubles
+class ExactCalculator : public ExpressionCalculator
+{
+public:
+	std::string GetBigInt(const std::string& name)const
+	{
+		return m_bigints.at(SymbolTable::InternFolded(name))->ToString();
+	}
+};
+
+// Program declaring k and w as BIGINT, x and y as INTEGER, r as REAL, analyzed
+struct Analyzed
+{
+	explicit Analyzed(const std::string& statements)
+	{
+		Parser parser(std::make_unique<Lexer>("PROGRAM Ranges;\nVAR\n   k, w : BIGINT;\n   x, y, i : INTEGER;\n"
+			"   r : REAL;\nBEGIN\n" + statements + "\nEND.\n"));
+		program = parser.ParseAsProgram();
+		analysis.Run(*program);
+	}
+
+	// Operator assigned by the statement, or by the body of the FOR statement
+	const BinOpNode& GetOperator(size_t statement)const
+	{
+		const ASTNode* node = &program->GetBlock().GetCompound().GetChild(statement);
+		if (const auto* loop = dynamic_cast<const ForNode*>(node))
+		{
+			node = &loop->GetBody();
+		}
+		const auto* assign = dynamic_cast<const AssignNode*>(node);
+		BOOST_REQUIRE(assign);
+		const auto* binop = dynamic_cast<const BinOpNode*>(&assign->GetRight());
+		BOOST_REQUIRE(binop);
+		return *binop;
+	}
+
+	bool IsProven(size_t statement, BinOpNode::Proof proof)const
+	{
+		return GetOperator(statement).IsProven(proof);
+	}
+
+	ExactCalculator Run()const
+	{
+		ExactCalculator calculator;
+		program->Accept(calculator);
+		return calculator;
+	}
+
+	std::unique_ptr<ProgramNode> program;
+	RangeAnalysis analysis;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(RangeAnalysisTests)
+
+BOOST_AUTO_TEST_CASE(LoopCountersStayWithinTheirBounds)
+{
+	const Analyzed analyzed("   FOR i := 1 TO 100 DO k := i * i;\n"
+		"   FOR i := 1 TO 100 DO w := 1000 DIV i;\n"
+		"   FOR i := 10 DOWNTO -10 DO w := 5 DIV i;\n"
+		"   FOR i := 5 TO 1 DO w := 7 DIV i;\n"
+		"   k := i * 2");
+	BOOST_CHECK(analyzed.IsProven(0, BinOpNode::NoOverflow));
+	BOOST_CHECK(analyzed.IsProven(1, BinOpNode::NonZeroDivisor));
+	// The range passes 0, and bounds that cross leave the counter unknown
+	BOOST_CHECK(!analyzed.IsProven(2, BinOpNode::NonZeroDivisor));
+	BOOST_CHECK(!analyzed.IsProven(3, BinOpNode::NonZeroDivisor));
+	// Unknown after the loop
+	BOOST_CHECK(!analyzed.IsProven(4, BinOpNode::NoOverflow));
+
+	const RangeAnalysis::Stats& stats = analyzed.analysis.GetStats();
+	BOOST_CHECK_EQUAL(stats.overflowChecks, 2u);
+	BOOST_CHECK_EQUAL(stats.overflowChecksRemoved, 1u);
+	BOOST_CHECK_EQUAL(stats.divisionChecks, 3u);
+	BOOST_CHECK_EQUAL(stats.divisionChecksRemoved, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ReassignedVariablesTakeTheirLastValue)
+{
+	const Analyzed analyzed("   k := 5;\n"
+		"   w := k * k;\n"
+		"   k := k * 1000000000000;\n"
+		"   w := k * k;\n"
+		"   k := 5;\n"
+		"   FOR i := 1 TO 3 DO k := k + 1;\n"
+		"   w := k + 1");
+	BOOST_CHECK(analyzed.IsProven(1, BinOpNode::NoOverflow));
+	BOOST_CHECK(analyzed.IsProven(2, BinOpNode::NoOverflow));
+	// 25 * 10^24 does not fit
+	BOOST_CHECK(!analyzed.IsProven(3, BinOpNode::NoOverflow));
+	// Assigned in the body: unknown in it and after it
+	BOOST_CHECK(!analyzed.IsProven(5, BinOpNode::NoOverflow));
+	BOOST_CHECK(!analyzed.IsProven(6, BinOpNode::NoOverflow));
+
+	const ExactCalculator calculator = analyzed.Run();
+	BOOST_CHECK_EQUAL(calculator.GetBigInt("k"), "8");
+	BOOST_CHECK_EQUAL(calculator.GetBigInt("w"), "9");
+}
+
+BOOST_AUTO_TEST_CASE(DoublesAreKnownWhileExact)
+{
+	const Analyzed analyzed("   x := 3;\n"
+		"   r := 100 DIV x;\n"
+		"   x := 9007199254740994;\n"
+		"   r := 100 DIV x;\n"
+		"   y := 16777216 DIV 3;\n"
+		"   r := 1 DIV y;\n"
+		"   y := 33554432 DIV 3;\n"
+		"   r := 1 DIV y;\n"
+		"   x := 4000000 * 4000000;\n"
+		"   r := 1 DIV x");
+	BOOST_CHECK(analyzed.IsProven(1, BinOpNode::NonZeroDivisor));
+	// Beyond 2^53 doubles are not exact
+	BOOST_CHECK(!analyzed.IsProven(3, BinOpNode::NonZeroDivisor));
+	// Rounded double quotients are known up to 2^24
+	BOOST_CHECK(analyzed.IsProven(5, BinOpNode::NonZeroDivisor));
+	BOOST_CHECK(!analyzed.IsProven(7, BinOpNode::NonZeroDivisor));
+	BOOST_CHECK(analyzed.IsProven(9, BinOpNode::NonZeroDivisor));
+	// Double arithmetic has no checks to remove
+	BOOST_CHECK_EQUAL(analyzed.analysis.GetStats().overflowChecks, 0u);
+	BOOST_CHECK_EQUAL(analyzed.analysis.GetStats().divisionChecks, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ValuesAtTheInlineLimitAreNotNarrowed)
+{
+	// 2^62 - 2^31, constants from 10^18 on are unknown
+	const Analyzed analyzed("   k := 2147483648 * 2147483647;\n"
+		"   w := k + 2147483647;\n"
+		"   w := k + 2147483648;\n"
+		"   r := RANDOM;\n"
+		"   k := r * 2;\n"
+		"   w := 3 / 2 + 1");
+	BOOST_CHECK(analyzed.IsProven(0, BinOpNode::NoOverflow));
+	BOOST_CHECK(analyzed.IsProven(1, BinOpNode::NoOverflow));
+	// 2^62 is stored on the heap
+	BOOST_CHECK(!analyzed.IsProven(2, BinOpNode::NoOverflow));
+	// Neither RANDOM nor '/' are integral
+	BOOST_CHECK(!analyzed.IsProven(4, BinOpNode::NoOverflow));
+	BOOST_CHECK(!analyzed.IsProven(5, BinOpNode::NoOverflow));
+
+	const Analyzed sum("   k := 2147483648 * 2147483647;\n   w := k + 2147483648");
+	BOOST_CHECK_EQUAL(sum.Run().GetBigInt("w"), "4611686018427387904");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
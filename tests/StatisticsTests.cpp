@@ -0,0 +1,212 @@
+#include "../src/Parser.h"
+#include "../src/MonteCarlo.h"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace
+{
+const double QUANTILES[] = { 0, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1 };
+
+// Magnitudes over 12 orders, a third of them negative, and zeros
+std::vector<double> MakeValues(size_t count, uint32_t seed)
+{
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> exponent(-6, 6);
+	std::vector<double> values;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const double magnitude = std::pow(10.0, exponent(generator));
+		values.push_back(i % 50 == 0 ? 0 : i % 3 == 0 ? -magnitude : magnitude);
+	}
+	return values;
+}
+
+// The value of rank q * (count - 1) as QuantileSketch counts it
+double GetExactQuantile(std::vector<double> values, double q)
+{
+	std::sort(values.begin(), values.end());
+	return values[static_cast<size_t>(q * static_cast<double>(values.size() - 1))];
+}
+
+void CheckWithinAccuracy(const QuantileSketch& sketch, const std::vector<double>& values)
+{
+	for (double q : QUANTILES)
+	{
+		BOOST_TEST_CONTEXT("q " << q)
+		{
+			const double exact = GetExactQuantile(values, q);
+			BOOST_CHECK_LE(std::abs(sketch.GetQuantile(q) - exact), QuantileSketch::ACCURACY * std::abs(exact) * (1 + 1e-9));
+		}
+	}
+}
+
+QuantileSketch MakeSketch(const std::vector<double>& values)
+{
+	QuantileSketch sketch;
+	for (double value : values)
+	{
+		sketch.Add(value);
+	}
+	return sketch;
+}
+
+// Same bits, NaN included
+bool Same(double left, double right)
+{
+	return std::memcmp(&left, &right, sizeof(double)) == 0;
+}
+
+std::vector<RunningStatistics> RunPaths(const char* text, unsigned threads, uint64_t paths,
+	const std::vector<std::string>& outputs, bool bytecode)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	auto program = parser.ParseAsProgram();
+	MonteCarlo::Options options;
+	options.seed = 42;
+	options.threads = threads;
+	MonteCarlo runner(*program, options);
+	runner.SetVariable("x", 1.5);
+	auto statistics = runner.Run(paths, outputs);
+	BOOST_CHECK_EQUAL(runner.GetStats().bytecode, bytecode);
+	// No more threads than chunks
+	BOOST_CHECK_LE(runner.GetStats().threads, threads);
+	return statistics;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(StatisticsTests)
+
+BOOST_AUTO_TEST_CASE(QuantilesAreWithinTheRelativeAccuracy)
+{
+	const std::vector<double> values = MakeValues(20000, 1);
+	CheckWithinAccuracy(MakeSketch(values), values);
+
+	// Constant values and a single one
+	CheckWithinAccuracy(MakeSketch({ 7, 7, 7 }), { 7, 7, 7 });
+	CheckWithinAccuracy(MakeSketch({ -1e-300 }), { -1e-300 });
+
+	QuantileSketch sketch;
+	BOOST_CHECK(std::isnan(sketch.GetQuantile(0.5)));
+	sketch.Add(std::numeric_limits<double>::infinity());
+	sketch.Add(std::numeric_limits<double>::quiet_NaN());
+	BOOST_CHECK_EQUAL(sketch.GetCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(CollapsedBucketsKeepTheLargestMagnitudes)
+{
+	// Magnitudes over 600 orders need about 69000 buckets, MAX_BUCKETS cover
+	// the largest 35 orders and the smaller ones are collapsed into the lowest
+	std::vector<double> values;
+	for (int exponent = -300; exponent <= 300; ++exponent)
+	{
+		values.push_back(std::pow(10.0, exponent));
+	}
+	const QuantileSketch sketch = MakeSketch(values);
+	for (double q : { 0.95, 0.99, 1.0 })
+	{
+		BOOST_TEST_CONTEXT("q " << q)
+		{
+			const double exact = GetExactQuantile(values, q);
+			BOOST_CHECK_LE(std::abs(sketch.GetQuantile(q) - exact), QuantileSketch::ACCURACY * exact * (1 + 1e-9));
+		}
+	}
+	BOOST_CHECK_GT(sketch.GetQuantile(0), 1e260);
+}
+
+BOOST_AUTO_TEST_CASE(MergedSketchesEqualOneSketchOfAllValues)
+{
+	const std::vector<double> values = MakeValues(9000, 2);
+	const QuantileSketch whole = MakeSketch(values);
+	std::vector<QuantileSketch> parts(3);
+	std::vector<RunningStatistics> statistics(3);
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		parts[i * parts.size() / values.size()].Add(values[i]);
+		statistics[i % statistics.size()].Add(values[i]);
+	}
+
+	QuantileSketch forward = parts[0];
+	forward.Merge(parts[1]);
+	forward.Merge(parts[2]);
+	QuantileSketch backward = parts[2];
+	backward.Merge(parts[1]);
+	backward.Merge(parts[0]);
+	BOOST_CHECK_EQUAL(forward.GetCount(), values.size());
+	for (double q : QUANTILES)
+	{
+		BOOST_TEST_CONTEXT("q " << q)
+		{
+			BOOST_CHECK(Same(forward.GetQuantile(q), whole.GetQuantile(q)));
+			BOOST_CHECK(Same(backward.GetQuantile(q), whole.GetQuantile(q)));
+		}
+	}
+
+	RunningStatistics merged;
+	for (const RunningStatistics& part : statistics)
+	{
+		merged.Merge(part);
+	}
+	double sum = 0;
+	for (double value : values)
+	{
+		sum += value;
+	}
+	const double mean = sum / static_cast<double>(values.size());
+	double squares = 0;
+	for (double value : values)
+	{
+		squares += (value - mean) * (value - mean);
+	}
+	BOOST_CHECK_EQUAL(merged.GetCount(), values.size());
+	BOOST_CHECK_CLOSE_FRACTION(merged.GetMean(), mean, 1e-12);
+	BOOST_CHECK_CLOSE_FRACTION(merged.GetVariance(), squares / static_cast<double>(values.size() - 1), 1e-12);
+	BOOST_CHECK_EQUAL(merged.GetMin(), *std::min_element(values.begin(), values.end()));
+	BOOST_CHECK_EQUAL(merged.GetMax(), *std::max_element(values.begin(), values.end()));
+}
+
+BOOST_AUTO_TEST_CASE(MonteCarloResultsDoNotDependOnThreads)
+{
+	// Bytecode, and the tree walker for DECIMAL; paths end within a chunk
+	const struct
+	{
+		const char* text;
+		uint64_t paths;
+		bool bytecode;
+	} SIMULATIONS[] = {
+		{ "PROGRAM Walk;\nVAR\n   x, s : REAL;\n   i : INTEGER;\nBEGIN\n"
+			"   s := 0;\n   FOR i := 1 TO 10 DO s := s + RANDOMNORMAL * x\nEND.\n", 3 * 4096 + 123, true },
+		{ "PROGRAM Priced;\nVAR\n   x, r, s : REAL;\n   d : DECIMAL(10, 2);\nBEGIN\n"
+			"   r := RANDOM * 100;\n   d := r;\n   s := d * x\nEND.\n", 4096 + 7, false },
+	};
+	for (const auto& simulation : SIMULATIONS)
+	{
+		BOOST_TEST_CONTEXT(simulation.text)
+		{
+			const auto expected = RunPaths(simulation.text, 1, simulation.paths, { "s" }, simulation.bytecode);
+			BOOST_REQUIRE_EQUAL(expected.size(), 1u);
+			BOOST_CHECK_EQUAL(expected[0].GetCount(), simulation.paths);
+			for (unsigned threads : { 2, 3, 5 })
+			{
+				BOOST_TEST_CONTEXT(threads << " threads")
+				{
+					const auto actual = RunPaths(simulation.text, threads, simulation.paths, { "s" }, simulation.bytecode);
+					BOOST_REQUIRE_EQUAL(actual.size(), 1u);
+					BOOST_CHECK_EQUAL(actual[0].GetCount(), expected[0].GetCount());
+					BOOST_CHECK(Same(actual[0].GetMean(), expected[0].GetMean()));
+					BOOST_CHECK(Same(actual[0].GetVariance(), expected[0].GetVariance()));
+					BOOST_CHECK(Same(actual[0].GetMin(), expected[0].GetMin()));
+					BOOST_CHECK(Same(actual[0].GetMax(), expected[0].GetMax()));
+					for (double q : QUANTILES)
+					{
+						BOOST_CHECK(Same(actual[0].GetQuantile(q), expected[0].GetQuantile(q)));
+					}
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,254 @@
+#include "TemporaryFile.h"
+#include "../src/Parser.h"
+#include "../src/Streaming.h"
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Counts the allocations of the test module, to check the steady state of
+// the evaluator allocates nothing
+namespace
+{
+std::atomic<uint64_t> g_allocations{ 0 };
+
+void* Allocate(size_t size)
+{
+	++g_allocations;
+	if (void* block = std::malloc(size ? size : 1))
+	{
+		return block;
+	}
+	throw std::bad_alloc();
+}
+}
+
+void* operator new(size_t size)
+{
+	return Allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+	return Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+namespace
+{
+// Outputs whose shortest forms need all 17 digits, a RANDOM draw and a loop
+const char* const PROGRAM = "PROGRAM Records;\nVAR\n   a, b, sum, product, drawn : REAL;\n   i : INTEGER;\nBEGIN\n"
+	"   sum := a + b;\n   product := 0;\n"
+	"   FOR i := 1 TO 3 DO product := product + a * b;\n"
+	"   drawn := RANDOM\nEND.\n";
+
+const std::vector<std::string> INPUTS = { "a", "b" };
+const std::vector<std::string> OUTPUTS = { "sum", "product", "drawn" };
+
+std::unique_ptr<ProgramNode> Parse(const std::string& text)
+{
+	Parser parser(std::make_unique<Lexer>(text));
+	return parser.ParseAsProgram();
+}
+
+StreamingEvaluator::Options MakeOptions(StreamingEvaluator::Format format)
+{
+	StreamingEvaluator::Options options;
+	options.format = format;
+	options.seed = 3;
+	return options;
+}
+
+// Output of the records in 'data', which have to be complete
+std::string Consume(const std::string& data, StreamingEvaluator::Format format)
+{
+	auto program = Parse(PROGRAM);
+	StreamingEvaluator evaluator(*program, INPUTS, OUTPUTS, MakeOptions(format));
+	const TemporaryFile output("streamed.out");
+	std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+	BOOST_REQUIRE(out);
+	{
+		RecordWriter writer(out);
+		BOOST_CHECK_EQUAL(evaluator.Consume(data.data(), data.size(), writer), data.size());
+	}
+	std::fclose(out);
+	return output.Read();
+}
+
+// Outputs of the records by Evaluate, record n being the nth call
+std::vector<double> Evaluate(const std::vector<double>& inputs)
+{
+	auto program = Parse(PROGRAM);
+	StreamingEvaluator evaluator(*program, INPUTS, OUTPUTS, MakeOptions(StreamingEvaluator::Text));
+	std::vector<double> outputs(inputs.size() / INPUTS.size() * OUTPUTS.size());
+	for (size_t record = 0; record * INPUTS.size() < inputs.size(); ++record)
+	{
+		evaluator.Evaluate(&inputs[record * INPUTS.size()], &outputs[record * OUTPUTS.size()]);
+	}
+	return outputs;
+}
+
+// Message of the exception, empty if none
+std::string GetConsumeError(const std::string& data, StreamingEvaluator::Format format)
+{
+	try
+	{
+		Consume(data, format);
+	}
+	catch (const std::exception& ex)
+	{
+		return ex.what();
+	}
+	return std::string();
+}
+
+// Output of Run reading the file, or its error
+std::string RunFile(const std::string& data, StreamingEvaluator::Format format)
+{
+	auto program = Parse(PROGRAM);
+	StreamingEvaluator evaluator(*program, INPUTS, OUTPUTS, MakeOptions(format));
+	const TemporaryFile input("streamed.in", data);
+	const TemporaryFile output("streamed.out");
+	std::FILE* in = std::fopen(input.GetPath().c_str(), "rb");
+	std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+	BOOST_REQUIRE(in && out);
+	std::string error;
+	try
+	{
+		RecordWriter writer(out);
+#ifdef _WIN32
+		evaluator.Run(_fileno(in), writer);
+#else
+		evaluator.Run(fileno(in), writer);
+#endif
+	}
+	catch (const std::exception& ex)
+	{
+		error = ex.what();
+	}
+	std::fclose(in);
+	std::fclose(out);
+	return error.empty() ? output.Read() : error;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(StreamingTests)
+
+BOOST_AUTO_TEST_CASE(TextRecordsRoundTrip)
+{
+	const std::vector<double> inputs = { 0.1, 0.2, -3, 1e-7, 1.5, 2.5 };
+	const std::vector<double> expected = Evaluate(inputs);
+	// Blanks around fields, CRLF, and every value printed in its shortest form
+	const std::string written = Consume(" 0.1,0.2\n-3 ,\t1e-7\r\n1.5,2.5\n", StreamingEvaluator::Text);
+	const char* p = written.data();
+	const char* const end = p + written.size();
+	for (size_t i = 0; i < expected.size(); ++i)
+	{
+		BOOST_TEST_CONTEXT("field " << i)
+		{
+			double value = 0;
+			const std::from_chars_result parsed = std::from_chars(p, end, value);
+			BOOST_REQUIRE(parsed.ec == std::errc());
+			BOOST_CHECK_EQUAL(value, expected[i]);
+			BOOST_REQUIRE(parsed.ptr != end);
+			BOOST_CHECK_EQUAL(*parsed.ptr, (i + 1) % OUTPUTS.size() ? ',' : '\n');
+			p = parsed.ptr + 1;
+		}
+	}
+	BOOST_CHECK(p == end);
+	BOOST_CHECK_EQUAL(written.substr(0, written.find(',')), "0.30000000000000004");
+
+	// The last line may have no end
+	BOOST_CHECK_EQUAL(RunFile(" 0.1,0.2\n-3 ,\t1e-7\r\n1.5,2.5", StreamingEvaluator::Text), written);
+}
+
+BOOST_AUTO_TEST_CASE(BinaryRecordsRoundTrip)
+{
+	const std::vector<double> inputs = { 0.1, 0.2, -3, 1e-7, 1.5, 2.5 };
+	const std::vector<double> expected = Evaluate(inputs);
+	const std::string data(reinterpret_cast<const char*>(inputs.data()), inputs.size() * sizeof(double));
+	const std::string written = Consume(data, StreamingEvaluator::Binary);
+	BOOST_REQUIRE_EQUAL(written.size(), expected.size() * sizeof(double));
+	BOOST_CHECK(std::memcmp(written.data(), expected.data(), written.size()) == 0);
+	BOOST_CHECK_EQUAL(RunFile(data, StreamingEvaluator::Binary), written);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedRecordsAreRejected)
+{
+	BOOST_CHECK_EQUAL(GetConsumeError("1,2\n1,x\n", StreamingEvaluator::Text), "record 2: field 2 is not a number");
+	BOOST_CHECK_EQUAL(GetConsumeError("1\n", StreamingEvaluator::Text), "record 1: expected 2 fields");
+	BOOST_CHECK_EQUAL(GetConsumeError("1,2,3\n", StreamingEvaluator::Text), "record 1: expected 2 fields");
+	BOOST_CHECK_EQUAL(GetConsumeError("1;2\n", StreamingEvaluator::Text), "record 1: expected 2 fields");
+	BOOST_CHECK_EQUAL(GetConsumeError("\n", StreamingEvaluator::Text), "record 1: expected 2 fields");
+
+	const double inputs[] = { 1, 2, 3 };
+	const std::string data(reinterpret_cast<const char*>(inputs), sizeof(inputs));
+	BOOST_CHECK_EQUAL(RunFile(data, StreamingEvaluator::Binary), "the input ends in the middle of record 2");
+	BOOST_CHECK_EQUAL(RunFile(std::string(70000, '1'), StreamingEvaluator::Text), "record 1 is longer than the input buffer");
+}
+
+BOOST_AUTO_TEST_CASE(SteadyStateAllocatesNothing)
+{
+	for (auto format : { StreamingEvaluator::Text, StreamingEvaluator::Binary })
+	{
+		BOOST_TEST_CONTEXT(format)
+		{
+			std::string data;
+			for (int record = 0; record < 1000; ++record)
+			{
+				if (format == StreamingEvaluator::Text)
+				{
+					data += std::to_string(record) + ".25," + std::to_string(-record) + "\n";
+				}
+				else
+				{
+					const double values[] = { record + 0.25, -record * 1.0 };
+					data.append(reinterpret_cast<const char*>(values), sizeof(values));
+				}
+			}
+			auto program = Parse(PROGRAM);
+			StreamingEvaluator evaluator(*program, INPUTS, OUTPUTS, MakeOptions(format));
+			const TemporaryFile output("streamed.out");
+			std::FILE* out = std::fopen(output.GetPath().c_str(), "wb");
+			BOOST_REQUIRE(out);
+			{
+				// Flushing every few records
+				RecordWriter writer(out, 256);
+				evaluator.Consume(data.data(), data.size(), writer);
+				const uint64_t allocations = g_allocations;
+				for (int run = 0; run < 5; ++run)
+				{
+					evaluator.Consume(data.data(), data.size(), writer);
+				}
+				BOOST_CHECK_EQUAL(g_allocations - allocations, 0u);
+				BOOST_CHECK_GT(writer.GetFlushCount(), 100u);
+			}
+			std::fclose(out);
+			BOOST_CHECK_EQUAL(evaluator.GetStats().records, 6000u);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
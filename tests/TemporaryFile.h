@@ -0,0 +1,44 @@
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// File in the temporary directory, removed with the object
+class TemporaryFile
+{
+public:
+	explicit TemporaryFile(const std::string& name)
+		: m_path(std::filesystem::temp_directory_path() / ("lsbasi-" + name))
+	{
+	}
+
+	// Created with 'content'
+	TemporaryFile(const std::string& name, const std::string& content)
+		: TemporaryFile(name)
+	{
+		std::ofstream(m_path, std::ios::binary) << content;
+	}
+
+	~TemporaryFile()
+	{
+		std::error_code error;
+		std::filesystem::remove(m_path, error);
+	}
+
+	TemporaryFile(const TemporaryFile&) = delete;
+	TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+	std::string GetPath()const
+	{
+		return m_path.string();
+	}
+
+	std::string Read()const
+	{
+		std::ifstream in(m_path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+
+private:
+	std::filesystem::path m_path;
+};
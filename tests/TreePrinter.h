@@ -0,0 +1,111 @@
+#pragma once
+#include "../src/AST.h"
+#include <cstdio>
+
+// Prints a tree with every node and value, so equal texts mean equal trees
+class TreePrinter : public IASTNodeVisitor
+{
+public:
+	std::string Print(const ASTNode& node)
+	{
+		node.Accept(*this);
+		return m_acc;
+	}
+
+	void Visit(const BinOpNode& binop) override
+	{
+		m_acc = "(" + std::to_string(binop.GetOperator()) + " " + Print(binop.GetLeft()) + " " + Print(binop.GetRight()) + ")";
+	}
+
+	void Visit(const LeafNumNode& num) override
+	{
+		char text[32];
+		std::snprintf(text, sizeof(text), "%a", num.GetValue());
+		m_acc = text;
+	}
+
+	void Visit(const UnOpNode& unop) override
+	{
+		m_acc = "(u" + std::to_string(unop.GetOperator()) + " " + Print(unop.GetExpression()) + ")";
+	}
+
+	void Visit(const LeafVarNode& var) override
+	{
+		m_acc = var.GetName();
+	}
+
+	void Visit(const LeafInvariantNode& invariant) override
+	{
+		m_acc = "(invariant " + std::to_string(invariant.GetSlot()) + ")";
+	}
+
+	void Visit(const InductionNode& induction) override
+	{
+		m_acc = "(induction " + std::to_string(induction.GetSlot()) + " " + Print(induction.GetProduct()) + ")";
+	}
+
+	void Visit(const RandomNode& random) override
+	{
+		m_acc = "(random " + std::to_string(random.GetDistribution()) + ")";
+	}
+
+	void Visit(const LeafNopNode&) override
+	{
+		m_acc = "nop";
+	}
+
+	void Visit(const AssignNode& assign) override
+	{
+		m_acc = "(:= " + assign.GetLeft() + " " + Print(assign.GetRight()) + ")";
+	}
+
+	void Visit(const CompoundNode& compound) override
+	{
+		std::string text = "(begin";
+		for (const auto& child : compound.GetChildren())
+		{
+			text += " " + Print(*child);
+		}
+		m_acc = text + ")";
+	}
+
+	void Visit(const ForNode& loop) override
+	{
+		m_acc = "(for " + loop.GetVariable() + " " + std::to_string(loop.GetDirection()) + " " + Print(loop.GetStart())
+			+ " " + Print(loop.GetEnd()) + " " + Print(loop.GetBody()) + ")";
+	}
+
+	void Visit(const TypeNode& type) override
+	{
+		m_acc = "(type " + std::to_string(type.GetType()) + " " + std::to_string(type.GetPrecision()) + " "
+			+ std::to_string(type.GetScale()) + ")";
+	}
+
+	void Visit(const VarDeclNode& vardecl) override
+	{
+		std::string text = "(var";
+		for (const auto& var : vardecl.GetVariables())
+		{
+			text += " " + Print(*var);
+		}
+		m_acc = text + " " + Print(vardecl.GetTypeNode()) + ")";
+	}
+
+	void Visit(const BlockNode& block) override
+	{
+		std::string text = "(block";
+		for (const auto& declaration : block.GetDeclarations())
+		{
+			text += " " + Print(*declaration);
+		}
+		m_acc = text + " " + Print(block.GetCompound()) + ")";
+	}
+
+	void Visit(const ProgramNode& program) override
+	{
+		m_acc = "(program " + program.GetName() + " " + Print(program.GetBlock()) + ")";
+	}
+
+private:
+	std::string m_acc;
+};